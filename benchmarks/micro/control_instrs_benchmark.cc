@@ -22,11 +22,14 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 *******************************************************************************/
 #include <benchmark/benchmark.h>
 
+#include "runtime/catch_site.h"
 #include "runtime/closure.h"
 #include "runtime/common.h"
 #include "runtime/compartment.h"
 #include "runtime/instr.h"
+#include "runtime/loc_info.h"
 #include "runtime/process.h"
+#include "runtime/vector.h"
 #include "types/native_type_value.h"
 
 #include "instr_benchmarks_fixture.h"
@@ -88,51 +91,84 @@ void BenchmarkInstrINVK(benchmark::State& state)
 
 // -----------------------------------------------------------------------------
 
-// TODO: explore other options to enable this benchmark.
-// This benchmark is currently disabled due to high cost associated with
-// set up works.
-/*
+/**
+ * Raises an exception in nested invocations of a closure, and catches it in
+ * the bottom frame, which has many try blocks (see
+ * `python/tests/try_except.py`). Measures the unwinding of frames and the
+ * lookup of catch sites in each of them.
+ */
 static
-void BenchmarkInstrRTRN(benchmark::State& state)
+void BenchmarkInstrEXC(benchmark::State& state, size_t depth)
 {
-  InstrBenchmarksFixture fixture;
+  const size_t catch_site_count = 32;
 
-  corevm::runtime::Instr instr { .code=0, .oprd1=0, .oprd2=0 };
+  corevm::runtime::Vector vector(catch_site_count * 2 + 2,
+    corevm::runtime::Instr(0, 0, 0));
 
-  corevm::runtime::closure* closure =
-    fixture.process().top_frame().closure();
+  InstrBenchmarksFixture fixture(vector);
 
-  ASSERT(closure);
+  auto frame = &fixture.process().top_frame();
+  auto invk_ctx = &fixture.process().top_invocation_ctx();
 
-  closure->vector.clear();
+  const corevm::runtime::ClosureCtx ctx = invk_ctx->closure_ctx();
+  auto compartment = invk_ctx->compartment();
+  auto closure = invk_ctx->closure();
 
-  corevm::runtime::Compartment* compartment =
-    fixture.process().top_frame().compartment();
+  // One try block every other instruction, none covering the first one,
+  // where invoked frames raise.
+  for (size_t i = 0; i < catch_site_count; ++i)
+  {
+    const int64_t from = static_cast<int64_t>(i * 2 + 1);
+    closure->catch_sites.push_back(
+      corevm::runtime::CatchSite(from, from, from + 1));
+  }
 
-  ASSERT(compartment);
+  // Raise from within the last try block.
+  const corevm::runtime::instr_addr_t pc =
+    static_cast<corevm::runtime::instr_addr_t>(catch_site_count * 2 - 1);
 
-  fixture.process().top_frame().set_return_addr(0);
+  auto exc_obj = fixture.process().create_dyobj();
 
-  corevm::runtime::ClosureCtx ctx {
-    .compartment_id = 0,
-    .closure_id = 0
-  };
+  corevm::runtime::Instr instr(0, 0, 0);
+  corevm::runtime::Instr exc_instr(0, 1, 0);
 
-  for (size_t i = 0; i < 260000; ++i)
+  while (state.KeepRunning())
   {
-    fixture.process().emplace_frame(
-      ctx, compartment, closure, 0);
+    fixture.process().set_pc(pc);
 
-    fixture.process().emplace_invocation_ctx(
-      ctx, compartment, closure);
-  }
+    for (size_t i = 0; i < depth; ++i)
+    {
+      fixture.process().emplace_invocation_ctx(ctx, compartment, closure);
+      fixture.process().top_invocation_ctx(&invk_ctx);
 
-  while (state.KeepRunning())
-  {
-    corevm::runtime::instr_handler_rtrn(instr, fixture.process());
+      corevm::runtime::instr_handler_invk(
+        instr, fixture.process(), &frame, &invk_ctx);
+
+      frame->set_pc_safe(0);
+    }
+
+    fixture.process().push_stack(exc_obj);
+
+    corevm::runtime::instr_handler_exc(
+      exc_instr, fixture.process(), &frame, &invk_ctx);
   }
 }
-*/
+
+// -----------------------------------------------------------------------------
+
+static
+void BenchmarkInstrEXC(benchmark::State& state)
+{
+  BenchmarkInstrEXC(state, 1);
+}
+
+// -----------------------------------------------------------------------------
+
+static
+void BenchmarkInstrEXCUnwind(benchmark::State& state)
+{
+  BenchmarkInstrEXC(state, 16);
+}
 
 // -----------------------------------------------------------------------------
 
@@ -293,6 +329,51 @@ void BenchmarkInstrJMPEXC(benchmark::State& state)
 
 // -----------------------------------------------------------------------------
 
+/**
+ * Runs a `DEC`/`JMPIF` loop through `Process::run()`, which measures the
+ * dispatch overhead of the interpreter loop on a branchy instruction stream.
+ */
+static
+void BenchmarkProcessRunJMPIFLoop(benchmark::State& state)
+{
+  const int64_t loop_count = 1000;
+
+  corevm::runtime::Vector vector {
+    corevm::runtime::Instr(corevm::runtime::UINT32, loop_count, 0),
+    corevm::runtime::Instr(corevm::runtime::DEC, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::JMPIF, -2, 0),
+  };
+
+  corevm::runtime::LocTable locs;
+  corevm::runtime::CatchSiteList catch_sites;
+
+  corevm::runtime::Closure closure(
+    "__main__",
+    0,
+    corevm::runtime::NONESET_CLOSURE_ID,
+    vector,
+    locs,
+    catch_sites);
+
+  corevm::runtime::Compartment compartment("./example.core");
+  corevm::runtime::ClosureTable closure_table { closure };
+  compartment.set_closure_table(std::move(closure_table));
+  compartment.decode_closures();
+
+  corevm::runtime::Process process;
+
+  while (state.KeepRunning())
+  {
+    process.reset();
+    process.insert_compartment(compartment);
+    process.run();
+  }
+
+  state.SetItemsProcessed(state.iterations() * (loop_count * 2 + 1));
+}
+
+// -----------------------------------------------------------------------------
+
 #ifdef __linux__
 BENCHMARK(BenchmarkInstrPINVK);
 BENCHMARK(BenchmarkInstrINVK);
@@ -304,9 +385,11 @@ BENCHMARK(BenchmarkInstrCLREXC);
 BENCHMARK(BenchmarkInstrJMP);
 BENCHMARK(BenchmarkInstrJMPIF);
 BENCHMARK(BenchmarkInstrJMPEXC);
+BENCHMARK(BenchmarkInstrEXC);
+BENCHMARK(BenchmarkInstrEXCUnwind);
+BENCHMARK(BenchmarkProcessRunJMPIFLoop);
 
 // Skipping these benchmarks.
 //BENCHMARK(BenchmarkInstrRTRN);
-//BENCHMARK(BenchmarkInstrEXC);
 
 // -----------------------------------------------------------------------------
@@ -23,6 +23,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include <benchmark/benchmark.h>
 
 #include "runtime/frame.h"
+#include "runtime/frame_arena.h"
 #include "types/native_type_value.h"
 
 
@@ -144,10 +145,110 @@ void BenchmarkSwapEvalStack(benchmark::State& state)
 
 // -----------------------------------------------------------------------------
 
+static
+void BenchmarkConstructFrame(benchmark::State& state)
+{
+  corevm::runtime::ClosureCtx ctx(corevm::runtime::NONESET_COMPARTMENT_ID,
+    corevm::runtime::NONESET_CLOSURE_ID);
+
+  while (state.KeepRunning())
+  {
+    corevm::runtime::Frame frame(ctx, NULL, NULL);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+static
+void BenchmarkPushAndPopFrameArena(benchmark::State& state)
+{
+  corevm::runtime::ClosureCtx ctx(corevm::runtime::NONESET_COMPARTMENT_ID,
+    corevm::runtime::NONESET_CLOSURE_ID);
+
+  corevm::runtime::FrameArena arena;
+
+  corevm::types::NativeTypeValue type_val = corevm::types::uint32(1);
+
+  while (state.KeepRunning())
+  {
+    arena.emplace_back(ctx, NULL, NULL, corevm::runtime::NONESET_INSTR_ADDR);
+    arena.back().push_eval_stack(type_val);
+    arena.pop_back();
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+static
+void BenchmarkNestedFramesEvalStack(benchmark::State& state)
+{
+  corevm::runtime::ClosureCtx ctx(corevm::runtime::NONESET_COMPARTMENT_ID,
+    corevm::runtime::NONESET_CLOSURE_ID);
+
+  corevm::runtime::FrameArena arena;
+
+  corevm::types::NativeTypeValue type_val = corevm::types::uint32(1);
+
+  while (state.KeepRunning())
+  {
+    for (size_t i = 0; i < 16; ++i)
+    {
+      arena.emplace_back(ctx, NULL, NULL, corevm::runtime::NONESET_INSTR_ADDR);
+
+      for (size_t j = 0; j < 4; ++j)
+      {
+        arena.back().push_eval_stack(type_val);
+      }
+    }
+
+    while (!arena.empty())
+    {
+      arena.back().pop_eval_stack();
+      arena.pop_back();
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+static
+void BenchmarkIterateObjs(benchmark::State& state)
+{
+  corevm::runtime::ClosureCtx ctx(corevm::runtime::NONESET_COMPARTMENT_ID,
+    corevm::runtime::NONESET_CLOSURE_ID);
+
+  corevm::runtime::Frame frame(ctx, NULL, NULL);
+
+  corevm::runtime::RuntimeTypes::dynamic_object_type obj;
+
+  for (corevm::runtime::variable_key_t key = 0; key < 8; ++key)
+  {
+    frame.set_visible_var(key, &obj);
+    frame.set_invisible_var(key, &obj);
+  }
+
+  volatile size_t count = 0;
+
+  while (state.KeepRunning())
+  {
+    frame.iterate_objs(
+      [&count](corevm::runtime::Frame::dyobj_ptr) {
+        count = count + 1;
+      }
+    );
+  }
+}
+
+// -----------------------------------------------------------------------------
+
 BENCHMARK(BenchmarkPushEvalStack);
 BENCHMARK(BenchmarkPushEvalStack2);
 BENCHMARK(BenchmarkPopEvalStack);
 BENCHMARK(BenchmarkGetVisibleVariable);
 BENCHMARK(BenchmarkSwapEvalStack);
+BENCHMARK(BenchmarkConstructFrame);
+BENCHMARK(BenchmarkPushAndPopFrameArena);
+BENCHMARK(BenchmarkNestedFramesEvalStack);
+BENCHMARK(BenchmarkIterateObjs);
 
 // -----------------------------------------------------------------------------
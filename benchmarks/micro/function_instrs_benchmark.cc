@@ -293,6 +293,64 @@ void BenchmarkInstrHASARGS(benchmark::State& state)
 
 // -----------------------------------------------------------------------------
 
+/**
+ * Invokes the closure of the fixture `depth` levels deep, and returns back.
+ * Invocation contexts are pushed directly, in place of PINVK.
+ */
+static
+void BenchmarkInstrINVKAndRTRN(benchmark::State& state, size_t depth)
+{
+  InstrBenchmarksFixture fixture;
+
+  corevm::runtime::Instr instr(0, 0, 0);
+
+  auto frame = &fixture.process().top_frame();
+  auto invk_ctx = &fixture.process().top_invocation_ctx();
+
+  const corevm::runtime::ClosureCtx ctx = invk_ctx->closure_ctx();
+  auto compartment = invk_ctx->compartment();
+  auto closure = invk_ctx->closure();
+
+  while (state.KeepRunning())
+  {
+    for (size_t i = 0; i < depth; ++i)
+    {
+      fixture.process().emplace_invocation_ctx(ctx, compartment, closure);
+      fixture.process().top_invocation_ctx(&invk_ctx);
+
+      corevm::runtime::instr_handler_invk(
+        instr, fixture.process(), &frame, &invk_ctx);
+
+      // Enter the callee, like the interpreter loop does.
+      frame->set_pc_safe(0);
+    }
+
+    for (size_t i = 0; i < depth; ++i)
+    {
+      corevm::runtime::instr_handler_rtrn(
+        instr, fixture.process(), &frame, &invk_ctx);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+static
+void BenchmarkInstrINVKAndRTRN(benchmark::State& state)
+{
+  BenchmarkInstrINVKAndRTRN(state, 1);
+}
+
+// -----------------------------------------------------------------------------
+
+static
+void BenchmarkInstrINVKAndRTRNRecursive(benchmark::State& state)
+{
+  BenchmarkInstrINVKAndRTRN(state, 64);
+}
+
+// -----------------------------------------------------------------------------
+
 // TODO: [COREVM-460] Re-enable functional instruction micro benchmarks
 //BENCHMARK(BenchmarkInstrPUTARG);
 //BENCHMARK(BenchmarkInstrPUTKWARG);
@@ -304,5 +362,7 @@ BENCHMARK(BenchmarkInstrGETKWARG);
 BENCHMARK(BenchmarkInstrGETARGS);
 BENCHMARK(BenchmarkInstrGETKWARGS);
 BENCHMARK(BenchmarkInstrHASARGS);
+BENCHMARK(BenchmarkInstrINVKAndRTRN);
+BENCHMARK(BenchmarkInstrINVKAndRTRNRecursive);
 
 // -----------------------------------------------------------------------------
@@ -71,11 +71,18 @@ InstrBenchmarksFixture::InstrBenchmarksFixture(
 
 // -----------------------------------------------------------------------------
 
+InstrBenchmarksFixture::InstrBenchmarksFixture(const runtime::Vector& vector)
+  :
+  m_process(BENCHMARK_PROCESS_HEAP_SIZE, BENCHMARK_PROCESS_POOL_SIZE)
+{
+  init(vector);
+}
+
+// -----------------------------------------------------------------------------
+
 void
 InstrBenchmarksFixture::init()
 {
-  corevm::runtime::Compartment compartment(DUMMY_PATH);
-
   // Please note that setting this vector too long can cause runtime errors
   // in certain benchmarks.
   corevm::runtime::Vector vector {
@@ -85,6 +92,16 @@ InstrBenchmarksFixture::init()
     corevm::runtime::Instr(0, 0, 0),
   };
 
+  init(vector);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+InstrBenchmarksFixture::init(const runtime::Vector& vector)
+{
+  corevm::runtime::Compartment compartment(DUMMY_PATH);
+
   corevm::runtime::LocTable locs;
   corevm::runtime::CatchSiteList catch_sites;
 
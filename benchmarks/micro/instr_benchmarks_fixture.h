@@ -26,6 +26,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "runtime/frame.h"
 #include "runtime/invocation_ctx.h"
 #include "runtime/process.h"
+#include "runtime/vector.h"
 
 
 namespace corevm {
@@ -41,11 +42,19 @@ public:
 
   explicit InstrBenchmarksFixture(const runtime::Process::Options& opts);
 
+  /**
+   * Sets up the process with a closure of the given instructions, for
+   * benchmarks that need decoded instructions of the closure.
+   */
+  explicit InstrBenchmarksFixture(const runtime::Vector& vector);
+
   corevm::runtime::Process& process();
 
 protected:
   void init();
 
+  void init(const runtime::Vector& vector);
+
   corevm::runtime::Process m_process;
 };
 
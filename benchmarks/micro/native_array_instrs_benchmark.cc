@@ -28,6 +28,9 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include "instr_benchmarks_fixture.h"
 
+#include <numeric>
+#include <utility>
+
 
 // -----------------------------------------------------------------------------
 
@@ -353,6 +356,184 @@ void BenchmarkInstrARYMRG(benchmark::State& state)
 
 // -----------------------------------------------------------------------------
 
+static const size_t LARGE_ARRAY_SIZE = 4096;
+
+// -----------------------------------------------------------------------------
+
+static
+corevm::types::native_array make_large_array()
+{
+  corevm::types::native_array_base array(LARGE_ARRAY_SIZE);
+  std::iota(array.begin(), array.end(), 0);
+
+  return corevm::types::native_array(std::move(array));
+}
+
+// -----------------------------------------------------------------------------
+
+static
+void BenchmarkInstrARYSUMOnLargeArray(benchmark::State& state)
+{
+  InstrBenchmarksFixture fixture;
+
+  corevm::types::NativeTypeValue oprd = make_large_array();
+
+  corevm::runtime::Instr instr(0, 0, 0);
+
+  auto frame = &fixture.process().top_frame();
+  auto invk_ctx = &fixture.process().top_invocation_ctx();
+
+  while (state.KeepRunning())
+  {
+    frame->push_eval_stack(oprd);
+
+    corevm::runtime::instr_handler_arysum(
+      instr, fixture.process(), &frame, &invk_ctx);
+
+    frame->clear_eval_stack();
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+static
+void BenchmarkInstrARYMINOnLargeArray(benchmark::State& state)
+{
+  InstrBenchmarksFixture fixture;
+
+  corevm::types::NativeTypeValue oprd = make_large_array();
+
+  corevm::runtime::Instr instr(0, 0, 0);
+
+  auto frame = &fixture.process().top_frame();
+  auto invk_ctx = &fixture.process().top_invocation_ctx();
+
+  while (state.KeepRunning())
+  {
+    frame->push_eval_stack(oprd);
+
+    corevm::runtime::instr_handler_arymin(
+      instr, fixture.process(), &frame, &invk_ctx);
+
+    frame->clear_eval_stack();
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+static
+void BenchmarkInstrARYMAXOnLargeArray(benchmark::State& state)
+{
+  InstrBenchmarksFixture fixture;
+
+  corevm::types::NativeTypeValue oprd = make_large_array();
+
+  corevm::runtime::Instr instr(0, 0, 0);
+
+  auto frame = &fixture.process().top_frame();
+  auto invk_ctx = &fixture.process().top_invocation_ctx();
+
+  while (state.KeepRunning())
+  {
+    frame->push_eval_stack(oprd);
+
+    corevm::runtime::instr_handler_arymax(
+      instr, fixture.process(), &frame, &invk_ctx);
+
+    frame->clear_eval_stack();
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+static
+void BenchmarkInstrARYFNDOnLargeArray(benchmark::State& state)
+{
+  InstrBenchmarksFixture fixture;
+
+  corevm::types::NativeTypeValue oprd = make_large_array();
+
+  // Not in the array, so that all elements are compared.
+  corevm::types::NativeTypeValue oprd2 =
+    corevm::types::uint64(LARGE_ARRAY_SIZE);
+
+  corevm::runtime::Instr instr(0, 0, 0);
+
+  auto frame = &fixture.process().top_frame();
+  auto invk_ctx = &fixture.process().top_invocation_ctx();
+
+  while (state.KeepRunning())
+  {
+    frame->push_eval_stack(oprd2);
+    frame->push_eval_stack(oprd);
+
+    corevm::runtime::instr_handler_aryfnd(
+      instr, fixture.process(), &frame, &invk_ctx);
+
+    frame->clear_eval_stack();
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+static
+void BenchmarkInstrREVERSEOnLargeArray(benchmark::State& state)
+{
+  InstrBenchmarksFixture fixture;
+
+  corevm::types::NativeTypeValue oprd = make_large_array();
+
+  corevm::runtime::Instr instr(0, 0, 0);
+
+  auto frame = &fixture.process().top_frame();
+  auto invk_ctx = &fixture.process().top_invocation_ctx();
+
+  while (state.KeepRunning())
+  {
+    frame->push_eval_stack(oprd);
+
+    corevm::runtime::instr_handler_reverse(
+      instr, fixture.process(), &frame, &invk_ctx);
+
+    frame->clear_eval_stack();
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+static
+void BenchmarkInstrSLICEOnLargeArray(benchmark::State& state)
+{
+  InstrBenchmarksFixture fixture;
+
+  corevm::types::NativeTypeValue oprd = make_large_array();
+
+  corevm::types::NativeTypeValue oprd2 =
+    corevm::types::uint32(1);
+
+  corevm::types::NativeTypeValue oprd3 =
+    corevm::types::uint32(LARGE_ARRAY_SIZE - 1);
+
+  corevm::runtime::Instr instr(0, 0, 0);
+
+  auto frame = &fixture.process().top_frame();
+  auto invk_ctx = &fixture.process().top_invocation_ctx();
+
+  while (state.KeepRunning())
+  {
+    frame->push_eval_stack(oprd3);
+    frame->push_eval_stack(oprd2);
+    frame->push_eval_stack(oprd);
+
+    corevm::runtime::instr_handler_slice(
+      instr, fixture.process(), &frame, &invk_ctx);
+
+    frame->clear_eval_stack();
+  }
+}
+
+// -----------------------------------------------------------------------------
+
 BENCHMARK(BenchmarkInstrARYLEN);
 BENCHMARK(BenchmarkInstrARYEMP);
 BENCHMARK(BenchmarkInstrARYAT);
@@ -367,5 +548,11 @@ BENCHMARK(BenchmarkInstrARYCLR);
 #ifdef BUILD_BENCHMARKS_STRICT
   BENCHMARK(BenchmarkInstrARYMRG);
 #endif
+BENCHMARK(BenchmarkInstrARYSUMOnLargeArray);
+BENCHMARK(BenchmarkInstrARYMINOnLargeArray);
+BENCHMARK(BenchmarkInstrARYMAXOnLargeArray);
+BENCHMARK(BenchmarkInstrARYFNDOnLargeArray);
+BENCHMARK(BenchmarkInstrREVERSEOnLargeArray);
+BENCHMARK(BenchmarkInstrSLICEOnLargeArray);
 
 // -----------------------------------------------------------------------------
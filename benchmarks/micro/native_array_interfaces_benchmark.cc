@@ -142,10 +142,12 @@ static
 void Benchmark_InterfaceArrayPop(benchmark::State& state)
 {
   corevm::types::NativeTypeValue oprd((corevm::types::native_array({ 1, 2, 3 })));
+  corevm::types::NativeTypeValue oprd2((3));
 
   while (state.KeepRunning())
   {
-    auto res = corevm::types::interface_array_pop(oprd);
+    corevm::types::interface_array_pop(oprd);
+    corevm::types::interface_array_append(oprd, oprd2);
   }
 }
 
@@ -186,7 +188,8 @@ void Benchmark_InterfaceArrayMerge(benchmark::State& state)
 
   while (state.KeepRunning())
   {
-    auto res = corevm::types::interface_array_merge(oprd, oprd2);
+    corevm::types::NativeTypeValue res(oprd);
+    corevm::types::interface_array_merge(res, oprd2);
   }
 }
 
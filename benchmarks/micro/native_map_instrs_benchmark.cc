@@ -401,6 +401,130 @@ void BenchmarkInstrMAPMRG(benchmark::State& state)
 
 // -----------------------------------------------------------------------------
 
+static const size_t LARGE_MAP_SIZE = 64 * 1024;
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Key of the i-th entry of large maps, spread out like the hashes that
+ * dictionaries are keyed by.
+ */
+static
+corevm::types::native_map_key_type
+large_map_key(size_t i)
+{
+  return static_cast<corevm::types::native_map_key_type>(i) * 2654435761u;
+}
+
+// -----------------------------------------------------------------------------
+
+static
+corevm::types::NativeTypeValue
+make_large_map()
+{
+  corevm::types::native_map map;
+
+  for (size_t i = 0; i < LARGE_MAP_SIZE; ++i)
+  {
+    map[large_map_key(i)] = i;
+  }
+
+  return map;
+}
+
+// -----------------------------------------------------------------------------
+
+static
+void BenchmarkInstrMAPFINDOnLargeMap(benchmark::State& state)
+{
+  InstrBenchmarksFixture fixture;
+
+  corevm::types::NativeTypeValue oprd = make_large_map();
+
+  corevm::runtime::Instr instr(0, 0, 0);
+
+  auto frame = &fixture.process().top_frame();
+  auto invk_ctx = &fixture.process().top_invocation_ctx();
+
+  size_t i = 0;
+
+  while (state.KeepRunning())
+  {
+    // Looks up entries in an order other than the one they were inserted in.
+    const size_t index = (i++ * 40503) % LARGE_MAP_SIZE;
+
+    frame->push_eval_stack(corevm::types::uint64(large_map_key(index)));
+    frame->push_eval_stack(oprd);
+
+    corevm::runtime::instr_handler_mapfind(
+      instr, fixture.process(), &frame, &invk_ctx);
+
+    frame->pop_eval_stack();
+    frame->pop_eval_stack();
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+static
+void BenchmarkInstrMAPPUTAndMAPERSOnLargeMap(benchmark::State& state)
+{
+  InstrBenchmarksFixture fixture;
+
+  corevm::runtime::Instr instr(0, 0, 0);
+
+  auto frame = &fixture.process().top_frame();
+  auto invk_ctx = &fixture.process().top_invocation_ctx();
+
+  // Both instructions work on the operands in place, with the key under the
+  // map, and the value under the key.
+  frame->push_eval_stack(corevm::types::uint64(200));
+  frame->push_eval_stack(corevm::types::uint64(0));
+  frame->push_eval_stack(make_large_map());
+
+  corevm::types::NativeTypeValue& key = frame->eval_stack_element(1);
+
+  size_t i = LARGE_MAP_SIZE;
+
+  while (state.KeepRunning())
+  {
+    key = corevm::types::uint64(large_map_key(i++));
+
+    corevm::runtime::instr_handler_mapput(
+      instr, fixture.process(), &frame, &invk_ctx);
+
+    corevm::runtime::instr_handler_mapers(
+      instr, fixture.process(), &frame, &invk_ctx);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+static
+void BenchmarkInstrMAPKEYSOnLargeMap(benchmark::State& state)
+{
+  InstrBenchmarksFixture fixture;
+
+  corevm::types::NativeTypeValue oprd = make_large_map();
+
+  corevm::runtime::Instr instr(0, 0, 0);
+
+  auto frame = &fixture.process().top_frame();
+  auto invk_ctx = &fixture.process().top_invocation_ctx();
+
+  while (state.KeepRunning())
+  {
+    frame->push_eval_stack(oprd);
+
+    corevm::runtime::instr_handler_mapkeys(
+      instr, fixture.process(), &frame, &invk_ctx);
+
+    frame->pop_eval_stack();
+  }
+}
+
+// -----------------------------------------------------------------------------
+
 BENCHMARK(BenchmarkInstrMAPLEN);
 BENCHMARK(BenchmarkInstrMAPEMP);
 BENCHMARK(BenchmarkInstrMAPFIND);
@@ -412,6 +536,9 @@ BENCHMARK(BenchmarkInstrMAPCLR);
 BENCHMARK(BenchmarkInstrMAPSWP);
 BENCHMARK(BenchmarkInstrMAPKEYS);
 BENCHMARK(BenchmarkInstrMAPVALS);
+BENCHMARK(BenchmarkInstrMAPFINDOnLargeMap);
+BENCHMARK(BenchmarkInstrMAPPUTAndMAPERSOnLargeMap);
+BENCHMARK(BenchmarkInstrMAPKEYSOnLargeMap);
 #ifdef BUILD_BENCHMARKS_STRICT
   BENCHMARK(BenchmarkInstrMAPMRG);
 #endif
@@ -209,6 +209,93 @@ void Benchmark_InterfaceMapVals(benchmark::State& state)
 
 // -----------------------------------------------------------------------------
 
+static const size_t LARGE_MAP_SIZE = 64 * 1024;
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Key of the i-th entry of large maps, spread out like the hashes that
+ * dictionaries are keyed by.
+ */
+static
+corevm::types::native_map_key_type
+large_map_key(size_t i)
+{
+  return static_cast<corevm::types::native_map_key_type>(i) * 2654435761u;
+}
+
+// -----------------------------------------------------------------------------
+
+static
+corevm::types::native_map
+make_large_map()
+{
+  corevm::types::native_map map;
+
+  for (size_t i = 0; i < LARGE_MAP_SIZE; ++i)
+  {
+    map[large_map_key(i)] = i;
+  }
+
+  return map;
+}
+
+// -----------------------------------------------------------------------------
+
+static
+void Benchmark_InterfaceMapFindOnLargeMap(benchmark::State& state)
+{
+  corevm::types::NativeTypeValue oprd(make_large_map());
+
+  size_t i = 0;
+
+  while (state.KeepRunning())
+  {
+    // Looks up entries in an order other than the one they were inserted in.
+    const size_t index = (i++ * 40503) % LARGE_MAP_SIZE;
+
+    corevm::types::NativeTypeValue oprd2(
+      (corevm::types::uint64(large_map_key(index))));
+
+    auto res = corevm::types::interface_map_find(oprd, oprd2);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+static
+void Benchmark_InterfaceMapPutAndEraseOnLargeMap(benchmark::State& state)
+{
+  corevm::types::NativeTypeValue oprd(make_large_map());
+  corevm::types::NativeTypeValue oprd3((corevm::types::uint64(200)));
+
+  size_t i = LARGE_MAP_SIZE;
+
+  while (state.KeepRunning())
+  {
+    corevm::types::NativeTypeValue oprd2(
+      (corevm::types::uint64(large_map_key(i++))));
+
+    corevm::types::interface_map_put(oprd, oprd2, oprd3);
+    corevm::types::interface_map_erase(oprd, oprd2);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+static
+void Benchmark_InterfaceMapKeysOnLargeMap(benchmark::State& state)
+{
+  corevm::types::NativeTypeValue oprd(make_large_map());
+
+  while (state.KeepRunning())
+  {
+    auto res = corevm::types::interface_map_keys(oprd);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
 BENCHMARK(Benchmark_InterfaceMapSize);
 BENCHMARK(Benchmark_InterfaceMapEmpty);
 BENCHMARK(Benchmark_InterfaceMapFind);
@@ -219,5 +306,8 @@ BENCHMARK(Benchmark_InterfaceMapClear);
 BENCHMARK(Benchmark_InterfaceMapSwap);
 BENCHMARK(Benchmark_InterfaceMapKeys);
 BENCHMARK(Benchmark_InterfaceMapVals);
+BENCHMARK(Benchmark_InterfaceMapFindOnLargeMap);
+BENCHMARK(Benchmark_InterfaceMapPutAndEraseOnLargeMap);
+BENCHMARK(Benchmark_InterfaceMapKeysOnLargeMap);
 
 // -----------------------------------------------------------------------------
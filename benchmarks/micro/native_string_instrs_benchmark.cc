@@ -519,6 +519,254 @@ void BenchmarkInstrSTRRFND2(benchmark::State& state)
 
 // -----------------------------------------------------------------------------
 
+/**
+ * Builds a string out of `N` appends of short strings, as a loop of
+ * `s += t` does.
+ */
+template<size_t N>
+static
+void BenchmarkInstrSTRAPDRepeatedly(benchmark::State& state)
+{
+  InstrBenchmarksFixture fixture;
+
+  corevm::types::NativeTypeValue oprd2 =
+    corevm::types::native_string("abc");
+
+  corevm::runtime::Instr instr(0, 0, 0);
+
+  auto frame = &fixture.process().top_frame();
+  auto invk_ctx = &fixture.process().top_invocation_ctx();
+
+  while (state.KeepRunning())
+  {
+    frame->push_eval_stack(oprd2);
+    frame->push_eval_stack(corevm::types::NativeTypeValue(
+      corevm::types::native_string()));
+
+    for (size_t i = 0; i < N; ++i)
+    {
+      corevm::runtime::instr_handler_strapd(
+        instr, fixture.process(), &frame, &invk_ctx);
+    }
+
+    frame->clear_eval_stack();
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Same as `BenchmarkInstrSTRAPDRepeatedly`, except that the string is copied
+ * onto the eval stack before each append and stored back after, as with
+ * `getval` and `setval` on the object holding the string.
+ */
+template<size_t N>
+static
+void BenchmarkInstrSTRAPDRepeatedlyOnCopies(benchmark::State& state)
+{
+  InstrBenchmarksFixture fixture;
+
+  corevm::types::NativeTypeValue oprd2 =
+    corevm::types::native_string("abc");
+
+  corevm::runtime::Instr instr(0, 0, 0);
+
+  auto frame = &fixture.process().top_frame();
+  auto invk_ctx = &fixture.process().top_invocation_ctx();
+
+  while (state.KeepRunning())
+  {
+    corevm::types::NativeTypeValue value = corevm::types::native_string();
+
+    for (size_t i = 0; i < N; ++i)
+    {
+      frame->push_eval_stack(oprd2);
+      frame->push_eval_stack(value);
+
+      corevm::runtime::instr_handler_strapd(
+        instr, fixture.process(), &frame, &invk_ctx);
+
+      value = frame->pop_eval_stack();
+      frame->pop_eval_stack();
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Builds a string out of `N` insertions of short strings at its front.
+ */
+template<size_t N>
+static
+void BenchmarkInstrSTRISTRepeatedlyAtFront(benchmark::State& state)
+{
+  InstrBenchmarksFixture fixture;
+
+  corevm::types::NativeTypeValue oprd2 =
+    corevm::types::uint32(0);
+
+  corevm::types::NativeTypeValue oprd3 =
+    corevm::types::native_string("abc");
+
+  corevm::runtime::Instr instr(0, 0, 0);
+
+  auto frame = &fixture.process().top_frame();
+  auto invk_ctx = &fixture.process().top_invocation_ctx();
+
+  while (state.KeepRunning())
+  {
+    frame->push_eval_stack(oprd3);
+    frame->push_eval_stack(oprd2);
+    frame->push_eval_stack(corevm::types::NativeTypeValue(
+      corevm::types::native_string()));
+
+    for (size_t i = 0; i < N; ++i)
+    {
+      corevm::runtime::instr_handler_strist(
+        instr, fixture.process(), &frame, &invk_ctx);
+    }
+
+    frame->clear_eval_stack();
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+template<size_t N>
+static
+void BenchmarkInstrSTRFNDOnLargeString(benchmark::State& state)
+{
+  InstrBenchmarksFixture fixture;
+
+  corevm::types::NativeTypeValue oprd =
+    corevm::types::native_string(std::string(N, 'a') + "world");
+
+  corevm::types::NativeTypeValue oprd2 =
+    corevm::types::native_string("world");
+
+  corevm::runtime::Instr instr(0, 0, 0);
+
+  auto frame = &fixture.process().top_frame();
+  auto invk_ctx = &fixture.process().top_invocation_ctx();
+
+  while (state.KeepRunning())
+  {
+    frame->push_eval_stack(oprd2);
+    frame->push_eval_stack(oprd);
+
+    corevm::runtime::instr_handler_strfnd(
+      instr, fixture.process(), &frame, &invk_ctx);
+
+    frame->clear_eval_stack();
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+template<size_t N>
+static
+void BenchmarkInstrSTRRFNDOnLargeString(benchmark::State& state)
+{
+  InstrBenchmarksFixture fixture;
+
+  corevm::types::NativeTypeValue oprd =
+    corevm::types::native_string("world" + std::string(N, 'a'));
+
+  corevm::types::NativeTypeValue oprd2 =
+    corevm::types::native_string("world");
+
+  corevm::runtime::Instr instr(0, 0, 0);
+
+  auto frame = &fixture.process().top_frame();
+  auto invk_ctx = &fixture.process().top_invocation_ctx();
+
+  while (state.KeepRunning())
+  {
+    frame->push_eval_stack(oprd2);
+    frame->push_eval_stack(oprd);
+
+    corevm::runtime::instr_handler_strrfnd(
+      instr, fixture.process(), &frame, &invk_ctx);
+
+    frame->clear_eval_stack();
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+template<size_t N>
+static
+void BenchmarkInstrSTRSPLITOnLargeString(benchmark::State& state)
+{
+  InstrBenchmarksFixture fixture;
+
+  std::string str;
+  for (size_t i = 0; i < N / 16; ++i)
+  {
+    str.append("abcdefghijklmno,");
+  }
+
+  corevm::types::NativeTypeValue oprd =
+    corevm::types::native_string(str);
+
+  corevm::types::NativeTypeValue oprd2 =
+    corevm::types::native_string(",");
+
+  corevm::runtime::Instr instr(0, 0, 0);
+
+  auto frame = &fixture.process().top_frame();
+  auto invk_ctx = &fixture.process().top_invocation_ctx();
+
+  while (state.KeepRunning())
+  {
+    frame->push_eval_stack(oprd2);
+    frame->push_eval_stack(oprd);
+
+    corevm::runtime::instr_handler_strsplit(
+      instr, fixture.process(), &frame, &invk_ctx);
+
+    frame->clear_eval_stack();
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+template<size_t N>
+static
+void BenchmarkInstrSLICEOnLargeString(benchmark::State& state)
+{
+  InstrBenchmarksFixture fixture;
+
+  corevm::types::NativeTypeValue oprd =
+    corevm::types::native_string(std::string(N, 'a'));
+
+  corevm::types::NativeTypeValue oprd2 =
+    corevm::types::uint32(1);
+
+  corevm::types::NativeTypeValue oprd3 =
+    corevm::types::uint32(N - 1);
+
+  corevm::runtime::Instr instr(0, 0, 0);
+
+  auto frame = &fixture.process().top_frame();
+  auto invk_ctx = &fixture.process().top_invocation_ctx();
+
+  while (state.KeepRunning())
+  {
+    frame->push_eval_stack(oprd3);
+    frame->push_eval_stack(oprd2);
+    frame->push_eval_stack(oprd);
+
+    corevm::runtime::instr_handler_slice(
+      instr, fixture.process(), &frame, &invk_ctx);
+
+    frame->clear_eval_stack();
+  }
+}
+
+// -----------------------------------------------------------------------------
+
 BENCHMARK(BenchmarkInstrSTRLEN);
 BENCHMARK(BenchmarkInstrSTRCLR);
 BENCHMARK(BenchmarkInstrSTRAPD);
@@ -529,6 +777,17 @@ BENCHMARK(BenchmarkInstrSTRERS);
 BENCHMARK(BenchmarkInstrSTRRPLC);
 BENCHMARK(BenchmarkInstrSTRSWP);
 BENCHMARK(BenchmarkInstrSTRSUB);
+BENCHMARK_TEMPLATE(BenchmarkInstrSTRAPDRepeatedly, 100000);
+BENCHMARK_TEMPLATE(BenchmarkInstrSTRAPDRepeatedly, 1000000);
+BENCHMARK_TEMPLATE(BenchmarkInstrSTRAPDRepeatedlyOnCopies, 100000);
+BENCHMARK_TEMPLATE(BenchmarkInstrSTRAPDRepeatedlyOnCopies, 1000000);
+BENCHMARK_TEMPLATE(BenchmarkInstrSTRISTRepeatedlyAtFront, 100000);
+BENCHMARK_TEMPLATE(BenchmarkInstrSTRISTRepeatedlyAtFront, 1000000);
+BENCHMARK_TEMPLATE(BenchmarkInstrSTRFNDOnLargeString, 4096);
+BENCHMARK_TEMPLATE(BenchmarkInstrSTRRFNDOnLargeString, 4096);
+BENCHMARK_TEMPLATE(BenchmarkInstrSTRSPLITOnLargeString, 4096);
+BENCHMARK_TEMPLATE(BenchmarkInstrSLICEOnLargeString, 4096);
+BENCHMARK_TEMPLATE(BenchmarkInstrSLICEOnLargeString, 65536);
 
 #ifdef BUILD_BENCHMARKS_STRICT
   BENCHMARK(BenchmarkInstrSTRERS2);
@@ -0,0 +1,161 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2016 Yanzheng Li
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#include <benchmark/benchmark.h>
+
+#include "types/native_string_kernels.h"
+
+#include <string>
+
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Searches through the string kernels, each next to the same search with
+ * `std::string`, on strings of `N` characters with the match at the far end.
+ */
+
+// -----------------------------------------------------------------------------
+
+template<size_t N>
+static
+void BenchmarkStringFindWithRareFirstChar(benchmark::State& state)
+{
+  const std::string s = std::string(N, 'a') + "world";
+
+  while (state.KeepRunning())
+  {
+    auto res = corevm::types::string_find(s.data(), s.size(), "world", 5, 0);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+template<size_t N>
+static
+void BenchmarkStdStringFindWithRareFirstChar(benchmark::State& state)
+{
+  const std::string s = std::string(N, 'a') + "world";
+
+  while (state.KeepRunning())
+  {
+    auto res = s.find("world", 0, 5);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+template<size_t N>
+static
+void BenchmarkStringFindWithCommonFirstChar(benchmark::State& state)
+{
+  const std::string s = std::string(N, 'w') + "world";
+
+  while (state.KeepRunning())
+  {
+    auto res = corevm::types::string_find(s.data(), s.size(), "world", 5, 0);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+template<size_t N>
+static
+void BenchmarkStdStringFindWithCommonFirstChar(benchmark::State& state)
+{
+  const std::string s = std::string(N, 'w') + "world";
+
+  while (state.KeepRunning())
+  {
+    auto res = s.find("world", 0, 5);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+template<size_t N>
+static
+void BenchmarkStringFindChar(benchmark::State& state)
+{
+  const std::string s = std::string(N, 'a') + "x";
+
+  while (state.KeepRunning())
+  {
+    auto res = corevm::types::string_find(s.data(), s.size(), "x", 1, 0);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+template<size_t N>
+static
+void BenchmarkStdStringFindChar(benchmark::State& state)
+{
+  const std::string s = std::string(N, 'a') + "x";
+
+  while (state.KeepRunning())
+  {
+    auto res = s.find("x", 0, 1);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+template<size_t N>
+static
+void BenchmarkStringRFindChar(benchmark::State& state)
+{
+  const std::string s = "x" + std::string(N, 'a');
+
+  while (state.KeepRunning())
+  {
+    auto res = corevm::types::string_rfind(s.data(), s.size(), "x", 1,
+      std::string::npos);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+template<size_t N>
+static
+void BenchmarkStdStringRFindChar(benchmark::State& state)
+{
+  const std::string s = "x" + std::string(N, 'a');
+
+  while (state.KeepRunning())
+  {
+    auto res = s.rfind("x", std::string::npos, 1);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+BENCHMARK_TEMPLATE(BenchmarkStringFindWithRareFirstChar, 4096);
+BENCHMARK_TEMPLATE(BenchmarkStdStringFindWithRareFirstChar, 4096);
+BENCHMARK_TEMPLATE(BenchmarkStringFindWithCommonFirstChar, 4096);
+BENCHMARK_TEMPLATE(BenchmarkStdStringFindWithCommonFirstChar, 4096);
+BENCHMARK_TEMPLATE(BenchmarkStringFindChar, 4096);
+BENCHMARK_TEMPLATE(BenchmarkStdStringFindChar, 4096);
+BENCHMARK_TEMPLATE(BenchmarkStringRFindChar, 4096);
+BENCHMARK_TEMPLATE(BenchmarkStdStringRFindChar, 4096);
+
+// -----------------------------------------------------------------------------
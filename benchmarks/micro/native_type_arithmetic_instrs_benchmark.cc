@@ -99,6 +99,48 @@ BENCHMARK(Benchmark##name##Instr)
 
 // -----------------------------------------------------------------------------
 
+static void
+BenchmarkNativeTypeArithmeticQuickenedBinaryInstrs(benchmark::State& state,
+  corevm::runtime::InstrHandler handler, corevm::runtime::instr_code_t code)
+{
+  const corevm::runtime::DecodedInstr instr(
+    corevm::runtime::Instr(code, 0, 0));
+
+  corevm::types::NativeTypeValue oprd1 = corevm::types::int64(1);
+  corevm::types::NativeTypeValue oprd2 = corevm::types::int64(1);
+
+  InstrBenchmarksFixture fixture;
+
+  fixture.process().top_frame().push_eval_stack(oprd1);
+  fixture.process().top_frame().push_eval_stack(oprd2);
+
+  auto frame = &fixture.process().top_frame();
+  auto invk_ctx = &fixture.process().top_invocation_ctx();
+
+  while (state.KeepRunning())
+  {
+    handler(instr, fixture.process(), &frame, &invk_ctx);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Benchmarks the generic and the quickened forms of an instruction on the
+ * same `int64` operands.
+ */
+#define BENCHMARK_NATIVE_TYPE_ARITHMETIC_QUICKENED_BINARY_INSTR(name, handler)  \
+static void                                                                     \
+Benchmark##name##Instr(benchmark::State& state)                                 \
+{                                                                               \
+  BenchmarkNativeTypeArithmeticQuickenedBinaryInstrs(state,                     \
+    corevm::runtime::instr_handler_##handler,                                   \
+    corevm::runtime::InstrEnum::name);                                          \
+}                                                                               \
+BENCHMARK(Benchmark##name##Instr)
+
+// -----------------------------------------------------------------------------
+
 BENCHMARK_NATIVE_TYPE_ARITHMETIC_UNARY_INSTR(POS, corevm::runtime::instr_handler_pos);
 BENCHMARK_NATIVE_TYPE_ARITHMETIC_UNARY_INSTR(NEG, corevm::runtime::instr_handler_neg);
 BENCHMARK_NATIVE_TYPE_ARITHMETIC_UNARY_INSTR(INC, corevm::runtime::instr_handler_inc);
@@ -130,4 +172,7 @@ BENCHMARK_NATIVE_TYPE_ARITHMETIC_BINARY_INSTR(LAND, corevm::runtime::instr_handl
 BENCHMARK_NATIVE_TYPE_ARITHMETIC_BINARY_INSTR(LOR, corevm::runtime::instr_handler_lor);
 BENCHMARK_NATIVE_TYPE_ARITHMETIC_BINARY_INSTR(ROUND, corevm::runtime::instr_handler_round);
 
+BENCHMARK_NATIVE_TYPE_ARITHMETIC_QUICKENED_BINARY_INSTR(ADDI64, addi64);
+BENCHMARK_NATIVE_TYPE_ARITHMETIC_QUICKENED_BINARY_INSTR(MULI64, muli64);
+
 // -----------------------------------------------------------------------------
@@ -127,6 +127,90 @@ void BenchmarkNativeTypeValueStrideOperatorInterfaceWithStringOperand(benchmark:
 
 // -----------------------------------------------------------------------------
 
+static
+void BenchmarkNativeTypeValueEqOperatorInterfaceWithStringOperands(benchmark::State& state)
+{
+  const std::string str(256, 'a');
+
+  corevm::types::NativeTypeValue oprd1 = corevm::types::string(str);
+  corevm::types::NativeTypeValue oprd2 = corevm::types::string(str);
+
+  while (state.KeepRunning())
+  {
+    auto result = corevm::types::interface_apply_eq_operator(oprd1, oprd2);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+static
+void BenchmarkNativeTypeValueEqOperatorInterfaceWithInternedStringOperands(benchmark::State& state)
+{
+  const std::string str(256, 'a');
+
+  corevm::types::NativeTypeValue oprd1 = corevm::types::string::intern(str);
+  corevm::types::NativeTypeValue oprd2 = corevm::types::string::intern(str);
+
+  while (state.KeepRunning())
+  {
+    auto result = corevm::types::interface_apply_eq_operator(oprd1, oprd2);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+static
+void BenchmarkNativeTypeValueHashInterfaceWithStringOperand(benchmark::State& state)
+{
+  corevm::types::NativeTypeValue oprd = corevm::types::string(256, 'a');
+
+  while (state.KeepRunning())
+  {
+    auto result = corevm::types::interface_compute_hash_value(oprd);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+static
+void BenchmarkNativeTypeValueHashInterfaceWithArrayOperand(benchmark::State& state)
+{
+  corevm::types::NativeTypeValue oprd =
+    corevm::types::array(corevm::types::native_array_base(1024, 1));
+
+  while (state.KeepRunning())
+  {
+    auto result = corevm::types::interface_compute_hash_value(oprd);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Same as `BenchmarkNativeTypeValueHashInterfaceWithArrayOperand`, except
+ * that the array is changed before each hash, which hashes all of its
+ * elements every time.
+ */
+static
+void BenchmarkNativeTypeValueHashInterfaceWithChangingArrayOperand(benchmark::State& state)
+{
+  corevm::types::NativeTypeValue oprd =
+    corevm::types::array(corevm::types::native_array_base(1024, 1));
+
+  auto& array = corevm::types::get_value_ref_from_type_value<
+    corevm::types::native_array>(oprd);
+
+  corevm::types::native_array_element_type i = 0;
+
+  while (state.KeepRunning())
+  {
+    array[0] = i++;
+    auto result = corevm::types::interface_compute_hash_value(oprd);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
 BENCHMARK(BenchmarkNativeTypeValueAssginment);
 BENCHMARK(BenchmarkNativeTypeValueBinaryOperator);
 BENCHMARK(BenchmarkNativeTypeValueBinaryOperatorInterface);
@@ -134,5 +218,10 @@ BENCHMARK(BenchmarkNativeTypeValueSliceOperatorInterfaceWithArrayOperand);
 BENCHMARK(BenchmarkNativeTypeValueSliceOperatorInterfaceWithStringOperand);
 BENCHMARK(BenchmarkNativeTypeValueStrideOperatorInterfaceWithArrayOperand);
 BENCHMARK(BenchmarkNativeTypeValueStrideOperatorInterfaceWithStringOperand);
+BENCHMARK(BenchmarkNativeTypeValueEqOperatorInterfaceWithStringOperands);
+BENCHMARK(BenchmarkNativeTypeValueEqOperatorInterfaceWithInternedStringOperands);
+BENCHMARK(BenchmarkNativeTypeValueHashInterfaceWithStringOperand);
+BENCHMARK(BenchmarkNativeTypeValueHashInterfaceWithArrayOperand);
+BENCHMARK(BenchmarkNativeTypeValueHashInterfaceWithChangingArrayOperand);
 
 // -----------------------------------------------------------------------------
@@ -28,6 +28,14 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include "instr_benchmarks_fixture.h"
 
+#include <boost/lexical_cast.hpp>
+
+#include <cstdio>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
 
 using corevm::benchmarks::InstrBenchmarksFixture;
 
@@ -76,3 +84,134 @@ BENCHMARK_NATIVE_TYPE_VALUE_CONVERSION_INSTR(2UINT64, corevm::runtime::instr_han
 BENCHMARK_NATIVE_TYPE_VALUE_CONVERSION_INSTR(2BOOL, corevm::runtime::instr_handler_2bool);
 
 // -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Operands of the benchmarks of number formatting below, spread over
+ * magnitudes.
+ */
+template<typename T>
+static std::vector<T>
+repr_operands()
+{
+  std::mt19937_64 engine(42);
+  std::vector<T> operands;
+
+  for (size_t i = 0; i < 1024; ++i)
+  {
+    const double value = static_cast<double>(engine() % 1000000007) /
+      static_cast<double>(1 << (engine() % 24));
+
+    operands.push_back(static_cast<T>(i % 2 ? value : -value));
+  }
+
+  return operands;
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename T>
+static void
+BenchmarkREPRInstrWithNumbers(benchmark::State& state)
+{
+  corevm::runtime::Instr instr(0, 0, 0);
+
+  std::vector<corevm::types::NativeTypeValue> operands;
+
+  for (const auto operand : repr_operands<T>())
+  {
+    operands.push_back(corevm::types::NativeTypeValue(operand));
+  }
+
+  InstrBenchmarksFixture fixture;
+
+  auto frame = &fixture.process().top_frame();
+  auto invk_ctx = &fixture.process().top_invocation_ctx();
+
+  size_t i = 0;
+
+  while (state.KeepRunning())
+  {
+    frame->push_eval_stack(operands[i++ % operands.size()]);
+    corevm::runtime::instr_handler_repr(instr, fixture.process(), &frame,
+      &invk_ctx);
+    frame->clear_eval_stack();
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Formats the same operands as `BenchmarkREPRInstrWithNumbers` through
+ * `boost::lexical_cast`, for comparison.
+ */
+template<typename T>
+static void
+BenchmarkReprThroughLexicalCast(benchmark::State& state)
+{
+  const std::vector<T> operands = repr_operands<T>();
+
+  size_t i = 0;
+  corevm::types::native_string str;
+
+  while (state.KeepRunning())
+  {
+    str = boost::lexical_cast<std::string>(operands[i++ % operands.size()]);
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Formats the same operands as `BenchmarkREPRInstrWithNumbers` through
+ * `snprintf()`, with enough digits for them to round trip, for comparison.
+ */
+template<typename T>
+static void
+BenchmarkReprThroughSnprintf(benchmark::State& state)
+{
+  const std::vector<T> operands = repr_operands<T>();
+
+  const char* format = std::is_floating_point<T>::value ? "%.17g" : "%lld";
+
+  size_t i = 0;
+  corevm::types::native_string str;
+
+  while (state.KeepRunning())
+  {
+    char buf[32];
+    const T operand = operands[i++ % operands.size()];
+
+    if (std::is_floating_point<T>::value)
+    {
+      snprintf(buf, sizeof(buf), format, static_cast<double>(operand));
+    }
+    else
+    {
+      snprintf(buf, sizeof(buf), format, static_cast<long long>(operand));
+    }
+
+    str = buf;
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+// -----------------------------------------------------------------------------
+
+BENCHMARK_TEMPLATE(BenchmarkREPRInstrWithNumbers, corevm::types::int64);
+BENCHMARK_TEMPLATE(BenchmarkREPRInstrWithNumbers, corevm::types::decimal);
+BENCHMARK_TEMPLATE(BenchmarkREPRInstrWithNumbers, corevm::types::decimal2);
+BENCHMARK_TEMPLATE(BenchmarkReprThroughLexicalCast, corevm::types::int64);
+BENCHMARK_TEMPLATE(BenchmarkReprThroughLexicalCast, corevm::types::decimal);
+BENCHMARK_TEMPLATE(BenchmarkReprThroughLexicalCast, corevm::types::decimal2);
+BENCHMARK_TEMPLATE(BenchmarkReprThroughSnprintf, corevm::types::int64);
+BENCHMARK_TEMPLATE(BenchmarkReprThroughSnprintf, corevm::types::decimal);
+BENCHMARK_TEMPLATE(BenchmarkReprThroughSnprintf, corevm::types::decimal2);
+
+// -----------------------------------------------------------------------------
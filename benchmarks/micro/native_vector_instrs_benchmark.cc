@@ -0,0 +1,168 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2016 Yanzheng Li
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#include <benchmark/benchmark.h>
+
+#include "runtime/instr.h"
+#include "types/native_type_value.h"
+#include "types/types.h"
+
+#include "instr_benchmarks_fixture.h"
+
+#include <utility>
+
+
+// -----------------------------------------------------------------------------
+
+using corevm::benchmarks::InstrBenchmarksFixture;
+
+// -----------------------------------------------------------------------------
+
+static const size_t LARGE_VECTOR_SIZE = 4096;
+
+// -----------------------------------------------------------------------------
+
+static
+corevm::types::native_vector make_large_vector()
+{
+  corevm::types::native_vector_base vector(LARGE_VECTOR_SIZE);
+
+  for (size_t i = 0; i < vector.size(); ++i)
+  {
+    vector[i] = static_cast<double>(i) * 0.5;
+  }
+
+  return corevm::types::native_vector(std::move(vector));
+}
+
+// -----------------------------------------------------------------------------
+
+static
+void BenchmarkInstrVECSUMOnLargeVector(benchmark::State& state)
+{
+  InstrBenchmarksFixture fixture;
+
+  corevm::types::NativeTypeValue oprd = make_large_vector();
+
+  corevm::runtime::Instr instr(0, 0, 0);
+
+  auto frame = &fixture.process().top_frame();
+  auto invk_ctx = &fixture.process().top_invocation_ctx();
+
+  while (state.KeepRunning())
+  {
+    frame->push_eval_stack(oprd);
+
+    corevm::runtime::instr_handler_vecsum(
+      instr, fixture.process(), &frame, &invk_ctx);
+
+    frame->clear_eval_stack();
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+static
+void BenchmarkInstrVECDOTOnLargeVector(benchmark::State& state)
+{
+  InstrBenchmarksFixture fixture;
+
+  corevm::types::NativeTypeValue oprd = make_large_vector();
+
+  corevm::runtime::Instr instr(0, 0, 0);
+
+  auto frame = &fixture.process().top_frame();
+  auto invk_ctx = &fixture.process().top_invocation_ctx();
+
+  while (state.KeepRunning())
+  {
+    frame->push_eval_stack(oprd);
+    frame->push_eval_stack(oprd);
+
+    corevm::runtime::instr_handler_vecdot(
+      instr, fixture.process(), &frame, &invk_ctx);
+
+    frame->clear_eval_stack();
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+static
+void BenchmarkInstrVECSCLOnLargeVector(benchmark::State& state)
+{
+  InstrBenchmarksFixture fixture;
+
+  corevm::types::NativeTypeValue oprd = make_large_vector();
+  corevm::types::NativeTypeValue factor = corevm::types::decimal2(1.5);
+
+  corevm::runtime::Instr instr(0, 0, 0);
+
+  auto frame = &fixture.process().top_frame();
+  auto invk_ctx = &fixture.process().top_invocation_ctx();
+
+  while (state.KeepRunning())
+  {
+    frame->push_eval_stack(factor);
+    frame->push_eval_stack(oprd);
+
+    corevm::runtime::instr_handler_vecscl(
+      instr, fixture.process(), &frame, &invk_ctx);
+
+    frame->clear_eval_stack();
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+static
+void BenchmarkInstrADDOnLargeVectors(benchmark::State& state)
+{
+  InstrBenchmarksFixture fixture;
+
+  corevm::types::NativeTypeValue oprd = make_large_vector();
+
+  corevm::runtime::Instr instr(0, 0, 0);
+
+  auto frame = &fixture.process().top_frame();
+  auto invk_ctx = &fixture.process().top_invocation_ctx();
+
+  while (state.KeepRunning())
+  {
+    frame->push_eval_stack(oprd);
+    frame->push_eval_stack(oprd);
+
+    corevm::runtime::instr_handler_add(
+      instr, fixture.process(), &frame, &invk_ctx);
+
+    frame->clear_eval_stack();
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+BENCHMARK(BenchmarkInstrVECSUMOnLargeVector);
+BENCHMARK(BenchmarkInstrVECDOTOnLargeVector);
+BENCHMARK(BenchmarkInstrVECSCLOnLargeVector);
+BENCHMARK(BenchmarkInstrADDOnLargeVectors);
+
+// -----------------------------------------------------------------------------
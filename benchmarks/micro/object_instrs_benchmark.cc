@@ -28,6 +28,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "runtime/compartment.h"
 #include "runtime/instr.h"
 #include "runtime/process.h"
+#include "types/interfaces.h"
 #include "types/native_type_value.h"
 
 #include "instr_benchmarks_fixture.h"
@@ -843,6 +844,352 @@ BenchmarkSETATTRSInstr(benchmark::State& state)
 
 // -----------------------------------------------------------------------------
 
+/**
+ * The benchmarks below compare attribute access with and without the inline
+ * caches of the instructions, which only decoded instructions carry.
+ *
+ * Receivers have `attr_count` attributes, with the accessed one last.
+ */
+
+// -----------------------------------------------------------------------------
+
+static
+const corevm::runtime::DecodedInstr&
+get_decoded_instr(corevm::runtime::Process& process, size_t index)
+{
+  auto frame = &process.top_frame();
+  return frame->compartment()->get_decoded_vector(frame->closure())[index];
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename ObjPtrType>
+static
+void put_dummy_attrs(ObjPtrType obj, ObjPtrType attr_obj, size_t attr_count)
+{
+  for (size_t i = 0; i < attr_count; ++i)
+  {
+    obj->putattr(static_cast<corevm::dyobj::attr_key_t>(i), attr_obj);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+static
+void BenchmarkGETATTRInstrWithInlineCache(benchmark::State& state,
+  bool cached, size_t attr_count)
+{
+  const std::string attr_str = "hello_world";
+
+  corevm::runtime::Vector vector {
+    corevm::runtime::Instr(corevm::runtime::GETATTR, 0, 0)
+  };
+
+  InstrBenchmarksFixture fixture(vector);
+
+  corevm::runtime::StringLiteralTable str_literal_table { attr_str };
+  set_encoding_pair(fixture.process(), str_literal_table);
+
+  const corevm::runtime::DecodedInstr instr = cached ?
+    get_decoded_instr(fixture.process(), 0) :
+    corevm::runtime::DecodedInstr(vector[0]);
+
+  auto obj = fixture.process().create_dyobj();
+  auto obj2 = fixture.process().create_dyobj();
+
+  put_dummy_attrs(obj, obj2, attr_count - 1);
+  obj->putattr(corevm::dyobj::hash_attr_str(attr_str), obj2);
+
+  auto frame = &fixture.process().top_frame();
+  auto invk_ctx = &fixture.process().top_invocation_ctx();
+
+  while (state.KeepRunning())
+  {
+    fixture.process().push_stack(obj);
+
+    corevm::runtime::instr_handler_getattr(
+      instr, fixture.process(), &frame, &invk_ctx);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+static
+void BenchmarkSETATTRInstrWithInlineCache(benchmark::State& state,
+  bool cached, size_t attr_count)
+{
+  const std::string attr_str = "hello_world";
+
+  corevm::runtime::Vector vector {
+    corevm::runtime::Instr(corevm::runtime::SETATTR, 0, 0)
+  };
+
+  InstrBenchmarksFixture fixture(vector);
+
+  corevm::runtime::StringLiteralTable str_literal_table { attr_str };
+  set_encoding_pair(fixture.process(), str_literal_table);
+
+  const corevm::runtime::DecodedInstr instr = cached ?
+    get_decoded_instr(fixture.process(), 0) :
+    corevm::runtime::DecodedInstr(vector[0]);
+
+  auto obj = fixture.process().create_dyobj();
+  auto obj2 = fixture.process().create_dyobj();
+
+  put_dummy_attrs(obj, obj2, attr_count - 1);
+  obj->putattr(corevm::dyobj::hash_attr_str(attr_str), obj2);
+
+  fixture.process().push_stack(obj);
+
+  auto frame = &fixture.process().top_frame();
+  auto invk_ctx = &fixture.process().top_invocation_ctx();
+
+  while (state.KeepRunning())
+  {
+    fixture.process().push_stack(obj2);
+
+    corevm::runtime::instr_handler_setattr(
+      instr, fixture.process(), &frame, &invk_ctx);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+static
+void BenchmarkHASATTR2InstrWithInlineCache(benchmark::State& state,
+  bool cached, size_t attr_count)
+{
+  const std::string attr_str = "hello_world";
+
+  corevm::runtime::Vector vector {
+    corevm::runtime::Instr(corevm::runtime::HASATTR2, 0, 0)
+  };
+
+  InstrBenchmarksFixture fixture(vector);
+
+  const corevm::runtime::DecodedInstr instr = cached ?
+    get_decoded_instr(fixture.process(), 0) :
+    corevm::runtime::DecodedInstr(vector[0]);
+
+  corevm::types::NativeTypeValue type_val( (corevm::types::native_string(attr_str)) );
+
+  auto obj = fixture.process().create_dyobj();
+  auto obj2 = fixture.process().create_dyobj();
+
+  put_dummy_attrs(obj, obj2, attr_count - 1);
+  obj->putattr(corevm::dyobj::hash_attr_str(attr_str), obj2);
+
+  fixture.process().push_stack(obj);
+
+  auto frame = &fixture.process().top_frame();
+  auto invk_ctx = &fixture.process().top_invocation_ctx();
+
+  while (state.KeepRunning())
+  {
+    frame->push_eval_stack(type_val);
+
+    corevm::runtime::instr_handler_hasattr2(
+      instr, fixture.process(), &frame, &invk_ctx);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+static
+void BenchmarkGETATTR2InstrWithInlineCache(benchmark::State& state,
+  bool cached, size_t attr_count)
+{
+  const std::string attr_str = "hello_world";
+
+  corevm::runtime::Vector vector {
+    corevm::runtime::Instr(corevm::runtime::GETATTR2, 0, 0)
+  };
+
+  InstrBenchmarksFixture fixture(vector);
+
+  const corevm::runtime::DecodedInstr instr = cached ?
+    get_decoded_instr(fixture.process(), 0) :
+    corevm::runtime::DecodedInstr(vector[0]);
+
+  corevm::types::NativeTypeValue type_val( (corevm::types::native_string(attr_str)) );
+
+  auto obj = fixture.process().create_dyobj();
+  auto obj2 = fixture.process().create_dyobj();
+
+  put_dummy_attrs(obj, obj2, attr_count - 1);
+  obj->putattr(corevm::dyobj::hash_attr_str(attr_str), obj2);
+
+  auto frame = &fixture.process().top_frame();
+  auto invk_ctx = &fixture.process().top_invocation_ctx();
+
+  frame->push_eval_stack(type_val);
+
+  while (state.KeepRunning())
+  {
+    fixture.process().push_stack(obj);
+
+    corevm::runtime::instr_handler_getattr2(
+      instr, fixture.process(), &frame, &invk_ctx);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+static const size_t SMALL_OBJECT_ATTR_COUNT = 1;
+static const size_t LARGE_OBJECT_ATTR_COUNT = 16;
+
+// -----------------------------------------------------------------------------
+
+#define DEFINE_INLINE_CACHE_BENCHMARKS(INSTR)                                 \
+  static void Benchmark##INSTR##InstrUncached(benchmark::State& state)        \
+  {                                                                           \
+    Benchmark##INSTR##InstrWithInlineCache(state, false,                      \
+      SMALL_OBJECT_ATTR_COUNT);                                               \
+  }                                                                           \
+  static void Benchmark##INSTR##InstrCached(benchmark::State& state)          \
+  {                                                                           \
+    Benchmark##INSTR##InstrWithInlineCache(state, true,                       \
+      SMALL_OBJECT_ATTR_COUNT);                                               \
+  }                                                                           \
+  static void Benchmark##INSTR##InstrOnLargeObjectUncached(                   \
+    benchmark::State& state)                                                  \
+  {                                                                           \
+    Benchmark##INSTR##InstrWithInlineCache(state, false,                      \
+      LARGE_OBJECT_ATTR_COUNT);                                               \
+  }                                                                           \
+  static void Benchmark##INSTR##InstrOnLargeObjectCached(                     \
+    benchmark::State& state)                                                  \
+  {                                                                           \
+    Benchmark##INSTR##InstrWithInlineCache(state, true,                       \
+      LARGE_OBJECT_ATTR_COUNT);                                               \
+  }
+
+DEFINE_INLINE_CACHE_BENCHMARKS(GETATTR)
+DEFINE_INLINE_CACHE_BENCHMARKS(SETATTR)
+DEFINE_INLINE_CACHE_BENCHMARKS(HASATTR2)
+DEFINE_INLINE_CACHE_BENCHMARKS(GETATTR2)
+
+#undef DEFINE_INLINE_CACHE_BENCHMARKS
+
+// -----------------------------------------------------------------------------
+
+/**
+ * GETVAL2 followed by STRLEN, on an object holding a large string value.
+ */
+static
+void BenchmarkGETVAL2STRLENInstrsOnLargeString(benchmark::State& state)
+{
+  const corevm::runtime::variable_key_t key = 1;
+  corevm::runtime::Instr getval2_instr(0,
+    static_cast<corevm::runtime::instr_oprd_t>(key), 0);
+  corevm::runtime::Instr strlen_instr(0, 0, 0);
+
+  InstrBenchmarksFixture fixture;
+
+  auto obj = fixture.process().create_dyobj();
+  corevm::types::NativeTypeValue type_val =
+    corevm::types::string(1024 * 1024, 'a');
+  obj->set_type_value(fixture.process().insert_type_value(type_val));
+
+  auto frame = &fixture.process().top_frame();
+  auto invk_ctx = &fixture.process().top_invocation_ctx();
+
+  frame->set_visible_var(key, obj);
+
+  while (state.KeepRunning())
+  {
+    corevm::runtime::instr_handler_getval2(getval2_instr, fixture.process(),
+      &frame, &invk_ctx);
+    corevm::runtime::instr_handler_strlen(strlen_instr, fixture.process(),
+      &frame, &invk_ctx);
+    frame->pop_eval_stack();
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Appends to the large array value of an object by running the first
+ * `count` instructions of the specified ones, and pops the element appended
+ * in place right after, so that the array stays the same size.
+ */
+static
+void
+BenchmarkARYAPNDInstrsOnLargeArray(benchmark::State& state,
+  const std::vector<corevm::runtime::DecodedInstr>& instrs, size_t count)
+{
+  InstrBenchmarksFixture fixture;
+
+  auto obj = fixture.process().create_dyobj();
+  corevm::types::NativeTypeValue type_val = corevm::types::array(
+    corevm::types::native_array_base(64 * 1024, 1));
+  obj->set_type_value(fixture.process().insert_type_value(type_val));
+
+  auto frame = &fixture.process().top_frame();
+  auto invk_ctx = &fixture.process().top_invocation_ctx();
+
+  frame->set_visible_var(
+    static_cast<corevm::runtime::variable_key_t>(instrs[0].oprd1), obj);
+
+  while (state.KeepRunning())
+  {
+    frame->push_eval_stack(
+      corevm::types::NativeTypeValue(corevm::types::uint64(2)));
+
+    for (size_t i = 0; i < count; ++i)
+    {
+      corevm::runtime::InstrHandlerMeta::instr_handlers[instrs[i].code](
+        instrs[i], fixture.process(), &frame, &invk_ctx);
+    }
+
+    fixture.process().pop_stack();
+    frame->pop_eval_stack();
+
+    corevm::types::interface_array_pop(
+      fixture.process().get_type_value(&obj->type_value()));
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * GETVAL2, ARYAPND, LDOBJ and SETVAL on an object holding a large array value,
+ * which copies the array on every append.
+ */
+static
+void BenchmarkGETVAL2ARYAPNDInstrsOnLargeArray(benchmark::State& state)
+{
+  const std::vector<corevm::runtime::DecodedInstr> instrs {
+    corevm::runtime::Instr(corevm::runtime::GETVAL2, 1, 0),
+    corevm::runtime::Instr(corevm::runtime::ARYAPND, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::LDOBJ, 1, 0),
+    corevm::runtime::Instr(corevm::runtime::SETVAL, 0, 0),
+  };
+
+  BenchmarkARYAPNDInstrsOnLargeArray(state, instrs, instrs.size());
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * The same sequence as above, fused into GETMUTVAL2, which appends to the
+ * array in place.
+ */
+static
+void BenchmarkGETMUTVAL2ARYAPNDInstrsOnLargeArray(benchmark::State& state)
+{
+  const std::vector<corevm::runtime::DecodedInstr> instrs {
+    corevm::runtime::Instr(corevm::runtime::GETMUTVAL2, 1, 0),
+    corevm::runtime::Instr(corevm::runtime::ARYAPND, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::LDOBJ, 1, 0),
+    corevm::runtime::Instr(corevm::runtime::SETVAL, 0, 0),
+  };
+
+  BenchmarkARYAPNDInstrsOnLargeArray(state, instrs, 1);
+}
+
+// -----------------------------------------------------------------------------
+
 BENCHMARK(BenchmarkLDOBJInstr);
 BENCHMARK(BenchmarkLDOBJ2Instr);
 BENCHMARK(BenchmarkDELOBJInstr);
@@ -881,6 +1228,27 @@ BENCHMARK(BenchmarkCPYREPRInstr);
 BENCHMARK(BenchmarkOBJEQInstr);
 BENCHMARK(BenchmarkOBJNEQInstr);
 
+BENCHMARK(BenchmarkGETVAL2STRLENInstrsOnLargeString);
+BENCHMARK(BenchmarkGETVAL2ARYAPNDInstrsOnLargeArray);
+BENCHMARK(BenchmarkGETMUTVAL2ARYAPNDInstrsOnLargeArray);
+
+BENCHMARK(BenchmarkGETATTRInstrUncached);
+BENCHMARK(BenchmarkGETATTRInstrCached);
+BENCHMARK(BenchmarkGETATTRInstrOnLargeObjectUncached);
+BENCHMARK(BenchmarkGETATTRInstrOnLargeObjectCached);
+BENCHMARK(BenchmarkSETATTRInstrUncached);
+BENCHMARK(BenchmarkSETATTRInstrCached);
+BENCHMARK(BenchmarkSETATTRInstrOnLargeObjectUncached);
+BENCHMARK(BenchmarkSETATTRInstrOnLargeObjectCached);
+BENCHMARK(BenchmarkHASATTR2InstrUncached);
+BENCHMARK(BenchmarkHASATTR2InstrCached);
+BENCHMARK(BenchmarkHASATTR2InstrOnLargeObjectUncached);
+BENCHMARK(BenchmarkHASATTR2InstrOnLargeObjectCached);
+BENCHMARK(BenchmarkGETATTR2InstrUncached);
+BENCHMARK(BenchmarkGETATTR2InstrCached);
+BENCHMARK(BenchmarkGETATTR2InstrOnLargeObjectUncached);
+BENCHMARK(BenchmarkGETATTR2InstrOnLargeObjectCached);
+
 #endif /* #ifdef BUILD_BENCHMARKS_STRICT */
 
 // -----------------------------------------------------------------------------
@@ -23,7 +23,13 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include <benchmark/benchmark.h>
 
 #include "corevm/macros.h"
+#include "runtime/catch_site.h"
+#include "runtime/closure.h"
+#include "runtime/compartment.h"
+#include "runtime/instr.h"
+#include "runtime/loc_info.h"
 #include "runtime/process.h"
+#include "runtime/vector.h"
 #include "types/native_type_value.h"
 
 
@@ -120,11 +126,145 @@ void BenchmarkProcessGetTypeValue(benchmark::State& state)
 
 // -----------------------------------------------------------------------------
 
+/**
+ * Runs a straight-line closure of short instructions through
+ * `Process::run()`, which measures the per-instruction overhead of the
+ * interpreter loop.
+ */
+static
+void BenchmarkProcessRunStraightLineClosure(benchmark::State& state)
+{
+  const size_t instr_count = 1024;
+
+  corevm::runtime::Vector vector;
+  vector.reserve(instr_count);
+
+  vector.push_back(corevm::runtime::Instr(corevm::runtime::UINT32, 0, 0));
+
+  for (size_t i = 1; i < instr_count; ++i)
+  {
+    const auto code = i % 2 ? corevm::runtime::INC : corevm::runtime::POS;
+    vector.push_back(corevm::runtime::Instr(code, 0, 0));
+  }
+
+  corevm::runtime::LocTable locs;
+  corevm::runtime::CatchSiteList catch_sites;
+
+  corevm::runtime::Closure closure(
+    "__main__",
+    0,
+    corevm::runtime::NONESET_CLOSURE_ID,
+    vector,
+    locs,
+    catch_sites);
+
+  corevm::runtime::Compartment compartment("./example.core");
+  corevm::runtime::ClosureTable closure_table { closure };
+  compartment.set_closure_table(std::move(closure_table));
+  compartment.decode_closures();
+
+  corevm::runtime::Process process;
+
+  while (state.KeepRunning())
+  {
+    process.reset();
+    process.insert_compartment(compartment);
+    process.run();
+  }
+
+  state.SetItemsProcessed(
+    state.iterations() * static_cast<int64_t>(instr_count));
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Runs a closure that makes a sequence of calls with a single argument,
+ * boxing a literal into each argument first, through `Process::run()`.
+ * Instruction sequences of this kind are the ones fused by superinstructions
+ * (see `COREVM_USE_SUPERINSTRS`).
+ */
+static
+void BenchmarkProcessRunCallSequence(benchmark::State& state)
+{
+  const size_t call_count = 128;
+
+  const corevm::runtime::variable_key_t func_key = 1;
+  const corevm::runtime::variable_key_t arg_key = 2;
+
+  corevm::runtime::Vector vector {
+    corevm::runtime::Instr(corevm::runtime::NEW, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::SETCTX, 1, 0),
+    corevm::runtime::Instr(corevm::runtime::STOBJ, func_key, 0),
+  };
+
+  for (size_t i = 0; i < call_count; ++i)
+  {
+    const auto value = static_cast<corevm::runtime::instr_oprd_t>(i);
+
+    vector.push_back(corevm::runtime::Instr(corevm::runtime::NEW, 0, 0));
+    vector.push_back(corevm::runtime::Instr(corevm::runtime::INT64, value, 0));
+    vector.push_back(corevm::runtime::Instr(corevm::runtime::SETVAL, 0, 0));
+    vector.push_back(corevm::runtime::Instr(corevm::runtime::STOBJ, arg_key, 0));
+    vector.push_back(corevm::runtime::Instr(corevm::runtime::LDOBJ, func_key, 0));
+    vector.push_back(corevm::runtime::Instr(corevm::runtime::PINVK, 0, 0));
+    vector.push_back(corevm::runtime::Instr(corevm::runtime::LDOBJ, arg_key, 0));
+    vector.push_back(corevm::runtime::Instr(corevm::runtime::PUTARG, 0, 0));
+    vector.push_back(corevm::runtime::Instr(corevm::runtime::INVK, 0, 0));
+    vector.push_back(corevm::runtime::Instr(corevm::runtime::POP, 0, 0));
+  }
+
+  corevm::runtime::Vector func_vector {
+    corevm::runtime::Instr(corevm::runtime::GETARG, arg_key, 0),
+    corevm::runtime::Instr(corevm::runtime::RTRN, 0, 0),
+  };
+
+  corevm::runtime::LocTable locs;
+  corevm::runtime::CatchSiteList catch_sites;
+
+  corevm::runtime::Closure closure(
+    "__main__",
+    0,
+    corevm::runtime::NONESET_CLOSURE_ID,
+    vector,
+    locs,
+    catch_sites);
+
+  corevm::runtime::Closure func_closure(
+    "func",
+    1,
+    0,
+    func_vector,
+    locs,
+    catch_sites);
+
+  corevm::runtime::Compartment compartment("./example.core");
+  corevm::runtime::ClosureTable closure_table { closure, func_closure };
+  compartment.set_closure_table(std::move(closure_table));
+  compartment.decode_closures();
+
+  corevm::runtime::Process process;
+
+  while (state.KeepRunning())
+  {
+    process.reset();
+    process.insert_compartment(compartment);
+    process.run();
+  }
+
+  state.SetItemsProcessed(state.iterations() *
+    static_cast<int64_t>(vector.size() + call_count * func_vector.size()));
+}
+
+// -----------------------------------------------------------------------------
+
 #if !COREVM_USE_SMALL_ATTRIBUTE_TABLE
 BENCHMARK(BenchmarkProcessCreateDyobj);
 #endif
 BENCHMARK(BenchmarkProcessGetDyobj);
 BENCHMARK(BenchmarkProcessGetTypeValue);
+BENCHMARK(BenchmarkProcessRunStraightLineClosure);
+BENCHMARK(BenchmarkProcessRunCallSequence);
 #ifdef BUILD_BENCHMARKS_STRICT
 BENCHMARK(BenchmarkProcessPushStack);
 BENCHMARK(BenchmarkProcessInsertTypeValue);
@@ -22,6 +22,8 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 *******************************************************************************/
 #include <benchmark/benchmark.h>
 
+#include "types/native_type_value.h"
+#include "types/types.h"
 #include "types/variant/static_visitor.h"
 #include "types/variant/variant.h"
 
@@ -295,6 +297,58 @@ static void BenchmarkVariantBinaryVisitor_coreVM(benchmark::State& state)
 
 // -----------------------------------------------------------------------------
 
+struct sizeof_visitor : public corevm::types::variant::static_visitor<size_t>
+{
+  template <typename T>
+  size_t operator()(const T&) const
+  {
+    return sizeof(T);
+  }
+
+  template <typename T, typename T2>
+  size_t operator()(const T&, const T2&) const
+  {
+    return sizeof(T) + sizeof(T2);
+  }
+};
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Visitation on each of the types of `NativeTypeValue`, which should cost
+ * the same regardless of the position of the type in the type list.
+ */
+template <typename T>
+static void BenchmarkNativeTypeValueUnaryVisitor(benchmark::State& state)
+{
+  corevm::types::NativeTypeValue v = T();
+
+  size_t res = 0;
+
+  while (state.KeepRunning())
+  {
+    res += corevm::types::variant::apply_visitor(sizeof_visitor(), v);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+static void BenchmarkNativeTypeValueBinaryVisitor(benchmark::State& state)
+{
+  corevm::types::NativeTypeValue v1 = T();
+  corevm::types::NativeTypeValue v2 = T();
+
+  size_t res = 0;
+
+  while (state.KeepRunning())
+  {
+    res += corevm::types::variant::apply_visitor(sizeof_visitor(), v1, v2);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
 BENCHMARK_TEMPLATE(BenchmarkVariantEmptyInitialization, BoostVariant);
 BENCHMARK_TEMPLATE(BenchmarkVariantEmptyInitialization, CorevmVariant);
 
@@ -329,3 +383,35 @@ BENCHMARK(BenchmarkVariantBinaryVisitor_Boost);
 BENCHMARK(BenchmarkVariantBinaryVisitor_coreVM);
 
 // -----------------------------------------------------------------------------
+
+BENCHMARK_TEMPLATE(BenchmarkNativeTypeValueUnaryVisitor, corevm::types::int8);
+BENCHMARK_TEMPLATE(BenchmarkNativeTypeValueUnaryVisitor, corevm::types::uint8);
+BENCHMARK_TEMPLATE(BenchmarkNativeTypeValueUnaryVisitor, corevm::types::int16);
+BENCHMARK_TEMPLATE(BenchmarkNativeTypeValueUnaryVisitor, corevm::types::uint16);
+BENCHMARK_TEMPLATE(BenchmarkNativeTypeValueUnaryVisitor, corevm::types::int32);
+BENCHMARK_TEMPLATE(BenchmarkNativeTypeValueUnaryVisitor, corevm::types::uint32);
+BENCHMARK_TEMPLATE(BenchmarkNativeTypeValueUnaryVisitor, corevm::types::int64);
+BENCHMARK_TEMPLATE(BenchmarkNativeTypeValueUnaryVisitor, corevm::types::uint64);
+BENCHMARK_TEMPLATE(BenchmarkNativeTypeValueUnaryVisitor, corevm::types::boolean);
+BENCHMARK_TEMPLATE(BenchmarkNativeTypeValueUnaryVisitor, corevm::types::decimal);
+BENCHMARK_TEMPLATE(BenchmarkNativeTypeValueUnaryVisitor, corevm::types::decimal2);
+BENCHMARK_TEMPLATE(BenchmarkNativeTypeValueUnaryVisitor, corevm::types::native_string);
+BENCHMARK_TEMPLATE(BenchmarkNativeTypeValueUnaryVisitor, corevm::types::native_array);
+BENCHMARK_TEMPLATE(BenchmarkNativeTypeValueUnaryVisitor, corevm::types::native_map);
+
+BENCHMARK_TEMPLATE(BenchmarkNativeTypeValueBinaryVisitor, corevm::types::int8);
+BENCHMARK_TEMPLATE(BenchmarkNativeTypeValueBinaryVisitor, corevm::types::uint8);
+BENCHMARK_TEMPLATE(BenchmarkNativeTypeValueBinaryVisitor, corevm::types::int16);
+BENCHMARK_TEMPLATE(BenchmarkNativeTypeValueBinaryVisitor, corevm::types::uint16);
+BENCHMARK_TEMPLATE(BenchmarkNativeTypeValueBinaryVisitor, corevm::types::int32);
+BENCHMARK_TEMPLATE(BenchmarkNativeTypeValueBinaryVisitor, corevm::types::uint32);
+BENCHMARK_TEMPLATE(BenchmarkNativeTypeValueBinaryVisitor, corevm::types::int64);
+BENCHMARK_TEMPLATE(BenchmarkNativeTypeValueBinaryVisitor, corevm::types::uint64);
+BENCHMARK_TEMPLATE(BenchmarkNativeTypeValueBinaryVisitor, corevm::types::boolean);
+BENCHMARK_TEMPLATE(BenchmarkNativeTypeValueBinaryVisitor, corevm::types::decimal);
+BENCHMARK_TEMPLATE(BenchmarkNativeTypeValueBinaryVisitor, corevm::types::decimal2);
+BENCHMARK_TEMPLATE(BenchmarkNativeTypeValueBinaryVisitor, corevm::types::native_string);
+BENCHMARK_TEMPLATE(BenchmarkNativeTypeValueBinaryVisitor, corevm::types::native_array);
+BENCHMARK_TEMPLATE(BenchmarkNativeTypeValueBinaryVisitor, corevm::types::native_map);
+
+// -----------------------------------------------------------------------------
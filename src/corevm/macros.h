@@ -98,4 +98,117 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 // -----------------------------------------------------------------------------
 
+/**
+ * Dispatch instructions in `Process::run()` through a direct-threaded loop
+ * (computed-goto labels) instead of the table-driven `while` loop.
+ * Relies on the "labels as values" extension of GCC and Clang, and is turned
+ * off otherwise.
+ */
+#ifndef COREVM_USE_THREADED_DISPATCH
+  #if defined(__GNUC__) || defined(__clang__)
+    #define COREVM_USE_THREADED_DISPATCH 1
+  #else
+    #define COREVM_USE_THREADED_DISPATCH 0
+  #endif
+#endif
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Fuse common instruction sequences into superinstructions when decoding
+ * closures (see `Compartment::get_decoded_vector()`).
+ */
+#ifndef COREVM_USE_SUPERINSTRS
+  #define COREVM_USE_SUPERINSTRS 1
+#endif
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Quicken arithmetic and comparison instructions in place into forms
+ * specialized for the types of operands they see.
+ */
+#ifndef COREVM_USE_QUICKENED_INSTRS
+  #define COREVM_USE_QUICKENED_INSTRS 1
+#endif
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Keep strings, arrays and maps in native type values behind pointers, so
+ * that native type values take 16 bytes rather than the size of the
+ * largest native type. The values are shared between copies, and copied on
+ * write.
+ */
+#ifndef COREVM_USE_COMPACT_NATIVE_TYPE_VALUE
+  #define COREVM_USE_COMPACT_NATIVE_TYPE_VALUE 1
+#endif
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Back native maps with a flat hash map of open addressing (see
+ * `types::flat_hash_map`) instead of `std::unordered_map`.
+ */
+#ifndef COREVM_USE_FLAT_NATIVE_MAP
+  #define COREVM_USE_FLAT_NATIVE_MAP 1
+#endif
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Let large native strings switch into builder mode as they are copied or
+ * inserted into, in which their contents are kept in a rope (see
+ * `types::native_string_rope`) until they are read.
+ */
+#ifndef COREVM_USE_NATIVE_STRING_BUILDER
+  #define COREVM_USE_NATIVE_STRING_BUILDER 1
+#endif
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Run bulk operations on native arrays through SIMD kernels selected by the
+ * features of the CPU at runtime (see `types/native_array_kernels.h`),
+ * instead of their scalar forms.
+ */
+#ifndef COREVM_USE_SIMD_ARRAY_KERNELS
+  #define COREVM_USE_SIMD_ARRAY_KERNELS 1
+#endif
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Run substring searches on native strings through SIMD kernels selected by
+ * the features of the CPU at runtime (see `types/native_string_kernels.h`),
+ * instead of their scalar forms.
+ */
+#ifndef COREVM_USE_SIMD_STRING_KERNELS
+  #define COREVM_USE_SIMD_STRING_KERNELS 1
+#endif
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Run element-wise arithmetic and reductions on native vectors through SIMD
+ * kernels selected by the features of the CPU at runtime (see
+ * `types/native_vector_kernels.h`), instead of their scalar forms.
+ */
+#ifndef COREVM_USE_SIMD_VECTOR_KERNELS
+  #define COREVM_USE_SIMD_VECTOR_KERNELS 1
+#endif
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Let large substrings of native strings and slices of native arrays share
+ * the contents they are taken from, which are only copied as they get
+ * mutated or read as a whole.
+ */
+#ifndef COREVM_USE_NATIVE_SLICE_VIEWS
+  #define COREVM_USE_NATIVE_SLICE_VIEWS 1
+#endif
+
+// -----------------------------------------------------------------------------
+
 #endif /* COREVM_MACROS_H_ */
@@ -27,6 +27,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "dyobj/common.h"
 #include "dyobj/flags.h"
 #include "dyobj/errors.h"
+#include "dyobj/shape.h"
 #include "runtime/closure_ctx.h"
 #include "types/fwd.h"
 
@@ -40,6 +41,8 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #endif // COREVM_USE_SMALL_ATTRIBUTE_TABLE
 
 #include <algorithm>
+#include <cstddef>
+#include <iterator>
 
 
 namespace corevm {
@@ -54,14 +57,79 @@ public:
 
   typedef std::pair<attr_key_type, dyobj_ptr> attr_key_value_pair;
 
+  /**
+   * Attribute values, in the slot order of the shape of the object.
+   */
 #if COREVM_USE_SMALL_ATTRIBUTE_TABLE
-  typedef llvm::SmallVector<attr_key_value_pair, 20> attr_map_type;
+  typedef llvm::SmallVector<dyobj_ptr, 4> attr_value_array_type;
 #else
-  typedef std::vector<attr_key_value_pair> attr_map_type;
+  typedef std::vector<dyobj_ptr> attr_value_array_type;
 #endif
 
-  typedef typename attr_map_type::iterator iterator;
-  typedef typename attr_map_type::const_iterator const_iterator;
+  /**
+   * Iterates over the attributes of an object as key-value pairs, in slot
+   * order.
+   */
+  class attr_iterator
+  {
+  public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef attr_key_value_pair value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const attr_key_value_pair* pointer;
+    typedef const attr_key_value_pair& reference;
+
+    attr_iterator(const DynamicObject* obj, size_t slot)
+      :
+      m_obj(obj),
+      m_slot(slot),
+      m_pair()
+    {
+    }
+
+    reference operator*() const
+    {
+      m_pair.first = m_obj->m_shape->key_at(m_slot);
+      m_pair.second = m_obj->m_attr_values[m_slot];
+      return m_pair;
+    }
+
+    pointer operator->() const
+    {
+      return &(**this);
+    }
+
+    attr_iterator& operator++()
+    {
+      ++m_slot;
+      return *this;
+    }
+
+    attr_iterator operator++(int)
+    {
+      attr_iterator itr(*this);
+      ++m_slot;
+      return itr;
+    }
+
+    bool operator==(const attr_iterator& rhs) const
+    {
+      return m_obj == rhs.m_obj && m_slot == rhs.m_slot;
+    }
+
+    bool operator!=(const attr_iterator& rhs) const
+    {
+      return !((*this) == rhs);
+    }
+
+  private:
+    const DynamicObject* m_obj;
+    size_t m_slot;
+    mutable attr_key_value_pair m_pair;
+  };
+
+  typedef attr_iterator iterator;
+  typedef attr_iterator const_iterator;
 
   DynamicObject();
 
@@ -101,7 +169,7 @@ public:
 
   bool hasattr(attr_key_type) const noexcept;
 
-  void putattr(attr_key_type, dyobj_ptr) noexcept;
+  void putattr(attr_key_type, dyobj_ptr);
 
   void delattr(attr_key_type);
 
@@ -109,6 +177,38 @@ public:
 
   bool getattr(attr_key_type, dyobj_ptr*) const;
 
+  /**
+   * Variants of the attribute accessors above that also output the slot of
+   * the attribute they found or stored, which is its position in the
+   * attribute table of the object. Slots stay valid for as long as the
+   * object keeps its shape.
+   */
+  bool hasattr(attr_key_type, size_t*) const noexcept;
+
+  void putattr(attr_key_type, dyobj_ptr, size_t*);
+
+  bool getattr(attr_key_type, dyobj_ptr*, size_t*) const;
+
+  /**
+   * Gets the shape of the object, which changes whenever an attribute is
+   * added or deleted, unless the object is in dictionary mode. The dictionary
+   * shape of an object (see `Shape`) is owned by it, and changed in place.
+   */
+  const Shape* shape() const noexcept;
+
+  /**
+   * Unchecked slot accessors, for callers that have already checked the
+   * shape of the object.
+   *
+   * `add_attr()` adds an attribute given the shape of the object after the
+   * addition, which has to be a direct transition from the current shape.
+   */
+  dyobj_ptr attr_at(size_t) const noexcept;
+
+  void set_attr_at(size_t, dyobj_ptr) noexcept;
+
+  void add_attr(const Shape*, dyobj_ptr);
+
   const runtime::ClosureCtx& closure_ctx() const;
 
   void set_closure_ctx(const runtime::ClosureCtx&);
@@ -123,42 +223,13 @@ public:
 private:
   void check_flag_bit(char) const;
 
-  struct AttributeKeyPred
-  {
-    explicit AttributeKeyPred(attr_key_t key)
-      :
-      m_key(key)
-    {
-    }
-
-    bool operator()(const attr_key_value_pair& pair) const
-    {
-      return m_key == pair.first;
-    }
-
-  private:
-    attr_key_t m_key;
-  };
-
-  struct AttributeValuePred
-  {
-    explicit AttributeValuePred(dyobj_ptr value)
-      :
-      m_value(value)
-    {
-    }
-
-    bool operator()(const attr_key_value_pair& pair) const
-    {
-      return m_value == pair.second;
-    }
+  Shape* dictionary_shape() const;
 
-  private:
-    dyobj_ptr m_value;
-  };
+  void release_dictionary_shape();
 
   flag_t m_flags;
-  attr_map_type m_attrs;
+  const Shape* m_shape;
+  attr_value_array_type m_attr_values;
   DynamicObjectManager m_manager;
   types::NativeTypeValue* m_type_value_ptr;
   runtime::ClosureCtx m_closure_ctx;
@@ -168,9 +239,6 @@ private:
 
 const int COREVM_DYNAMIC_OBJECT_DEFAULT_FLAG_VALUE = 0;
 
-// -----------------------------------------------------------------------------
-
-static const size_t COREVM_DYNAMIC_OBJECT_DEFAULT_ATTRIBUTE_COUNT = 10u;
 
 // -----------------------------------------------------------------------------
 
@@ -178,13 +246,13 @@ template<class DynamicObjectManager>
 DynamicObject<DynamicObjectManager>::DynamicObject()
   :
   m_flags(COREVM_DYNAMIC_OBJECT_DEFAULT_FLAG_VALUE),
-  m_attrs(),
+  m_shape(Shape::root()),
+  m_attr_values(),
   m_manager(),
   m_type_value_ptr(NULL),
   m_closure_ctx(runtime::ClosureCtx(
     runtime::NONESET_COMPARTMENT_ID, runtime::NONESET_CLOSURE_ID))
 {
-  m_attrs.reserve(COREVM_DYNAMIC_OBJECT_DEFAULT_ATTRIBUTE_COUNT);
 }
 
 // -----------------------------------------------------------------------------
@@ -192,7 +260,7 @@ DynamicObject<DynamicObjectManager>::DynamicObject()
 template<class DynamicObjectManager>
 DynamicObject<DynamicObjectManager>::~DynamicObject()
 {
-  // Do nothing here.
+  release_dictionary_shape();
 }
 
 // -----------------------------------------------------------------------------
@@ -221,7 +289,7 @@ template<class DynamicObjectManager>
 typename DynamicObject<DynamicObjectManager>::iterator
 DynamicObject<DynamicObjectManager>::begin() noexcept
 {
-  return m_attrs.begin();
+  return iterator(this, 0);
 }
 
 // -----------------------------------------------------------------------------
@@ -230,7 +298,7 @@ template<class DynamicObjectManager>
 typename DynamicObject<DynamicObjectManager>::iterator
 DynamicObject<DynamicObjectManager>::end() noexcept
 {
-  return m_attrs.end();
+  return iterator(this, m_attr_values.size());
 }
 
 // -----------------------------------------------------------------------------
@@ -239,7 +307,7 @@ template<class DynamicObjectManager>
 typename DynamicObject<DynamicObjectManager>::const_iterator
 DynamicObject<DynamicObjectManager>::cbegin() const noexcept
 {
-  return m_attrs.begin();
+  return const_iterator(this, 0);
 }
 
 // -----------------------------------------------------------------------------
@@ -248,7 +316,7 @@ template<class DynamicObjectManager>
 typename DynamicObject<DynamicObjectManager>::const_iterator
 DynamicObject<DynamicObjectManager>::cend() const noexcept
 {
-  return m_attrs.end();
+  return const_iterator(this, m_attr_values.size());
 }
 
 // -----------------------------------------------------------------------------
@@ -332,6 +400,33 @@ DynamicObject<DynamicObjectManager>::check_flag_bit(char bit) const
 
 // -----------------------------------------------------------------------------
 
+template<class DynamicObjectManager>
+Shape*
+DynamicObject<DynamicObjectManager>::dictionary_shape() const
+{
+#if __DEBUG__
+  ASSERT(m_shape->is_dictionary());
+#endif
+
+  // Dictionary shapes are owned by the objects that have them.
+  return const_cast<Shape*>(m_shape);
+}
+
+// -----------------------------------------------------------------------------
+
+template<class DynamicObjectManager>
+void
+DynamicObject<DynamicObjectManager>::release_dictionary_shape()
+{
+  if (m_shape->is_dictionary())
+  {
+    delete m_shape;
+    m_shape = Shape::root();
+  }
+}
+
+// -----------------------------------------------------------------------------
+
 template<class DynamicObjectManager>
 bool
 DynamicObject<DynamicObjectManager>::get_flag(char bit) const
@@ -378,7 +473,7 @@ template<typename DynamicObjectManager>
 size_t
 DynamicObject<DynamicObjectManager>::attr_count() const
 {
-  return m_attrs.size();
+  return m_attr_values.size();
 }
 
 // -----------------------------------------------------------------------------
@@ -388,8 +483,8 @@ bool
 DynamicObject<DynamicObjectManager>::hasattr(
   DynamicObject<DynamicObjectManager>::attr_key_type attr_key) const noexcept
 {
-  auto itr = std::find_if(m_attrs.begin(), m_attrs.end(), AttributeKeyPred(attr_key));
-  return itr != m_attrs.end();
+  size_t slot = 0;
+  return m_shape->find(attr_key, &slot);
 }
 
 // -----------------------------------------------------------------------------
@@ -399,12 +494,22 @@ void
 DynamicObject<DynamicObjectManager>::delattr(
   DynamicObject<DynamicObjectManager>::attr_key_type attr_key)
 {
-  auto itr = std::find_if(m_attrs.begin(), m_attrs.end(), AttributeKeyPred(attr_key));
-  if (itr == m_attrs.end())
+  size_t slot = 0;
+  if (!m_shape->find(attr_key, &slot))
   {
     THROW(ObjectAttributeNotFoundError(attr_key, id()));
   }
-  m_attrs.erase(itr);
+  m_attr_values.erase(
+    m_attr_values.begin() + static_cast<std::ptrdiff_t>(slot));
+
+  if (m_shape->is_dictionary())
+  {
+    dictionary_shape()->remove_in_place(attr_key);
+  }
+  else
+  {
+    m_shape = m_shape->remove(attr_key);
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -433,17 +538,31 @@ DynamicObject<DynamicObjectManager>::getattr(
   DynamicObject<DynamicObjectManager>::attr_key_type attr_key,
   dyobj_ptr* attr_ptr) const
 {
-  auto itr = std::find_if(m_attrs.begin(), m_attrs.end(),
-    AttributeKeyPred(attr_key));
+  size_t slot = 0;
+  return getattr(attr_key, attr_ptr, &slot);
+}
 
-  bool res = itr != m_attrs.end();
+// -----------------------------------------------------------------------------
 
-  if (res)
-  {
-    *attr_ptr = itr->second;
-  }
+template<class DynamicObjectManager>
+void
+DynamicObject<DynamicObjectManager>::putattr(
+  DynamicObject<DynamicObjectManager>::attr_key_type attr_key,
+  DynamicObject<DynamicObjectManager>::dyobj_ptr obj_ptr)
+{
+  size_t slot = 0;
+  putattr(attr_key, obj_ptr, &slot);
+}
 
-  return res;
+// -----------------------------------------------------------------------------
+
+template<class DynamicObjectManager>
+bool
+DynamicObject<DynamicObjectManager>::hasattr(
+  DynamicObject<DynamicObjectManager>::attr_key_type attr_key,
+  size_t* slot) const noexcept
+{
+  return m_shape->find(attr_key, slot);
 }
 
 // -----------------------------------------------------------------------------
@@ -452,19 +571,94 @@ template<class DynamicObjectManager>
 void
 DynamicObject<DynamicObjectManager>::putattr(
   DynamicObject<DynamicObjectManager>::attr_key_type attr_key,
-  DynamicObject<DynamicObjectManager>::dyobj_ptr obj_ptr) noexcept
+  DynamicObject<DynamicObjectManager>::dyobj_ptr obj_ptr,
+  size_t* slot)
 {
-  auto itr = std::find_if(m_attrs.begin(), m_attrs.end(),
-    AttributeKeyPred(attr_key));
-
-  if (itr == m_attrs.end())
+  if (m_shape->find(attr_key, slot))
   {
-    m_attrs.push_back(std::make_pair(attr_key, obj_ptr));
+    m_attr_values[*slot] = obj_ptr;
   }
   else
   {
-    (*itr).second = obj_ptr;
+    *slot = m_attr_values.size();
+
+    if (!m_shape->is_dictionary() &&
+        m_attr_values.size() + 1 < Shape::DICTIONARY_MODE_MIN_SIZE)
+    {
+      add_attr(m_shape->add(attr_key), obj_ptr);
+      return;
+    }
+
+    if (!m_shape->is_dictionary())
+    {
+      m_shape = Shape::create_dictionary(m_shape);
+    }
+
+    m_attr_values.reserve(m_attr_values.size() + 1);
+    dictionary_shape()->add_in_place(attr_key);
+    m_attr_values.push_back(obj_ptr);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+template<class DynamicObjectManager>
+bool
+DynamicObject<DynamicObjectManager>::getattr(
+  DynamicObject<DynamicObjectManager>::attr_key_type attr_key,
+  dyobj_ptr* attr_ptr, size_t* slot) const
+{
+  bool res = m_shape->find(attr_key, slot);
+
+  if (res)
+  {
+    *attr_ptr = m_attr_values[*slot];
   }
+
+  return res;
+}
+
+// -----------------------------------------------------------------------------
+
+template<class DynamicObjectManager>
+const Shape*
+DynamicObject<DynamicObjectManager>::shape() const noexcept
+{
+  return m_shape;
+}
+
+// -----------------------------------------------------------------------------
+
+template<class DynamicObjectManager>
+typename DynamicObject<DynamicObjectManager>::dyobj_ptr
+DynamicObject<DynamicObjectManager>::attr_at(size_t slot) const noexcept
+{
+  return m_attr_values[slot];
+}
+
+// -----------------------------------------------------------------------------
+
+template<class DynamicObjectManager>
+void
+DynamicObject<DynamicObjectManager>::set_attr_at(size_t slot,
+  DynamicObject<DynamicObjectManager>::dyobj_ptr obj_ptr) noexcept
+{
+  m_attr_values[slot] = obj_ptr;
+}
+
+// -----------------------------------------------------------------------------
+
+template<class DynamicObjectManager>
+void
+DynamicObject<DynamicObjectManager>::add_attr(const Shape* shape,
+  DynamicObject<DynamicObjectManager>::dyobj_ptr obj_ptr)
+{
+#if __DEBUG__
+  ASSERT(shape->parent() == m_shape);
+#endif
+
+  m_attr_values.push_back(obj_ptr);
+  m_shape = shape;
 }
 
 // -----------------------------------------------------------------------------
@@ -492,7 +686,8 @@ template<class DynamicObjectManager>
 bool
 DynamicObject<DynamicObjectManager>::has_ref(dyobj_ptr ref_ptr) const noexcept
 {
-  return std::find_if(cbegin(), cend(), AttributeValuePred(ref_ptr)) != cend();
+  return std::find(m_attr_values.begin(), m_attr_values.end(), ref_ptr) !=
+    m_attr_values.end();
 }
 
 // -----------------------------------------------------------------------------
@@ -502,14 +697,10 @@ template<typename Function>
 void
 DynamicObject<DynamicObjectManager>::iterate(Function func) noexcept
 {
-  std::for_each(begin(), end(),
-    [&func](DynamicObject<DynamicObjectManager>::attr_key_value_pair& pair) {
-      func(
-        static_cast<DynamicObject<DynamicObjectManager>::attr_key_type>(pair.first),
-        static_cast<DynamicObject<DynamicObjectManager>::dyobj_ptr>(pair.second)
-      );
-    }
-  );
+  for (size_t slot = 0; slot < m_attr_values.size(); ++slot)
+  {
+    func(m_shape->key_at(slot), m_attr_values[slot]);
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -521,7 +712,14 @@ DynamicObject<DynamicObjectManager>::copy_from(
 {
   // NOTE: Need to be careful about what fields are being copied here.
   m_flags = src.m_flags;
-  m_attrs = src.m_attrs;
+
+  const Shape* shape = src.m_shape->is_dictionary() ?
+    Shape::create_dictionary(src.m_shape) : src.m_shape;
+
+  release_dictionary_shape();
+  m_shape = shape;
+
+  m_attr_values = src.m_attr_values;
   m_closure_ctx = src.m_closure_ctx;
 }
 
@@ -0,0 +1,237 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2016 Yanzheng Li
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#include "shape.h"
+
+#include "corevm/macros.h"
+
+
+namespace corevm {
+namespace dyobj {
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Key tables with at least this many keys get a key to slot index, instead
+ * of being scanned linearly.
+ */
+static const size_t KEY_TABLE_INDEX_THRESHOLD = 16;
+
+// -----------------------------------------------------------------------------
+
+void
+Shape::KeyTable::append(attr_key_t attr_key)
+{
+  keys.push_back(attr_key);
+
+  if (!index.empty())
+  {
+    index[attr_key] = keys.size() - 1;
+  }
+  else if (keys.size() >= KEY_TABLE_INDEX_THRESHOLD)
+  {
+    build_index();
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+void
+Shape::KeyTable::build_index()
+{
+  index.clear();
+
+  if (keys.size() < KEY_TABLE_INDEX_THRESHOLD)
+  {
+    return;
+  }
+
+  index.reserve(keys.size());
+
+  for (size_t i = 0; i < keys.size(); ++i)
+  {
+    index[keys[i]] = i;
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+/* static */
+const Shape*
+Shape::root()
+{
+  static const Shape root_shape(
+    nullptr, std::make_shared<KeyTable>(), 0, false);
+
+  return &root_shape;
+}
+
+// -----------------------------------------------------------------------------
+
+/* static */
+Shape*
+Shape::create_dictionary(const Shape* shape)
+{
+  std::shared_ptr<KeyTable> key_table = std::make_shared<KeyTable>();
+
+  key_table->keys.assign(shape->m_key_table->keys.begin(),
+    shape->m_key_table->keys.begin() +
+      static_cast<std::ptrdiff_t>(shape->m_attr_count));
+  key_table->build_index();
+
+  return new Shape(nullptr, key_table, shape->m_attr_count, true);
+}
+
+// -----------------------------------------------------------------------------
+
+Shape::Shape(const Shape* parent, const std::shared_ptr<KeyTable>& key_table,
+  size_t attr_count, bool dictionary)
+  :
+  m_parent(parent),
+  m_key_table(key_table),
+  m_attr_count(attr_count),
+  m_dictionary(dictionary),
+  m_transitions()
+{
+}
+
+// -----------------------------------------------------------------------------
+
+Shape::~Shape()
+{
+  // Do nothing here.
+}
+
+// -----------------------------------------------------------------------------
+
+const Shape*
+Shape::add(attr_key_t attr_key) const
+{
+#if __DEBUG__
+  ASSERT(!m_dictionary);
+  size_t slot = 0;
+  ASSERT(!find(attr_key, &slot));
+#endif
+
+  auto itr = m_transitions.find(attr_key);
+
+  if (itr != m_transitions.end())
+  {
+    return itr->second.get();
+  }
+
+  // The first shape to extend this one shares its key table. Later ones
+  // get a copy of the keys of this shape.
+  std::shared_ptr<KeyTable> key_table = m_key_table;
+
+  if (key_table->keys.size() != m_attr_count)
+  {
+    key_table = std::make_shared<KeyTable>();
+    key_table->keys.assign(m_key_table->keys.begin(),
+      m_key_table->keys.begin() + static_cast<std::ptrdiff_t>(m_attr_count));
+    key_table->build_index();
+  }
+
+  key_table->append(attr_key);
+
+  Shape* shape = new Shape(this, key_table, m_attr_count + 1, false);
+  m_transitions[attr_key].reset(shape);
+
+  return shape;
+}
+
+// -----------------------------------------------------------------------------
+
+const Shape*
+Shape::remove(attr_key_t attr_key) const
+{
+#if __DEBUG__
+  ASSERT(!m_dictionary);
+#endif
+
+  // Replay the transitions from the root, skipping the removed attribute, so
+  // that objects left with the same attributes end up sharing shapes.
+  const Shape* shape = root();
+
+  for (size_t i = 0; i < m_attr_count; ++i)
+  {
+    const attr_key_t key = key_at(i);
+
+    if (key != attr_key)
+    {
+      shape = shape->add(key);
+    }
+  }
+
+  return shape;
+}
+
+// -----------------------------------------------------------------------------
+
+void
+Shape::add_in_place(attr_key_t attr_key)
+{
+#if __DEBUG__
+  ASSERT(m_dictionary);
+  size_t slot = 0;
+  ASSERT(!find(attr_key, &slot));
+#endif
+
+  m_key_table->append(attr_key);
+  ++m_attr_count;
+}
+
+// -----------------------------------------------------------------------------
+
+void
+Shape::remove_in_place(attr_key_t attr_key)
+{
+#if __DEBUG__
+  ASSERT(m_dictionary);
+#endif
+
+  size_t slot = 0;
+
+  if (!find(attr_key, &slot))
+  {
+    return;
+  }
+
+  std::vector<attr_key_t>& keys = m_key_table->keys;
+  keys.erase(keys.begin() + static_cast<std::ptrdiff_t>(slot));
+  --m_attr_count;
+
+  m_key_table->build_index();
+}
+
+// -----------------------------------------------------------------------------
+
+size_t
+Shape::transition_count() const
+{
+  return m_transitions.size();
+}
+
+// -----------------------------------------------------------------------------
+
+} /* end namespace dyobj */
+} /* end namespace corevm */
@@ -0,0 +1,211 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2016 Yanzheng Li
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#ifndef COREVM_DYOBJ_SHAPE_H_
+#define COREVM_DYOBJ_SHAPE_H_
+
+#include "common.h"
+
+#include <cstddef>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+
+namespace corevm {
+namespace dyobj {
+
+/**
+ * The shape (hidden class) of dynamic objects, which maps attribute keys to
+ * the slots of their values in objects.
+ *
+ * Shapes form a transition tree rooted at the empty shape. Adding an
+ * attribute to an object moves it to the child shape for that key, so
+ * objects that gain the same attributes in the same order share the same
+ * shape, and only need to store the values of their attributes. Shapes in
+ * the tree are never freed, and are shared by all processes.
+ *
+ * The keys of a shape are kept in a table shared with its ancestors and
+ * the descendants it was extended by first, so a chain of shapes only
+ * stores each of its keys once.
+ *
+ * Objects with `DICTIONARY_MODE_MIN_SIZE` attributes or more get a
+ * dictionary shape of their own instead, which is not part of the tree,
+ * and is changed in place as attributes are added and deleted.
+ *
+ * Shapes are not thread-safe.
+ */
+class Shape
+{
+public:
+  /**
+   * Number of attributes from which objects switch to a dictionary shape.
+   */
+  static const size_t DICTIONARY_MODE_MIN_SIZE = 128;
+
+  /**
+   * Gets the empty shape, which all objects start out with.
+   */
+  static const Shape* root();
+
+  /**
+   * Creates a dictionary shape with the attributes of the specified shape,
+   * which is owned by the caller.
+   */
+  static Shape* create_dictionary(const Shape*);
+
+  Shape(const Shape&) = delete;
+  Shape& operator=(const Shape&) = delete;
+
+  ~Shape();
+
+  size_t attr_count() const;
+
+  attr_key_t key_at(size_t slot) const;
+
+  bool find(attr_key_t, size_t* slot) const;
+
+  const Shape* parent() const;
+
+  bool is_dictionary() const;
+
+  /**
+   * Gets the shape that results from adding the specified attribute, which
+   * must not be in this shape.
+   */
+  const Shape* add(attr_key_t) const;
+
+  /**
+   * Gets the shape that results from removing the specified attribute, which
+   * must be in this shape. The slots of the attributes after it shift down by
+   * one.
+   */
+  const Shape* remove(attr_key_t) const;
+
+  /**
+   * In-place counterparts of `add()` and `remove()`, for dictionary shapes
+   * only.
+   */
+  void add_in_place(attr_key_t);
+
+  void remove_in_place(attr_key_t);
+
+  size_t transition_count() const;
+
+private:
+  /**
+   * Keys in slot order, along with an index of them once there are many.
+   * Shapes only see the first `attr_count()` keys of their table.
+   */
+  struct KeyTable
+  {
+    std::vector<attr_key_t> keys;
+    std::unordered_map<attr_key_t, size_t> index;
+
+    void append(attr_key_t);
+
+    void build_index();
+  };
+
+  Shape(const Shape* parent, const std::shared_ptr<KeyTable>&,
+    size_t attr_count, bool dictionary);
+
+  const Shape* m_parent;
+  std::shared_ptr<KeyTable> m_key_table;
+  size_t m_attr_count;
+  bool m_dictionary;
+
+  mutable std::unordered_map<attr_key_t, std::unique_ptr<Shape>> m_transitions;
+};
+
+// -----------------------------------------------------------------------------
+
+inline size_t
+Shape::attr_count() const
+{
+  return m_attr_count;
+}
+
+// -----------------------------------------------------------------------------
+
+inline attr_key_t
+Shape::key_at(size_t slot) const
+{
+  return m_key_table->keys[slot];
+}
+
+// -----------------------------------------------------------------------------
+
+inline bool
+Shape::find(attr_key_t attr_key, size_t* slot) const
+{
+  const KeyTable& table = *m_key_table;
+
+  if (table.index.empty())
+  {
+    for (size_t i = 0; i < m_attr_count; ++i)
+    {
+      if (table.keys[i] == attr_key)
+      {
+        *slot = i;
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  // The index covers the keys of the shapes extending this one as well.
+  auto itr = table.index.find(attr_key);
+
+  if (itr == table.index.end() || itr->second >= m_attr_count)
+  {
+    return false;
+  }
+
+  *slot = itr->second;
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+
+inline const Shape*
+Shape::parent() const
+{
+  return m_parent;
+}
+
+// -----------------------------------------------------------------------------
+
+inline bool
+Shape::is_dictionary() const
+{
+  return m_dictionary;
+}
+
+// -----------------------------------------------------------------------------
+
+} /* end namespace dyobj */
+} /* end namespace corevm */
+
+
+#endif /* COREVM_DYOBJ_SHAPE_H_ */
@@ -65,6 +65,9 @@ BinaryBytecodeLoader::load(const std::string& path, runtime::Process& process)
   // Load closures.
   compartment.set_closure_table(std::move(structured_bytecode.__MAIN__));
 
+  // Decode closures.
+  compartment.decode_closures();
+
   // Insert compartment.
   process.insert_compartment(std::move(compartment));
 }
@@ -23,8 +23,11 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "compartment.h"
 
 #include "corevm/macros.h"
+#include "dyobj/util.h"
 
 #include <algorithm>
+#include <cstdint>
+#include <limits>
 #include <ostream>
 
 
@@ -41,6 +44,56 @@ Compartment::Compartment(const std::string& path)
 
 // -----------------------------------------------------------------------------
 
+Compartment::Compartment(const Compartment& other)
+  :
+  m_path(other.m_path),
+  m_str_literal_table(other.m_str_literal_table),
+  m_interned_str_literal_table(other.m_interned_str_literal_table),
+  m_attr_key_table(other.m_attr_key_table),
+  m_fpt_literal_table(other.m_fpt_literal_table),
+  m_closure_table(other.m_closure_table),
+  m_decoded_vector_table(other.m_decoded_vector_table),
+  m_attr_cache_table(other.m_attr_cache_table),
+  m_variable_layout_table(other.m_variable_layout_table),
+  m_eval_stack_depth_table(other.m_eval_stack_depth_table),
+  m_exc_tables(other.m_exc_tables)
+{
+  // Rebase resolved string literals onto the copied literal table.
+  for (auto& decoded_vector : m_decoded_vector_table)
+  {
+    for (auto& decoded_instr : decoded_vector)
+    {
+      if (decoded_instr.flags & DecodedInstr::FLAG_STR_LITERAL)
+      {
+        const auto key = static_cast<size_t>(decoded_instr.str_literal -
+          other.m_interned_str_literal_table.data());
+
+        decoded_instr.str_literal = &m_interned_str_literal_table[key];
+      }
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+Compartment::Compartment(Compartment&& other)
+  :
+  m_path(other.m_path),
+  m_str_literal_table(std::move(other.m_str_literal_table)),
+  m_interned_str_literal_table(std::move(other.m_interned_str_literal_table)),
+  m_attr_key_table(std::move(other.m_attr_key_table)),
+  m_fpt_literal_table(std::move(other.m_fpt_literal_table)),
+  m_closure_table(std::move(other.m_closure_table)),
+  m_decoded_vector_table(std::move(other.m_decoded_vector_table)),
+  m_attr_cache_table(std::move(other.m_attr_cache_table)),
+  m_variable_layout_table(std::move(other.m_variable_layout_table)),
+  m_eval_stack_depth_table(std::move(other.m_eval_stack_depth_table)),
+  m_exc_tables(std::move(other.m_exc_tables))
+{
+}
+
+// -----------------------------------------------------------------------------
+
 const std::string&
 Compartment::path() const
 {
@@ -53,6 +106,9 @@ void
 Compartment::set_string_literal_table(const StringLiteralTable& table)
 {
   m_str_literal_table = table;
+  init_interned_str_literal_table();
+  init_attr_key_table();
+  clear_decoded_closures();
 }
 
 // -----------------------------------------------------------------------------
@@ -61,6 +117,9 @@ void
 Compartment::set_string_literal_table(StringLiteralTable&& table)
 {
   m_str_literal_table = std::move(table);
+  init_interned_str_literal_table();
+  init_attr_key_table();
+  clear_decoded_closures();
 }
 
 // -----------------------------------------------------------------------------
@@ -69,6 +128,7 @@ void
 Compartment::set_fpt_literal_table(const FptLiteralTable& table)
 {
   m_fpt_literal_table = table;
+  clear_decoded_closures();
 }
 
 // -----------------------------------------------------------------------------
@@ -77,6 +137,7 @@ void
 Compartment::set_fpt_literal_table(FptLiteralTable&& table)
 {
   m_fpt_literal_table = std::move(table);
+  clear_decoded_closures();
 }
 
 // -----------------------------------------------------------------------------
@@ -119,6 +180,61 @@ Compartment::get_string_literal(encoding_key_t key, const char** str) const
 
 // -----------------------------------------------------------------------------
 
+size_t
+Compartment::string_literal_count() const
+{
+  return m_str_literal_table.size();
+}
+
+// -----------------------------------------------------------------------------
+
+dyobj::attr_key_t
+Compartment::get_attr_key(encoding_key_t key) const
+{
+  if (key < m_attr_key_table.size())
+  {
+    return m_attr_key_table[key];
+  }
+
+  // Same key as the one of an empty attribute name, as unknown string
+  // literals are treated as empty strings.
+  return dyobj::hash_attr_str(std::string());
+}
+
+// -----------------------------------------------------------------------------
+
+void
+Compartment::init_attr_key_table()
+{
+  m_attr_key_table.clear();
+  m_attr_key_table.reserve(m_str_literal_table.size());
+
+  for (const auto& str : m_str_literal_table)
+  {
+    m_attr_key_table.push_back(dyobj::hash_attr_str(str));
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * String literals, attribute names included, are interned as they are
+ * loaded, so that the strings pushed by `str` instructions share their atoms.
+ */
+void
+Compartment::init_interned_str_literal_table()
+{
+  m_interned_str_literal_table.clear();
+  m_interned_str_literal_table.reserve(m_str_literal_table.size());
+
+  for (const auto& str : m_str_literal_table)
+  {
+    m_interned_str_literal_table.push_back(types::native_string::intern(str));
+  }
+}
+
+// -----------------------------------------------------------------------------
+
 double
 Compartment::get_fpt_literal(encoding_key_t key) const
 {
@@ -144,6 +260,7 @@ void
 Compartment::set_closure_table(const ClosureTable&& closure_table)
 {
   m_closure_table = closure_table;
+  clear_decoded_closures();
 }
 
 // -----------------------------------------------------------------------------
@@ -193,5 +310,477 @@ Compartment::get_starting_closure(Closure** closure)
 
 // -----------------------------------------------------------------------------
 
+const DecodedVector&
+Compartment::get_decoded_vector(const Closure* closure)
+{
+#if __DEBUG__
+  ASSERT(closure);
+#endif
+
+  const Closure* begin = m_closure_table.data();
+  const Closure* end = begin + m_closure_table.size();
+
+  if (closure < begin || closure >= end)
+  {
+    THROW(ClosureNotFoundError(closure->id));
+  }
+
+  if (m_decoded_vector_table.size() != m_closure_table.size())
+  {
+    m_decoded_vector_table.resize(m_closure_table.size());
+  }
+
+  if (m_variable_layout_table.size() != m_closure_table.size())
+  {
+    init_variable_layouts();
+  }
+
+  DecodedVector& decoded_vector =
+    m_decoded_vector_table[static_cast<size_t>(closure - begin)];
+
+  if (decoded_vector.size() != closure->vector.size())
+  {
+    decode_closure(*closure, &decoded_vector);
+  }
+
+  return decoded_vector;
+}
+
+// -----------------------------------------------------------------------------
+
+void
+Compartment::decode_closures()
+{
+  clear_decoded_closures();
+  init_variable_layouts();
+
+  m_decoded_vector_table.resize(m_closure_table.size());
+
+  for (size_t i = 0; i < m_closure_table.size(); ++i)
+  {
+    decode_closure(m_closure_table[i], &m_decoded_vector_table[i]);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+void
+Compartment::clear_decoded_closures()
+{
+  m_decoded_vector_table.clear();
+  m_attr_cache_table.clear();
+  m_variable_layout_table.clear();
+  m_eval_stack_depth_table.clear();
+  m_exc_tables.clear();
+}
+
+// -----------------------------------------------------------------------------
+
+const VariableLayout*
+Compartment::get_variable_layout(const Closure* closure)
+{
+  const Closure* begin = m_closure_table.data();
+  const Closure* end = begin + m_closure_table.size();
+
+  if (closure < begin || closure >= end)
+  {
+    return NULL;
+  }
+
+  if (m_variable_layout_table.size() != m_closure_table.size())
+  {
+    init_variable_layouts();
+  }
+
+  return &m_variable_layout_table[static_cast<size_t>(closure - begin)];
+}
+
+// -----------------------------------------------------------------------------
+
+void
+Compartment::init_variable_layouts()
+{
+  m_variable_layout_table.clear();
+  m_variable_layout_table.resize(m_closure_table.size());
+
+  for (size_t i = 0; i < m_closure_table.size(); ++i)
+  {
+    VariableLayout& layout = m_variable_layout_table[i];
+
+    for (const auto& instr : m_closure_table[i].vector)
+    {
+      switch (instr.code)
+      {
+      case STOBJ:
+      case GETARG:
+      case GETKWARG:
+        {
+          const auto key = static_cast<variable_key_t>(instr.oprd1);
+          size_t slot = 0;
+
+          if (!layout.find(key, &slot) &&
+              layout.keys.size() <= VariableLayout::MAX_SLOT)
+          {
+            layout.keys.push_back(key);
+          }
+        }
+        break;
+      default:
+        break;
+      }
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+void
+Compartment::init_eval_stack_depths()
+{
+  m_eval_stack_depth_table.assign(m_closure_table.size(), 0);
+
+  // A single linear pass, which does not follow jumps. The result is a
+  // reservation hint only (see `get_eval_stack_depth()`).
+  for (size_t i = 0; i < m_closure_table.size(); ++i)
+  {
+    uint32_t depth = 0;
+    uint32_t max_depth = 0;
+
+    for (const auto& instr : m_closure_table[i].vector)
+    {
+      switch (instr.code)
+      {
+      // Instructions that push an operand onto the eval stack. All others
+      // either leave it as is, or operate on its top operands in place.
+      case HASATTR2:
+      case GETVAL:
+      case GETVAL2:
+      case ISTRUTHY:
+      case OBJEQ:
+      case OBJNEQ:
+      case PUTOBJ:
+      case GETARGS:
+      case GETKWARGS:
+      case HASARGS:
+      case INT8:
+      case UINT8:
+      case INT16:
+      case UINT16:
+      case INT32:
+      case UINT32:
+      case INT64:
+      case UINT64:
+      case BOOL:
+      case DEC1:
+      case DEC2:
+      case STR:
+      case ARY:
+      case MAP:
+      case TRUTHY:
+      case REPR:
+      case HASH:
+        max_depth = std::max(max_depth, ++depth);
+        break;
+      // Instructions that pop an operand off the eval stack.
+      case SETVAL:
+      case CLDOBJ:
+      case GETOBJ:
+        depth = depth ? depth - 1 : 0;
+        break;
+      default:
+        break;
+      }
+    }
+
+    m_eval_stack_depth_table[i] = max_depth;
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+void
+Compartment::init_exc_tables()
+{
+  m_exc_tables.clear();
+  m_exc_tables.reserve(m_closure_table.size());
+
+  for (const auto& closure : m_closure_table)
+  {
+    m_exc_tables.emplace_back(closure.catch_sites);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+Compartment::find_closure_index(closure_id_t id, size_t* index) const
+{
+  // Closures are usually laid out by id; see `get_closure_by_id()`.
+  if (id >= 0 && id < static_cast<closure_id_t>(m_closure_table.size()) &&
+      m_closure_table[static_cast<size_t>(id)].id == id)
+  {
+    *index = static_cast<size_t>(id);
+    return true;
+  }
+
+  for (size_t i = 0; i < m_closure_table.size(); ++i)
+  {
+    if (m_closure_table[i].id == id)
+    {
+      *index = i;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+
+#if COREVM_USE_SUPERINSTRS
+
+/**
+ * Stands for any instruction that mutates the top element on the eval stack
+ * in place, in the sequences of `SUPERINSTR_TABLE`.
+ */
+static const uint16_t IN_PLACE = std::numeric_limits<uint16_t>::max();
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Instruction sequences fused into superinstructions, longest first for each
+ * leading instruction. Picked by how often they appear back to back in code
+ * generated from the Python test suite and builtin modules.
+ */
+static const struct
+{
+  uint16_t code;
+  size_t length;
+  uint16_t seq[4];
+} SUPERINSTR_TABLE[] {
+  { LDPUTINVK,  3, { LDOBJ,   PUTARG,   INVK           } },
+  { LDPUTARG,   2, { LDOBJ,   PUTARG                   } },
+  { LDPINVK,    2, { LDOBJ,   PINVK                    } },
+  { LDGETATTR,  2, { LDOBJ,   GETATTR                  } },
+  { PUTINVK,    2, { PUTARG,  INVK                     } },
+  { NEWINT64,   3, { NEW,     INT64,    SETVAL         } },
+  { NEWSTR,     3, { NEW,     STR,      SETVAL         } },
+  { NEWSTOBJ,   3, { NEW,     SETVAL,   STOBJ          } },
+  { GETMUTVAL,  3, { GETVAL,  IN_PLACE, SETVAL         } },
+  { GETMUTVAL2, 4, { GETVAL2, IN_PLACE, LDOBJ,  SETVAL } },
+};
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Whether the specified instruction only mutates the top element on the eval
+ * stack in place, leaving the eval stack as deep as it was.
+ */
+static
+bool
+is_in_place_instr(uint16_t code)
+{
+  switch (code)
+  {
+  case STRCLR:
+  case STRAPD:
+  case STRPSH:
+  case STRIST:
+  case STRIST2:
+  case STRERS:
+  case STRERS2:
+  case STRRPLC:
+  case STRRPLCALL:
+  case STRSWP:
+  case ARYPUT:
+  case ARYAPND:
+  case ARYERS:
+  case ARYPOP:
+  case ARYSWP:
+  case ARYCLR:
+  case ARYMRG:
+  case MAPPUT:
+  case MAPERS:
+  case MAPCLR:
+  case MAPSWP:
+  case MAPMRG:
+  case VECPUT:
+  case VECAPND:
+    return true;
+  default:
+    return false;
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Replaces the first instruction of each sequence in `SUPERINSTR_TABLE` with
+ * the superinstruction that fuses it. The rest of the sequence is left as is,
+ * so addresses of instructions, and hence jumps, catch sites and source
+ * locations, remain valid; jumping into the middle of a sequence runs the
+ * instructions it consists of.
+ */
+static
+void
+fuse_superinstrs(DecodedVector* decoded_vector)
+{
+  DecodedVector& instrs = *decoded_vector;
+
+  size_t i = 0;
+
+  while (i < instrs.size())
+  {
+    size_t length = 1;
+
+    for (const auto& superinstr : SUPERINSTR_TABLE)
+    {
+      if (i + superinstr.length > instrs.size())
+      {
+        continue;
+      }
+
+      size_t j = 0;
+      while (j < superinstr.length)
+      {
+        const auto code = instrs[i + j].code;
+
+        if (superinstr.seq[j] == IN_PLACE ? !is_in_place_instr(code) :
+            code != superinstr.seq[j])
+        {
+          break;
+        }
+
+        ++j;
+      }
+
+      if (j == superinstr.length)
+      {
+        instrs[i].code = superinstr.code;
+        length = superinstr.length;
+        break;
+      }
+    }
+
+    i += length;
+  }
+}
+
+#endif /* COREVM_USE_SUPERINSTRS */
+
+// -----------------------------------------------------------------------------
+
+void
+Compartment::decode_closure(const Closure& closure,
+  DecodedVector* decoded_vector)
+{
+  decoded_vector->clear();
+  decoded_vector->reserve(closure.vector.size());
+
+  const size_t closure_index = static_cast<size_t>(
+    &closure - m_closure_table.data());
+
+  for (const auto& instr : closure.vector)
+  {
+    // Superinstructions and quickened instructions are only synthesized by
+    // the interpreter, and are never valid as input.
+    if (instr.code < 0 || instr.code >= LDPINVK ||
+        instr.oprd2 < std::numeric_limits<int32_t>::min() ||
+        instr.oprd2 > std::numeric_limits<int32_t>::max())
+    {
+      THROW(InvalidInstrError(instr.code));
+    }
+
+    DecodedInstr decoded_instr(instr);
+
+    const auto key = static_cast<encoding_key_t>(instr.oprd1);
+
+    switch (instr.code)
+    {
+    case STR:
+      // A zero key denotes the empty string; see `instr_handler_str()`.
+      if (instr.oprd1 > 0 && key < m_interned_str_literal_table.size())
+      {
+        decoded_instr.str_literal = &m_interned_str_literal_table[key];
+        decoded_instr.flags |= DecodedInstr::FLAG_STR_LITERAL;
+      }
+      break;
+    case DEC1:
+    case DEC2:
+      if (key < m_fpt_literal_table.size())
+      {
+        decoded_instr.fpt_literal = m_fpt_literal_table[key];
+        decoded_instr.flags |= DecodedInstr::FLAG_FPT_LITERAL;
+      }
+      break;
+    case GETATTR:
+    case SETATTR:
+    case GETATTR2:
+    case HASATTR2:
+      if (m_attr_cache_table.size() <
+          static_cast<size_t>(std::numeric_limits<int32_t>::max()))
+      {
+        decoded_instr.oprd2 = static_cast<int32_t>(m_attr_cache_table.size());
+        decoded_instr.flags |= DecodedInstr::FLAG_ATTR_CACHE;
+        m_attr_cache_table.push_back(AttrInlineCache());
+      }
+      break;
+    case LDOBJ:
+      {
+        // Resolve the variable to the nearest lexically enclosing closure
+        // that stores it. Closures are followed up to the number of them,
+        // in case of cycles in the parent links.
+        const auto var_key = static_cast<variable_key_t>(instr.oprd1);
+        size_t index = closure_index;
+
+        for (uint32_t depth = 0;
+             depth <= VariableLayout::MAX_DEPTH && depth < m_closure_table.size();
+             ++depth)
+        {
+          size_t slot = 0;
+          if (m_variable_layout_table[index].find(var_key, &slot))
+          {
+            decoded_instr.oprd2 = VariableLayout::encode_addr(depth,
+              static_cast<uint32_t>(slot));
+            decoded_instr.flags |= DecodedInstr::FLAG_VAR_ADDR;
+            break;
+          }
+
+          const closure_id_t parent_id = m_closure_table[index].parent_id;
+          if (parent_id == NONESET_CLOSURE_ID ||
+              !find_closure_index(parent_id, &index))
+          {
+            break;
+          }
+        }
+      }
+      break;
+    case STOBJ:
+    case GETARG:
+      {
+        size_t slot = 0;
+        const auto var_key = static_cast<variable_key_t>(instr.oprd1);
+        if (m_variable_layout_table[closure_index].find(var_key, &slot))
+        {
+          decoded_instr.oprd2 = VariableLayout::encode_addr(0,
+            static_cast<uint32_t>(slot));
+          decoded_instr.flags |= DecodedInstr::FLAG_VAR_ADDR;
+        }
+      }
+      break;
+    default:
+      break;
+    }
+
+    decoded_vector->push_back(decoded_instr);
+  }
+
+#if COREVM_USE_SUPERINSTRS
+  fuse_superinstrs(decoded_vector);
+#endif
+}
+
+// -----------------------------------------------------------------------------
+
 } /* end namespace runtime */
 } /* end namespace corevm */
@@ -26,8 +26,16 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "closure.h"
 #include "common.h"
 #include "errors.h"
+#include "exc_table.h"
+#include "inline_cache.h"
+#include "variable_layout.h"
+#include "vector.h"
+#include "corevm/macros.h"
+#include "dyobj/common.h"
+#include "types/native_string.h"
 
 #include <string>
+#include <vector>
 
 
 namespace corevm {
@@ -42,6 +50,14 @@ class Compartment
 public:
   explicit Compartment(const std::string&);
 
+  /**
+   * Decoded closures are carried over, with resolved string literals
+   * pointing into the literal table of the copy.
+   */
+  Compartment(const Compartment&);
+
+  Compartment(Compartment&&);
+
   const std::string& path() const;
 
   void set_string_literal_table(const StringLiteralTable&);
@@ -58,6 +74,14 @@ public:
 
   void get_string_literal(encoding_key_t, const char**) const;
 
+  size_t string_literal_count() const;
+
+  /**
+   * Gets the attribute key of the string literal with the specified key.
+   * Attribute keys are computed once when the string literal table is set.
+   */
+  dyobj::attr_key_t get_attr_key(encoding_key_t) const;
+
   double get_fpt_literal(encoding_key_t) const;
 
   size_t closure_count() const;
@@ -70,15 +94,139 @@ public:
 
   bool get_starting_closure(Closure**);
 
+  /**
+   * Gets the decoded form of the specified closure, which must be owned by
+   * this compartment. Closures that have not been decoded yet are decoded on
+   * first access.
+   */
+  const DecodedVector& get_decoded_vector(const Closure*);
+
+  /**
+   * Decodes all closures of the compartment ahead of time. Meant to be called
+   * once the literal and closure tables have been loaded.
+   */
+  void decode_closures();
+
+  /**
+   * Gets the inline cache of an attribute access instruction, given the
+   * cache index its decoded form holds.
+   */
+  AttrInlineCache& get_attr_cache(int32_t);
+
+  /**
+   * Gets the lexical layout of the visible variables of the specified
+   * closure, or `NULL` if the closure is not owned by this compartment.
+   * Layouts of all closures are resolved together on first access.
+   */
+  const VariableLayout* get_variable_layout(const Closure*);
+
+  /**
+   * Gets the max depth the eval stack of the specified closure reaches, or
+   * `0` if the closure is not owned by this compartment.
+   *
+   * Depths are estimated on first access by walking the instructions of each
+   * closure in order, regardless of jumps. Branches and loops can take the
+   * eval stack deeper than that, so the estimate is only a hint of how much
+   * to reserve up front, and is never relied on as a bound: eval stacks
+   * still grow on demand (see `Frame::push_eval_stack()`).
+   */
+  size_t get_eval_stack_depth(const Closure*);
+
+  /**
+   * Gets the exception table compiled from the catch sites of the specified
+   * closure, or `NULL` if the closure is not owned by this compartment.
+   * Tables of all closures are compiled together on first access.
+   */
+  const ExcTable* get_exc_table(const Closure*);
+
   friend class CompartmentPrinter;
 
 private:
+  void init_attr_key_table();
+
+  void init_interned_str_literal_table();
+
+  void clear_decoded_closures();
+
+  void init_variable_layouts();
+
+  void init_eval_stack_depths();
+
+  void init_exc_tables();
+
+  bool find_closure_index(closure_id_t, size_t*) const;
+
+  void decode_closure(const Closure&, DecodedVector*);
+
   const std::string m_path;
   StringLiteralTable m_str_literal_table;
+  std::vector<types::native_string> m_interned_str_literal_table;
+  std::vector<dyobj::attr_key_t> m_attr_key_table;
   FptLiteralTable m_fpt_literal_table;
   ClosureTable m_closure_table;
+  std::vector<DecodedVector> m_decoded_vector_table;
+  AttrInlineCacheTable m_attr_cache_table;
+  VariableLayoutTable m_variable_layout_table;
+  std::vector<uint32_t> m_eval_stack_depth_table;
+  ExcTableList m_exc_tables;
 };
 
+// -----------------------------------------------------------------------------
+
+inline AttrInlineCache&
+Compartment::get_attr_cache(int32_t index)
+{
+#if __DEBUG__
+  ASSERT(index >= 0 && static_cast<size_t>(index) < m_attr_cache_table.size());
+#endif
+
+  return m_attr_cache_table[static_cast<size_t>(index)];
+}
+
+// -----------------------------------------------------------------------------
+
+inline size_t
+Compartment::get_eval_stack_depth(const Closure* closure)
+{
+  const Closure* begin = m_closure_table.data();
+  const Closure* end = begin + m_closure_table.size();
+
+  if (closure < begin || closure >= end)
+  {
+    return 0;
+  }
+
+  if (m_eval_stack_depth_table.size() != m_closure_table.size())
+  {
+    init_eval_stack_depths();
+  }
+
+  return m_eval_stack_depth_table[static_cast<size_t>(closure - begin)];
+}
+
+// -----------------------------------------------------------------------------
+
+inline const ExcTable*
+Compartment::get_exc_table(const Closure* closure)
+{
+  const Closure* begin = m_closure_table.data();
+  const Closure* end = begin + m_closure_table.size();
+
+  if (closure < begin || closure >= end)
+  {
+    return NULL;
+  }
+
+  if (m_exc_tables.size() != m_closure_table.size())
+  {
+    init_exc_tables();
+  }
+
+  return &m_exc_tables[static_cast<size_t>(closure - begin)];
+}
+
+// -----------------------------------------------------------------------------
+
 } /* end namespace runtime */
 } /* end namespace corevm */
 
@@ -169,6 +169,18 @@ public:
 
 // -----------------------------------------------------------------------------
 
+class InvalidInstrError : public RuntimeError
+{
+public:
+  explicit InvalidInstrError(instr_code_t code)
+    :
+    RuntimeError(str(boost::format("Invalid instruction with code %lld") % code))
+  {
+  }
+};
+
+// -----------------------------------------------------------------------------
+
 class NativeTypeValueInsertionError : public RuntimeError
 {
 public:
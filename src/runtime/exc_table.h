@@ -0,0 +1,225 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2016 Yanzheng Li
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#ifndef COREVM_EXC_TABLE_H_
+#define COREVM_EXC_TABLE_H_
+
+#include "catch_site.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+
+namespace corevm {
+namespace runtime {
+
+/**
+ * Catch sites of a closure compiled into disjoint address ranges, sorted by
+ * address, for the unwinding of exceptions to look up by binary search.
+ *
+ * Catch sites may overlap, e.g. for nested try blocks, in which case the
+ * first one in the list of the closure takes precedence. Each range is
+ * resolved to the destination of that catch site when the table is built.
+ */
+class ExcTable
+{
+public:
+  struct Entry
+  {
+    int64_t from;
+    int64_t to;
+    int64_t dst;
+  };
+
+  ExcTable();
+
+  explicit ExcTable(const CatchSiteList&);
+
+  bool empty() const;
+
+  size_t size() const;
+
+  const Entry& operator[](size_t) const;
+
+  /**
+   * Finds the destination of the catch site covering the specified address.
+   */
+  bool find(int64_t addr, int64_t* dst) const;
+
+  /**
+   * Finds the destination of the catch site covering the specified address
+   * by a linear search over the catch sites, in the same way tables resolve
+   * overlapping ones.
+   */
+  static bool find(const CatchSiteList&, int64_t addr, int64_t* dst);
+
+private:
+  struct EntryLess
+  {
+    bool operator()(int64_t addr, const Entry& entry) const
+    {
+      return addr < entry.from;
+    }
+  };
+
+  std::vector<Entry> m_entries;
+};
+
+// -----------------------------------------------------------------------------
+
+typedef std::vector<ExcTable> ExcTableList;
+
+// -----------------------------------------------------------------------------
+
+inline
+ExcTable::ExcTable()
+  :
+  m_entries()
+{
+}
+
+// -----------------------------------------------------------------------------
+
+inline
+ExcTable::ExcTable(const CatchSiteList& catch_sites)
+  :
+  m_entries()
+{
+  // Split the address space at the boundaries of all catch sites, so that
+  // each range is covered by the same catch sites throughout.
+  std::vector<int64_t> bounds;
+  bounds.reserve(catch_sites.size() * 2);
+
+  for (const auto& catch_site : catch_sites)
+  {
+    if (catch_site.from <= catch_site.to)
+    {
+      bounds.push_back(catch_site.from);
+      bounds.push_back(catch_site.to + 1);
+    }
+  }
+
+  std::sort(bounds.begin(), bounds.end());
+  bounds.erase(std::unique(bounds.begin(), bounds.end()), bounds.end());
+
+  for (size_t i = 0; i + 1 < bounds.size(); ++i)
+  {
+    int64_t dst = 0;
+
+    if (!find(catch_sites, bounds[i], &dst))
+    {
+      continue;
+    }
+
+    // Merge with the previous range if contiguous and resolved alike.
+    if (!m_entries.empty() &&
+        m_entries.back().to + 1 == bounds[i] &&
+        m_entries.back().dst == dst)
+    {
+      m_entries.back().to = bounds[i + 1] - 1;
+      continue;
+    }
+
+    Entry entry;
+    entry.from = bounds[i];
+    entry.to = bounds[i + 1] - 1;
+    entry.dst = dst;
+
+    m_entries.push_back(entry);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+inline bool
+ExcTable::empty() const
+{
+  return m_entries.empty();
+}
+
+// -----------------------------------------------------------------------------
+
+inline size_t
+ExcTable::size() const
+{
+  return m_entries.size();
+}
+
+// -----------------------------------------------------------------------------
+
+inline const ExcTable::Entry&
+ExcTable::operator[](size_t i) const
+{
+  return m_entries[i];
+}
+
+// -----------------------------------------------------------------------------
+
+inline bool
+ExcTable::find(int64_t addr, int64_t* dst) const
+{
+  // The last range starting at or before the address.
+  auto itr = std::upper_bound(
+    m_entries.begin(), m_entries.end(), addr, EntryLess());
+
+  if (itr == m_entries.begin())
+  {
+    return false;
+  }
+
+  --itr;
+
+  if (addr > itr->to)
+  {
+    return false;
+  }
+
+  *dst = itr->dst;
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+
+inline bool
+ExcTable::find(const CatchSiteList& catch_sites, int64_t addr, int64_t* dst)
+{
+  for (const auto& catch_site : catch_sites)
+  {
+    if (addr >= catch_site.from && addr <= catch_site.to)
+    {
+      *dst = catch_site.dst;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+
+} /* end namespace runtime */
+} /* end namespace corevm */
+
+
+#endif /* COREVM_EXC_TABLE_H_ */
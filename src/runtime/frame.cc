@@ -29,7 +29,9 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "corevm/macros.h"
 #include "types/native_type_value.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <new>
 
 
 namespace corevm {
@@ -37,6 +39,20 @@ namespace runtime {
 
 // -----------------------------------------------------------------------------
 
+/** Capacity of eval stacks when first grown. */
+static const size_t DEFAULT_EVAL_STACK_CAPACITY = 16;
+
+// -----------------------------------------------------------------------------
+
+static inline void
+destroy_operand(types::NativeTypeValue* operand)
+{
+  typedef types::NativeTypeValue value_type;
+  operand->~value_type();
+}
+
+// -----------------------------------------------------------------------------
+
 Frame::Frame(const runtime::ClosureCtx& closure_ctx,
   Compartment* compartment,
   Closure* closure)
@@ -47,13 +63,20 @@ Frame::Frame(const runtime::ClosureCtx& closure_ctx,
   m_closure(closure),
   m_parent(nullptr),
   m_return_addr(NONESET_INSTR_ADDR),
+  m_variable_layout(NULL),
+  m_visible_slots(),
   m_visible_vars(),
   m_invisible_vars(),
-  m_eval_stack(),
+  m_eval_stack(NULL),
+  m_eval_stack_size(0),
+  m_eval_stack_capacity(0),
+  m_eval_stack_owned(false),
+  m_operand_stack(NULL),
+  m_operand_stack_mark(),
+  m_has_operand_stack_window(false),
   m_exc_obj(NULL)
 {
-  // Do nothing here.
-  m_eval_stack.reserve(100);
+  init_visible_slots();
 }
 
 // -----------------------------------------------------------------------------
@@ -69,82 +92,297 @@ Frame::Frame(const runtime::ClosureCtx& closure_ctx,
   m_closure(closure),
   m_parent(nullptr),
   m_return_addr(return_addr),
+  m_variable_layout(NULL),
+  m_visible_slots(),
   m_visible_vars(),
   m_invisible_vars(),
-  m_eval_stack(),
+  m_eval_stack(NULL),
+  m_eval_stack_size(0),
+  m_eval_stack_capacity(0),
+  m_eval_stack_owned(false),
+  m_operand_stack(NULL),
+  m_operand_stack_mark(),
+  m_has_operand_stack_window(false),
   m_exc_obj(NULL)
 {
-  // Do nothing here.
-  m_eval_stack.reserve(100);
+  init_visible_slots();
+}
+
+// -----------------------------------------------------------------------------
+
+Frame::Frame(const Frame& other)
+  :
+  m_pc(other.m_pc),
+  m_closure_ctx(other.m_closure_ctx),
+  m_compartment(other.m_compartment),
+  m_closure(other.m_closure),
+  m_parent(other.m_parent),
+  m_return_addr(other.m_return_addr),
+  m_variable_layout(other.m_variable_layout),
+  m_visible_slots(other.m_visible_slots),
+  m_visible_vars(other.m_visible_vars),
+  m_invisible_vars(other.m_invisible_vars),
+  m_eval_stack(NULL),
+  m_eval_stack_size(0),
+  m_eval_stack_capacity(0),
+  m_eval_stack_owned(false),
+  m_operand_stack(NULL),
+  m_operand_stack_mark(),
+  m_has_operand_stack_window(false),
+  m_exc_obj(other.m_exc_obj)
+{
+  reserve_eval_stack(other.m_eval_stack_size);
+
+  for (size_t i = 0; i < other.m_eval_stack_size; ++i)
+  {
+    push_eval_stack(other.m_eval_stack[i]);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+Frame&
+Frame::operator=(const Frame& other)
+{
+  if (this == &other)
+  {
+    return *this;
+  }
+
+  m_pc = other.m_pc;
+  m_closure_ctx = other.m_closure_ctx;
+  m_compartment = other.m_compartment;
+  m_closure = other.m_closure;
+  m_parent = other.m_parent;
+  m_return_addr = other.m_return_addr;
+  m_variable_layout = other.m_variable_layout;
+  m_visible_slots = other.m_visible_slots;
+  m_visible_vars = other.m_visible_vars;
+  m_invisible_vars = other.m_invisible_vars;
+  m_exc_obj = other.m_exc_obj;
+
+  clear_eval_stack();
+  reserve_eval_stack(other.m_eval_stack_size);
+
+  for (size_t i = 0; i < other.m_eval_stack_size; ++i)
+  {
+    push_eval_stack(other.m_eval_stack[i]);
+  }
+
+  return *this;
 }
 
 // -----------------------------------------------------------------------------
 
 Frame::~Frame()
 {
-  // Do nothing here.
+  // The window on the operand stack, if any, is released by its owner.
+  clear_eval_stack();
+  free_eval_stack_buffer();
 }
 
 // -----------------------------------------------------------------------------
 
-size_t
-Frame::eval_stack_size() const
+void
+Frame::reset(const runtime::ClosureCtx& closure_ctx,
+  Compartment* compartment,
+  Closure* closure,
+  instr_addr_t return_addr)
 {
-  return m_eval_stack.size();
+  m_pc = corevm::runtime::NONESET_INSTR_ADDR;
+  m_closure_ctx = closure_ctx;
+  m_compartment = compartment;
+  m_closure = closure;
+  m_parent = nullptr;
+  m_return_addr = return_addr;
+  m_variable_layout = NULL;
+  m_visible_slots.clear();
+  m_visible_vars.clear();
+  m_invisible_vars.clear();
+  clear_eval_stack();
+  m_exc_obj = NULL;
+
+  init_visible_slots();
 }
 
 // -----------------------------------------------------------------------------
 
-instr_addr_t
-Frame::pc() const
+void
+Frame::init_visible_slots()
+{
+  if (m_compartment && m_closure)
+  {
+    m_variable_layout = m_compartment->get_variable_layout(m_closure);
+  }
+
+  if (m_variable_layout)
+  {
+    m_visible_slots.assign(m_variable_layout->keys.size(), NULL);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+void
+Frame::release_eval_stack()
 {
-  return m_pc;
+  clear_eval_stack();
+
+  if (m_has_operand_stack_window)
+  {
+    m_operand_stack->release(m_operand_stack_mark);
+    m_has_operand_stack_window = false;
+
+    if (!m_eval_stack_owned)
+    {
+      m_eval_stack = NULL;
+      m_eval_stack_capacity = 0;
+    }
+  }
+
+  m_operand_stack = NULL;
 }
 
 // -----------------------------------------------------------------------------
 
 void
-Frame::set_pc(instr_addr_t addr)
+Frame::reserve_eval_stack(size_t capacity)
 {
-  if ( addr != corevm::runtime::NONESET_INSTR_ADDR &&
-      (addr < 0 || static_cast<size_t>(addr) >= m_closure->vector.size()) )
+  if (capacity <= m_eval_stack_capacity)
   {
-    THROW(InvalidInstrAddrError());
+    return;
   }
 
-  m_pc = addr;
+  if (m_operand_stack && !m_eval_stack_owned)
+  {
+    if (!m_has_operand_stack_window)
+    {
+      // The window is reserved on first use, sized by the estimated max eval
+      // stack depth of the closure. The estimate is only a hint, and pushes
+      // past it grow the window like any other. Only the frame being
+      // executed pushes operands, so it is on top of the operand stack at
+      // that point.
+      if (m_compartment && m_closure)
+      {
+        capacity = std::max(capacity,
+          m_compartment->get_eval_stack_depth(m_closure));
+      }
+
+      // Nothing has been pushed yet, so there is nothing to relocate.
+#if __DEBUG__
+      ASSERT(!m_eval_stack_size);
+#endif
+
+      m_eval_stack = m_operand_stack->allocate(capacity, &m_operand_stack_mark);
+      m_has_operand_stack_window = true;
+      m_eval_stack_capacity = capacity;
+      return;
+    }
+
+    // A window on top of the operand stack is extended in place if possible,
+    // or else moved to a new window on top of it.
+    const types::NativeTypeValue* end = m_eval_stack + m_eval_stack_capacity;
+
+    if (m_operand_stack->extend(end, capacity - m_eval_stack_capacity))
+    {
+      m_eval_stack_capacity = capacity;
+      return;
+    }
+    else if (m_operand_stack->is_top(end))
+    {
+      // The current window is released along with the new one, through the
+      // mark of the frame.
+      operand_stack_type::Mark mark;
+      relocate_eval_stack(m_operand_stack->allocate(capacity, &mark));
+      m_eval_stack_capacity = capacity;
+      return;
+    }
+  }
+
+  // Otherwise the eval stack moves to a buffer of its own. A window it
+  // leaves behind is still released along with the frame.
+  auto buffer = static_cast<types::NativeTypeValue*>(
+    ::operator new(capacity * sizeof(types::NativeTypeValue)));
+
+  relocate_eval_stack(buffer);
+  m_eval_stack_owned = true;
+  m_eval_stack_capacity = capacity;
 }
 
 // -----------------------------------------------------------------------------
 
 void
-Frame::set_pc_safe(instr_addr_t addr)
+Frame::grow_eval_stack()
 {
-  m_pc = addr;
+  reserve_eval_stack(m_eval_stack_capacity ?
+    m_eval_stack_capacity * 2 : DEFAULT_EVAL_STACK_CAPACITY);
 }
 
 // -----------------------------------------------------------------------------
 
-const Instr&
-Frame::current_instr() const
+void
+Frame::relocate_eval_stack(types::NativeTypeValue* eval_stack)
 {
-  return m_closure->vector[m_pc];
+  for (size_t i = 0; i < m_eval_stack_size; ++i)
+  {
+    new (eval_stack + i) types::NativeTypeValue(std::move(m_eval_stack[i]));
+    destroy_operand(m_eval_stack + i);
+  }
+
+  free_eval_stack_buffer();
+  m_eval_stack = eval_stack;
 }
 
 // -----------------------------------------------------------------------------
 
 void
-Frame::inc_pc()
+Frame::free_eval_stack_buffer()
 {
-  ++m_pc;
+  if (m_eval_stack_owned)
+  {
+    ::operator delete(m_eval_stack);
+    m_eval_stack = NULL;
+    m_eval_stack_owned = false;
+    m_eval_stack_capacity = 0;
+  }
 }
 
 // -----------------------------------------------------------------------------
 
-bool
-Frame::can_execute() const
+size_t
+Frame::eval_stack_size() const
+{
+  return m_eval_stack_size;
+}
+
+// -----------------------------------------------------------------------------
+
+size_t
+Frame::eval_stack_capacity() const
+{
+  return m_eval_stack_capacity;
+}
+
+// -----------------------------------------------------------------------------
+
+void
+Frame::set_pc(instr_addr_t addr)
+{
+  if ( addr != corevm::runtime::NONESET_INSTR_ADDR &&
+      (addr < 0 || static_cast<size_t>(addr) >= m_closure->vector.size()) )
+  {
+    THROW(InvalidInstrAddrError());
+  }
+
+  m_pc = addr;
+}
+
+// -----------------------------------------------------------------------------
+
+void
+Frame::set_pc_safe(instr_addr_t addr)
 {
-  return m_pc >= 0 && static_cast<size_t>(m_pc) < m_closure->vector.size();
+  m_pc = addr;
 }
 
 // -----------------------------------------------------------------------------
@@ -168,7 +406,21 @@ Frame::set_return_addr(instr_addr_t return_addr)
 void
 Frame::push_eval_stack(const types::NativeTypeValue& operand)
 {
-  m_eval_stack.push_back(operand);
+  if (m_eval_stack_size == m_eval_stack_capacity)
+  {
+    // The operand may be an element of the eval stack itself, which is
+    // relocated as the eval stack grows.
+    if (&operand >= m_eval_stack && &operand < m_eval_stack + m_eval_stack_size)
+    {
+      push_eval_stack(types::NativeTypeValue(operand));
+      return;
+    }
+
+    grow_eval_stack();
+  }
+
+  new (m_eval_stack + m_eval_stack_size) types::NativeTypeValue(operand);
+  ++m_eval_stack_size;
 }
 
 // -----------------------------------------------------------------------------
@@ -176,8 +428,20 @@ Frame::push_eval_stack(const types::NativeTypeValue& operand)
 void
 Frame::push_eval_stack(types::NativeTypeValue&& operand)
 {
-  m_eval_stack.push_back(
-    std::forward<types::NativeTypeValue>(operand));
+  if (m_eval_stack_size == m_eval_stack_capacity)
+  {
+    types::NativeTypeValue value(std::forward<types::NativeTypeValue>(operand));
+    grow_eval_stack();
+    new (m_eval_stack + m_eval_stack_size) types::NativeTypeValue(
+      std::move(value));
+  }
+  else
+  {
+    new (m_eval_stack + m_eval_stack_size) types::NativeTypeValue(
+      std::forward<types::NativeTypeValue>(operand));
+  }
+
+  ++m_eval_stack_size;
 }
 
 // -----------------------------------------------------------------------------
@@ -185,13 +449,15 @@ Frame::push_eval_stack(types::NativeTypeValue&& operand)
 types::NativeTypeValue
 Frame::pop_eval_stack()
 {
-  if (m_eval_stack.empty())
+  if (!m_eval_stack_size)
   {
     THROW(EvaluationStackEmptyError());
   }
 
-  types::NativeTypeValue operand = m_eval_stack.back();
-  m_eval_stack.pop_back();
+  types::NativeTypeValue* top = m_eval_stack + m_eval_stack_size - 1;
+  types::NativeTypeValue operand(std::move(*top));
+  destroy_operand(top);
+  --m_eval_stack_size;
   return operand;
 }
 
@@ -200,12 +466,12 @@ Frame::pop_eval_stack()
 types::NativeTypeValue&
 Frame::top_eval_stack()
 {
-  if (m_eval_stack.empty())
+  if (!m_eval_stack_size)
   {
     THROW(EvaluationStackEmptyError());
   }
 
-  return m_eval_stack.back();
+  return m_eval_stack[m_eval_stack_size - 1];
 }
 
 // -----------------------------------------------------------------------------
@@ -213,7 +479,7 @@ Frame::top_eval_stack()
 void
 Frame::swap_eval_stack()
 {
-  const size_t eval_stack_size = m_eval_stack.size();
+  const size_t eval_stack_size = m_eval_stack_size;
 
   if (eval_stack_size < 2u)
   {
@@ -228,10 +494,13 @@ Frame::swap_eval_stack()
 
 // -----------------------------------------------------------------------------
 
-const std::vector<types::NativeTypeValue>&
-Frame::eval_stack() const
+void
+Frame::clear_eval_stack()
 {
-  return m_eval_stack;
+  for (; m_eval_stack_size; --m_eval_stack_size)
+  {
+    destroy_operand(m_eval_stack + m_eval_stack_size - 1);
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -247,7 +516,17 @@ Frame::eval_stack_element(size_t i)
 size_t
 Frame::visible_var_count() const
 {
-  return m_visible_vars.size();
+  return m_visible_vars.size() + static_cast<size_t>(
+    std::count_if(m_visible_slots.begin(), m_visible_slots.end(),
+      [](dyobj_ptr obj) { return obj != NULL; }));
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+Frame::find_visible_slot(variable_key_t var_key, size_t* slot) const
+{
+  return m_variable_layout && m_variable_layout->find(var_key, slot);
 }
 
 // -----------------------------------------------------------------------------
@@ -255,6 +534,12 @@ Frame::visible_var_count() const
 Frame::dyobj_ptr
 Frame::get_visible_var(variable_key_t var_key) const
 {
+  dyobj_ptr obj = NULL;
+  if (get_visible_var_fast(var_key, &obj))
+  {
+    return obj;
+  }
+
   auto itr = m_visible_vars.find(var_key);
   if (itr == m_visible_vars.end())
   {
@@ -271,6 +556,13 @@ Frame::get_visible_var(variable_key_t var_key) const
 bool
 Frame::get_visible_var_fast(variable_key_t var_key, dyobj_ptr* obj_ptr) const
 {
+  size_t slot = 0;
+  if (find_visible_slot(var_key, &slot))
+  {
+    *obj_ptr = m_visible_slots[slot];
+    return *obj_ptr != NULL;
+  }
+
   auto itr = m_visible_vars.find(var_key);
   if (itr == m_visible_vars.end())
   {
@@ -322,7 +614,17 @@ Frame::dyobj_ptr
 Frame::pop_visible_var(variable_key_t var_key)
 {
   auto ptr = get_visible_var(var_key);
-  m_visible_vars.erase(var_key);
+
+  size_t slot = 0;
+  if (find_visible_slot(var_key, &slot))
+  {
+    m_visible_slots[slot] = NULL;
+  }
+  else
+  {
+    m_visible_vars.erase(var_key);
+  }
+
   return ptr;
 }
 
@@ -331,7 +633,23 @@ Frame::pop_visible_var(variable_key_t var_key)
 void
 Frame::set_visible_var(variable_key_t var_key, dyobj_ptr obj_ptr)
 {
-  m_visible_vars[var_key] = obj_ptr;
+  size_t slot = 0;
+  if (find_visible_slot(var_key, &slot))
+  {
+    m_visible_slots[slot] = obj_ptr;
+  }
+  else
+  {
+    m_visible_vars[var_key] = obj_ptr;
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+const VariableLayout*
+Frame::variable_layout() const
+{
+  return m_variable_layout;
 }
 
 // -----------------------------------------------------------------------------
@@ -432,7 +750,15 @@ std::vector<variable_key_t>
 Frame::visible_var_keys() const
 {
   std::vector<variable_key_t> keys;
-  keys.reserve(m_visible_vars.size());
+  keys.reserve(m_visible_slots.size() + m_visible_vars.size());
+
+  for (size_t i = 0; i < m_visible_slots.size(); ++i)
+  {
+    if (m_visible_slots[i])
+    {
+      keys.push_back(m_variable_layout->keys[i]);
+    }
+  }
 
   for (const auto& pair : m_visible_vars)
   {
@@ -464,7 +790,15 @@ std::vector<Frame::dyobj_ptr>
 Frame::get_visible_objs() const
 {
   std::vector<dyobj_ptr> obj_ptrs;
-  obj_ptrs.reserve(m_visible_vars.size());
+  obj_ptrs.reserve(m_visible_slots.size() + m_visible_vars.size());
+
+  for (const auto obj_ptr : m_visible_slots)
+  {
+    if (obj_ptr)
+    {
+      obj_ptrs.push_back(obj_ptr);
+    }
+  }
 
   for (auto itr = m_visible_vars.begin(); itr != m_visible_vars.end(); ++itr)
   {
@@ -510,14 +844,6 @@ Frame::compartment() const
 
 // -----------------------------------------------------------------------------
 
-Closure*
-Frame::closure() const
-{
-  return m_closure;
-}
-
-// -----------------------------------------------------------------------------
-
 Frame*
 Frame::parent() const
 {
@@ -29,9 +29,12 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "errors.h"
 #include "fwd.h"
 #include "instr_fwd.h"
+#include "operand_stack.h"
 #include "runtime_types.h"
+#include "variable_layout.h"
 #include "dyobj/common.h"
 #include "types/fwd.h"
+#include "corevm/llvm_smallvector.h"
 #include "corevm/macros.h"
 
 #include <cstdint>
@@ -39,7 +42,6 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #if COREVM_USE_LINEAR_VARIABLE_TABLE
   #include "linear_map.h"
-  #include "corevm/llvm_smallvector.h"
 #else
   #include <unordered_map>
 #endif // COREVM_USE_LINEAR_VARIABLE_TABLE
@@ -52,9 +54,11 @@ namespace runtime {
  * Each frame is consisted of:
  *
  * - Return address.
- * - Visible local variables.
+ * - Visible local variables, in the slots given by the variable layout of
+ *   the closure, plus a table of the ones created under other names.
  * - Invisible local variables.
- * - Evaluation stack.
+ * - Evaluation stack, either as a window of the operand stack of the process,
+ *   or in a buffer of its own.
  * - Closure context.
  * - A pointer to the associated compartment.
  * - A pointer to the associated closure object.
@@ -64,14 +68,48 @@ class Frame
 public:
   typedef RuntimeTypes::dyobj_ptr_type dyobj_ptr;
 
+  typedef OperandStack<types::NativeTypeValue> operand_stack_type;
+
   Frame(const ClosureCtx&, Compartment*, Closure*);
 
   Frame(const ClosureCtx&, Compartment*, Closure*, instr_addr_t);
 
+  /**
+   * Copies of a frame keep their eval stack in a buffer of their own.
+   */
+  Frame(const Frame&);
+
+  Frame& operator=(const Frame&);
+
   ~Frame();
 
+  /**
+   * Re-initializes the frame for a new invocation, as if it was constructed
+   * with the specified arguments, while keeping the buffers of its eval
+   * stack and variable tables.
+   */
+  void reset(const ClosureCtx&, Compartment*, Closure*, instr_addr_t);
+
+  /**
+   * Sets the operand stack the eval stack of the frame is to be kept on.
+   *
+   * The frame reserves a window on top of the operand stack on its first
+   * push, sized by the max eval stack depth of its closure. The window has to
+   * be released through `release_eval_stack()` before any window reserved
+   * prior to it.
+   */
+  void set_operand_stack(operand_stack_type*);
+
+  /**
+   * Clears the eval stack, and releases its window back to the operand stack
+   * it was reserved on, if any.
+   */
+  void release_eval_stack();
+
   size_t eval_stack_size() const;
 
+  size_t eval_stack_capacity() const;
+
   instr_addr_t pc() const;
 
   void set_pc(instr_addr_t);
@@ -98,7 +136,7 @@ public:
 
   void swap_eval_stack();
 
-  const std::vector<types::NativeTypeValue>& eval_stack() const;
+  void clear_eval_stack();
 
   types::NativeTypeValue& eval_stack_element(size_t i);
 
@@ -114,6 +152,28 @@ public:
 
   void set_visible_var(variable_key_t, dyobj_ptr);
 
+  /**
+   * Loads a visible variable by its lexical address (see `VariableLayout`),
+   * as resolved for the closure of this frame.
+   *
+   * Returns `false` whenever the address cannot be relied on, i.e. the
+   * variable is not set yet, a frame on the way holds variables created
+   * under other names, a frame on the way has a parent frame that does not
+   * belong to its lexical parent (as the ones not on the call stack are
+   * skipped), or the frames do not match the layouts. Callers should then
+   * fall back to `get_visible_var_through_ancestry()`.
+   */
+  bool get_visible_var_at(uint32_t depth, uint32_t slot, variable_key_t,
+    dyobj_ptr*) const;
+
+  /**
+   * Stores a visible variable in the specified slot of the variable layout
+   * of the closure of this frame.
+   */
+  void set_visible_var_at(uint32_t slot, dyobj_ptr);
+
+  const VariableLayout* variable_layout() const;
+
   size_t invisible_var_count() const;
 
   dyobj_ptr get_invisible_var(variable_key_t) const;
@@ -134,6 +194,13 @@ public:
 
   std::vector<dyobj_ptr> get_invisible_objs() const;
 
+  /**
+   * Invokes the specified function on the objects of all visible and
+   * invisible variables of the frame, in place.
+   */
+  template<typename Function>
+  void iterate_objs(Function) const;
+
   ClosureCtx closure_ctx() const;
 
   Compartment* compartment() const;
@@ -162,18 +229,183 @@ protected:
   typedef std::unordered_map<variable_key_t, dyobj_ptr> VariableTable;
 #endif
 
+  typedef llvm::SmallVector<dyobj_ptr, 16> VariableSlots;
+
+  void init_visible_slots();
+
+  bool find_visible_slot(variable_key_t, size_t*) const;
+
+  void reserve_eval_stack(size_t);
+
+  void grow_eval_stack();
+
+  void relocate_eval_stack(types::NativeTypeValue*);
+
+  void free_eval_stack_buffer();
+
   instr_addr_t m_pc;
-  const runtime::ClosureCtx m_closure_ctx;
+  runtime::ClosureCtx m_closure_ctx;
   Compartment* m_compartment;
   Closure* m_closure;
   Frame* m_parent;
   instr_addr_t m_return_addr;
+  const VariableLayout* m_variable_layout;
+  VariableSlots m_visible_slots;
   VariableTable m_visible_vars;
   VariableTable m_invisible_vars;
-  std::vector<types::NativeTypeValue> m_eval_stack;
+  types::NativeTypeValue* m_eval_stack;
+  size_t m_eval_stack_size;
+  size_t m_eval_stack_capacity;
+  bool m_eval_stack_owned;
+  operand_stack_type* m_operand_stack;
+  operand_stack_type::Mark m_operand_stack_mark;
+  bool m_has_operand_stack_window;
   dyobj_ptr m_exc_obj;
 };
 
+// -----------------------------------------------------------------------------
+
+/**
+ * The accessors below are on the hot path of the interpreter loop, so they
+ * are defined inline here rather than in the translation unit.
+ */
+
+// -----------------------------------------------------------------------------
+
+inline instr_addr_t
+Frame::pc() const
+{
+  return m_pc;
+}
+
+// -----------------------------------------------------------------------------
+
+inline const Instr&
+Frame::current_instr() const
+{
+  return m_closure->vector[static_cast<size_t>(m_pc)];
+}
+
+// -----------------------------------------------------------------------------
+
+inline void
+Frame::inc_pc()
+{
+  ++m_pc;
+}
+
+// -----------------------------------------------------------------------------
+
+inline bool
+Frame::can_execute() const
+{
+  return m_pc >= 0 && static_cast<size_t>(m_pc) < m_closure->vector.size();
+}
+
+// -----------------------------------------------------------------------------
+
+inline Closure*
+Frame::closure() const
+{
+  return m_closure;
+}
+
+// -----------------------------------------------------------------------------
+
+inline bool
+Frame::get_visible_var_at(uint32_t depth, uint32_t slot, variable_key_t key,
+  dyobj_ptr* obj_ptr) const
+{
+  const Frame* frame = this;
+
+  for (uint32_t i = 0; i < depth; ++i)
+  {
+    if (!frame->m_visible_vars.empty())
+    {
+      return false;
+    }
+
+    const Frame* parent = frame->m_parent;
+
+    // Parent frames skip the lexical parents that are not on the call stack,
+    // past which the address no longer holds.
+    if (!parent || parent->m_closure->id != frame->m_closure->parent_id)
+    {
+      return false;
+    }
+
+    frame = parent;
+  }
+
+  if (slot >= frame->m_visible_slots.size() ||
+      frame->m_variable_layout->keys[slot] != key)
+  {
+    return false;
+  }
+
+  dyobj_ptr obj = frame->m_visible_slots[slot];
+
+  if (!obj)
+  {
+    return false;
+  }
+
+  *obj_ptr = obj;
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+
+inline void
+Frame::set_operand_stack(operand_stack_type* operand_stack)
+{
+#if __DEBUG__
+  ASSERT(!m_has_operand_stack_window);
+#endif
+
+  m_operand_stack = operand_stack;
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename Function>
+inline void
+Frame::iterate_objs(Function func) const
+{
+  for (const auto obj : m_visible_slots)
+  {
+    if (obj)
+    {
+      func(obj);
+    }
+  }
+
+  for (const auto& pair : m_visible_vars)
+  {
+    func(pair.second);
+  }
+
+  for (const auto& pair : m_invisible_vars)
+  {
+    func(pair.second);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+inline void
+Frame::set_visible_var_at(uint32_t slot, dyobj_ptr obj_ptr)
+{
+#if __DEBUG__
+  ASSERT(slot < m_visible_slots.size());
+#endif
+
+  m_visible_slots[slot] = obj_ptr;
+}
+
+// -----------------------------------------------------------------------------
+
 } /* end namespace runtime */
 } /* end namespace corevm */
 
@@ -0,0 +1,148 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2016 Yanzheng Li
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#include "frame_arena.h"
+
+#include "frame.h"
+#include "types/native_type_value.h"
+
+
+namespace corevm {
+namespace runtime {
+
+// -----------------------------------------------------------------------------
+
+FrameArena::FrameArena()
+  :
+  m_operand_stack(),
+  m_frames(),
+  m_size(0)
+{
+}
+
+// -----------------------------------------------------------------------------
+
+FrameArena::~FrameArena()
+{
+  // Do nothing here.
+}
+
+// -----------------------------------------------------------------------------
+
+size_t
+FrameArena::capacity() const
+{
+  return m_frames.size();
+}
+
+// -----------------------------------------------------------------------------
+
+void
+FrameArena::reserve(size_t n)
+{
+  m_frames.reserve(n);
+}
+
+// -----------------------------------------------------------------------------
+
+Frame*
+FrameArena::next_frame()
+{
+  if (m_size < m_frames.size())
+  {
+    return m_frames[m_size++].get();
+  }
+
+  return nullptr;
+}
+
+// -----------------------------------------------------------------------------
+
+void
+FrameArena::push_back(const Frame& frame)
+{
+  Frame* next = next_frame();
+
+  if (next)
+  {
+    *next = frame;
+  }
+  else
+  {
+    m_frames.emplace_back(new Frame(frame));
+    next = m_frames[m_size++].get();
+  }
+
+  next->set_operand_stack(&m_operand_stack);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+FrameArena::emplace_back(const ClosureCtx& ctx, Compartment* compartment,
+  Closure* closure, instr_addr_t return_addr)
+{
+  Frame* next = next_frame();
+
+  if (next)
+  {
+    next->reset(ctx, compartment, closure, return_addr);
+  }
+  else
+  {
+    m_frames.emplace_back(new Frame(ctx, compartment, closure, return_addr));
+    next = m_frames[m_size++].get();
+  }
+
+  next->set_operand_stack(&m_operand_stack);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+FrameArena::pop_back()
+{
+#if __DEBUG__
+  ASSERT(m_size);
+#endif
+
+  --m_size;
+
+  // Release the operands still on the eval stack right away, along with its
+  // window of the operand stack.
+  m_frames[m_size]->release_eval_stack();
+}
+
+// -----------------------------------------------------------------------------
+
+void
+FrameArena::clear()
+{
+  m_frames.clear();
+  m_size = 0;
+  m_operand_stack.clear();
+}
+
+// -----------------------------------------------------------------------------
+
+} /* end namespace runtime */
+} /* end namespace corevm */
@@ -0,0 +1,174 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2016 Yanzheng Li
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#ifndef COREVM_FRAME_ARENA_H_
+#define COREVM_FRAME_ARENA_H_
+
+#include "closure.h"
+#include "closure_ctx.h"
+#include "common.h"
+#include "frame.h"
+#include "fwd.h"
+#include "corevm/macros.h"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+
+namespace corevm {
+namespace runtime {
+
+/**
+ * Storage of the frames of the call stack of a process.
+ *
+ * Frames are allocated one at a time and never relocated, so pointers to
+ * frames on the stack (e.g. parent frames) remain valid as the stack grows.
+ * Popped frames are kept and re-initialized by later pushes, which recycles
+ * their variable table buffers across calls.
+ *
+ * The eval stacks of frames are windows of a single operand stack, reserved
+ * as frames first push operands and released as they are popped.
+ */
+class FrameArena
+{
+public:
+  FrameArena();
+
+  FrameArena(const FrameArena&) = delete;
+  FrameArena& operator=(const FrameArena&) = delete;
+
+  ~FrameArena();
+
+  size_t size() const;
+
+  bool empty() const;
+
+  /**
+   * Number of frames allocated, including the ones available for reuse.
+   */
+  size_t capacity() const;
+
+  void reserve(size_t);
+
+  Frame& operator[](size_t);
+
+  const Frame& operator[](size_t) const;
+
+  Frame& back();
+
+  const Frame& back() const;
+
+  void push_back(const Frame&);
+
+  void emplace_back(const ClosureCtx&, Compartment*, Closure*, instr_addr_t);
+
+  void pop_back();
+
+  /**
+   * Pops all frames, and releases their storage.
+   */
+  void clear();
+
+  const Frame::operand_stack_type& operand_stack() const;
+
+private:
+  Frame* next_frame();
+
+  // Declared ahead of the frames, which may still hold windows of it when
+  // destroyed.
+  Frame::operand_stack_type m_operand_stack;
+  std::vector<std::unique_ptr<Frame>> m_frames;
+  size_t m_size;
+};
+
+// -----------------------------------------------------------------------------
+
+inline size_t
+FrameArena::size() const
+{
+  return m_size;
+}
+
+// -----------------------------------------------------------------------------
+
+inline bool
+FrameArena::empty() const
+{
+  return m_size == 0;
+}
+
+// -----------------------------------------------------------------------------
+
+inline Frame&
+FrameArena::operator[](size_t i)
+{
+  return *m_frames[i];
+}
+
+// -----------------------------------------------------------------------------
+
+inline const Frame&
+FrameArena::operator[](size_t i) const
+{
+  return *m_frames[i];
+}
+
+// -----------------------------------------------------------------------------
+
+inline Frame&
+FrameArena::back()
+{
+#if __DEBUG__
+  ASSERT(m_size);
+#endif
+
+  return *m_frames[m_size - 1];
+}
+
+// -----------------------------------------------------------------------------
+
+inline const Frame&
+FrameArena::back() const
+{
+#if __DEBUG__
+  ASSERT(m_size);
+#endif
+
+  return *m_frames[m_size - 1];
+}
+
+// -----------------------------------------------------------------------------
+
+inline const Frame::operand_stack_type&
+FrameArena::operand_stack() const
+{
+  return m_operand_stack;
+}
+
+// -----------------------------------------------------------------------------
+
+} /* end namespace runtime */
+} /* end namespace corevm */
+
+
+#endif /* COREVM_FRAME_ARENA_H_ */
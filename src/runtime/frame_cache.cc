@@ -23,59 +23,85 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "frame_cache.h"
 #include "frame.h"
 
-#include <boost/functional/hash.hpp>
-
 
 namespace corevm {
 namespace runtime {
 
 // -----------------------------------------------------------------------------
 
-size_t
-ClosureCtxHash::operator()(const ClosureCtx& closure_ctx) const
+FrameCache::Entry*
+FrameCache::entry_of(const ClosureCtx& ctx)
 {
-  std::size_t seed = 0;
-  boost::hash_combine(seed, closure_ctx.compartment_id);
-  boost::hash_combine(seed, closure_ctx.closure_id);
-  return seed;
-}
+  // Frames of closure contexts not laid out in compartments are not indexed.
+  if (ctx.compartment_id < 0 || ctx.closure_id < 0)
+  {
+    return NULL;
+  }
 
-// -----------------------------------------------------------------------------
+  const size_t compartment_id = static_cast<size_t>(ctx.compartment_id);
+  const size_t closure_id = static_cast<size_t>(ctx.closure_id);
 
-void
-FrameCache::insert_parent_frame(const ClosureCtx& ctx, FramePtr parent_frame)
-{
-  m_cache.insert(std::make_pair(ctx, parent_frame));
-  m_reverse_cache.insert(std::make_pair(parent_frame, ctx));
+  if (compartment_id >= m_entry_tables.size())
+  {
+    m_entry_tables.resize(compartment_id + 1);
+  }
+
+  EntryTable& entry_table = m_entry_tables[compartment_id];
+
+  if (closure_id >= entry_table.size())
+  {
+    entry_table.resize(closure_id + 1);
+  }
+
+  return &entry_table[closure_id];
 }
 
 // -----------------------------------------------------------------------------
 
 void
-FrameCache::erase_parent_frame(FramePtr parent_frame)
+FrameCache::insert_frame(FramePtr frame)
 {
-  auto itr = m_reverse_cache.find(parent_frame);
-  if (itr != m_reverse_cache.end())
+  Entry* entry = entry_of(frame->closure_ctx());
+
+  if (!entry)
+  {
+    return;
+  }
+
+  if (!entry->depth++)
   {
-    m_reverse_cache.erase(itr);
-    m_cache.erase(itr->second);
+    entry->frame = frame;
   }
 }
 
 // -----------------------------------------------------------------------------
 
-FramePtr
-FrameCache::parent_frame_of(const ClosureCtx& ctx)
+void
+FrameCache::erase_frame(FramePtr frame)
 {
-  FramePtr parent = NULL;
+  Entry* entry = entry_of(frame->closure_ctx());
+
+  if (!entry || !entry->depth)
+  {
+    return;
+  }
 
-  auto itr = m_cache.find(ctx);
-  if (itr != m_cache.end())
+  if (!--entry->depth)
   {
-    parent = itr->second;
+#if __DEBUG__
+    ASSERT(entry->frame == frame);
+#endif
+
+    entry->frame = NULL;
   }
+}
 
-  return parent;
+// -----------------------------------------------------------------------------
+
+void
+FrameCache::clear()
+{
+  m_entry_tables.clear();
 }
 
 // -----------------------------------------------------------------------------
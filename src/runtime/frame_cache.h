@@ -25,7 +25,8 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include "closure_ctx.h"
 
-#include <unordered_map>
+#include <cstddef>
+#include <vector>
 
 
 namespace corevm {
@@ -33,34 +34,84 @@ namespace runtime {
 
 // -----------------------------------------------------------------------------
 
-struct ClosureCtxHash
-{
-  size_t operator()(const ClosureCtx& closure_ctx) const;
-};
-
-// -----------------------------------------------------------------------------
-
 class Frame;
 typedef Frame* FramePtr;
 
 // -----------------------------------------------------------------------------
 
+/**
+ * Index of the frames on the call stack of a process by their closure
+ * contexts.
+ *
+ * Closure ids are dense within each compartment, so entries are laid out in a
+ * vector per compartment indexed by closure id. Since frames are pushed and
+ * popped in LIFO order, the frames of a closure on the call stack form a
+ * stack of their own, and each entry only has to keep its bottom frame and
+ * the number of frames on top of it.
+ */
 class FrameCache
 {
 public:
-  void insert_parent_frame(const ClosureCtx& ctx, FramePtr parent_frame);
+  /**
+   * Records the specified frame, which has just been pushed onto the call
+   * stack.
+   */
+  void insert_frame(FramePtr frame);
+
+  /**
+   * Removes the specified frame, which is about to be popped off the call
+   * stack.
+   */
+  void erase_frame(FramePtr frame);
+
+  /**
+   * Returns the bottom-most frame on the call stack associated with the
+   * specified closure context, or `NULL` if there is none.
+   */
+  FramePtr frame_of(const ClosureCtx& ctx) const;
+
+  void clear();
 
-  void erase_parent_frame(FramePtr parent_frame);
+private:
+  struct Entry
+  {
+    Entry() : frame(NULL), depth(0) {}
 
-  FramePtr parent_frame_of(const ClosureCtx& ctx);
+    FramePtr frame;
+    size_t depth;
+  };
 
-private:
-  std::unordered_map<ClosureCtx, FramePtr, ClosureCtxHash> m_cache;
-  std::unordered_map<FramePtr, ClosureCtx> m_reverse_cache;
+  typedef std::vector<Entry> EntryTable;
+
+  Entry* entry_of(const ClosureCtx& ctx);
+
+  std::vector<EntryTable> m_entry_tables;
 };
 
 // -----------------------------------------------------------------------------
 
+inline FramePtr
+FrameCache::frame_of(const ClosureCtx& ctx) const
+{
+  if (ctx.compartment_id < 0 || ctx.closure_id < 0)
+  {
+    return NULL;
+  }
+
+  const size_t compartment_id = static_cast<size_t>(ctx.compartment_id);
+  const size_t closure_id = static_cast<size_t>(ctx.closure_id);
+
+  if (compartment_id >= m_entry_tables.size() ||
+      closure_id >= m_entry_tables[compartment_id].size())
+  {
+    return NULL;
+  }
+
+  return m_entry_tables[compartment_id][closure_id].frame;
+}
+
+// -----------------------------------------------------------------------------
+
 } /* end namespace runtime */
 } /* end namespace corevm */
 
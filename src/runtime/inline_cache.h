@@ -0,0 +1,279 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2016 Yanzheng Li
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#ifndef COREVM_INLINE_CACHE_H_
+#define COREVM_INLINE_CACHE_H_
+
+#include "dyobj/common.h"
+#include "dyobj/shape.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+namespace corevm {
+namespace runtime {
+
+/**
+ * Inline cache of an attribute access site (i.e. a GETATTR, SETATTR,
+ * GETATTR2 or HASATTR2 instruction). Entries are keyed by the shape of
+ * receivers (see `dyobj::Shape`) and by the attribute key accessed, as
+ * GETATTR2 and HASATTR2 take their keys from the eval stack, which can
+ * differ from one execution of the site to the next.
+ *
+ * Each entry records the shape of a receiver before and after an access,
+ * and the slot of the attribute in the latter. Accesses only hit entries
+ * for the same key. Loads hit when the receiver has the shape after the
+ * access. Stores hit either when the receiver has the shape after the
+ * access, in which case the value in the slot is replaced, or when it has
+ * the shape before it, in which case the attribute is added by moving the
+ * receiver to the cached transition. Entries are invalidated implicitly
+ * once receivers change shape through `putattr()` or `delattr()`.
+ *
+ * A site starts out monomorphic, and turns polymorphic as receivers with
+ * different shapes, or different keys, pass through it, up to
+ * `MAX_ENTRY_COUNT` entries, after which entries are replaced in a
+ * round-robin fashion. Receivers in dictionary mode always miss.
+ */
+class AttrInlineCache
+{
+public:
+  static const uint32_t MAX_ENTRY_COUNT = 4;
+
+  AttrInlineCache();
+
+  uint32_t size() const;
+
+  uint64_t hit_count() const;
+
+  uint64_t miss_count() const;
+
+  template<typename ObjPtrType>
+  bool hasattr(const ObjPtrType&, dyobj::attr_key_t);
+
+  template<typename ObjPtrType>
+  bool getattr(const ObjPtrType&, dyobj::attr_key_t, ObjPtrType*);
+
+  template<typename ObjPtrType>
+  void putattr(const ObjPtrType&, dyobj::attr_key_t, const ObjPtrType&);
+
+private:
+  struct Entry
+  {
+    const dyobj::Shape* shape;
+    const dyobj::Shape* new_shape;
+    dyobj::attr_key_t attr_key;
+    uint32_t slot;
+  };
+
+  void insert(const dyobj::Shape*, const dyobj::Shape*, dyobj::attr_key_t,
+    size_t slot);
+
+  Entry m_entries[MAX_ENTRY_COUNT];
+  uint32_t m_size;
+  uint32_t m_next;
+  uint64_t m_hit_count;
+  uint64_t m_miss_count;
+};
+
+// -----------------------------------------------------------------------------
+
+typedef std::vector<AttrInlineCache> AttrInlineCacheTable;
+
+// -----------------------------------------------------------------------------
+
+inline
+AttrInlineCache::AttrInlineCache()
+  :
+  m_entries(),
+  m_size(0),
+  m_next(0),
+  m_hit_count(0),
+  m_miss_count(0)
+{
+}
+
+// -----------------------------------------------------------------------------
+
+inline uint32_t
+AttrInlineCache::size() const
+{
+  return m_size;
+}
+
+// -----------------------------------------------------------------------------
+
+inline uint64_t
+AttrInlineCache::hit_count() const
+{
+  return m_hit_count;
+}
+
+// -----------------------------------------------------------------------------
+
+inline uint64_t
+AttrInlineCache::miss_count() const
+{
+  return m_miss_count;
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename ObjPtrType>
+inline bool
+AttrInlineCache::hasattr(const ObjPtrType& obj, dyobj::attr_key_t attr_key)
+{
+  const dyobj::Shape* shape = obj->shape();
+
+  for (uint32_t i = 0; i < m_size; ++i)
+  {
+    if (m_entries[i].new_shape == shape && m_entries[i].attr_key == attr_key)
+    {
+      ++m_hit_count;
+      return true;
+    }
+  }
+
+  ++m_miss_count;
+
+  size_t slot = 0;
+  const bool res = obj->hasattr(attr_key, &slot);
+
+  if (res)
+  {
+    insert(shape, shape, attr_key, slot);
+  }
+
+  return res;
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename ObjPtrType>
+inline bool
+AttrInlineCache::getattr(const ObjPtrType& obj, dyobj::attr_key_t attr_key,
+  ObjPtrType* attr_ptr)
+{
+  const dyobj::Shape* shape = obj->shape();
+
+  for (uint32_t i = 0; i < m_size; ++i)
+  {
+    if (m_entries[i].new_shape == shape && m_entries[i].attr_key == attr_key)
+    {
+      ++m_hit_count;
+      *attr_ptr = obj->attr_at(m_entries[i].slot);
+      return true;
+    }
+  }
+
+  ++m_miss_count;
+
+  size_t slot = 0;
+  const bool res = obj->getattr(attr_key, attr_ptr, &slot);
+
+  if (res)
+  {
+    insert(shape, shape, attr_key, slot);
+  }
+
+  return res;
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename ObjPtrType>
+inline void
+AttrInlineCache::putattr(const ObjPtrType& obj, dyobj::attr_key_t attr_key,
+  const ObjPtrType& attr_obj)
+{
+  const dyobj::Shape* shape = obj->shape();
+
+  for (uint32_t i = 0; i < m_size; ++i)
+  {
+    const Entry& entry = m_entries[i];
+
+    if (entry.attr_key != attr_key)
+    {
+      continue;
+    }
+
+    if (entry.new_shape == shape)
+    {
+      ++m_hit_count;
+      obj->set_attr_at(entry.slot, attr_obj);
+      return;
+    }
+    else if (entry.shape == shape)
+    {
+      ++m_hit_count;
+      obj->add_attr(entry.new_shape, attr_obj);
+      return;
+    }
+  }
+
+  ++m_miss_count;
+
+  size_t slot = 0;
+  obj->putattr(attr_key, attr_obj, &slot);
+
+  insert(shape, obj->shape(), attr_key, slot);
+}
+
+// -----------------------------------------------------------------------------
+
+inline void
+AttrInlineCache::insert(const dyobj::Shape* shape,
+  const dyobj::Shape* new_shape, dyobj::attr_key_t attr_key, size_t slot)
+{
+  // Dictionary shapes change in place, and are freed along with their
+  // objects, so they cannot be cached.
+  if (new_shape->is_dictionary())
+  {
+    return;
+  }
+
+  Entry* entry = NULL;
+
+  if (m_size < MAX_ENTRY_COUNT)
+  {
+    entry = &m_entries[m_size++];
+  }
+  else
+  {
+    entry = &m_entries[m_next];
+    m_next = (m_next + 1) % MAX_ENTRY_COUNT;
+  }
+
+  entry->shape = shape;
+  entry->new_shape = new_shape;
+  entry->attr_key = attr_key;
+  entry->slot = static_cast<uint32_t>(slot);
+}
+
+// -----------------------------------------------------------------------------
+
+} /* end namespace runtime */
+} /* end namespace corevm */
+
+
+#endif /* COREVM_INLINE_CACHE_H_ */
@@ -26,11 +26,13 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "compartment.h"
 #include "dbgmem_printer.h"
 #include "dbgvar_printer.h"
+#include "exc_table.h"
 #include "frame.h"
 #include "frame_printer.h"
 #include "invocation_ctx.h"
 #include "process.h"
 #include "utils.h"
+#include "variable_layout.h"
 #include "corevm/macros.h"
 #include "dyobj/util.h"
 #include "types/interfaces.h"
@@ -55,222 +57,88 @@ namespace runtime {
 
 // -----------------------------------------------------------------------------
 
+DecodedInstr::DecodedInstr()
+  :
+  oprd1(0),
+  oprd2(0),
+  code(0),
+  flags(0)
+{
+}
+
+// -----------------------------------------------------------------------------
+
+DecodedInstr::DecodedInstr(const Instr& instr)
+  :
+  oprd1(instr.oprd1),
+  oprd2(static_cast<int32_t>(instr.oprd2)),
+  code(static_cast<uint16_t>(instr.code)),
+  flags(0)
+{
+}
+
+// -----------------------------------------------------------------------------
+
 #if defined(__clang__) and __clang__
   #pragma clang diagnostic push
   #pragma clang diagnostic ignored "-Wc99-extensions"
 #endif
 
+#define INSTR_HANDLER(code, handler) handler,
+
 InstrHandler*
 InstrHandlerMeta::instr_handlers[INSTR_CODE_MAX] {
-
-  /* -------------------------- Object instructions ------------------------- */
-
-  /* NEW       */    instr_handler_new       ,
-  /* LDOBJ     */    instr_handler_ldobj     ,
-  /* STOBJ     */    instr_handler_stobj     ,
-  /* STOBJN    */    instr_handler_stobjn    ,
-  /* GETATTR   */    instr_handler_getattr   ,
-  /* SETATTR   */    instr_handler_setattr   ,
-  /* DELATTR   */    instr_handler_delattr   ,
-  /* HASATTR2  */    instr_handler_hasattr2  ,
-  /* GETATTR2  */    instr_handler_getattr2  ,
-  /* SETATTR2  */    instr_handler_setattr2  ,
-  /* DELATTR2  */    instr_handler_delattr2  ,
-  /* POP       */    instr_handler_pop       ,
-  /* LDOBJ2    */    instr_handler_ldobj2    ,
-  /* STOBJ2    */    instr_handler_stobj2    ,
-  /* DELOBJ    */    instr_handler_delobj    ,
-  /* DELOBJ2   */    instr_handler_delobj2   ,
-  /* GETVAL    */    instr_handler_getval    ,
-  /* SETVAL    */    instr_handler_setval    ,
-  /* GETVAL2   */    instr_handler_getval2   ,
-  /* CLRVAL    */    instr_handler_clrval    ,
-  /* CPYVAL    */    instr_handler_cpyval    ,
-  /* CPYREPR   */    instr_handler_cpyrepr   ,
-  /* ISTRUTHY  */    instr_handler_istruthy  ,
-  /* OBJEQ     */    instr_handler_objeq     ,
-  /* OBJNEQ    */    instr_handler_objneq    ,
-  /* SETCTX    */    instr_handler_setctx    ,
-  /* CLDOBJ    */    instr_handler_cldobj    ,
-  /* RSETATTRS */    instr_handler_rsetattrs ,
-  /* SETATTRS  */    instr_handler_setattrs  ,
-  /* PUTOBJ    */    instr_handler_putobj    ,
-  /* GETOBJ    */    instr_handler_getobj    ,
-  /* SWAP      */    instr_handler_swap      ,
-  /* SETFLGC   */    instr_handler_setflgc   ,
-  /* SETFLDEL  */    instr_handler_setfldel  ,
-  /* SETFLCALL */    instr_handler_setflcall ,
-  /* SETFLMUTE */    instr_handler_setflmute ,
-
-  /* -------------------------- Control instructions ------------------------ */
-
-  /* PINVK     */    instr_handler_pinvk     ,
-  /* INVK      */    instr_handler_invk      ,
-  /* RTRN      */    instr_handler_rtrn      ,
-  /* JMP       */    instr_handler_jmp       ,
-  /* JMPIF     */    instr_handler_jmpif     ,
-  /* JMPR      */    instr_handler_jmpr      ,
-  /* EXC       */    instr_handler_exc       ,
-  /* EXCOBJ    */    instr_handler_excobj    ,
-  /* CLREXC    */    instr_handler_clrexc    ,
-  /* JMPEXC    */    instr_handler_jmpexc    ,
-  /* EXIT      */    instr_handler_exit      ,
-
-  /* ------------------------- Function instructions ------------------------ */
-
-  /* PUTARG    */    instr_handler_putarg    ,
-  /* PUTKWARG  */    instr_handler_putkwarg  ,
-  /* PUTARGS   */    instr_handler_putargs   ,
-  /* PUTKWARGS */    instr_handler_putkwargs ,
-  /* GETARG    */    instr_handler_getarg    ,
-  /* GETKWARG  */    instr_handler_getkwarg  ,
-  /* GETARGS   */    instr_handler_getargs   ,
-  /* GETKWARGS */    instr_handler_getkwargs ,
-  /* HASARGS   */    instr_handler_hasargs   ,
-
-  /* ------------------------- Runtime instructions ------------------------- */
-
-  /* GC        */    instr_handler_gc        ,
-  /* DEBUG     */    instr_handler_debug     ,
-  /* DBGFRM    */    instr_handler_dbgfrm    ,
-  /* DBGMEM    */    instr_handler_dbgmem    ,
-  /* DBGVAR    */    instr_handler_dbgvar    ,
-  /* PRINT     */    instr_handler_print     ,
-  /* SWAP2     */    instr_handler_swap2     ,
-
-  /* ---------------- Arithmetic and logic instructions --------------------- */
-
-  /* POS      */     instr_handler_pos       ,
-  /* NEG      */     instr_handler_neg       ,
-  /* INC      */     instr_handler_inc       ,
-  /* DEC      */     instr_handler_dec       ,
-  /* ABS      */     instr_handler_abs       ,
-  /* SQRT     */     instr_handler_sqrt      ,
-  /* ADD      */     instr_handler_add       ,
-  /* SUB      */     instr_handler_sub       ,
-  /* MUL      */     instr_handler_mul       ,
-  /* DIV      */     instr_handler_div       ,
-  /* MOD      */     instr_handler_mod       ,
-  /* POW      */     instr_handler_pow       ,
-  /* BNOT     */     instr_handler_bnot      ,
-  /* BAND     */     instr_handler_band      ,
-  /* BOR      */     instr_handler_bor       ,
-  /* BXOR     */     instr_handler_bxor      ,
-  /* BLS      */     instr_handler_bls       ,
-  /* BRS      */     instr_handler_brs       ,
-  /* EQ       */     instr_handler_eq        ,
-  /* NEQ      */     instr_handler_neq       ,
-  /* GT       */     instr_handler_gt        ,
-  /* LT       */     instr_handler_lt        ,
-  /* GTE      */     instr_handler_gte       ,
-  /* LTE      */     instr_handler_lte       ,
-  /* LNOT     */     instr_handler_lnot      ,
-  /* LAND     */     instr_handler_land      ,
-  /* LOR      */     instr_handler_lor       ,
-  /* CMP      */     instr_handler_cmp       ,
-
-  /* ----------------- Native type creation instructions -------------------- */
-
-  /* INT8     */     instr_handler_int8      ,
-  /* UINT8    */     instr_handler_uint8     ,
-  /* INT16    */     instr_handler_int16     ,
-  /* UINT16   */     instr_handler_uint16    ,
-  /* INT32    */     instr_handler_int32     ,
-  /* UINT32   */     instr_handler_uint32    ,
-  /* INT64    */     instr_handler_int64     ,
-  /* UINT64   */     instr_handler_uint64    ,
-  /* BOOL     */     instr_handler_bool      ,
-  /* DEC1     */     instr_handler_dec1      ,
-  /* DEC2     */     instr_handler_dec2      ,
-  /* STR      */     instr_handler_str       ,
-  /* ARY      */     instr_handler_ary       ,
-  /* MAP      */     instr_handler_map       ,
-
-  /* ----------------- Native type conversion instructions ------------------ */
-
-  /* TOINT8   */     instr_handler_2int8     ,
-  /* TOUINT8  */     instr_handler_2uint8    ,
-  /* TOINT16  */     instr_handler_2int16    ,
-  /* TOUINT16 */     instr_handler_2uint16   ,
-  /* TOINT32  */     instr_handler_2int32    ,
-  /* TOUINT32 */     instr_handler_2uint32   ,
-  /* TOINT64  */     instr_handler_2int64    ,
-  /* TOUINT64 */     instr_handler_2uint64   ,
-  /* TOBOOL   */     instr_handler_2bool     ,
-  /* TODEC1   */     instr_handler_2dec1     ,
-  /* TODEC2   */     instr_handler_2dec2     ,
-  /* TOSTR    */     instr_handler_2str      ,
-  /* TOARY    */     instr_handler_2ary      ,
-  /* TOMAP    */     instr_handler_2map      ,
-
-  /* ----------------- Native type manipulation instructions ---------------- */
-
-  /* TRUTHY   */     instr_handler_truthy    ,
-  /* REPR     */     instr_handler_repr      ,
-  /* HASH     */     instr_handler_hash      ,
-  /* SLICE    */     instr_handler_slice     ,
-  /* STRIDE   */     instr_handler_stride    ,
-  /* REVERSE  */     instr_handler_reverse   ,
-  /* ROUND    */     instr_handler_round     ,
-
-  /* --------------------- String type instructions ------------------------- */
-
-  /* STRLEN   */     instr_handler_strlen    ,
-  /* STRAT    */     instr_handler_strat     ,
-  /* STRCLR   */     instr_handler_strclr    ,
-  /* STRAPD   */     instr_handler_strapd    ,
-  /* STRPSH   */     instr_handler_strpsh    ,
-  /* STRIST   */     instr_handler_strist    ,
-  /* STRIST2  */     instr_handler_strist2   ,
-  /* STRERS   */     instr_handler_strers    ,
-  /* STRERS2  */     instr_handler_strers2   ,
-  /* STRRPLC  */     instr_handler_strrplc   ,
-  /* STRSWP   */     instr_handler_strswp    ,
-  /* STRSUB   */     instr_handler_strsub    ,
-  /* STRSUB2  */     instr_handler_strsub2   ,
-  /* STRFND   */     instr_handler_strfnd    ,
-  /* STRFND2  */     instr_handler_strfnd2   ,
-  /* STRRFND  */     instr_handler_strrfnd   ,
-  /* STRRFND2 */     instr_handler_strrfnd2  ,
-
-  /* --------------------- Array type instructions -------------------------- */
-
-  /* ARYLEN   */     instr_handler_arylen    ,
-  /* ARYEMP   */     instr_handler_aryemp    ,
-  /* ARYAT    */     instr_handler_aryat     ,
-  /* ARYFRT   */     instr_handler_aryfrt    ,
-  /* ARYBAK   */     instr_handler_arybak    ,
-  /* ARYPUT   */     instr_handler_aryput    ,
-  /* ARYAPND  */     instr_handler_aryapnd   ,
-  /* ARYERS   */     instr_handler_aryers    ,
-  /* ARYPOP   */     instr_handler_arypop    ,
-  /* ARYSWP   */     instr_handler_aryswp    ,
-  /* ARYCLR   */     instr_handler_aryclr    ,
-  /* ARYMRG   */     instr_handler_arymrg    ,
-
-  /* --------------------- Map type instructions ---------------------------- */
-
-  /* MAPLEN   */     instr_handler_maplen    ,
-  /* MAPEMP   */     instr_handler_mapemp    ,
-  /* MAPFIND  */     instr_handler_mapfind   ,
-  /* MAPAT    */     instr_handler_mapat     ,
-  /* MAPPUT   */     instr_handler_mapput    ,
-  /* MAPSET   */     instr_handler_mapset    ,
-  /* MAPERS   */     instr_handler_mapers    ,
-  /* MAPCLR   */     instr_handler_mapclr    ,
-  /* MAPSWP   */     instr_handler_mapswp    ,
-  /* MAPKEYS  */     instr_handler_mapkeys   ,
-  /* MAPVALS  */     instr_handler_mapvals   ,
-  /* MAPMRG   */     instr_handler_mapmrg
-
+  COREVM_INSTR_HANDLERS(INSTR_HANDLER)
 };
 
+#undef INSTR_HANDLER
+
 #if defined(__clang__) and __clang__
   #pragma clang diagnostic pop
 #endif  /* #if defined(__clang__) and __clang__ */
 
 // -----------------------------------------------------------------------------
 
+namespace {
+
+// -----------------------------------------------------------------------------
+
+#define INSTR_HANDLER_CODE(code, handler) code,
+
+constexpr InstrEnum INSTR_HANDLER_CODES[] {
+  COREVM_INSTR_HANDLERS(INSTR_HANDLER_CODE)
+};
+
+#undef INSTR_HANDLER_CODE
+
+// -----------------------------------------------------------------------------
+
+constexpr bool
+instr_handler_codes_in_order(size_t i = 0)
+{
+  return i == INSTR_CODE_MAX ||
+    (INSTR_HANDLER_CODES[i] == i && instr_handler_codes_in_order(i + 1));
+}
+
+// -----------------------------------------------------------------------------
+
+static_assert(
+  sizeof(INSTR_HANDLER_CODES) / sizeof(INSTR_HANDLER_CODES[0]) ==
+    INSTR_CODE_MAX,
+  "Instruction handler list incompatibility"
+);
+
+static_assert(
+  instr_handler_codes_in_order(),
+  "Instruction handler list out of order"
+);
+
+// -----------------------------------------------------------------------------
+
+} /* end anonymous namespace */
+
+// -----------------------------------------------------------------------------
+
 
 /* --------------------------- INSTRUCTION HANDLERS ------------------------- */
 
@@ -309,10 +177,130 @@ execute_binary_operator_instr(Frame* frame, InterfaceFunc interface_func)
 
 // -----------------------------------------------------------------------------
 
+/**
+ * Runs a generic binary operator instruction, and quickens it in place into
+ * the form specialized for its operands if they are both of type `int64` or
+ * `decimal2`, unless it has fallen back from a quickened form before.
+ */
+template<instr_code_t Int64Code, instr_code_t Decimal2Code,
+  typename InterfaceFunc>
+static
+void
+execute_quickening_binary_operator_instr(const DecodedInstr& instr,
+  Frame* frame, InterfaceFunc interface_func)
+{
+#if COREVM_USE_QUICKENED_INSTRS
+  size_t eval_stack_size = frame->eval_stack_size();
+
+  if (eval_stack_size >= 2 && !(instr.flags & DecodedInstr::FLAG_POLYMORPHIC))
+  {
+    const types::NativeTypeValue& lhs =
+      frame->eval_stack_element(eval_stack_size - 1);
+    const types::NativeTypeValue& rhs =
+      frame->eval_stack_element(eval_stack_size - 2);
+
+    if (lhs.type_index() == rhs.type_index())
+    {
+      if (lhs.is<types::int64>())
+      {
+        instr.code = static_cast<uint16_t>(Int64Code);
+      }
+      else if (lhs.is<types::decimal2>())
+      {
+        instr.code = static_cast<uint16_t>(Decimal2Code);
+      }
+    }
+  }
+#endif
+
+  execute_binary_operator_instr(frame, interface_func);
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Reverts a quickened instruction to its generic form for good.
+ */
+static
+void
+dequicken_instr(const DecodedInstr& instr, instr_code_t generic_code)
+{
+  instr.code = static_cast<uint16_t>(generic_code);
+  instr.flags |= DecodedInstr::FLAG_POLYMORPHIC;
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Runs a quickened arithmetic instruction on two operands of type `T` in
+ * place, the same way the generic form does, or falls back to the generic
+ * form on operands of any other types.
+ */
+template<typename T, class Op, instr_code_t GenericCode,
+  typename InterfaceFunc>
+static
+void
+execute_quickened_arithmetic_instr(const DecodedInstr& instr, Frame* frame,
+  InterfaceFunc interface_func)
+{
+  size_t eval_stack_size = frame->eval_stack_size();
+
+  if (eval_stack_size >= 2)
+  {
+    types::NativeTypeValue& lhs = frame->eval_stack_element(eval_stack_size - 1);
+    types::NativeTypeValue& rhs = frame->eval_stack_element(eval_stack_size - 2);
+
+    if (lhs.is<T>() && rhs.is<T>())
+    {
+      T& lhs_val = lhs.get<T>();
+      lhs_val = Op().template operator()<T>(lhs_val, rhs.get<T>());
+      return;
+    }
+  }
+
+  dequicken_instr(instr, GenericCode);
+  execute_binary_operator_instr(frame, interface_func);
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Runs a quickened comparison instruction on two operands of type `T`, the
+ * same way the generic form does, or falls back to the generic form on
+ * operands of any other types.
+ */
+template<typename T, class Op, instr_code_t GenericCode,
+  typename InterfaceFunc>
+static
+void
+execute_quickened_comparison_instr(const DecodedInstr& instr, Frame* frame,
+  InterfaceFunc interface_func)
+{
+  size_t eval_stack_size = frame->eval_stack_size();
+
+  if (eval_stack_size >= 2)
+  {
+    types::NativeTypeValue& lhs = frame->eval_stack_element(eval_stack_size - 1);
+    types::NativeTypeValue& rhs = frame->eval_stack_element(eval_stack_size - 2);
+
+    if (lhs.is<T>() && rhs.is<T>())
+    {
+      lhs = types::NativeTypeValue(static_cast<types::boolean>(
+        Op().template operator()<T>(lhs.get<T>(), rhs.get<T>())));
+      return;
+    }
+  }
+
+  dequicken_instr(instr, GenericCode);
+  execute_binary_operator_instr(frame, interface_func);
+}
+
+// -----------------------------------------------------------------------------
+
 template<typename NativeType>
 static
 void
-execute_native_integer_type_creation_instr(const Instr& instr, Frame* frame)
+execute_native_integer_type_creation_instr(const DecodedInstr& instr, Frame* frame)
 {
   types::NativeTypeValue type_val(NativeType(instr.oprd1));
 
@@ -324,12 +312,21 @@ execute_native_integer_type_creation_instr(const Instr& instr, Frame* frame)
 template<typename NativeType>
 static
 void
-execute_native_floating_type_creation_instr(const Instr& instr, Frame* frame)
+execute_native_floating_type_creation_instr(const DecodedInstr& instr, Frame* frame)
 {
-  const Compartment* compartment = frame->compartment();
+  NativeType fpt_literal;
+
+  if (instr.flags & DecodedInstr::FLAG_FPT_LITERAL)
+  {
+    fpt_literal = static_cast<NativeType>(instr.fpt_literal);
+  }
+  else
+  {
+    const Compartment* compartment = frame->compartment();
 
-  auto encoding_key = static_cast<encoding_key_t>(instr.oprd1);
-  auto fpt_literal = static_cast<NativeType>(compartment->get_fpt_literal(encoding_key));
+    auto encoding_key = static_cast<encoding_key_t>(instr.oprd1);
+    fpt_literal = static_cast<NativeType>(compartment->get_fpt_literal(encoding_key));
+  }
 
   types::NativeTypeValue type_val(fpt_literal);
 
@@ -342,7 +339,7 @@ template<typename NativeType>
 static
 void
 execute_native_complex_type_creation_instr(
-  const Instr& /* instr */, Frame* frame)
+  const DecodedInstr& /* instr */, Frame* frame)
 {
   NativeType value;
   types::NativeTypeValue type_val(value);
@@ -522,168 +519,337 @@ execute_native_type_complex_instr_with_four_operands_in_place(Frame* frame,
 
 // -----------------------------------------------------------------------------
 
-void
-instr_handler_new(const Instr& /* instr */, Process& process,
-  Frame** /* frame_ptr */, InvocationCtx** /* invk_ctx_ptr */)
+/**
+ * Looks up the visible variable of the specified `ldobj` instruction, without
+ * throwing if it is not found.
+ */
+static
+bool
+try_load_visible_var(const DecodedInstr& instr, Frame* frame,
+  Process::dyobj_ptr* obj_ptr)
 {
-  auto obj = process.create_dyobj();
-  process.push_stack(obj);
+  variable_key_t key = static_cast<variable_key_t>(instr.oprd1);
+
+  if (instr.flags & DecodedInstr::FLAG_VAR_ADDR)
+  {
+    const uint32_t depth = VariableLayout::decode_depth(instr.oprd2);
+    const uint32_t slot = VariableLayout::decode_slot(instr.oprd2);
+
+    if (frame->get_visible_var_at(depth, slot, key, obj_ptr))
+    {
+      return true;
+    }
+  }
+
+  return frame->get_visible_var_through_ancestry(key, obj_ptr);
 }
 
 // -----------------------------------------------------------------------------
 
-void
-instr_handler_ldobj(const Instr& instr, Process& process,
-  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+/**
+ * Loads the visible variable of the specified `ldobj` instruction.
+ */
+static
+Process::dyobj_ptr
+load_visible_var(const DecodedInstr& instr, Frame* frame)
 {
-  Frame* frame = *frame_ptr;
-  variable_key_t key = static_cast<variable_key_t>(instr.oprd1);
   Process::dyobj_ptr obj = NULL;
 
-  if (frame->get_visible_var_through_ancestry(key, &obj))
-  {
-#if __DEBUG__
-    ASSERT(obj);
-#endif
-
-    process.push_stack(obj);
-  }
-  else
+  if (!try_load_visible_var(instr, frame, &obj))
   {
     std::string name;
-    const auto encoding_key = static_cast<encoding_key_t>(key);
+    const auto encoding_key = static_cast<encoding_key_t>(instr.oprd1);
     frame->compartment()->get_string_literal(encoding_key, &name);
     THROW(NameNotFoundError(name.c_str()));
   }
+
+#if __DEBUG__
+  ASSERT(obj);
+#endif
+
+  return obj;
 }
 
 // -----------------------------------------------------------------------------
 
+/**
+ * Stores an object as the visible variable of the specified `stobj`
+ * instruction.
+ */
+static
 void
-instr_handler_stobj(const Instr& instr, Process& process,
-  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+store_visible_var(const DecodedInstr& instr, Frame* frame,
+  Process::dyobj_ptr obj)
 {
-  variable_key_t key = static_cast<variable_key_t>(instr.oprd1);
-
-  Frame* frame = *frame_ptr;
-
-  auto obj = process.pop_stack();
-
   obj->manager().on_setattr();
 
-  frame->set_visible_var(key, obj);
+  if (instr.flags & DecodedInstr::FLAG_VAR_ADDR)
+  {
+    frame->set_visible_var_at(VariableLayout::decode_slot(instr.oprd2), obj);
+  }
+  else
+  {
+    frame->set_visible_var(static_cast<variable_key_t>(instr.oprd1), obj);
+  }
 }
 
 // -----------------------------------------------------------------------------
 
-void
-instr_handler_stobjn(const Instr& instr, Process& process,
-  Frame** /* frame_ptr */, InvocationCtx** /* invk_ctx_ptr */)
+/**
+ * Gets the attribute of an object named by the specified `getattr`
+ * instruction, through its inline cache if it has one.
+ */
+static
+Process::dyobj_ptr
+load_attr(const DecodedInstr& instr, Frame* frame, Process::dyobj_ptr obj)
 {
-  variable_key_t key = static_cast<variable_key_t>(instr.oprd1);
-  size_t n = static_cast<size_t>(instr.oprd2);
-
-  Frame& frame = process.top_nth_frame(n);
+  auto str_key = static_cast<encoding_key_t>(instr.oprd1);
+  auto compartment = frame->compartment();
 
-  auto obj = process.pop_stack();
+  if (instr.flags & DecodedInstr::FLAG_ATTR_CACHE)
+  {
+    auto& cache = compartment->get_attr_cache(instr.oprd2);
 
-  obj->manager().on_setattr();
+    Process::dyobj_ptr attr_obj = NULL;
+    if (cache.getattr(obj, compartment->get_attr_key(str_key), &attr_obj))
+    {
+      return attr_obj;
+    }
+  }
 
-  frame.set_visible_var(key, obj);
+  return getattr(obj, compartment, str_key);
 }
 
 // -----------------------------------------------------------------------------
 
+/**
+ * Pushes an invocation context for calling the specified object.
+ */
+static
 void
-instr_handler_getattr(const Instr& instr, Process& process,
-  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+prepare_invocation(Process& process, Process::dyobj_ptr obj,
+  InvocationCtx** invk_ctx_ptr)
 {
-  auto str_key = static_cast<encoding_key_t>(instr.oprd1);
-  auto frame = *frame_ptr;
+  if (obj->get_flag(dyobj::DynamicObjectFlagBits::DYOBJ_IS_NON_CALLABLE))
+  {
+    THROW(InvocationError(obj->id()));
+  }
 
-  auto obj = process.pop_stack();
+  const ClosureCtx& ctx = obj->closure_ctx();
+
+  if (ctx.compartment_id == NONESET_COMPARTMENT_ID)
+  {
+    THROW(CompartmentNotFoundError(ctx.compartment_id));
+  }
+
+  if (ctx.closure_id == NONESET_CLOSURE_ID)
+  {
+    THROW(ClosureNotFoundError(ctx.closure_id));
+  }
 
-  auto attr_obj = getattr(obj, frame->compartment(), str_key);
+  Compartment* compartment = nullptr;
+  process.get_compartment(ctx.compartment_id, &compartment);
 
-  process.push_stack(attr_obj);
+  Closure *closure = nullptr;
+  compartment->get_closure_by_id(ctx.closure_id, &closure);
+
+#if __DEBUG__
+  ASSERT(compartment);
+  ASSERT(closure);
+#endif
+
+  process.emplace_invocation_ctx(ctx, compartment, closure);
+  process.top_invocation_ctx(invk_ctx_ptr);
 }
 
 // -----------------------------------------------------------------------------
 
-void
-instr_handler_setattr(const Instr& instr, Process& process,
-  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+/**
+ * Gets the native string value of the specified `str` instruction.
+ */
+static
+types::NativeTypeValue
+string_literal_value(const DecodedInstr& instr, const Frame* frame)
 {
-  auto str_key = static_cast<encoding_key_t>(instr.oprd1);
-  auto frame = *frame_ptr;
-  auto attr_key = get_attr_key(frame->compartment(), str_key);
+  if (instr.flags & DecodedInstr::FLAG_STR_LITERAL)
+  {
+    return types::NativeTypeValue(types::string(*instr.str_literal));
+  }
 
-  auto attr_obj = process.pop_stack();
-  auto target_obj = process.top_stack();
+  std::string str;
 
-  if (target_obj->get_flag(dyobj::DynamicObjectFlagBits::DYOBJ_IS_IMMUTABLE))
+  if (instr.oprd1 > 0)
   {
-    THROW(InvalidOperationError(
-      str(boost::format("cannot mutate immutable object 0x%08x") % target_obj->id()).c_str()));
+    auto encoding_key = static_cast<runtime::encoding_key_t>(instr.oprd1);
+
+    const Compartment* compartment = frame->compartment();
+
+    str = compartment->get_string_literal(encoding_key);
   }
 
-  const char* attr_name = NULL;
-  frame->compartment()->get_string_literal(str_key, &attr_name);
-  process.insert_attr_name(attr_key, attr_name);
-  target_obj->putattr(attr_key, attr_obj);
-  attr_obj->manager().on_setattr();
+  return types::NativeTypeValue(types::string(str));
 }
 
 // -----------------------------------------------------------------------------
 
+/**
+ * Sets the native type value of an object that does not have one yet.
+ */
+static
 void
-instr_handler_delattr(const Instr& instr, Process& process,
-  Frame** /* frame_ptr */, InvocationCtx** /* invk_ctx_ptr */)
+init_type_value(Process& process, Process::dyobj_ptr obj,
+  const types::NativeTypeValue& type_val)
 {
-  dyobj::attr_key_t attr_key = static_cast<dyobj::attr_key_t>(instr.oprd1);
-
-  auto obj = process.pop_stack();
+#if __DEBUG__
+  ASSERT(!obj->has_type_value());
+#endif
 
-  if (obj->get_flag(dyobj::DynamicObjectFlagBits::DYOBJ_IS_IMMUTABLE))
-  {
-    THROW(InvalidOperationError(
-      str(boost::format("cannot mutate immutable object 0x%08x") % obj->id()).c_str()));
-  }
+  obj->set_type_value(process.insert_type_value(type_val));
+}
 
-  auto attr_obj = obj->getattr(attr_key);
-  attr_obj->manager().on_delattr();
-  obj->delattr(attr_key);
+// -----------------------------------------------------------------------------
 
+void
+instr_handler_new(const DecodedInstr& /* instr */, Process& process,
+  Frame** /* frame_ptr */, InvocationCtx** /* invk_ctx_ptr */)
+{
+  auto obj = process.create_dyobj();
   process.push_stack(obj);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_hasattr2(const Instr& /* instr */, Process& process,
+instr_handler_ldobj(const DecodedInstr& instr, Process& process,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  auto obj = process.top_stack();
-
-  const auto frame = *frame_ptr;
-  types::NativeTypeValue type_val = frame->top_eval_stack();
-
-  auto attr_str = types::get_intrinsic_value_from_type_value<types::native_string>(type_val);
-  std::string attr_str_value = static_cast<std::string>(attr_str);
-
-  dyobj::attr_key_t attr_key = dyobj::hash_attr_str(attr_str);
-
-  const bool res_value = obj->hasattr(attr_key);
-
-  types::NativeTypeValue res( (types::boolean(res_value)) );
-
-  frame->push_eval_stack(std::move(res));
+  process.push_stack(load_visible_var(instr, *frame_ptr));
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_getattr2(const Instr& /* instr */, Process& process,
+instr_handler_stobj(const DecodedInstr& instr, Process& process,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+{
+  auto obj = process.pop_stack();
+
+  store_visible_var(instr, *frame_ptr, obj);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+instr_handler_stobjn(const DecodedInstr& instr, Process& process,
+  Frame** /* frame_ptr */, InvocationCtx** /* invk_ctx_ptr */)
+{
+  variable_key_t key = static_cast<variable_key_t>(instr.oprd1);
+  size_t n = static_cast<size_t>(instr.oprd2);
+
+  Frame& frame = process.top_nth_frame(n);
+
+  auto obj = process.pop_stack();
+
+  obj->manager().on_setattr();
+
+  frame.set_visible_var(key, obj);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+instr_handler_getattr(const DecodedInstr& instr, Process& process,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+{
+  auto obj = process.pop_stack();
+
+  process.push_stack(load_attr(instr, *frame_ptr, obj));
+}
+
+// -----------------------------------------------------------------------------
+
+void
+instr_handler_setattr(const DecodedInstr& instr, Process& process,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+{
+  auto str_key = static_cast<encoding_key_t>(instr.oprd1);
+  auto frame = *frame_ptr;
+  auto attr_key = get_attr_key(frame->compartment(), str_key);
+
+  auto attr_obj = process.pop_stack();
+  auto target_obj = process.top_stack();
+
+  if (target_obj->get_flag(dyobj::DynamicObjectFlagBits::DYOBJ_IS_IMMUTABLE))
+  {
+    THROW(InvalidOperationError(
+      str(boost::format("cannot mutate immutable object 0x%08x") % target_obj->id()).c_str()));
+  }
+
+  if (instr.flags & DecodedInstr::FLAG_ATTR_CACHE)
+  {
+    auto& cache = frame->compartment()->get_attr_cache(instr.oprd2);
+    cache.putattr(target_obj, attr_key, attr_obj);
+  }
+  else
+  {
+    target_obj->putattr(attr_key, attr_obj);
+  }
+
+  attr_obj->manager().on_setattr();
+}
+
+// -----------------------------------------------------------------------------
+
+void
+instr_handler_delattr(const DecodedInstr& instr, Process& process,
+  Frame** /* frame_ptr */, InvocationCtx** /* invk_ctx_ptr */)
+{
+  dyobj::attr_key_t attr_key = static_cast<dyobj::attr_key_t>(instr.oprd1);
+
+  auto obj = process.pop_stack();
+
+  if (obj->get_flag(dyobj::DynamicObjectFlagBits::DYOBJ_IS_IMMUTABLE))
+  {
+    THROW(InvalidOperationError(
+      str(boost::format("cannot mutate immutable object 0x%08x") % obj->id()).c_str()));
+  }
+
+  auto attr_obj = obj->getattr(attr_key);
+  attr_obj->manager().on_delattr();
+  obj->delattr(attr_key);
+
+  process.push_stack(obj);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+instr_handler_hasattr2(const DecodedInstr& instr, Process& process,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+{
+  auto obj = process.top_stack();
+
+  const auto frame = *frame_ptr;
+  types::NativeTypeValue type_val = frame->top_eval_stack();
+
+  auto attr_str = types::get_intrinsic_value_from_type_value<types::native_string>(type_val);
+  std::string attr_str_value = static_cast<std::string>(attr_str);
+
+  dyobj::attr_key_t attr_key = dyobj::hash_attr_str(attr_str);
+
+  const bool res_value = instr.flags & DecodedInstr::FLAG_ATTR_CACHE ?
+    frame->compartment()->get_attr_cache(instr.oprd2).hasattr(obj, attr_key) :
+    obj->hasattr(attr_key);
+
+  types::NativeTypeValue res( (types::boolean(res_value)) );
+
+  frame->push_eval_stack(std::move(res));
+}
+
+// -----------------------------------------------------------------------------
+
+void
+instr_handler_getattr2(const DecodedInstr& instr, Process& process,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
   auto obj = process.pop_stack();
@@ -694,6 +860,18 @@ instr_handler_getattr2(const Instr& /* instr */, Process& process,
   auto attr_str = types::get_intrinsic_value_from_type_value<types::native_string>(type_val);
   std::string attr_str_value = static_cast<std::string>(attr_str);
 
+  if (instr.flags & DecodedInstr::FLAG_ATTR_CACHE)
+  {
+    auto& cache = frame->compartment()->get_attr_cache(instr.oprd2);
+
+    Process::dyobj_ptr attr_obj = NULL;
+    if (cache.getattr(obj, dyobj::hash_attr_str(attr_str_value), &attr_obj))
+    {
+      process.push_stack(attr_obj);
+      return;
+    }
+  }
+
   auto attr_obj = getattr(obj, attr_str_value);
 
   process.push_stack(attr_obj);
@@ -702,7 +880,7 @@ instr_handler_getattr2(const Instr& /* instr */, Process& process,
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_setattr2(const Instr& /* instr */, Process& process,
+instr_handler_setattr2(const DecodedInstr& /* instr */, Process& process,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
   auto attr_obj = process.pop_stack();
@@ -726,7 +904,7 @@ instr_handler_setattr2(const Instr& /* instr */, Process& process,
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_delattr2(const Instr& /* instr */, Process& process,
+instr_handler_delattr2(const DecodedInstr& /* instr */, Process& process,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
   auto obj = process.top_stack();
@@ -745,7 +923,7 @@ instr_handler_delattr2(const Instr& /* instr */, Process& process,
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_pop(const Instr& /* instr */, Process& process,
+instr_handler_pop(const DecodedInstr& /* instr */, Process& process,
   Frame** /* frame_ptr */, InvocationCtx** /* invk_ctx_ptr */)
 {
   process.pop_stack();
@@ -754,7 +932,7 @@ instr_handler_pop(const Instr& /* instr */, Process& process,
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_ldobj2(const Instr& instr, Process& process,
+instr_handler_ldobj2(const DecodedInstr& instr, Process& process,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
   Frame* frame = *frame_ptr;
@@ -781,7 +959,7 @@ instr_handler_ldobj2(const Instr& instr, Process& process,
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_stobj2(const Instr& instr, Process& process,
+instr_handler_stobj2(const DecodedInstr& instr, Process& process,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
   variable_key_t key = static_cast<variable_key_t>(instr.oprd1);
@@ -795,7 +973,7 @@ instr_handler_stobj2(const Instr& instr, Process& process,
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_delobj(const Instr& instr, Process& /* process */,
+instr_handler_delobj(const DecodedInstr& instr, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
   variable_key_t key = static_cast<variable_key_t>(instr.oprd1);
@@ -814,7 +992,7 @@ instr_handler_delobj(const Instr& instr, Process& /* process */,
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_delobj2(const Instr& instr, Process& /* process */,
+instr_handler_delobj2(const DecodedInstr& instr, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
   variable_key_t key = static_cast<variable_key_t>(instr.oprd1);
@@ -833,7 +1011,7 @@ instr_handler_delobj2(const Instr& instr, Process& /* process */,
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_getval(const Instr& /* instr */, Process& process,
+instr_handler_getval(const DecodedInstr& /* instr */, Process& process,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
   Frame* frame = *frame_ptr;
@@ -850,7 +1028,7 @@ instr_handler_getval(const Instr& /* instr */, Process& process,
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_setval(const Instr& /* instr */, Process& process,
+instr_handler_setval(const DecodedInstr& /* instr */, Process& process,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
   Frame* frame = *frame_ptr;
@@ -874,7 +1052,7 @@ instr_handler_setval(const Instr& /* instr */, Process& process,
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_getval2(const Instr& instr, Process& /* process */,
+instr_handler_getval2(const DecodedInstr& instr, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
   Frame* frame = *frame_ptr;
@@ -893,7 +1071,7 @@ instr_handler_getval2(const Instr& instr, Process& /* process */,
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_clrval(const Instr& /* instr */, Process& process,
+instr_handler_clrval(const DecodedInstr& /* instr */, Process& process,
   Frame** /* frame_ptr */, InvocationCtx** /* invk_ctx_ptr */)
 {
   auto obj = process.top_stack();
@@ -910,7 +1088,7 @@ instr_handler_clrval(const Instr& /* instr */, Process& process,
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_cpyval(const Instr& instr, Process& process,
+instr_handler_cpyval(const DecodedInstr& instr, Process& process,
   Frame** /* frame_ptr */, InvocationCtx** /* invk_ctx_ptr */)
 {
   auto src_obj = process.pop_stack();
@@ -1009,7 +1187,7 @@ instr_handler_cpyval(const Instr& instr, Process& process,
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_cpyrepr(const Instr& /* instr */, Process& process,
+instr_handler_cpyrepr(const DecodedInstr& /* instr */, Process& process,
   Frame** /* frame_ptr */, InvocationCtx** /* invk_ctx_ptr */)
 {
   Process::dyobj_ptr src_obj = process.pop_stack();
@@ -1030,7 +1208,7 @@ instr_handler_cpyrepr(const Instr& /* instr */, Process& process,
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_istruthy(const Instr& /* instr */, Process& process,
+instr_handler_istruthy(const DecodedInstr& /* instr */, Process& process,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
   Frame* frame = *frame_ptr;
@@ -1052,7 +1230,7 @@ instr_handler_istruthy(const Instr& /* instr */, Process& process,
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_objeq(const Instr& /* instr */, Process& process,
+instr_handler_objeq(const DecodedInstr& /* instr */, Process& process,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
   auto obj1 = process.pop_stack();
@@ -1067,7 +1245,7 @@ instr_handler_objeq(const Instr& /* instr */, Process& process,
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_objneq(const Instr& /* instr */, Process& process,
+instr_handler_objneq(const DecodedInstr& /* instr */, Process& process,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
   auto obj1 = process.pop_stack();
@@ -1082,7 +1260,7 @@ instr_handler_objneq(const Instr& /* instr */, Process& process,
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_setctx(const Instr& instr, Process& process,
+instr_handler_setctx(const DecodedInstr& instr, Process& process,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
   auto obj = process.top_stack();
@@ -1098,7 +1276,7 @@ instr_handler_setctx(const Instr& instr, Process& process,
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_cldobj(const Instr& instr, Process& process,
+instr_handler_cldobj(const DecodedInstr& instr, Process& process,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
   Frame* frame = *frame_ptr;
@@ -1137,7 +1315,7 @@ instr_handler_cldobj(const Instr& instr, Process& process,
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_rsetattrs(const Instr& instr, Process& process,
+instr_handler_rsetattrs(const DecodedInstr& instr, Process& process,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
   auto str_key = static_cast<encoding_key_t>(instr.oprd1);
@@ -1160,17 +1338,12 @@ instr_handler_rsetattrs(const Instr& instr, Process& process,
     attr_obj->manager().on_setattr();
     obj.putattr(attr_key, attr_obj);
   }
-
-  const char* attr_name = NULL;
-  frame->compartment()->get_string_literal(static_cast<encoding_key_t>(str_key),
-    &attr_name);
-  process.insert_attr_name(attr_key, attr_name);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_setattrs(const Instr& instr, Process& process,
+instr_handler_setattrs(const DecodedInstr& instr, Process& process,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
   auto self_str_key = static_cast<encoding_key_t>(instr.oprd1);
@@ -1208,7 +1381,7 @@ instr_handler_setattrs(const Instr& instr, Process& process,
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_putobj(const Instr& /* instr */, Process& process,
+instr_handler_putobj(const DecodedInstr& /* instr */, Process& process,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
   auto ptr = process.top_stack();
@@ -1223,7 +1396,7 @@ instr_handler_putobj(const Instr& /* instr */, Process& process,
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_getobj(const Instr& /* instr */, Process& process,
+instr_handler_getobj(const DecodedInstr& /* instr */, Process& process,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
   Frame* frame = *frame_ptr;
@@ -1237,7 +1410,7 @@ instr_handler_getobj(const Instr& /* instr */, Process& process,
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_swap(const Instr& /* instr */, Process& process,
+instr_handler_swap(const DecodedInstr& /* instr */, Process& process,
   Frame** /* frame_ptr */, InvocationCtx** /* invk_ctx_ptr */)
 {
   process.swap_stack();
@@ -1246,7 +1419,7 @@ instr_handler_swap(const Instr& /* instr */, Process& process,
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_setflgc(const Instr& instr, Process& process,
+instr_handler_setflgc(const DecodedInstr& instr, Process& process,
   Frame** /* frame_ptr */, InvocationCtx** /* invk_ctx_ptr */)
 {
   auto obj = process.top_stack();
@@ -1266,7 +1439,7 @@ instr_handler_setflgc(const Instr& instr, Process& process,
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_setfldel(const Instr& instr, Process& process,
+instr_handler_setfldel(const DecodedInstr& instr, Process& process,
   Frame** /* frame_ptr */, InvocationCtx** /* invk_ctx_ptr */)
 {
   auto obj = process.top_stack();
@@ -1286,7 +1459,7 @@ instr_handler_setfldel(const Instr& instr, Process& process,
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_setflcall(const Instr& instr, Process& process,
+instr_handler_setflcall(const DecodedInstr& instr, Process& process,
   Frame** /* frame_ptr */, InvocationCtx** /* invk_ctx_ptr */)
 {
   auto obj = process.top_stack();
@@ -1306,7 +1479,7 @@ instr_handler_setflcall(const Instr& instr, Process& process,
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_setflmute(const Instr& instr, Process& process,
+instr_handler_setflmute(const DecodedInstr& instr, Process& process,
   Frame** /* frame_ptr */, InvocationCtx** /* invk_ctx_ptr */)
 {
   auto obj = process.top_stack();
@@ -1326,47 +1499,16 @@ instr_handler_setflmute(const Instr& instr, Process& process,
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_pinvk(const Instr& /* instr */, Process& process,
+instr_handler_pinvk(const DecodedInstr& /* instr */, Process& process,
   Frame** /* frame_ptr */, InvocationCtx** invk_ctx_ptr)
 {
-  auto obj = process.top_stack();
-
-  if (obj->get_flag(dyobj::DynamicObjectFlagBits::DYOBJ_IS_NON_CALLABLE))
-  {
-    THROW(InvocationError(obj->id()));
-  }
-
-  const ClosureCtx& ctx = obj->closure_ctx();
-
-  if (ctx.compartment_id == NONESET_COMPARTMENT_ID)
-  {
-    THROW(CompartmentNotFoundError(ctx.compartment_id));
-  }
-
-  if (ctx.closure_id == NONESET_CLOSURE_ID)
-  {
-    THROW(ClosureNotFoundError(ctx.closure_id));
-  }
-
-  Compartment* compartment = nullptr;
-  process.get_compartment(ctx.compartment_id, &compartment);
-
-  Closure *closure = nullptr;
-  compartment->get_closure_by_id(ctx.closure_id, &closure);
-
-#if __DEBUG__
-  ASSERT(compartment);
-  ASSERT(closure);
-#endif
-
-  process.emplace_invocation_ctx(ctx, compartment, closure);
-  process.top_invocation_ctx(invk_ctx_ptr);
+  prepare_invocation(process, process.top_stack(), invk_ctx_ptr);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_invk(const Instr& /* instr */, Process& process,
+instr_handler_invk(const DecodedInstr& /* instr */, Process& process,
   Frame** frame_ptr, InvocationCtx** invk_ctx_ptr)
 {
   InvocationCtx* invk_ctx = *invk_ctx_ptr;
@@ -1382,7 +1524,7 @@ instr_handler_invk(const Instr& /* instr */, Process& process,
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_rtrn(const Instr& /* instr */, Process& process,
+instr_handler_rtrn(const DecodedInstr& /* instr */, Process& process,
   Frame** frame_ptr, InvocationCtx** invk_ctx_ptr)
 {
   Frame* frame = *frame_ptr;
@@ -1412,7 +1554,7 @@ instr_handler_rtrn(const Instr& /* instr */, Process& process,
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_jmp(const Instr& instr, Process& process,
+instr_handler_jmp(const DecodedInstr& instr, Process& process,
   Frame** /* frame_ptr */, InvocationCtx** /* invk_ctx_ptr */)
 {
   instr_addr_t starting_addr = process.pc();
@@ -1431,7 +1573,7 @@ instr_handler_jmp(const Instr& instr, Process& process,
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_jmpif(const Instr& instr, Process& process,
+instr_handler_jmpif(const DecodedInstr& instr, Process& process,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
   Frame* frame = *frame_ptr;
@@ -1459,7 +1601,7 @@ instr_handler_jmpif(const Instr& instr, Process& process,
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_jmpr(const Instr& instr, Process& process,
+instr_handler_jmpr(const DecodedInstr& instr, Process& process,
   Frame** /* frame_ptr */, InvocationCtx** /* invk_ctx_ptr */)
 {
   const instr_addr_t starting_addr = 0;
@@ -1479,7 +1621,7 @@ instr_handler_jmpr(const Instr& instr, Process& process,
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_exc(const Instr& instr, Process& process,
+instr_handler_exc(const DecodedInstr& instr, Process& process,
   Frame** frame_ptr, InvocationCtx** invk_ctx_ptr)
 {
   bool search_catch_sites = static_cast<bool>(instr.oprd1);
@@ -1501,23 +1643,21 @@ instr_handler_exc(const Instr& instr, Process& process,
 
       uint32_t index = static_cast<uint32_t>(process.pc() - starting_addr);
 
-      if (search_catch_sites)
+      // Frames of closures without catch sites are unwound right away.
+      if (!closure->catch_sites.empty())
       {
-        const auto& catch_sites = closure->catch_sites;
+        Compartment* compartment = frame.compartment();
 
-        auto itr = std::find_if(
-          catch_sites.begin(),
-          catch_sites.end(),
-          [&index](const CatchSite& catch_site) -> bool {
-            return index >= catch_site.from && index <= catch_site.to;
-          }
-        );
+        const ExcTable* exc_table =
+          compartment ? compartment->get_exc_table(closure) : NULL;
 
-        if (itr != catch_sites.end())
+        if (exc_table)
         {
-          const CatchSite& catch_site = *itr;
-
-          dst = catch_site.dst;
+          exc_table->find(index, &dst);
+        }
+        else
+        {
+          ExcTable::find(closure->catch_sites, index, &dst);
         }
       }
     }
@@ -1561,7 +1701,7 @@ instr_handler_exc(const Instr& instr, Process& process,
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_excobj(const Instr& /* instr */, Process& process,
+instr_handler_excobj(const DecodedInstr& /* instr */, Process& process,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
   const Frame* frame = *frame_ptr;
@@ -1581,7 +1721,7 @@ instr_handler_excobj(const Instr& /* instr */, Process& process,
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_clrexc(const Instr& /* instr */, Process& /* process */,
+instr_handler_clrexc(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
   Frame* frame = *frame_ptr;
@@ -1591,7 +1731,7 @@ instr_handler_clrexc(const Instr& /* instr */, Process& /* process */,
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_jmpexc(const Instr& instr, Process& process,
+instr_handler_jmpexc(const DecodedInstr& instr, Process& process,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
   const Frame* frame = *frame_ptr;
@@ -1625,7 +1765,7 @@ instr_handler_jmpexc(const Instr& instr, Process& process,
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_exit(const Instr& /* instr */, Process& process,
+instr_handler_exit(const DecodedInstr& /* instr */, Process& process,
   Frame** /* frame_ptr */, InvocationCtx** /* invk_ctx_ptr */)
 {
   process.terminate_exec();
@@ -1634,7 +1774,7 @@ instr_handler_exit(const Instr& /* instr */, Process& process,
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_putarg(const Instr& /* instr */, Process& process,
+instr_handler_putarg(const DecodedInstr& /* instr */, Process& process,
   Frame** /* frame_ptr */, InvocationCtx** invk_ctx_ptr)
 {
   auto obj = process.pop_stack();
@@ -1646,7 +1786,7 @@ instr_handler_putarg(const Instr& /* instr */, Process& process,
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_putkwarg(const Instr& instr, Process& process,
+instr_handler_putkwarg(const DecodedInstr& instr, Process& process,
   Frame** /* frame_ptr */, InvocationCtx** invk_ctx_ptr)
 {
   variable_key_t key = static_cast<variable_key_t>(instr.oprd1);
@@ -1660,7 +1800,7 @@ instr_handler_putkwarg(const Instr& instr, Process& process,
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_putargs(const Instr& /* instr */, Process& process,
+instr_handler_putargs(const DecodedInstr& /* instr */, Process& process,
   Frame** /* frame_ptr */, InvocationCtx** invk_ctx_ptr)
 {
   InvocationCtx* invk_ctx = *invk_ctx_ptr;
@@ -1683,7 +1823,7 @@ instr_handler_putargs(const Instr& /* instr */, Process& process,
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_putkwargs(const Instr& /* instr */, Process& process,
+instr_handler_putkwargs(const DecodedInstr& /* instr */, Process& process,
   Frame** /* frame_ptr */, InvocationCtx** invk_ctx_ptr)
 {
   InvocationCtx* invk_ctx = *invk_ctx_ptr;
@@ -1709,7 +1849,7 @@ instr_handler_putkwargs(const Instr& /* instr */, Process& process,
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_getarg(const Instr& instr, Process& /* process */,
+instr_handler_getarg(const DecodedInstr& instr, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** invk_ctx_ptr)
 {
   InvocationCtx* invk_ctx = *invk_ctx_ptr;
@@ -1719,13 +1859,21 @@ instr_handler_getarg(const Instr& instr, Process& /* process */,
   variable_key_t key = static_cast<variable_key_t>(instr.oprd1);
 
   Frame* frame = *frame_ptr;
-  frame->set_visible_var(key, obj);
+
+  if (instr.flags & DecodedInstr::FLAG_VAR_ADDR)
+  {
+    frame->set_visible_var_at(VariableLayout::decode_slot(instr.oprd2), obj);
+  }
+  else
+  {
+    frame->set_visible_var(key, obj);
+  }
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_getkwarg(const Instr& instr, Process& process,
+instr_handler_getkwarg(const DecodedInstr& instr, Process& process,
   Frame** frame_ptr, InvocationCtx** invk_ctx_ptr)
 {
   InvocationCtx* invk_ctx = *invk_ctx_ptr;
@@ -1746,7 +1894,7 @@ instr_handler_getkwarg(const Instr& instr, Process& process,
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_getargs(const Instr& /* instr */, Process& /* process */,
+instr_handler_getargs(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** invk_ctx_ptr)
 {
   Frame* frame = *frame_ptr;
@@ -1768,7 +1916,7 @@ instr_handler_getargs(const Instr& /* instr */, Process& /* process */,
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_getkwargs(const Instr& /* instr */, Process& /* process */,
+instr_handler_getkwargs(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** invk_ctx_ptr)
 {
   Frame* frame = *frame_ptr;
@@ -1795,1159 +1943,1762 @@ instr_handler_getkwargs(const Instr& /* instr */, Process& /* process */,
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_hasargs(const Instr& /* instr */, Process& /* process */,
-  Frame** frame_ptr, InvocationCtx** invk_ctx_ptr)
+instr_handler_hasargs(const DecodedInstr& /* instr */, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** invk_ctx_ptr)
+{
+  Frame* frame = *frame_ptr;
+  InvocationCtx* invk_ctx = *invk_ctx_ptr;
+
+  const bool result = invk_ctx->has_params();
+
+  types::NativeTypeValue type_val( (types::boolean(result)) );
+
+  frame->push_eval_stack(std::move(type_val));
+}
+
+// -----------------------------------------------------------------------------
+
+void
+instr_handler_gc(const DecodedInstr& /* instr */, Process& process,
+  Frame** /* frame_ptr */, InvocationCtx** /* invk_ctx_ptr */)
+{
+  process.do_gc();
+}
+
+// -----------------------------------------------------------------------------
+
+void
+instr_handler_debug(const DecodedInstr& instr, Process& process,
+  Frame** /* frame_ptr */, InvocationCtx** /* invk_ctx_ptr */)
+{
+  const uint32_t opts = static_cast<uint32_t>(instr.oprd1);
+  Process::Printer printer(process, opts);
+  printer(std::cout) << std::endl;
+}
+
+// -----------------------------------------------------------------------------
+
+void
+instr_handler_dbgfrm(const DecodedInstr& instr, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+{
+  auto& frame = *frame_ptr;
+
+  const uint32_t opts = static_cast<uint32_t>(instr.oprd1);
+  FramePrinter printer(*frame, opts);
+  printer(std::cout) << std::endl;
+}
+
+// -----------------------------------------------------------------------------
+
+void
+instr_handler_dbgmem(const DecodedInstr& instr, Process& /* process */,
+  Frame** /* frame_ptr */, InvocationCtx** /* invk_ctx_ptr */)
+{
+  const uint32_t opts = static_cast<uint32_t>(instr.oprd1);
+  DbgMemPrinter printer(opts);
+  printer(std::cout) << std::endl;
+}
+
+// -----------------------------------------------------------------------------
+
+void
+instr_handler_dbgvar(const DecodedInstr& instr, Process& process,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+{
+  const encoding_key_t encoding_key = static_cast<encoding_key_t>(instr.oprd1);
+
+  Frame* frame = *frame_ptr;
+  std::string variable_name;
+  frame->compartment()->get_string_literal(encoding_key, &variable_name);
+
+  const variable_key_t key = static_cast<variable_key_t>(instr.oprd1);
+  Process::dyobj_ptr obj = NULL;
+
+  if (frame->get_visible_var_through_ancestry(key, &obj))
+  {
+#if __DEBUG__
+    ASSERT(obj);
+#endif
+  }
+  else
+  {
+    std::string name;
+    frame->compartment()->get_string_literal(encoding_key, &name);
+    THROW(NameNotFoundError(name.c_str()));
+  }
+
+  DbgvarPrinter printer(process, *frame, variable_name.c_str(), obj);
+  printer(std::cout);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+instr_handler_print(const DecodedInstr& instr, Process& process,
+  Frame** /* frame_ptr */, InvocationCtx** /* invk_ctx_ptr */)
+{
+  auto obj = process.top_stack();
+
+  if (!obj->has_type_value())
+  {
+    THROW(NativeTypeValueNotFoundError());
+  }
+
+  const types::NativeTypeValue& type_val = obj->type_value();
+
+  types::native_string native_str =
+    types::get_intrinsic_value_from_type_value<types::native_string>(type_val);
+
+  static const char* PRINT_FORMATS[2] = { "%s", "%s\n" };
+
+  const size_t index = static_cast<size_t>(instr.oprd1) % 2;
+
+  printf(PRINT_FORMATS[index], native_str.c_str());
+}
+
+// -----------------------------------------------------------------------------
+
+void
+instr_handler_swap2(const DecodedInstr& /* instr */, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+{
+  Frame* frame = *frame_ptr;
+  frame->swap_eval_stack();
+}
+
+// -----------------------------------------------------------------------------
+
+void
+instr_handler_pos(const DecodedInstr& /* instr */, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+{
+  execute_unary_operator_instr(*frame_ptr, types::interface_apply_positive_operator);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+instr_handler_neg(const DecodedInstr& /* instr */, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+{
+  execute_unary_operator_instr(*frame_ptr, types::interface_apply_negation_operator);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+instr_handler_inc(const DecodedInstr& /* instr */, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+{
+  execute_unary_operator_instr(*frame_ptr, types::interface_apply_increment_operator);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+instr_handler_dec(const DecodedInstr& /* instr */, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+{
+  execute_unary_operator_instr(*frame_ptr, types::interface_apply_decrement_operator);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+instr_handler_abs(const DecodedInstr& /* instr */, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+{
+  execute_unary_operator_instr(*frame_ptr, types::interface_apply_abs_operator);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+instr_handler_sqrt(const DecodedInstr& /* instr */, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+{
+  execute_unary_operator_instr(*frame_ptr, types::interface_apply_sqrt_operator);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+instr_handler_add(const DecodedInstr& instr, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+{
+  execute_quickening_binary_operator_instr<ADDI64, ADDDEC2>(instr, *frame_ptr,
+    types::interface_apply_addition_operator);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+instr_handler_sub(const DecodedInstr& instr, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+{
+  execute_quickening_binary_operator_instr<SUBI64, SUBDEC2>(instr, *frame_ptr,
+    types::interface_apply_subtraction_operator);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+instr_handler_mul(const DecodedInstr& instr, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+{
+  execute_quickening_binary_operator_instr<MULI64, MULDEC2>(instr, *frame_ptr,
+    types::interface_apply_multiplication_operator);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+instr_handler_div(const DecodedInstr& instr, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+{
+  execute_quickening_binary_operator_instr<DIVI64, DIVDEC2>(instr, *frame_ptr,
+    types::interface_apply_division_operator);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+instr_handler_mod(const DecodedInstr& instr, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+{
+  execute_quickening_binary_operator_instr<MODI64, MODDEC2>(instr, *frame_ptr,
+    types::interface_apply_modulus_operator);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+instr_handler_pow(const DecodedInstr& /* instr */, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+{
+  execute_binary_operator_instr(*frame_ptr, types::interface_apply_pow_operator);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+instr_handler_bnot(const DecodedInstr& /* instr */, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+{
+  execute_unary_operator_instr(*frame_ptr, types::interface_apply_bitwise_not_operator);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+instr_handler_band(const DecodedInstr& /* instr */, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+{
+  execute_binary_operator_instr(*frame_ptr, types::interface_apply_bitwise_and_operator);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+instr_handler_bor(const DecodedInstr& /* instr */, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+{
+  execute_binary_operator_instr(*frame_ptr, types::interface_apply_bitwise_or_operator);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+instr_handler_bxor(const DecodedInstr& /* instr */, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+{
+  execute_binary_operator_instr(*frame_ptr, types::interface_apply_bitwise_xor_operator);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+instr_handler_bls(const DecodedInstr& /* instr */, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+{
+  execute_binary_operator_instr(*frame_ptr, types::interface_apply_bitwise_left_shift_operator);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+instr_handler_brs(const DecodedInstr& /* instr */, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+{
+  execute_binary_operator_instr(*frame_ptr, types::interface_apply_bitwise_right_shift_operator);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+instr_handler_eq(const DecodedInstr& instr, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+{
+  execute_quickening_binary_operator_instr<EQI64, EQDEC2>(instr, *frame_ptr,
+    types::interface_apply_eq_operator);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+instr_handler_neq(const DecodedInstr& instr, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+{
+  execute_quickening_binary_operator_instr<NEQI64, NEQDEC2>(instr, *frame_ptr,
+    types::interface_apply_neq_operator);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+instr_handler_gt(const DecodedInstr& instr, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+{
+  execute_quickening_binary_operator_instr<GTI64, GTDEC2>(instr, *frame_ptr,
+    types::interface_apply_gt_operator);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+instr_handler_lt(const DecodedInstr& instr, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+{
+  execute_quickening_binary_operator_instr<LTI64, LTDEC2>(instr, *frame_ptr,
+    types::interface_apply_lt_operator);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+instr_handler_gte(const DecodedInstr& instr, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+{
+  execute_quickening_binary_operator_instr<GTEI64, GTEDEC2>(instr, *frame_ptr,
+    types::interface_apply_gte_operator);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+instr_handler_lte(const DecodedInstr& instr, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+{
+  execute_quickening_binary_operator_instr<LTEI64, LTEDEC2>(instr, *frame_ptr,
+    types::interface_apply_lte_operator);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+instr_handler_lnot(const DecodedInstr& /* instr */, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+{
+  execute_unary_operator_instr(*frame_ptr, types::interface_apply_logical_not_operator);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+instr_handler_land(const DecodedInstr& /* instr */, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+{
+  execute_binary_operator_instr(*frame_ptr, types::interface_apply_logical_and_operator);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+instr_handler_lor(const DecodedInstr& /* instr */, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+{
+  execute_binary_operator_instr(*frame_ptr, types::interface_apply_logical_or_operator);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+instr_handler_cmp(
+  const DecodedInstr& /* instr */, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+{
+  execute_binary_operator_instr(*frame_ptr, types::interface_apply_cmp_operator);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+instr_handler_int8(const DecodedInstr& instr, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+{
+  execute_native_integer_type_creation_instr<types::int8>(instr, *frame_ptr);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+instr_handler_uint8(const DecodedInstr& instr, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+{
+  execute_native_integer_type_creation_instr<types::uint8>(instr, *frame_ptr);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+instr_handler_int16(const DecodedInstr& instr, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+{
+  execute_native_integer_type_creation_instr<types::int16>(instr, *frame_ptr);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+instr_handler_uint16(const DecodedInstr& instr, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+{
+  execute_native_integer_type_creation_instr<types::uint16>(instr, *frame_ptr);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+instr_handler_int32(const DecodedInstr& instr, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+{
+  execute_native_integer_type_creation_instr<types::int32>(instr, *frame_ptr);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+instr_handler_uint32(const DecodedInstr& instr, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+{
+  execute_native_integer_type_creation_instr<types::uint32>(instr, *frame_ptr);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+instr_handler_int64(const DecodedInstr& instr, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  Frame* frame = *frame_ptr;
-  InvocationCtx* invk_ctx = *invk_ctx_ptr;
-
-  const bool result = invk_ctx->has_params();
-
-  types::NativeTypeValue type_val( (types::boolean(result)) );
-
-  frame->push_eval_stack(std::move(type_val));
+  execute_native_integer_type_creation_instr<types::int64>(instr, *frame_ptr);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_gc(const Instr& /* instr */, Process& process,
-  Frame** /* frame_ptr */, InvocationCtx** /* invk_ctx_ptr */)
+instr_handler_uint64(const DecodedInstr& instr, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  process.do_gc();
+  execute_native_integer_type_creation_instr<types::uint64>(instr, *frame_ptr);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_debug(const Instr& instr, Process& process,
-  Frame** /* frame_ptr */, InvocationCtx** /* invk_ctx_ptr */)
+instr_handler_bool(const DecodedInstr& instr, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  const uint32_t opts = static_cast<uint32_t>(instr.oprd1);
-  Process::Printer printer(process, opts);
-  printer(std::cout) << std::endl;
+  execute_native_integer_type_creation_instr<types::boolean>(instr, *frame_ptr);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_dbgfrm(const Instr& instr, Process& /* process */,
+instr_handler_dec1(const DecodedInstr& instr, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  auto& frame = *frame_ptr;
-
-  const uint32_t opts = static_cast<uint32_t>(instr.oprd1);
-  FramePrinter printer(*frame, opts);
-  printer(std::cout) << std::endl;
+  execute_native_floating_type_creation_instr<types::decimal>(instr, *frame_ptr);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_dbgmem(const Instr& instr, Process& /* process */,
-  Frame** /* frame_ptr */, InvocationCtx** /* invk_ctx_ptr */)
+instr_handler_dec2(const DecodedInstr& instr, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  const uint32_t opts = static_cast<uint32_t>(instr.oprd1);
-  DbgMemPrinter printer(opts);
-  printer(std::cout) << std::endl;
+  execute_native_floating_type_creation_instr<types::decimal2>(instr, *frame_ptr);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_dbgvar(const Instr& instr, Process& process,
+instr_handler_str(const DecodedInstr& instr, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  const encoding_key_t encoding_key = static_cast<encoding_key_t>(instr.oprd1);
-
+  // String type is different than other complex types.
   Frame* frame = *frame_ptr;
-  std::string variable_name;
-  frame->compartment()->get_string_literal(encoding_key, &variable_name);
 
-  const variable_key_t key = static_cast<variable_key_t>(instr.oprd1);
-  Process::dyobj_ptr obj = NULL;
+  frame->push_eval_stack(string_literal_value(instr, frame));
+}
 
-  if (frame->get_visible_var_through_ancestry(key, &obj))
-  {
-#if __DEBUG__
-    ASSERT(obj);
-#endif
-  }
-  else
-  {
-    std::string name;
-    frame->compartment()->get_string_literal(encoding_key, &name);
-    THROW(NameNotFoundError(name.c_str()));
-  }
+// -----------------------------------------------------------------------------
 
-  DbgvarPrinter printer(process, *frame, variable_name.c_str(), obj);
-  printer(std::cout);
+void
+instr_handler_ary(const DecodedInstr& instr, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+{
+  execute_native_complex_type_creation_instr<types::array>(instr, *frame_ptr);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_print(const Instr& instr, Process& process,
-  Frame** /* frame_ptr */, InvocationCtx** /* invk_ctx_ptr */)
+instr_handler_map(const DecodedInstr& instr, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  auto obj = process.top_stack();
+  execute_native_complex_type_creation_instr<types::map>(instr, *frame_ptr);
+}
 
-  if (!obj->has_type_value())
-  {
-    THROW(NativeTypeValueNotFoundError());
-  }
+// -----------------------------------------------------------------------------
 
-  const types::NativeTypeValue& type_val = obj->type_value();
+void
+instr_handler_vec(const DecodedInstr& instr, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+{
+  execute_native_complex_type_creation_instr<types::vector>(instr, *frame_ptr);
+}
 
-  types::native_string native_str =
-    types::get_intrinsic_value_from_type_value<types::native_string>(type_val);
+// -----------------------------------------------------------------------------
 
-  static const char* PRINT_FORMATS[2] = { "%s", "%s\n" };
+void
+instr_handler_2int8(const DecodedInstr& /* instr */, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+{
+  execute_native_type_conversion_instr(*frame_ptr, types::interface_to_int8);
+}
 
-  const size_t index = static_cast<size_t>(instr.oprd1) % 2;
+// -----------------------------------------------------------------------------
 
-  printf(PRINT_FORMATS[index], native_str.c_str());
+void
+instr_handler_2uint8(
+  const DecodedInstr& /* instr */, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+{
+  execute_native_type_conversion_instr(*frame_ptr, types::interface_to_uint8);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_swap2(const Instr& /* instr */, Process& /* process */,
+instr_handler_2int16(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  Frame* frame = *frame_ptr;
-  frame->swap_eval_stack();
+  execute_native_type_conversion_instr(*frame_ptr, types::interface_to_int16);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_pos(const Instr& /* instr */, Process& /* process */,
+instr_handler_2uint16(
+  const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_unary_operator_instr(*frame_ptr, types::interface_apply_positive_operator);
+  execute_native_type_conversion_instr(*frame_ptr, types::interface_to_uint16);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_neg(const Instr& /* instr */, Process& /* process */,
+instr_handler_2int32(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_unary_operator_instr(*frame_ptr, types::interface_apply_negation_operator);
+  execute_native_type_conversion_instr(*frame_ptr, types::interface_to_int32);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_inc(const Instr& /* instr */, Process& /* process */,
+instr_handler_2uint32(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_unary_operator_instr(*frame_ptr, types::interface_apply_increment_operator);
+  execute_native_type_conversion_instr(*frame_ptr, types::interface_to_uint32);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_dec(const Instr& /* instr */, Process& /* process */,
+instr_handler_2int64(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_unary_operator_instr(*frame_ptr, types::interface_apply_decrement_operator);
+  execute_native_type_conversion_instr(*frame_ptr, types::interface_to_int64);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_abs(const Instr& /* instr */, Process& /* process */,
+instr_handler_2uint64(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_unary_operator_instr(*frame_ptr, types::interface_apply_abs_operator);
+  execute_native_type_conversion_instr(*frame_ptr, types::interface_to_uint64);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_sqrt(const Instr& /* instr */, Process& /* process */,
+instr_handler_2bool(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_unary_operator_instr(*frame_ptr, types::interface_apply_sqrt_operator);
+  execute_native_type_conversion_instr(*frame_ptr, types::interface_to_bool);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_add(const Instr& /* instr */, Process& /* process */,
+instr_handler_2dec1(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_binary_operator_instr(*frame_ptr, types::interface_apply_addition_operator);
+  execute_native_type_conversion_instr(*frame_ptr, types::interface_to_dec1);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_sub(const Instr& /* instr */, Process& /* process */,
+instr_handler_2dec2(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_binary_operator_instr(*frame_ptr, types::interface_apply_subtraction_operator);
+  execute_native_type_conversion_instr(*frame_ptr, types::interface_to_dec2);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_mul(const Instr& /* instr */, Process& /* process */,
+instr_handler_2str(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_binary_operator_instr(*frame_ptr, types::interface_apply_multiplication_operator);
+  execute_native_type_conversion_instr(*frame_ptr, types::interface_to_str);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_div(const Instr& /* instr */, Process& /* process */,
+instr_handler_2ary(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_binary_operator_instr(*frame_ptr, types::interface_apply_division_operator);
+  execute_native_type_conversion_instr(*frame_ptr, types::interface_to_ary);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_mod(const Instr& /* instr */, Process& /* process */,
+instr_handler_2map(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_binary_operator_instr(*frame_ptr, types::interface_apply_modulus_operator);
+  execute_native_type_conversion_instr(*frame_ptr, types::interface_to_map);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_pow(const Instr& /* instr */, Process& /* process */,
+instr_handler_truthy(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_binary_operator_instr(*frame_ptr, types::interface_apply_pow_operator);
+  Frame* frame = *frame_ptr;
+
+  types::NativeTypeValue& oprd = frame->top_eval_stack();
+  types::NativeTypeValue result =
+    types::interface_compute_truthy_value(oprd);
+
+  frame->push_eval_stack(std::move(result));
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_bnot(const Instr& /* instr */, Process& /* process */,
+instr_handler_repr(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_unary_operator_instr(*frame_ptr, types::interface_apply_bitwise_not_operator);
+  Frame* frame = *frame_ptr;
+
+  types::NativeTypeValue& oprd = frame->top_eval_stack();
+  types::NativeTypeValue result =
+    types::interface_compute_repr_value(oprd);
+
+  frame->push_eval_stack(std::move(result));
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_band(const Instr& /* instr */, Process& /* process */,
+instr_handler_hash(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_binary_operator_instr(*frame_ptr, types::interface_apply_bitwise_and_operator);
+  Frame* frame = *frame_ptr;
+
+  types::NativeTypeValue& oprd = frame->top_eval_stack();
+  types::NativeTypeValue result =
+    types::interface_compute_hash_value(oprd);
+
+  frame->push_eval_stack(std::move(result));
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_bor(const Instr& /* instr */, Process& /* process */,
+instr_handler_slice(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_binary_operator_instr(*frame_ptr, types::interface_apply_bitwise_or_operator);
+  execute_native_type_complex_instr_with_three_operands(*frame_ptr,
+    types::interface_compute_slice);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_bxor(const Instr& /* instr */, Process& /* process */,
+instr_handler_stride(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_binary_operator_instr(*frame_ptr, types::interface_apply_bitwise_xor_operator);
+  execute_native_type_complex_instr_with_two_operands(*frame_ptr,
+    types::interface_compute_stride);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_bls(const Instr& /* instr */, Process& /* process */,
+instr_handler_reverse(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_binary_operator_instr(*frame_ptr, types::interface_apply_bitwise_left_shift_operator);
+  execute_native_type_complex_instr_with_single_operand(*frame_ptr,
+    types::interface_compute_reverse);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_brs(const Instr& /* instr */, Process& /* process */,
+instr_handler_round(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_binary_operator_instr(*frame_ptr, types::interface_apply_bitwise_right_shift_operator);
+  execute_native_type_complex_instr_with_two_operands(*frame_ptr,
+    types::interface_apply_rounding);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_eq(const Instr& /* instr */, Process& /* process */,
+instr_handler_strlen(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_binary_operator_instr(*frame_ptr, types::interface_apply_eq_operator);
+  execute_native_type_complex_instr_with_single_operand(*frame_ptr,
+    types::interface_string_get_size);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_neq(const Instr& /* instr */, Process& /* process */,
+instr_handler_strat(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_binary_operator_instr(*frame_ptr, types::interface_apply_neq_operator);
+  execute_native_type_complex_instr_with_two_operands(*frame_ptr,
+    types::interface_string_at_2);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_gt(const Instr& /* instr */, Process& /* process */,
+instr_handler_strclr(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_binary_operator_instr(*frame_ptr, types::interface_apply_gt_operator);
+  execute_native_type_complex_instr_with_single_operand_in_place(*frame_ptr,
+    types::interface_string_clear);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_lt(const Instr& /* instr */, Process& /* process */,
+instr_handler_strapd(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_binary_operator_instr(*frame_ptr, types::interface_apply_lt_operator);
+  execute_native_type_complex_instr_with_two_operands_in_place(*frame_ptr,
+    types::interface_string_append);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_gte(const Instr& /* instr */, Process& /* process */,
+instr_handler_strpsh(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_binary_operator_instr(*frame_ptr, types::interface_apply_gte_operator);
+  execute_native_type_complex_instr_with_two_operands_in_place(*frame_ptr,
+    types::interface_string_pushback);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_lte(const Instr& /* instr */, Process& /* process */,
+instr_handler_strist(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_binary_operator_instr(*frame_ptr, types::interface_apply_lte_operator);
+  execute_native_type_complex_instr_with_three_operands_in_place(*frame_ptr,
+    types::interface_string_insert_str);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_lnot(const Instr& /* instr */, Process& /* process */,
+instr_handler_strist2(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_unary_operator_instr(*frame_ptr, types::interface_apply_logical_not_operator);
+  execute_native_type_complex_instr_with_three_operands_in_place(*frame_ptr,
+    types::interface_string_insert_char);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_land(const Instr& /* instr */, Process& /* process */,
+instr_handler_strers(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_binary_operator_instr(*frame_ptr, types::interface_apply_logical_and_operator);
+  execute_native_type_complex_instr_with_two_operands_in_place(*frame_ptr,
+    types::interface_string_erase);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_lor(const Instr& /* instr */, Process& /* process */,
+instr_handler_strers2(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_binary_operator_instr(*frame_ptr, types::interface_apply_logical_or_operator);
+  execute_native_type_complex_instr_with_three_operands_in_place(*frame_ptr,
+    types::interface_string_erase2);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_cmp(
-  const Instr& /* instr */, Process& /* process */,
+instr_handler_strrplc(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_binary_operator_instr(*frame_ptr, types::interface_apply_cmp_operator);
+  execute_native_type_complex_instr_with_four_operands_in_place(*frame_ptr,
+    types::interface_string_replace_str);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_int8(const Instr& instr, Process& /* process */,
+instr_handler_strswp(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_integer_type_creation_instr<types::int8>(instr, *frame_ptr);
+  execute_native_type_complex_instr_with_two_operands_in_place(*frame_ptr,
+    types::interface_string_swap);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_uint8(const Instr& instr, Process& /* process */,
+instr_handler_strsub(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_integer_type_creation_instr<types::uint8>(instr, *frame_ptr);
+  execute_native_type_complex_instr_with_two_operands(*frame_ptr,
+    types::interface_string_substr);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_int16(const Instr& instr, Process& /* process */,
+instr_handler_strsub2(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_integer_type_creation_instr<types::int16>(instr, *frame_ptr);
+  execute_native_type_complex_instr_with_three_operands(*frame_ptr,
+    types::interface_string_substr2);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_uint16(const Instr& instr, Process& /* process */,
+instr_handler_strfnd(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_integer_type_creation_instr<types::uint16>(instr, *frame_ptr);
+  execute_native_type_complex_instr_with_two_operands(*frame_ptr,
+    types::interface_string_find);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_int32(const Instr& instr, Process& /* process */,
+instr_handler_strfnd2(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_integer_type_creation_instr<types::int32>(instr, *frame_ptr);
+  execute_native_type_complex_instr_with_three_operands(*frame_ptr,
+    types::interface_string_find2);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_uint32(const Instr& instr, Process& /* process */,
+instr_handler_strrfnd(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_integer_type_creation_instr<types::uint32>(instr, *frame_ptr);
+  execute_native_type_complex_instr_with_two_operands(*frame_ptr,
+    types::interface_string_rfind);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_int64(const Instr& instr, Process& /* process */,
+instr_handler_strrfnd2(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_integer_type_creation_instr<types::int64>(instr, *frame_ptr);
+  execute_native_type_complex_instr_with_three_operands(*frame_ptr,
+    types::interface_string_rfind2);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_uint64(const Instr& instr, Process& /* process */,
+instr_handler_strrplcall(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_integer_type_creation_instr<types::uint64>(instr, *frame_ptr);
+  execute_native_type_complex_instr_with_three_operands_in_place(*frame_ptr,
+    types::interface_string_replace_all);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_bool(const Instr& instr, Process& /* process */,
+instr_handler_strsplit(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_integer_type_creation_instr<types::boolean>(instr, *frame_ptr);
+  execute_native_type_complex_instr_with_two_operands(*frame_ptr,
+    types::interface_string_split);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_dec1(const Instr& instr, Process& /* process */,
+instr_handler_strjoin(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_floating_type_creation_instr<types::decimal>(instr, *frame_ptr);
+  execute_native_type_complex_instr_with_three_operands(*frame_ptr,
+    types::interface_string_join);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_dec2(const Instr& instr, Process& /* process */,
+instr_handler_arylen(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_floating_type_creation_instr<types::decimal2>(instr, *frame_ptr);
+  execute_native_type_complex_instr_with_single_operand(*frame_ptr,
+    types::interface_array_size);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_str(const Instr& instr, Process& /* process */,
+instr_handler_aryemp(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  // String type is different than other complex types.
-  Frame* frame = *frame_ptr;
+  execute_native_type_complex_instr_with_single_operand(*frame_ptr,
+    types::interface_array_empty);
+}
 
-  std::string str;
+// -----------------------------------------------------------------------------
 
-  if (instr.oprd1 > 0)
-  {
-    auto encoding_key = static_cast<runtime::encoding_key_t>(instr.oprd1);
+void
+instr_handler_aryat(const DecodedInstr& /* instr */, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+{
+  execute_native_type_complex_instr_with_two_operands(*frame_ptr,
+    types::interface_array_at);
+}
 
-    const Compartment* compartment = frame->compartment();
+// -----------------------------------------------------------------------------
 
-    str = compartment->get_string_literal(encoding_key);
-  }
+void
+instr_handler_aryfrt(
+  const DecodedInstr& /* instr */, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+{
+  execute_native_type_complex_instr_with_single_operand(*frame_ptr,
+    types::interface_array_front);
+}
 
-  types::NativeTypeValue type_val = types::string(str);
+// -----------------------------------------------------------------------------
 
-  frame->push_eval_stack(std::move(type_val));
+void
+instr_handler_arybak(const DecodedInstr& /* instr */, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+{
+  execute_native_type_complex_instr_with_single_operand(*frame_ptr,
+    types::interface_array_back);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_ary(const Instr& instr, Process& /* process */,
+instr_handler_aryput(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_complex_type_creation_instr<types::array>(instr, *frame_ptr);
+  execute_native_type_complex_instr_with_three_operands_in_place(*frame_ptr,
+    types::interface_array_put);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_map(const Instr& instr, Process& /* process */,
+instr_handler_aryapnd(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_complex_type_creation_instr<types::map>(instr, *frame_ptr);
+  execute_native_type_complex_instr_with_two_operands_in_place(*frame_ptr,
+    types::interface_array_append);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_2int8(const Instr& /* instr */, Process& /* process */,
+instr_handler_aryers(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_type_conversion_instr(*frame_ptr, types::interface_to_int8);
+  execute_native_type_complex_instr_with_two_operands_in_place(*frame_ptr,
+    types::interface_array_erase);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_2uint8(
-  const Instr& /* instr */, Process& /* process */,
+instr_handler_arypop(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_type_conversion_instr(*frame_ptr, types::interface_to_uint8);
+  execute_native_type_complex_instr_with_single_operand_in_place(*frame_ptr,
+    types::interface_array_pop);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_2int16(const Instr& /* instr */, Process& /* process */,
+instr_handler_aryswp(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_type_conversion_instr(*frame_ptr, types::interface_to_int16);
+  execute_native_type_complex_instr_with_two_operands_in_place(*frame_ptr,
+    types::interface_array_swap);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_2uint16(
-  const Instr& /* instr */, Process& /* process */,
+instr_handler_aryclr(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_type_conversion_instr(*frame_ptr, types::interface_to_uint16);
+  execute_native_type_complex_instr_with_single_operand_in_place(*frame_ptr,
+    types::interface_array_clear);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_2int32(const Instr& /* instr */, Process& /* process */,
+instr_handler_arymrg(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_type_conversion_instr(*frame_ptr, types::interface_to_int32);
+  execute_native_type_complex_instr_with_two_operands_in_place(*frame_ptr,
+    types::interface_array_merge);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_2uint32(const Instr& /* instr */, Process& /* process */,
+instr_handler_arysum(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_type_conversion_instr(*frame_ptr, types::interface_to_uint32);
+  execute_native_type_complex_instr_with_single_operand(*frame_ptr,
+    types::interface_array_sum);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_2int64(const Instr& /* instr */, Process& /* process */,
+instr_handler_arymin(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_type_conversion_instr(*frame_ptr, types::interface_to_int64);
+  execute_native_type_complex_instr_with_single_operand(*frame_ptr,
+    types::interface_array_min);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_2uint64(const Instr& /* instr */, Process& /* process */,
+instr_handler_arymax(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_type_conversion_instr(*frame_ptr, types::interface_to_uint64);
+  execute_native_type_complex_instr_with_single_operand(*frame_ptr,
+    types::interface_array_max);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_2bool(const Instr& /* instr */, Process& /* process */,
+instr_handler_aryfnd(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_type_conversion_instr(*frame_ptr, types::interface_to_bool);
+  execute_native_type_complex_instr_with_two_operands(*frame_ptr,
+    types::interface_array_find);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_2dec1(const Instr& /* instr */, Process& /* process */,
+instr_handler_maplen(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_type_conversion_instr(*frame_ptr, types::interface_to_dec1);
+  execute_native_type_complex_instr_with_single_operand(*frame_ptr,
+    types::interface_map_size);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_2dec2(const Instr& /* instr */, Process& /* process */,
+instr_handler_mapemp(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_type_conversion_instr(*frame_ptr, types::interface_to_dec2);
+  execute_native_type_complex_instr_with_single_operand(*frame_ptr,
+    types::interface_map_empty);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_2str(const Instr& /* instr */, Process& /* process */,
+instr_handler_mapat(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_type_conversion_instr(*frame_ptr, types::interface_to_str);
+  execute_native_type_complex_instr_with_two_operands(*frame_ptr,
+    types::interface_map_at);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_2ary(const Instr& /* instr */, Process& /* process */,
+instr_handler_mapfind(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_type_conversion_instr(*frame_ptr, types::interface_to_ary);
+  execute_native_type_complex_instr_with_two_operands(*frame_ptr,
+    types::interface_map_find);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_2map(const Instr& /* instr */, Process& /* process */,
+instr_handler_mapput(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_type_conversion_instr(*frame_ptr, types::interface_to_map);
+  execute_native_type_complex_instr_with_three_operands_in_place(*frame_ptr,
+    types::interface_map_put);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_truthy(const Instr& /* instr */, Process& /* process */,
+instr_handler_mapset(const DecodedInstr& instr, Process& process,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
+  types::native_map_key_type key = static_cast<
+    types::native_map_key_type>(instr.oprd1);
+
+  auto ptr = process.top_stack();
+
   Frame* frame = *frame_ptr;
 
-  types::NativeTypeValue& oprd = frame->top_eval_stack();
-  types::NativeTypeValue result =
-    types::interface_compute_truthy_value(oprd);
+  types::NativeTypeValue& res = frame->top_eval_stack();
 
-  frame->push_eval_stack(std::move(result));
+  types::native_map map = types::get_intrinsic_value_from_type_value<types::native_map>(res);
+
+  map[key] = ptr->id();
+
+  res = map;
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_repr(const Instr& /* instr */, Process& /* process */,
+instr_handler_mapers(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  Frame* frame = *frame_ptr;
-
-  types::NativeTypeValue& oprd = frame->top_eval_stack();
-  types::NativeTypeValue result =
-    types::interface_compute_repr_value(oprd);
-
-  frame->push_eval_stack(std::move(result));
+  execute_native_type_complex_instr_with_two_operands_in_place(*frame_ptr,
+    types::interface_map_erase);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_hash(const Instr& /* instr */, Process& /* process */,
+instr_handler_mapclr(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  Frame* frame = *frame_ptr;
-
-  types::NativeTypeValue& oprd = frame->top_eval_stack();
-  types::NativeTypeValue result =
-    types::interface_compute_hash_value(oprd);
-
-  frame->push_eval_stack(std::move(result));
+  execute_native_type_complex_instr_with_single_operand_in_place(*frame_ptr,
+    types::interface_map_clear);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_slice(const Instr& /* instr */, Process& /* process */,
+instr_handler_mapswp(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_type_complex_instr_with_three_operands(*frame_ptr,
-    types::interface_compute_slice);
+  execute_native_type_complex_instr_with_two_operands_in_place(*frame_ptr,
+    types::interface_map_swap);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_stride(const Instr& /* instr */, Process& /* process */,
+instr_handler_mapkeys(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_type_complex_instr_with_two_operands(*frame_ptr,
-    types::interface_compute_stride);
+  execute_native_type_complex_instr_with_single_operand(*frame_ptr,
+    types::interface_map_keys);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_reverse(const Instr& /* instr */, Process& /* process */,
+instr_handler_mapvals(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
   execute_native_type_complex_instr_with_single_operand(*frame_ptr,
-    types::interface_compute_reverse);
+    types::interface_map_vals);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_round(const Instr& /* instr */, Process& /* process */,
+instr_handler_mapmrg(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_type_complex_instr_with_two_operands(*frame_ptr,
-    types::interface_apply_rounding);
+  execute_native_type_complex_instr_with_two_operands_in_place(*frame_ptr,
+    types::interface_map_merge);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_strlen(const Instr& /* instr */, Process& /* process */,
+instr_handler_veclen(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
   execute_native_type_complex_instr_with_single_operand(*frame_ptr,
-    types::interface_string_get_size);
+    types::interface_vector_size);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_strat(const Instr& /* instr */, Process& /* process */,
+instr_handler_vecat(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
   execute_native_type_complex_instr_with_two_operands(*frame_ptr,
-    types::interface_string_at_2);
+    types::interface_vector_at);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_strclr(const Instr& /* instr */, Process& /* process */,
+instr_handler_vecput(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_type_complex_instr_with_single_operand_in_place(*frame_ptr,
-    types::interface_string_clear);
+  execute_native_type_complex_instr_with_three_operands_in_place(*frame_ptr,
+    types::interface_vector_put);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_strapd(const Instr& /* instr */, Process& /* process */,
+instr_handler_vecapnd(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
   execute_native_type_complex_instr_with_two_operands_in_place(*frame_ptr,
-    types::interface_string_append);
+    types::interface_vector_append);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_strpsh(const Instr& /* instr */, Process& /* process */,
+instr_handler_vecsum(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_type_complex_instr_with_two_operands_in_place(*frame_ptr,
-    types::interface_string_pushback);
+  execute_native_type_complex_instr_with_single_operand(*frame_ptr,
+    types::interface_vector_sum);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_strist(const Instr& /* instr */, Process& /* process */,
+instr_handler_vecdot(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_type_complex_instr_with_three_operands_in_place(*frame_ptr,
-    types::interface_string_insert_str);
+  execute_native_type_complex_instr_with_two_operands(*frame_ptr,
+    types::interface_vector_dot);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_strist2(const Instr& /* instr */, Process& /* process */,
+instr_handler_vecscl(const DecodedInstr& /* instr */, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_type_complex_instr_with_three_operands_in_place(*frame_ptr,
-    types::interface_string_insert_char);
+  execute_native_type_complex_instr_with_two_operands(*frame_ptr,
+    types::interface_vector_scale);
 }
 
 // -----------------------------------------------------------------------------
 
-void
-instr_handler_strers(const Instr& /* instr */, Process& /* process */,
-  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
-{
-  execute_native_type_complex_instr_with_two_operands_in_place(*frame_ptr,
-    types::interface_string_erase);
-}
+/**
+ * Superinstructions below run the instructions they fuse one after another,
+ * reading them from the decoded instructions that follow. The program counter
+ * is advanced to each of them in turn, so that it always points at the one
+ * being run, as it would without fusing (e.g. for catch sites of exceptions
+ * raised, and the return address of invocations).
+ */
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_strers2(const Instr& /* instr */, Process& /* process */,
-  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+instr_handler_ldpinvk(const DecodedInstr& instr, Process& process,
+  Frame** frame_ptr, InvocationCtx** invk_ctx_ptr)
 {
-  execute_native_type_complex_instr_with_three_operands_in_place(*frame_ptr,
-    types::interface_string_erase2);
+  Frame* frame = *frame_ptr;
+
+  auto obj = load_visible_var(instr, frame);
+  process.push_stack(obj);
+
+  frame->inc_pc();
+  prepare_invocation(process, obj, invk_ctx_ptr);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_strrplc(const Instr& /* instr */, Process& /* process */,
-  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+instr_handler_ldputarg(const DecodedInstr& instr, Process& /* process */,
+  Frame** frame_ptr, InvocationCtx** invk_ctx_ptr)
 {
-  execute_native_type_complex_instr_with_four_operands_in_place(*frame_ptr,
-    types::interface_string_replace_str);
+  Frame* frame = *frame_ptr;
+
+  auto obj = load_visible_var(instr, frame);
+
+  frame->inc_pc();
+  obj->manager().on_setattr();
+  (*invk_ctx_ptr)->put_param(obj);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_strswp(const Instr& /* instr */, Process& /* process */,
-  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+instr_handler_ldputinvk(const DecodedInstr& instr, Process& process,
+  Frame** frame_ptr, InvocationCtx** invk_ctx_ptr)
 {
-  execute_native_type_complex_instr_with_two_operands_in_place(*frame_ptr,
-    types::interface_string_swap);
+  instr_handler_ldputarg(instr, process, frame_ptr, invk_ctx_ptr);
+
+  (*frame_ptr)->inc_pc();
+  instr_handler_invk((&instr)[2], process, frame_ptr, invk_ctx_ptr);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_strsub(const Instr& /* instr */, Process& /* process */,
-  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+instr_handler_putinvk(const DecodedInstr& instr, Process& process,
+  Frame** frame_ptr, InvocationCtx** invk_ctx_ptr)
 {
-  execute_native_type_complex_instr_with_two_operands(*frame_ptr,
-    types::interface_string_substr);
+  instr_handler_putarg(instr, process, frame_ptr, invk_ctx_ptr);
+
+  (*frame_ptr)->inc_pc();
+  instr_handler_invk((&instr)[1], process, frame_ptr, invk_ctx_ptr);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_strsub2(const Instr& /* instr */, Process& /* process */,
+instr_handler_ldgetattr(const DecodedInstr& instr, Process& process,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_type_complex_instr_with_three_operands(*frame_ptr,
-    types::interface_string_substr2);
+  Frame* frame = *frame_ptr;
+
+  auto obj = load_visible_var(instr, frame);
+
+  frame->inc_pc();
+  process.push_stack(load_attr((&instr)[1], frame, obj));
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_strfnd(const Instr& /* instr */, Process& /* process */,
+instr_handler_newint64(const DecodedInstr& instr, Process& process,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_type_complex_instr_with_two_operands(*frame_ptr,
-    types::interface_string_find);
+  Frame* frame = *frame_ptr;
+
+  auto obj = process.create_dyobj();
+  process.push_stack(obj);
+
+  frame->inc_pc();
+  types::NativeTypeValue type_val(types::int64((&instr)[1].oprd1));
+
+  frame->inc_pc();
+  init_type_value(process, obj, type_val);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_strfnd2(const Instr& /* instr */, Process& /* process */,
+instr_handler_newstr(const DecodedInstr& instr, Process& process,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_type_complex_instr_with_three_operands(*frame_ptr,
-    types::interface_string_find2);
+  Frame* frame = *frame_ptr;
+
+  auto obj = process.create_dyobj();
+  process.push_stack(obj);
+
+  frame->inc_pc();
+  types::NativeTypeValue type_val(string_literal_value((&instr)[1], frame));
+
+  frame->inc_pc();
+  init_type_value(process, obj, type_val);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_strrfnd(const Instr& /* instr */, Process& /* process */,
+instr_handler_newstobj(const DecodedInstr& instr, Process& process,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_type_complex_instr_with_two_operands(*frame_ptr,
-    types::interface_string_rfind);
+  Frame* frame = *frame_ptr;
+
+  auto obj = process.create_dyobj();
+
+  frame->inc_pc();
+  init_type_value(process, obj, frame->pop_eval_stack());
+
+  frame->inc_pc();
+  store_visible_var((&instr)[2], frame, obj);
 }
 
 // -----------------------------------------------------------------------------
 
+/**
+ * Runs the specified instruction, which mutates the top element on the eval
+ * stack in place, on the native type value of the specified object. The value
+ * is moved onto the eval stack rather than copied, so that the instruction
+ * mutates the only instance of it, and is left there to be moved back. If the
+ * instruction throws, the object gets a copy of the value back right away.
+ */
+static
 void
-instr_handler_strrfnd2(const Instr& /* instr */, Process& /* process */,
-  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+mutate_type_value_in_place(const DecodedInstr& instr, Process& process,
+  Frame** frame_ptr, InvocationCtx** invk_ctx_ptr, Process::dyobj_ptr obj)
 {
-  execute_native_type_complex_instr_with_three_operands(*frame_ptr,
-    types::interface_string_rfind2);
+  Frame* frame = *frame_ptr;
+
+  frame->push_eval_stack(std::move(process.get_type_value(&obj->type_value())));
+
+  frame->inc_pc();
+
+  try
+  {
+    InstrHandlerMeta::instr_handlers[instr.code](instr, process, frame_ptr,
+      invk_ctx_ptr);
+  }
+  catch (...)
+  {
+    process.get_type_value(&obj->type_value()) = frame->top_eval_stack();
+    throw;
+  }
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_arylen(const Instr& /* instr */, Process& /* process */,
-  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+instr_handler_getmutval(const DecodedInstr& instr, Process& process,
+  Frame** frame_ptr, InvocationCtx** invk_ctx_ptr)
 {
-  execute_native_type_complex_instr_with_single_operand(*frame_ptr,
-    types::interface_array_size);
+  auto obj = process.top_stack();
+
+  if (!obj->has_type_value())
+  {
+    THROW(NativeTypeValueNotFoundError());
+  }
+
+  mutate_type_value_in_place((&instr)[1], process, frame_ptr, invk_ctx_ptr,
+    obj);
+
+  Frame* frame = *frame_ptr;
+
+  frame->inc_pc();
+  process.get_type_value(&obj->type_value()) = frame->pop_eval_stack();
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_aryemp(const Instr& /* instr */, Process& /* process */,
-  Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
+instr_handler_getmutval2(const DecodedInstr& instr, Process& process,
+  Frame** frame_ptr, InvocationCtx** invk_ctx_ptr)
 {
-  execute_native_type_complex_instr_with_single_operand(*frame_ptr,
-    types::interface_array_empty);
+  Frame* frame = *frame_ptr;
+  variable_key_t key = static_cast<variable_key_t>(instr.oprd1);
+
+  auto obj = frame->get_visible_var(key);
+
+  // The value can only be moved when `ldobj` loads the same object back, and
+  // otherwise the instructions fused are run one after another.
+  Process::dyobj_ptr target_obj = NULL;
+  if (!obj->has_type_value() ||
+      !try_load_visible_var((&instr)[2], frame, &target_obj) ||
+      target_obj != obj)
+  {
+    instr_handler_getval2(instr, process, frame_ptr, invk_ctx_ptr);
+
+    const DecodedInstr& mutation_instr = (&instr)[1];
+    frame->inc_pc();
+    InstrHandlerMeta::instr_handlers[mutation_instr.code](mutation_instr,
+      process, frame_ptr, invk_ctx_ptr);
+
+    frame->inc_pc();
+    instr_handler_ldobj((&instr)[2], process, frame_ptr, invk_ctx_ptr);
+
+    frame->inc_pc();
+    instr_handler_setval((&instr)[3], process, frame_ptr, invk_ctx_ptr);
+
+    return;
+  }
+
+  mutate_type_value_in_place((&instr)[1], process, frame_ptr, invk_ctx_ptr,
+    obj);
+
+  frame->inc_pc();
+  process.push_stack(obj);
+
+  frame->inc_pc();
+  process.get_type_value(&obj->type_value()) = frame->pop_eval_stack();
 }
 
 // -----------------------------------------------------------------------------
 
+/**
+ * Quickened instructions below are only reached once generic ones quicken
+ * themselves; see `execute_quickening_binary_operator_instr()`.
+ */
+
+// -----------------------------------------------------------------------------
+
 void
-instr_handler_aryat(const Instr& /* instr */, Process& /* process */,
+instr_handler_addi64(const DecodedInstr& instr, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_type_complex_instr_with_two_operands(*frame_ptr,
-    types::interface_array_at);
+  execute_quickened_arithmetic_instr<types::int64, types::addition, ADD>(instr,
+    *frame_ptr, types::interface_apply_addition_operator);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_aryfrt(
-  const Instr& /* instr */, Process& /* process */,
+instr_handler_subi64(const DecodedInstr& instr, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_type_complex_instr_with_single_operand(*frame_ptr,
-    types::interface_array_front);
+  execute_quickened_arithmetic_instr<types::int64, types::subtraction, SUB>(instr,
+    *frame_ptr, types::interface_apply_subtraction_operator);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_arybak(const Instr& /* instr */, Process& /* process */,
+instr_handler_muli64(const DecodedInstr& instr, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_type_complex_instr_with_single_operand(*frame_ptr,
-    types::interface_array_back);
+  execute_quickened_arithmetic_instr<types::int64, types::multiplication, MUL>(instr,
+    *frame_ptr, types::interface_apply_multiplication_operator);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_aryput(const Instr& /* instr */, Process& /* process */,
+instr_handler_divi64(const DecodedInstr& instr, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_type_complex_instr_with_three_operands_in_place(*frame_ptr,
-    types::interface_array_put);
+  execute_quickened_arithmetic_instr<types::int64, types::division, DIV>(instr,
+    *frame_ptr, types::interface_apply_division_operator);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_aryapnd(const Instr& /* instr */, Process& /* process */,
+instr_handler_modi64(const DecodedInstr& instr, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_type_complex_instr_with_two_operands_in_place(*frame_ptr,
-    types::interface_array_append);
+  execute_quickened_arithmetic_instr<types::int64, types::modulus, MOD>(instr,
+    *frame_ptr, types::interface_apply_modulus_operator);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_aryers(const Instr& /* instr */, Process& /* process */,
+instr_handler_eqi64(const DecodedInstr& instr, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_type_complex_instr_with_two_operands_in_place(*frame_ptr,
-    types::interface_array_erase);
+  execute_quickened_comparison_instr<types::int64, types::eq, EQ>(instr,
+    *frame_ptr, types::interface_apply_eq_operator);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_arypop(const Instr& /* instr */, Process& /* process */,
+instr_handler_neqi64(const DecodedInstr& instr, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_type_complex_instr_with_single_operand(*frame_ptr,
-    types::interface_array_pop);
+  execute_quickened_comparison_instr<types::int64, types::neq, NEQ>(instr,
+    *frame_ptr, types::interface_apply_neq_operator);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_aryswp(const Instr& /* instr */, Process& /* process */,
+instr_handler_gti64(const DecodedInstr& instr, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_type_complex_instr_with_two_operands_in_place(*frame_ptr,
-    types::interface_array_swap);
+  execute_quickened_comparison_instr<types::int64, types::gt, GT>(instr,
+    *frame_ptr, types::interface_apply_gt_operator);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_aryclr(const Instr& /* instr */, Process& /* process */,
+instr_handler_lti64(const DecodedInstr& instr, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_type_complex_instr_with_single_operand_in_place(*frame_ptr,
-    types::interface_array_clear);
+  execute_quickened_comparison_instr<types::int64, types::lt, LT>(instr,
+    *frame_ptr, types::interface_apply_lt_operator);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_arymrg(const Instr& /* instr */, Process& /* process */,
+instr_handler_gtei64(const DecodedInstr& instr, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_type_complex_instr_with_two_operands(*frame_ptr,
-    types::interface_array_merge);
+  execute_quickened_comparison_instr<types::int64, types::gte, GTE>(instr,
+    *frame_ptr, types::interface_apply_gte_operator);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_maplen(const Instr& /* instr */, Process& /* process */,
+instr_handler_ltei64(const DecodedInstr& instr, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_type_complex_instr_with_single_operand(*frame_ptr,
-    types::interface_map_size);
+  execute_quickened_comparison_instr<types::int64, types::lte, LTE>(instr,
+    *frame_ptr, types::interface_apply_lte_operator);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_mapemp(const Instr& /* instr */, Process& /* process */,
+instr_handler_adddec2(const DecodedInstr& instr, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_type_complex_instr_with_single_operand(*frame_ptr,
-    types::interface_map_empty);
+  execute_quickened_arithmetic_instr<types::decimal2, types::addition, ADD>(instr,
+    *frame_ptr, types::interface_apply_addition_operator);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_mapat(const Instr& /* instr */, Process& /* process */,
+instr_handler_subdec2(const DecodedInstr& instr, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_type_complex_instr_with_two_operands(*frame_ptr,
-    types::interface_map_at);
+  execute_quickened_arithmetic_instr<types::decimal2, types::subtraction, SUB>(instr,
+    *frame_ptr, types::interface_apply_subtraction_operator);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_mapfind(const Instr& /* instr */, Process& /* process */,
+instr_handler_muldec2(const DecodedInstr& instr, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_type_complex_instr_with_two_operands(*frame_ptr,
-    types::interface_map_find);
+  execute_quickened_arithmetic_instr<types::decimal2, types::multiplication, MUL>(instr,
+    *frame_ptr, types::interface_apply_multiplication_operator);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_mapput(const Instr& /* instr */, Process& /* process */,
+instr_handler_divdec2(const DecodedInstr& instr, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_type_complex_instr_with_three_operands_in_place(*frame_ptr,
-    types::interface_map_put);
+  execute_quickened_arithmetic_instr<types::decimal2, types::division, DIV>(instr,
+    *frame_ptr, types::interface_apply_division_operator);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_mapset(const Instr& instr, Process& process,
+instr_handler_moddec2(const DecodedInstr& instr, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  types::native_map_key_type key = static_cast<
-    types::native_map_key_type>(instr.oprd1);
-
-  auto ptr = process.top_stack();
-
-  Frame* frame = *frame_ptr;
-
-  types::NativeTypeValue& res = frame->top_eval_stack();
-
-  types::native_map map = types::get_intrinsic_value_from_type_value<types::native_map>(res);
-
-  map[key] = ptr->id();
-
-  res = map;
+  execute_quickened_arithmetic_instr<types::decimal2, types::modulus, MOD>(instr,
+    *frame_ptr, types::interface_apply_modulus_operator);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_mapers(const Instr& /* instr */, Process& /* process */,
+instr_handler_eqdec2(const DecodedInstr& instr, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_type_complex_instr_with_two_operands_in_place(*frame_ptr,
-    types::interface_map_erase);
+  execute_quickened_comparison_instr<types::decimal2, types::eq, EQ>(instr,
+    *frame_ptr, types::interface_apply_eq_operator);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_mapclr(const Instr& /* instr */, Process& /* process */,
+instr_handler_neqdec2(const DecodedInstr& instr, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_type_complex_instr_with_single_operand_in_place(*frame_ptr,
-    types::interface_map_clear);
+  execute_quickened_comparison_instr<types::decimal2, types::neq, NEQ>(instr,
+    *frame_ptr, types::interface_apply_neq_operator);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_mapswp(const Instr& /* instr */, Process& /* process */,
+instr_handler_gtdec2(const DecodedInstr& instr, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_type_complex_instr_with_two_operands_in_place(*frame_ptr,
-    types::interface_map_swap);
+  execute_quickened_comparison_instr<types::decimal2, types::gt, GT>(instr,
+    *frame_ptr, types::interface_apply_gt_operator);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_mapkeys(const Instr& /* instr */, Process& /* process */,
+instr_handler_ltdec2(const DecodedInstr& instr, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_type_complex_instr_with_single_operand(*frame_ptr,
-    types::interface_map_keys);
+  execute_quickened_comparison_instr<types::decimal2, types::lt, LT>(instr,
+    *frame_ptr, types::interface_apply_lt_operator);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_mapvals(const Instr& /* instr */, Process& /* process */,
+instr_handler_gtedec2(const DecodedInstr& instr, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_type_complex_instr_with_single_operand(*frame_ptr,
-    types::interface_map_vals);
+  execute_quickened_comparison_instr<types::decimal2, types::gte, GTE>(instr,
+    *frame_ptr, types::interface_apply_gte_operator);
 }
 
 // -----------------------------------------------------------------------------
 
 void
-instr_handler_mapmrg(const Instr& /* instr */, Process& /* process */,
+instr_handler_ltedec2(const DecodedInstr& instr, Process& /* process */,
   Frame** frame_ptr, InvocationCtx** /* invk_ctx_ptr */)
 {
-  execute_native_type_complex_instr_with_two_operands(*frame_ptr,
-    types::interface_map_merge);
+  execute_quickened_comparison_instr<types::decimal2, types::lte, LTE>(instr,
+    *frame_ptr, types::interface_apply_lte_operator);
 }
 
 // -----------------------------------------------------------------------------
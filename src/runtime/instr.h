@@ -43,147 +43,147 @@ namespace runtime {
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_new(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_new(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_ldobj(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_ldobj(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_stobj(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_stobj(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_stobjn(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_stobjn(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_getattr(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_getattr(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_setattr(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_setattr(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_delattr(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_delattr(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_hasattr2(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_hasattr2(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_getattr2(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_getattr2(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_setattr2(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_setattr2(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_delattr2(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_delattr2(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_pop(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_pop(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_ldobj2(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_ldobj2(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_stobj2(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_stobj2(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_delobj(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_delobj(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_delobj2(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_delobj2(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_getval(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_getval(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_setval(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_setval(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_getval2(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_getval2(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_clrval(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_clrval(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_cpyval(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_cpyval(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_cpyrepr(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_cpyrepr(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_istruthy(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_istruthy(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_objeq(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_objeq(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_objneq(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_objneq(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_setctx(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_setctx(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_cldobj(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_cldobj(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_rsetattrs(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_rsetattrs(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_setattrs(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_setattrs(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_putobj(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_putobj(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_getobj(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_getobj(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_swap(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_swap(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_setflgc(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_setflgc(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_setfldel(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_setfldel(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_setflcall(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_setflcall(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_setflmute(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_setflmute(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
@@ -193,47 +193,47 @@ void instr_handler_setflmute(const Instr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_pinvk(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_pinvk(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_invk(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_invk(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_rtrn(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_rtrn(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_jmp(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_jmp(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_jmpif(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_jmpif(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_jmpr(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_jmpr(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_exc(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_exc(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_excobj(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_excobj(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_clrexc(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_clrexc(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_jmpexc(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_jmpexc(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_exit(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_exit(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
@@ -243,39 +243,39 @@ void instr_handler_exit(const Instr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_putarg(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_putarg(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_putkwarg(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_putkwarg(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_putargs(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_putargs(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_putkwargs(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_putkwargs(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_getarg(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_getarg(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_getkwarg(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_getkwarg(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_getargs(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_getargs(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_getkwargs(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_getkwargs(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_hasargs(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_hasargs(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
@@ -285,31 +285,31 @@ void instr_handler_hasargs(const Instr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_gc(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_gc(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_debug(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_debug(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_dbgfrm(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_dbgfrm(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_dbgmem(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_dbgmem(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_dbgvar(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_dbgvar(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_print(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_print(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_swap2(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_swap2(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
@@ -319,115 +319,115 @@ void instr_handler_swap2(const Instr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_pos(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_pos(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_neg(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_neg(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_inc(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_inc(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_dec(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_dec(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_abs(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_abs(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_sqrt(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_sqrt(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_add(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_add(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_sub(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_sub(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_mul(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_mul(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_div(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_div(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_mod(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_mod(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_pow(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_pow(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_bnot(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_bnot(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_band(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_band(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_bor(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_bor(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_bxor(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_bxor(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_bls(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_bls(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_brs(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_brs(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_eq(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_eq(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_neq(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_neq(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_gt(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_gt(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_lt(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_lt(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_gte(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_gte(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_lte(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_lte(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_lnot(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_lnot(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_land(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_land(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_lor(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_lor(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_cmp(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_cmp(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
@@ -437,59 +437,63 @@ void instr_handler_cmp(const Instr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_int8(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_int8(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_uint8(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_uint8(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_int16(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_int16(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_uint16(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_uint16(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_int32(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_int32(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_uint32(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_uint32(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_int64(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_int64(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_uint64(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_uint64(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_bool(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_bool(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_dec1(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_dec1(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_dec2(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_dec2(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_str(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_str(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_ary(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_ary(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_map(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_map(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
+
+// -----------------------------------------------------------------------------
+
+void instr_handler_vec(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
@@ -499,59 +503,59 @@ void instr_handler_map(const Instr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_2int8(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_2int8(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_2uint8(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_2uint8(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_2int16(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_2int16(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_2uint16(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_2uint16(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_2int32(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_2int32(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_2uint32(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_2uint32(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_2int64(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_2int64(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_2uint64(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_2uint64(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_2bool(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_2bool(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_2dec1(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_2dec1(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_2dec2(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_2dec2(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_2str(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_2str(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_2ary(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_2ary(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_2map(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_2map(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
@@ -561,31 +565,31 @@ void instr_handler_2map(const Instr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_truthy(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_truthy(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_repr(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_repr(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_hash(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_hash(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_slice(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_slice(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_stride(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_stride(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_reverse(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_reverse(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_round(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_round(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
@@ -595,71 +599,83 @@ void instr_handler_round(const Instr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_strlen(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_strlen(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
+
+// -----------------------------------------------------------------------------
+
+void instr_handler_strat(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
+
+// -----------------------------------------------------------------------------
+
+void instr_handler_strclr(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
+
+// -----------------------------------------------------------------------------
+
+void instr_handler_strapd(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_strat(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_strpsh(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_strclr(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_strist(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_strapd(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_strist2(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_strpsh(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_strers(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_strist(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_strers2(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_strist2(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_strrplc(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_strers(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_strswp(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_strers2(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_strsub(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_strrplc(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_strsub2(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_strswp(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_strfnd(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_strsub(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_strfnd2(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_strsub2(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_strrfnd(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_strfnd(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_strrfnd2(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_strfnd2(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_strrplcall(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_strrfnd(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_strsplit(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_strrfnd2(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_strjoin(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
@@ -669,51 +685,67 @@ void instr_handler_strrfnd2(const Instr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_arylen(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_arylen(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
+
+// -----------------------------------------------------------------------------
+
+void instr_handler_aryemp(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_aryemp(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_aryat(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_aryat(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_aryfrt(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_aryfrt(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_arybak(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_arybak(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_aryput(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_aryput(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_aryapnd(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_aryapnd(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_aryers(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_aryers(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_arypop(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_arypop(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_aryswp(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_aryswp(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_aryclr(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_aryclr(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_arymrg(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_arymrg(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_arysum(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
+
+// -----------------------------------------------------------------------------
+
+void instr_handler_arymin(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
+
+// -----------------------------------------------------------------------------
+
+void instr_handler_arymax(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
+
+// -----------------------------------------------------------------------------
+
+void instr_handler_aryfnd(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
@@ -723,55 +755,501 @@ void instr_handler_arymrg(const Instr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_maplen(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_maplen(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
+
+// -----------------------------------------------------------------------------
+
+void instr_handler_mapemp(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
+
+// -----------------------------------------------------------------------------
+
+void instr_handler_mapfind(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
+
+// -----------------------------------------------------------------------------
+
+void instr_handler_mapat(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
+
+// -----------------------------------------------------------------------------
+
+void instr_handler_mapput(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
+
+// -----------------------------------------------------------------------------
+
+void instr_handler_mapset(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
+
+// -----------------------------------------------------------------------------
+
+void instr_handler_mapers(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
+
+// -----------------------------------------------------------------------------
+
+void instr_handler_mapclr(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
+
+// -----------------------------------------------------------------------------
+
+void instr_handler_mapswp(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
+
+// -----------------------------------------------------------------------------
+
+void instr_handler_mapkeys(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
+
+// -----------------------------------------------------------------------------
+
+void instr_handler_mapvals(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
+
+// -----------------------------------------------------------------------------
+
+void instr_handler_mapmrg(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
+
+// -----------------------------------------------------------------------------
+
+
+/* ---------------------- Vector type instructions -------------------------- */
+
+
+// -----------------------------------------------------------------------------
+
+void instr_handler_veclen(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
+
+// -----------------------------------------------------------------------------
+
+void instr_handler_vecat(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
+
+// -----------------------------------------------------------------------------
+
+void instr_handler_vecput(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
+
+// -----------------------------------------------------------------------------
+
+void instr_handler_vecapnd(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
+
+// -----------------------------------------------------------------------------
+
+void instr_handler_vecsum(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
+
+// -----------------------------------------------------------------------------
+
+void instr_handler_vecdot(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
+
+// -----------------------------------------------------------------------------
+
+void instr_handler_vecscl(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
+
+// -----------------------------------------------------------------------------
+
+
+/* ------------------------- Superinstructions ------------------------------ */
+
+
+// -----------------------------------------------------------------------------
+
+void instr_handler_ldpinvk(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
+
+// -----------------------------------------------------------------------------
+
+void instr_handler_ldputarg(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
+
+// -----------------------------------------------------------------------------
+
+void instr_handler_ldputinvk(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
+
+// -----------------------------------------------------------------------------
+
+void instr_handler_putinvk(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
+
+// -----------------------------------------------------------------------------
+
+void instr_handler_ldgetattr(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
+
+// -----------------------------------------------------------------------------
+
+void instr_handler_newint64(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
+
+// -----------------------------------------------------------------------------
+
+void instr_handler_newstr(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
+
+// -----------------------------------------------------------------------------
+
+void instr_handler_newstobj(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
+
+// -----------------------------------------------------------------------------
+
+void instr_handler_getmutval(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
+
+// -----------------------------------------------------------------------------
+
+void instr_handler_getmutval2(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
+
+// -----------------------------------------------------------------------------
+
+
+/* ------------------------- Quickened instructions ------------------------- */
+
+
+// -----------------------------------------------------------------------------
+
+void instr_handler_addi64(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
+
+// -----------------------------------------------------------------------------
+
+void instr_handler_subi64(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
+
+// -----------------------------------------------------------------------------
+
+void instr_handler_muli64(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
+
+// -----------------------------------------------------------------------------
+
+void instr_handler_divi64(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
+
+// -----------------------------------------------------------------------------
+
+void instr_handler_modi64(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
+
+// -----------------------------------------------------------------------------
+
+void instr_handler_eqi64(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
+
+// -----------------------------------------------------------------------------
+
+void instr_handler_neqi64(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
+
+// -----------------------------------------------------------------------------
+
+void instr_handler_gti64(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
+
+// -----------------------------------------------------------------------------
+
+void instr_handler_lti64(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
+
+// -----------------------------------------------------------------------------
+
+void instr_handler_gtei64(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
+
+// -----------------------------------------------------------------------------
+
+void instr_handler_ltei64(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_mapemp(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_adddec2(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_mapfind(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_subdec2(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_mapat(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_muldec2(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_mapput(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_divdec2(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_mapset(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_moddec2(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_mapers(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_eqdec2(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_mapclr(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_neqdec2(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_mapswp(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_gtdec2(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_mapkeys(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_ltdec2(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_mapvals(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_gtedec2(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-void instr_handler_mapmrg(const Instr&, Process&, Frame**, InvocationCtx**);
+void instr_handler_ltedec2(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
-typedef void InstrHandler(const Instr&, Process&, Frame**, InvocationCtx**);
+/**
+ * Instruction codes and their handlers, in the order of `InstrEnum`.
+ *
+ * `X(code, handler)` is expanded for every instruction code, so that the
+ * handler table below and the labels of the threaded dispatch loop in
+ * `Process::Impl::run()` are generated from the same list.
+ */
+#define COREVM_INSTR_HANDLERS(X)                                              \
+  /* Object instructions */                                                   \
+                                                                              \
+  X(NEW,        instr_handler_new)                                            \
+  X(LDOBJ,      instr_handler_ldobj)                                          \
+  X(STOBJ,      instr_handler_stobj)                                          \
+  X(STOBJN,     instr_handler_stobjn)                                         \
+  X(GETATTR,    instr_handler_getattr)                                        \
+  X(SETATTR,    instr_handler_setattr)                                        \
+  X(DELATTR,    instr_handler_delattr)                                        \
+  X(HASATTR2,   instr_handler_hasattr2)                                       \
+  X(GETATTR2,   instr_handler_getattr2)                                       \
+  X(SETATTR2,   instr_handler_setattr2)                                       \
+  X(DELATTR2,   instr_handler_delattr2)                                       \
+  X(POP,        instr_handler_pop)                                            \
+  X(LDOBJ2,     instr_handler_ldobj2)                                         \
+  X(STOBJ2,     instr_handler_stobj2)                                         \
+  X(DELOBJ,     instr_handler_delobj)                                         \
+  X(DELOBJ2,    instr_handler_delobj2)                                        \
+  X(GETVAL,     instr_handler_getval)                                         \
+  X(SETVAL,     instr_handler_setval)                                         \
+  X(GETVAL2,    instr_handler_getval2)                                        \
+  X(CLRVAL,     instr_handler_clrval)                                         \
+  X(CPYVAL,     instr_handler_cpyval)                                         \
+  X(CPYREPR,    instr_handler_cpyrepr)                                        \
+  X(ISTRUTHY,   instr_handler_istruthy)                                       \
+  X(OBJEQ,      instr_handler_objeq)                                          \
+  X(OBJNEQ,     instr_handler_objneq)                                         \
+  X(SETCTX,     instr_handler_setctx)                                         \
+  X(CLDOBJ,     instr_handler_cldobj)                                         \
+  X(RSETATTRS,  instr_handler_rsetattrs)                                      \
+  X(SETATTRS,   instr_handler_setattrs)                                       \
+  X(PUTOBJ,     instr_handler_putobj)                                         \
+  X(GETOBJ,     instr_handler_getobj)                                         \
+  X(SWAP,       instr_handler_swap)                                           \
+  X(SETFLGC,    instr_handler_setflgc)                                        \
+  X(SETFLDEL,   instr_handler_setfldel)                                       \
+  X(SETFLCALL,  instr_handler_setflcall)                                      \
+  X(SETFLMUTE,  instr_handler_setflmute)                                      \
+                                                                              \
+  /* Control instructions */                                                  \
+                                                                              \
+  X(PINVK,      instr_handler_pinvk)                                          \
+  X(INVK,       instr_handler_invk)                                           \
+  X(RTRN,       instr_handler_rtrn)                                           \
+  X(JMP,        instr_handler_jmp)                                            \
+  X(JMPIF,      instr_handler_jmpif)                                          \
+  X(JMPR,       instr_handler_jmpr)                                           \
+  X(EXC,        instr_handler_exc)                                            \
+  X(EXCOBJ,     instr_handler_excobj)                                         \
+  X(CLREXC,     instr_handler_clrexc)                                         \
+  X(JMPEXC,     instr_handler_jmpexc)                                         \
+  X(EXIT,       instr_handler_exit)                                           \
+                                                                              \
+  /* Function instructions */                                                 \
+                                                                              \
+  X(PUTARG,     instr_handler_putarg)                                         \
+  X(PUTKWARG,   instr_handler_putkwarg)                                       \
+  X(PUTARGS,    instr_handler_putargs)                                        \
+  X(PUTKWARGS,  instr_handler_putkwargs)                                      \
+  X(GETARG,     instr_handler_getarg)                                         \
+  X(GETKWARG,   instr_handler_getkwarg)                                       \
+  X(GETARGS,    instr_handler_getargs)                                        \
+  X(GETKWARGS,  instr_handler_getkwargs)                                      \
+  X(HASARGS,    instr_handler_hasargs)                                        \
+                                                                              \
+  /* Runtime instructions */                                                  \
+                                                                              \
+  X(GC,         instr_handler_gc)                                             \
+  X(DEBUG,      instr_handler_debug)                                          \
+  X(DBGFRM,     instr_handler_dbgfrm)                                         \
+  X(DBGMEM,     instr_handler_dbgmem)                                         \
+  X(DBGVAR,     instr_handler_dbgvar)                                         \
+  X(PRINT,      instr_handler_print)                                          \
+  X(SWAP2,      instr_handler_swap2)                                          \
+                                                                              \
+  /* Arithmetic and logic instructions */                                     \
+                                                                              \
+  X(POS,        instr_handler_pos)                                            \
+  X(NEG,        instr_handler_neg)                                            \
+  X(INC,        instr_handler_inc)                                            \
+  X(DEC,        instr_handler_dec)                                            \
+  X(ABS,        instr_handler_abs)                                            \
+  X(SQRT,       instr_handler_sqrt)                                           \
+  X(ADD,        instr_handler_add)                                            \
+  X(SUB,        instr_handler_sub)                                            \
+  X(MUL,        instr_handler_mul)                                            \
+  X(DIV,        instr_handler_div)                                            \
+  X(MOD,        instr_handler_mod)                                            \
+  X(POW,        instr_handler_pow)                                            \
+  X(BNOT,       instr_handler_bnot)                                           \
+  X(BAND,       instr_handler_band)                                           \
+  X(BOR,        instr_handler_bor)                                            \
+  X(BXOR,       instr_handler_bxor)                                           \
+  X(BLS,        instr_handler_bls)                                            \
+  X(BRS,        instr_handler_brs)                                            \
+  X(EQ,         instr_handler_eq)                                             \
+  X(NEQ,        instr_handler_neq)                                            \
+  X(GT,         instr_handler_gt)                                             \
+  X(LT,         instr_handler_lt)                                             \
+  X(GTE,        instr_handler_gte)                                            \
+  X(LTE,        instr_handler_lte)                                            \
+  X(LNOT,       instr_handler_lnot)                                           \
+  X(LAND,       instr_handler_land)                                           \
+  X(LOR,        instr_handler_lor)                                            \
+  X(CMP,        instr_handler_cmp)                                            \
+                                                                              \
+  /* Native type creation instructions */                                     \
+                                                                              \
+  X(INT8,       instr_handler_int8)                                           \
+  X(UINT8,      instr_handler_uint8)                                          \
+  X(INT16,      instr_handler_int16)                                          \
+  X(UINT16,     instr_handler_uint16)                                         \
+  X(INT32,      instr_handler_int32)                                          \
+  X(UINT32,     instr_handler_uint32)                                         \
+  X(INT64,      instr_handler_int64)                                          \
+  X(UINT64,     instr_handler_uint64)                                         \
+  X(BOOL,       instr_handler_bool)                                           \
+  X(DEC1,       instr_handler_dec1)                                           \
+  X(DEC2,       instr_handler_dec2)                                           \
+  X(STR,        instr_handler_str)                                            \
+  X(ARY,        instr_handler_ary)                                            \
+  X(MAP,        instr_handler_map)                                            \
+                                                                              \
+  /* Native type conversion instructions */                                   \
+                                                                              \
+  X(TOINT8,     instr_handler_2int8)                                          \
+  X(TOUINT8,    instr_handler_2uint8)                                         \
+  X(TOINT16,    instr_handler_2int16)                                         \
+  X(TOUINT16,   instr_handler_2uint16)                                        \
+  X(TOINT32,    instr_handler_2int32)                                         \
+  X(TOUINT32,   instr_handler_2uint32)                                        \
+  X(TOINT64,    instr_handler_2int64)                                         \
+  X(TOUINT64,   instr_handler_2uint64)                                        \
+  X(TOBOOL,     instr_handler_2bool)                                          \
+  X(TODEC1,     instr_handler_2dec1)                                          \
+  X(TODEC2,     instr_handler_2dec2)                                          \
+  X(TOSTR,      instr_handler_2str)                                           \
+  X(TOARY,      instr_handler_2ary)                                           \
+  X(TOMAP,      instr_handler_2map)                                           \
+                                                                              \
+  /* Native type manipulation instructions */                                 \
+                                                                              \
+  X(TRUTHY,     instr_handler_truthy)                                         \
+  X(REPR,       instr_handler_repr)                                           \
+  X(HASH,       instr_handler_hash)                                           \
+  X(SLICE,      instr_handler_slice)                                          \
+  X(STRIDE,     instr_handler_stride)                                         \
+  X(REVERSE,    instr_handler_reverse)                                        \
+  X(ROUND,      instr_handler_round)                                          \
+                                                                              \
+  /* String type instructions */                                              \
+                                                                              \
+  X(STRLEN,     instr_handler_strlen)                                         \
+  X(STRAT,      instr_handler_strat)                                          \
+  X(STRCLR,     instr_handler_strclr)                                         \
+  X(STRAPD,     instr_handler_strapd)                                         \
+  X(STRPSH,     instr_handler_strpsh)                                         \
+  X(STRIST,     instr_handler_strist)                                         \
+  X(STRIST2,    instr_handler_strist2)                                        \
+  X(STRERS,     instr_handler_strers)                                         \
+  X(STRERS2,    instr_handler_strers2)                                        \
+  X(STRRPLC,    instr_handler_strrplc)                                        \
+  X(STRSWP,     instr_handler_strswp)                                         \
+  X(STRSUB,     instr_handler_strsub)                                         \
+  X(STRSUB2,    instr_handler_strsub2)                                        \
+  X(STRFND,     instr_handler_strfnd)                                         \
+  X(STRFND2,    instr_handler_strfnd2)                                        \
+  X(STRRFND,    instr_handler_strrfnd)                                        \
+  X(STRRFND2,   instr_handler_strrfnd2)                                       \
+                                                                              \
+  /* Array type instructions */                                               \
+                                                                              \
+  X(ARYLEN,     instr_handler_arylen)                                         \
+  X(ARYEMP,     instr_handler_aryemp)                                         \
+  X(ARYAT,      instr_handler_aryat)                                          \
+  X(ARYFRT,     instr_handler_aryfrt)                                         \
+  X(ARYBAK,     instr_handler_arybak)                                         \
+  X(ARYPUT,     instr_handler_aryput)                                         \
+  X(ARYAPND,    instr_handler_aryapnd)                                        \
+  X(ARYERS,     instr_handler_aryers)                                         \
+  X(ARYPOP,     instr_handler_arypop)                                         \
+  X(ARYSWP,     instr_handler_aryswp)                                         \
+  X(ARYCLR,     instr_handler_aryclr)                                         \
+  X(ARYMRG,     instr_handler_arymrg)                                         \
+                                                                              \
+  /* Map type instructions */                                                 \
+                                                                              \
+  X(MAPLEN,     instr_handler_maplen)                                         \
+  X(MAPEMP,     instr_handler_mapemp)                                         \
+  X(MAPFIND,    instr_handler_mapfind)                                        \
+  X(MAPAT,      instr_handler_mapat)                                          \
+  X(MAPPUT,     instr_handler_mapput)                                         \
+  X(MAPSET,     instr_handler_mapset)                                         \
+  X(MAPERS,     instr_handler_mapers)                                         \
+  X(MAPCLR,     instr_handler_mapclr)                                         \
+  X(MAPSWP,     instr_handler_mapswp)                                         \
+  X(MAPKEYS,    instr_handler_mapkeys)                                        \
+  X(MAPVALS,    instr_handler_mapvals)                                        \
+  X(MAPMRG,     instr_handler_mapmrg)                                         \
+                                                                              \
+  /* Array type instructions (continued) */                                   \
+                                                                              \
+  X(ARYSUM,     instr_handler_arysum)                                         \
+  X(ARYMIN,     instr_handler_arymin)                                         \
+  X(ARYMAX,     instr_handler_arymax)                                         \
+  X(ARYFND,     instr_handler_aryfnd)                                         \
+                                                                              \
+  /* String type instructions (continued) */                                  \
+                                                                              \
+  X(STRRPLCALL, instr_handler_strrplcall)                                     \
+  X(STRSPLIT,   instr_handler_strsplit)                                       \
+  X(STRJOIN,    instr_handler_strjoin)                                        \
+                                                                              \
+  /* Vector type instructions */                                              \
+                                                                              \
+  X(VEC,        instr_handler_vec)                                            \
+  X(VECLEN,     instr_handler_veclen)                                         \
+  X(VECAT,      instr_handler_vecat)                                          \
+  X(VECPUT,     instr_handler_vecput)                                         \
+  X(VECAPND,    instr_handler_vecapnd)                                        \
+  X(VECSUM,     instr_handler_vecsum)                                         \
+  X(VECDOT,     instr_handler_vecdot)                                         \
+  X(VECSCL,     instr_handler_vecscl)                                         \
+                                                                              \
+  /* Superinstructions */                                                     \
+                                                                              \
+  X(LDPINVK,    instr_handler_ldpinvk)                                        \
+  X(LDPUTARG,   instr_handler_ldputarg)                                       \
+  X(LDPUTINVK,  instr_handler_ldputinvk)                                      \
+  X(PUTINVK,    instr_handler_putinvk)                                        \
+  X(LDGETATTR,  instr_handler_ldgetattr)                                      \
+  X(NEWINT64,   instr_handler_newint64)                                       \
+  X(NEWSTR,     instr_handler_newstr)                                         \
+  X(NEWSTOBJ,   instr_handler_newstobj)                                       \
+  X(GETMUTVAL,  instr_handler_getmutval)                                      \
+  X(GETMUTVAL2, instr_handler_getmutval2)                                     \
+                                                                              \
+  /* Quickened instructions */                                                \
+                                                                              \
+  X(ADDI64,     instr_handler_addi64)                                         \
+  X(SUBI64,     instr_handler_subi64)                                         \
+  X(MULI64,     instr_handler_muli64)                                         \
+  X(DIVI64,     instr_handler_divi64)                                         \
+  X(MODI64,     instr_handler_modi64)                                         \
+  X(EQI64,      instr_handler_eqi64)                                          \
+  X(NEQI64,     instr_handler_neqi64)                                         \
+  X(GTI64,      instr_handler_gti64)                                          \
+  X(LTI64,      instr_handler_lti64)                                          \
+  X(GTEI64,     instr_handler_gtei64)                                         \
+  X(LTEI64,     instr_handler_ltei64)                                         \
+  X(ADDDEC2,    instr_handler_adddec2)                                        \
+  X(SUBDEC2,    instr_handler_subdec2)                                        \
+  X(MULDEC2,    instr_handler_muldec2)                                        \
+  X(DIVDEC2,    instr_handler_divdec2)                                        \
+  X(MODDEC2,    instr_handler_moddec2)                                        \
+  X(EQDEC2,     instr_handler_eqdec2)                                         \
+  X(NEQDEC2,    instr_handler_neqdec2)                                        \
+  X(GTDEC2,     instr_handler_gtdec2)                                         \
+  X(LTDEC2,     instr_handler_ltdec2)                                         \
+  X(GTEDEC2,    instr_handler_gtedec2)                                        \
+  X(LTEDEC2,    instr_handler_ltedec2)
+
+// -----------------------------------------------------------------------------
+
+typedef void InstrHandler(const DecodedInstr&, Process&, Frame**, InvocationCtx**);
 
 // -----------------------------------------------------------------------------
 
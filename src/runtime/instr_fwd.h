@@ -24,8 +24,10 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #define COREVM_INSTR_FWD_H_
 
 #include "corevm/corevm_bytecode_schema.h" // Compiled.
+#include "types/native_string.h"
 
 #include <cstdint>
+#include <string>
 
 
 namespace corevm {
@@ -1247,6 +1249,342 @@ enum InstrEnum : uint32_t
    */
   MAPMRG,
 
+  /* ------------------ Array type instructions (continued) ----------------- */
+
+  /**
+   * <arysum, _, _>
+   * Pops the top element on the eval stack, and performs the "array sum"
+   * operation.
+   */
+  ARYSUM,
+
+  /**
+   * <arymin, _, _>
+   * Pops the top element on the eval stack, and performs the "array min"
+   * operation.
+   */
+  ARYMIN,
+
+  /**
+   * <arymax, _, _>
+   * Pops the top element on the eval stack, and performs the "array max"
+   * operation.
+   */
+  ARYMAX,
+
+  /**
+   * <aryfnd, _, _>
+   * Pops the top two elements on the eval stack, and performs the
+   * "array find" operation.
+   */
+  ARYFND,
+
+  /* ----------------- String type instructions (continued) ----------------- */
+
+  /**
+   * <strrplcall, _, _>
+   * Pops the top three elements on the eval stack, and performs the
+   * "string replace all" operation.
+   */
+  STRRPLCALL,
+
+  /**
+   * <strsplit, _, _>
+   * Pops the top two elements on the eval stack, and performs the
+   * "string split" operation.
+   */
+  STRSPLIT,
+
+  /**
+   * <strjoin, _, _>
+   * Pops the top three elements on the eval stack, and performs the
+   * "string join" operation.
+   */
+  STRJOIN,
+
+  /* ------------------------ Vector type instructions ---------------------- */
+
+  /**
+   * <vec, _, _>
+   * Creates an instance of type `vector` and place it on top of eval stack.
+   */
+  VEC,
+
+  /**
+   * <veclen, _, _>
+   * Pops the top element on the eval stack, and performs the "vector size"
+   * operation.
+   */
+  VECLEN,
+
+  /**
+   * <vecat, _, _>
+   * Pops the top two elements on the eval stack, and performs the "vector at"
+   * operation.
+   */
+  VECAT,
+
+  /**
+   * <vecput, _, _>
+   * Pops the top three elements on the eval stack, and performs the
+   * "vector put" operation.
+   */
+  VECPUT,
+
+  /**
+   * <vecapnd, _, _>
+   * Pops the top two elements on the eval stack, and performs the
+   * "vector append" operation.
+   */
+  VECAPND,
+
+  /**
+   * <vecsum, _, _>
+   * Pops the top element on the eval stack, and performs the "vector sum"
+   * operation.
+   */
+  VECSUM,
+
+  /**
+   * <vecdot, _, _>
+   * Pops the top two elements on the eval stack, and performs the
+   * "vector dot" operation.
+   */
+  VECDOT,
+
+  /**
+   * <vecscl, _, _>
+   * Pops the top two elements on the eval stack, and performs the
+   * "vector scale" operation.
+   */
+  VECSCL,
+
+  /* ---------------------------- Superinstructions ------------------------- */
+
+  /*
+   * Superinstructions fuse common sequences of the instructions above, and
+   * are only synthesized when closures are decoded (see
+   * `Compartment::get_decoded_vector()`). Each one takes the place of the
+   * first instruction of its sequence, and reads the operands of the rest
+   * from the decoded instructions that follow, which are kept in place so
+   * that instruction addresses do not change.
+   */
+
+  /**
+   * <ldpinvk, key, _>
+   * Fuses <ldobj, key, _> and <pinvk, _, _>.
+   */
+  LDPINVK,
+
+  /**
+   * <ldputarg, key, _>
+   * Fuses <ldobj, key, _> and <putarg, _, _>, without placing the object
+   * on the stack.
+   */
+  LDPUTARG,
+
+  /**
+   * <ldputinvk, key, _>
+   * Fuses <ldobj, key, _>, <putarg, _, _> and <invk, _, _>, without placing
+   * the object on the stack.
+   */
+  LDPUTINVK,
+
+  /**
+   * <putinvk, _, _>
+   * Fuses <putarg, _, _> and <invk, _, _>.
+   */
+  PUTINVK,
+
+  /**
+   * <ldgetattr, key, _>
+   * Fuses <ldobj, key, _> and <getattr, attr_str_key, _>, without placing
+   * the loaded object on the stack.
+   */
+  LDGETATTR,
+
+  /**
+   * <newint64, _, _>
+   * Fuses <new, _, _>, <int64, value, _> and <setval, _, _>, without placing
+   * the value on the eval stack.
+   */
+  NEWINT64,
+
+  /**
+   * <newstr, _, _>
+   * Fuses <new, _, _>, <str, value, _> and <setval, _, _>, without placing
+   * the value on the eval stack.
+   */
+  NEWSTR,
+
+  /**
+   * <newstobj, _, _>
+   * Fuses <new, _, _>, <setval, _, _> and <stobj, key, _>, without placing
+   * the object on the stack.
+   */
+  NEWSTOBJ,
+
+  /**
+   * <getmutval, _, _>
+   * Fuses <getval, _, _>, an instruction that mutates the top element on the
+   * eval stack in place (e.g. <strapd, _, _>), and <setval, _, _>, by moving
+   * the native type value of the object on top of the stack onto the eval
+   * stack and back instead of copying it.
+   */
+  GETMUTVAL,
+
+  /**
+   * <getmutval2, key, _>
+   * Fuses <getval2, key, _>, an instruction that mutates the top element on
+   * the eval stack in place (e.g. <aryapnd, _, _>), <ldobj, key, _> and
+   * <setval, _, _>, by moving the native type value of the object onto the
+   * eval stack and back instead of copying it.
+   */
+  GETMUTVAL2,
+
+  /* ------------------------- Quickened instructions ----------------------- */
+
+  /*
+   * Type-specialized forms of arithmetic and comparison instructions. The
+   * generic instructions quicken themselves in place into one of these once
+   * they see operands of a matching type, and these fall back to the generic
+   * forms for good once they see operands of any other types (see
+   * `DecodedInstr::FLAG_POLYMORPHIC`). Like superinstructions, they are never
+   * valid in bytecode.
+   */
+
+  /**
+   * <addi64, _, _>
+   * Quickened form of <add, _, _> on two `int64` operands.
+   */
+  ADDI64,
+
+  /**
+   * <subi64, _, _>
+   * Quickened form of <sub, _, _> on two `int64` operands.
+   */
+  SUBI64,
+
+  /**
+   * <muli64, _, _>
+   * Quickened form of <mul, _, _> on two `int64` operands.
+   */
+  MULI64,
+
+  /**
+   * <divi64, _, _>
+   * Quickened form of <div, _, _> on two `int64` operands.
+   */
+  DIVI64,
+
+  /**
+   * <modi64, _, _>
+   * Quickened form of <mod, _, _> on two `int64` operands.
+   */
+  MODI64,
+
+  /**
+   * <eqi64, _, _>
+   * Quickened form of <eq, _, _> on two `int64` operands.
+   */
+  EQI64,
+
+  /**
+   * <neqi64, _, _>
+   * Quickened form of <neq, _, _> on two `int64` operands.
+   */
+  NEQI64,
+
+  /**
+   * <gti64, _, _>
+   * Quickened form of <gt, _, _> on two `int64` operands.
+   */
+  GTI64,
+
+  /**
+   * <lti64, _, _>
+   * Quickened form of <lt, _, _> on two `int64` operands.
+   */
+  LTI64,
+
+  /**
+   * <gtei64, _, _>
+   * Quickened form of <gte, _, _> on two `int64` operands.
+   */
+  GTEI64,
+
+  /**
+   * <ltei64, _, _>
+   * Quickened form of <lte, _, _> on two `int64` operands.
+   */
+  LTEI64,
+
+  /**
+   * <adddec2, _, _>
+   * Quickened form of <add, _, _> on two `decimal2` operands.
+   */
+  ADDDEC2,
+
+  /**
+   * <subdec2, _, _>
+   * Quickened form of <sub, _, _> on two `decimal2` operands.
+   */
+  SUBDEC2,
+
+  /**
+   * <muldec2, _, _>
+   * Quickened form of <mul, _, _> on two `decimal2` operands.
+   */
+  MULDEC2,
+
+  /**
+   * <divdec2, _, _>
+   * Quickened form of <div, _, _> on two `decimal2` operands.
+   */
+  DIVDEC2,
+
+  /**
+   * <moddec2, _, _>
+   * Quickened form of <mod, _, _> on two `decimal2` operands.
+   */
+  MODDEC2,
+
+  /**
+   * <eqdec2, _, _>
+   * Quickened form of <eq, _, _> on two `decimal2` operands.
+   */
+  EQDEC2,
+
+  /**
+   * <neqdec2, _, _>
+   * Quickened form of <neq, _, _> on two `decimal2` operands.
+   */
+  NEQDEC2,
+
+  /**
+   * <gtdec2, _, _>
+   * Quickened form of <gt, _, _> on two `decimal2` operands.
+   */
+  GTDEC2,
+
+  /**
+   * <ltdec2, _, _>
+   * Quickened form of <lt, _, _> on two `decimal2` operands.
+   */
+  LTDEC2,
+
+  /**
+   * <gtedec2, _, _>
+   * Quickened form of <gte, _, _> on two `decimal2` operands.
+   */
+  GTEDEC2,
+
+  /**
+   * <ltedec2, _, _>
+   * Quickened form of <lte, _, _> on two `decimal2` operands.
+   */
+  LTEDEC2,
+
   /* -------------------------------- Max ----------------------------------- */
 
   INSTR_CODE_MAX
@@ -1254,6 +1592,77 @@ enum InstrEnum : uint32_t
 
 // -----------------------------------------------------------------------------
 
+/**
+ * Compact form of an instruction, which is what the interpreter executes.
+ *
+ * Each closure is decoded into a vector of these the first time it runs
+ * (see `Compartment::get_decoded_vector()`). Compared to `Instr`, the
+ * instruction code and the second operand are narrowed, and literal operands
+ * are resolved against the literal tables of the owning compartment ahead of
+ * time, so that handlers do not have to look them up on every execution.
+ * Source locations and catch sites are not part of the decoded form, and
+ * remain in the closure.
+ */
+struct DecodedInstr
+{
+  enum Flags : uint16_t
+  {
+    /** `str_literal` holds the resolved string literal of `oprd1`. */
+    FLAG_STR_LITERAL = 1 << 0,
+
+    /** `fpt_literal` holds the resolved floating-point literal of `oprd1`. */
+    FLAG_FPT_LITERAL = 1 << 1,
+
+    /**
+     * `oprd2` holds the index of the inline cache of the instruction in the
+     * owning compartment (see `Compartment::get_attr_cache()`).
+     */
+    FLAG_ATTR_CACHE = 1 << 2,
+
+    /**
+     * `oprd2` holds the lexical address of the variable of `oprd1`, encoded
+     * by `VariableLayout::encode_addr()`.
+     */
+    FLAG_VAR_ADDR = 1 << 3,
+
+    /**
+     * The instruction has fallen back from a quickened form, and is not to be
+     * quickened again.
+     */
+    FLAG_POLYMORPHIC = 1 << 4
+  };
+
+  DecodedInstr();
+
+  /**
+   * Implicit on purpose, so that handlers can be invoked on an undecoded
+   * instruction directly.
+   */
+  DecodedInstr(const Instr&);
+
+  union
+  {
+    int64_t oprd1;
+    double fpt_literal;
+    const types::native_string* str_literal;
+  };
+
+  int32_t oprd2;
+
+  /**
+   * Mutable so that instruction handlers can quicken the instructions they
+   * run in place.
+   */
+  mutable uint16_t code;
+  mutable uint16_t flags;
+};
+
+// -----------------------------------------------------------------------------
+
+static_assert(sizeof(DecodedInstr) == 16, "Unexpected size of DecodedInstr");
+
+// -----------------------------------------------------------------------------
+
 } /* end namespace runtime */
 } /* end namespace corevm */
 
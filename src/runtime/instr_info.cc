@@ -235,6 +235,68 @@ const InstrInfo InstrSetInfo::instr_infos[INSTR_CODE_MAX] {
   /* MAPVALS  */     { .name="mapvals"   },
   /* MAPMRG   */     { .name="mapmrg"    },
 
+  /* --------------- Array type instructions (continued) -------------------- */
+
+  /* ARYSUM   */     { .name="arysum"    },
+  /* ARYMIN   */     { .name="arymin"    },
+  /* ARYMAX   */     { .name="arymax"    },
+  /* ARYFND   */     { .name="aryfnd"    },
+
+  /* -------------- String type instructions (continued) -------------------- */
+
+  /* STRRPLCALL */   { .name="strrplcall"},
+  /* STRSPLIT */     { .name="strsplit"  },
+  /* STRJOIN  */     { .name="strjoin"   },
+
+  /* -------------------- Vector type instructions -------------------------- */
+
+  /* VEC      */     { .name="vec"       },
+  /* VECLEN   */     { .name="veclen"    },
+  /* VECAT    */     { .name="vecat"     },
+  /* VECPUT   */     { .name="vecput"    },
+  /* VECAPND  */     { .name="vecapnd"   },
+  /* VECSUM   */     { .name="vecsum"    },
+  /* VECDOT   */     { .name="vecdot"    },
+  /* VECSCL   */     { .name="vecscl"    },
+
+  /* ------------------------- Superinstructions ---------------------------- */
+
+  /* LDPINVK   */    { .name="ldpinvk"   },
+  /* LDPUTARG  */    { .name="ldputarg"  },
+  /* LDPUTINVK */    { .name="ldputinvk" },
+  /* PUTINVK   */    { .name="putinvk"   },
+  /* LDGETATTR */    { .name="ldgetattr" },
+  /* NEWINT64  */    { .name="newint64"  },
+  /* NEWSTR    */    { .name="newstr"    },
+  /* NEWSTOBJ  */    { .name="newstobj"  },
+  /* GETMUTVAL */    { .name="getmutval" },
+  /* GETMUTVAL2 */   { .name="getmutval2" },
+
+  /* ------------------------- Quickened instructions ----------------------- */
+
+  /* ADDI64    */    { .name="addi64"    },
+  /* SUBI64    */    { .name="subi64"    },
+  /* MULI64    */    { .name="muli64"    },
+  /* DIVI64    */    { .name="divi64"    },
+  /* MODI64    */    { .name="modi64"    },
+  /* EQI64     */    { .name="eqi64"     },
+  /* NEQI64    */    { .name="neqi64"    },
+  /* GTI64     */    { .name="gti64"     },
+  /* LTI64     */    { .name="lti64"     },
+  /* GTEI64    */    { .name="gtei64"    },
+  /* LTEI64    */    { .name="ltei64"    },
+  /* ADDDEC2   */    { .name="adddec2"   },
+  /* SUBDEC2   */    { .name="subdec2"   },
+  /* MULDEC2   */    { .name="muldec2"   },
+  /* DIVDEC2   */    { .name="divdec2"   },
+  /* MODDEC2   */    { .name="moddec2"   },
+  /* EQDEC2    */    { .name="eqdec2"    },
+  /* NEQDEC2   */    { .name="neqdec2"   },
+  /* GTDEC2    */    { .name="gtdec2"    },
+  /* LTDEC2    */    { .name="ltdec2"    },
+  /* GTEDEC2   */    { .name="gtedec2"   },
+  /* LTEDEC2   */    { .name="ltedec2"   },
+
 };
 
 // -----------------------------------------------------------------------------
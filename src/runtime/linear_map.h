@@ -70,6 +70,8 @@ public:
 
   bool empty() const { return m_vec.empty(); }
 
+  void clear() { m_vec.clear(); }
+
   iterator find(K k)
   {
     return std::find_if(m_vec.begin(), m_vec.end(), KeyPred(k));
@@ -0,0 +1,299 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2016 Yanzheng Li
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#ifndef COREVM_OPERAND_STACK_H_
+#define COREVM_OPERAND_STACK_H_
+
+#include "corevm/macros.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <vector>
+
+
+namespace corevm {
+namespace runtime {
+
+/**
+ * Contiguous storage of the eval stacks of all frames of a process.
+ *
+ * Each frame reserves a window of the stack when it is pushed, and releases
+ * it when it is popped, so windows are allocated and released in LIFO order
+ * by bumping a pointer. The window of the frame on top of the stack can be
+ * extended in place while there is room left in the current chunk.
+ *
+ * Storage is made of chunks that are never relocated nor freed until the
+ * stack is cleared, so addresses of windows remain valid as the stack
+ * grows. The stack only hands out raw memory; values in windows are
+ * constructed and destroyed by the frames that own them.
+ */
+template<typename T>
+class OperandStack
+{
+public:
+  typedef T value_type;
+
+  /**
+   * Position of the top of the stack, to release windows to.
+   */
+  struct Mark
+  {
+    Mark() : chunk(0), top(NULL) {}
+
+    size_t chunk;
+    value_type* top;
+  };
+
+  /** Minimum number of values in each chunk. */
+  static const size_t CHUNK_CAPACITY = 1024;
+
+  OperandStack();
+
+  OperandStack(const OperandStack&) = delete;
+  OperandStack& operator=(const OperandStack&) = delete;
+
+  ~OperandStack();
+
+  /**
+   * Reserves a window of storage for `n` values on top of the stack, and
+   * sets the mark to release it to.
+   */
+  value_type* allocate(size_t n, Mark*);
+
+  /**
+   * Extends the window ending at `end` by `n` values in place.
+   *
+   * Returns `false` if the window is not on top of the stack, or there is not
+   * enough room left in its chunk.
+   */
+  bool extend(const value_type* end, size_t n);
+
+  /**
+   * Determines if the window ending at `end` is on top of the stack.
+   */
+  bool is_top(const value_type* end) const;
+
+  /**
+   * Releases all windows allocated since the specified mark was set.
+   */
+  void release(const Mark&);
+
+  /**
+   * Releases all windows, and frees the storage of the stack.
+   */
+  void clear();
+
+  size_t chunk_count() const;
+
+private:
+  struct Chunk
+  {
+    value_type* data;
+    size_t capacity;
+  };
+
+  value_type* allocate_from_next_chunk(size_t n);
+
+  void set_chunk(size_t);
+
+  std::vector<Chunk> m_chunks;
+  size_t m_chunk;
+  value_type* m_top;
+  value_type* m_limit;
+};
+
+// -----------------------------------------------------------------------------
+
+template<typename T>
+const size_t OperandStack<T>::CHUNK_CAPACITY;
+
+// -----------------------------------------------------------------------------
+
+template<typename T>
+OperandStack<T>::OperandStack()
+  :
+  m_chunks(),
+  m_chunk(0),
+  m_top(NULL),
+  m_limit(NULL)
+{
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename T>
+OperandStack<T>::~OperandStack()
+{
+  clear();
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename T>
+inline T*
+OperandStack<T>::allocate(size_t n, Mark* mark)
+{
+  mark->chunk = m_chunk;
+  mark->top = m_top;
+
+  if (static_cast<size_t>(m_limit - m_top) >= n)
+  {
+    value_type* window = m_top;
+    m_top += n;
+    return window;
+  }
+
+  return allocate_from_next_chunk(n);
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename T>
+T*
+OperandStack<T>::allocate_from_next_chunk(size_t n)
+{
+  // The remainder of the current chunk is left unused until the windows
+  // allocated from the next one are released.
+  const size_t next = m_chunks.empty() ? 0 : m_chunk + 1;
+  const size_t capacity = std::max(n, CHUNK_CAPACITY);
+
+  if (next == m_chunks.size())
+  {
+    Chunk chunk;
+    chunk.data = static_cast<value_type*>(
+      ::operator new(capacity * sizeof(value_type)));
+    chunk.capacity = capacity;
+    m_chunks.push_back(chunk);
+  }
+  else if (m_chunks[next].capacity < n)
+  {
+    // Chunks above the current one hold no windows.
+    ::operator delete(m_chunks[next].data);
+    m_chunks[next].data = static_cast<value_type*>(
+      ::operator new(capacity * sizeof(value_type)));
+    m_chunks[next].capacity = capacity;
+  }
+
+  set_chunk(next);
+
+  value_type* window = m_top;
+  m_top += n;
+  return window;
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename T>
+inline bool
+OperandStack<T>::extend(const value_type* end, size_t n)
+{
+  if (end != m_top || static_cast<size_t>(m_limit - m_top) < n)
+  {
+    return false;
+  }
+
+  m_top += n;
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename T>
+inline bool
+OperandStack<T>::is_top(const value_type* end) const
+{
+  return end == m_top;
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename T>
+inline void
+OperandStack<T>::release(const Mark& mark)
+{
+  if (!mark.top)
+  {
+    // Set before any chunk was allocated.
+    m_top = m_chunks.empty() ? NULL : m_chunks[0].data;
+    m_limit = m_chunks.empty() ? NULL : m_chunks[0].data + m_chunks[0].capacity;
+    m_chunk = 0;
+    return;
+  }
+
+  if (mark.chunk != m_chunk)
+  {
+    set_chunk(mark.chunk);
+  }
+
+  m_top = mark.top;
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename T>
+void
+OperandStack<T>::clear()
+{
+  for (auto& chunk : m_chunks)
+  {
+    ::operator delete(chunk.data);
+  }
+
+  m_chunks.clear();
+  m_chunk = 0;
+  m_top = NULL;
+  m_limit = NULL;
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename T>
+size_t
+OperandStack<T>::chunk_count() const
+{
+  return m_chunks.size();
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename T>
+void
+OperandStack<T>::set_chunk(size_t i)
+{
+#if __DEBUG__
+  ASSERT(i < m_chunks.size());
+#endif
+
+  m_chunk = i;
+  m_top = m_chunks[i].data;
+  m_limit = m_chunks[i].data + m_chunks[i].capacity;
+}
+
+// -----------------------------------------------------------------------------
+
+} /* end namespace runtime */
+} /* end namespace corevm */
+
+
+#endif /* COREVM_OPERAND_STACK_H_ */
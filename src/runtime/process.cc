@@ -29,6 +29,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "compartment_printer.h"
 #include "errors.h"
 #include "frame.h"
+#include "frame_arena.h"
 #include "frame_cache.h"
 #include "gc_rule.h"
 #include "instr.h"
@@ -214,6 +215,8 @@ public:
 
   void insert_attr_name(dyobj::attr_key_t, const char*);
 
+  void insert_attr_names(const Compartment&);
+
   bool get_attr_name(dyobj::attr_key_t, const char**) const;
 
   instr_addr_t pc() const;
@@ -275,8 +278,6 @@ private:
 
   bool start();
 
-  void check_call_stack_capacity();
-
   void check_invk_ctx_stack_capacity();
 
   void set_parent_for_top_frame();
@@ -284,7 +285,7 @@ private:
   typedef llvm::SmallString<16> AttributeNameType;
   typedef std::unordered_map<dyobj::attr_key_t, AttributeNameType> AttributeNameStore;
   typedef llvm::SmallVector<dyobj_ptr, 20> DynamicObjectStack;
-  typedef llvm::SmallVector<Frame, 20> CallStack;
+  typedef FrameArena CallStack;
   typedef llvm::SmallVector<InvocationCtx, 20> InvocationCtxStack;
   typedef llvm::SmallVector<Compartment, 5> CompartmentStore;
 
@@ -468,22 +469,13 @@ Process::Impl::pop_frame()
 {
   Frame& frame = top_frame();
 
-  auto visible_objs = frame.get_visible_objs();
-  auto invisible_objs = frame.get_invisible_objs();
-
-  std::for_each(visible_objs.begin(), visible_objs.end(),
-    [this](Process::dyobj_ptr ptr) {
-      ptr->manager().on_exit();
-    }
-  );
-
-  std::for_each(invisible_objs.begin(), invisible_objs.end(),
-    [this](Process::dyobj_ptr ptr) {
+  frame.iterate_objs(
+    [](Process::dyobj_ptr ptr) {
       ptr->manager().on_exit();
     }
   );
 
-  m_frame_cache.erase_parent_frame(&frame);
+  m_frame_cache.erase_frame(&frame);
 
   m_call_stack.pop_back();
 
@@ -495,35 +487,16 @@ Process::Impl::pop_frame()
 void
 Process::Impl::pop_frame_safe()
 {
+  m_frame_cache.erase_frame(&m_call_stack.back());
   m_call_stack.pop_back();
   pop_invocation_ctx();
 }
 
 // -----------------------------------------------------------------------------
 
-void
-Process::Impl::check_call_stack_capacity()
-{
-  // NOTE: Pointers of frames on the call stack are used to set as parents
-  // on frames. If memories for frames are ever relocated here, we need to
-  // reset the pointers.
-  size_t current_size = m_call_stack.size();
-  if (current_size == m_call_stack.capacity())
-  {
-    size_t new_size = current_size << 1;
-    if (new_size > current_size)
-    {
-      m_call_stack.reserve(new_size);
-    }
-  }
-}
-
-// -----------------------------------------------------------------------------
-
 void
 Process::Impl::push_frame(Frame& frame)
 {
-  check_call_stack_capacity();
   m_call_stack.push_back(frame);
 
   set_parent_for_top_frame();
@@ -537,8 +510,7 @@ Process::Impl::emplace_frame(const ClosureCtx& ctx, Compartment* compartment,
 {
   ASSERT(compartment);
   ASSERT(closure);
-  check_call_stack_capacity();
-  m_call_stack.push_back(Frame(ctx, compartment, closure));
+  m_call_stack.emplace_back(ctx, compartment, closure, NONESET_INSTR_ADDR);
 
   set_parent_for_top_frame();
 }
@@ -551,8 +523,7 @@ Process::Impl::emplace_frame(const ClosureCtx& ctx, Compartment* compartment,
 {
   ASSERT(compartment);
   ASSERT(closure);
-  check_call_stack_capacity();
-  m_call_stack.push_back(Frame(ctx, compartment, closure, return_addr));
+  m_call_stack.emplace_back(ctx, compartment, closure, return_addr);
 
   set_parent_for_top_frame();
 }
@@ -564,20 +535,9 @@ Process::Impl::set_parent_for_top_frame()
 {
   Frame* frame = &m_call_stack.back();
 
-  Frame* parent = NULL;
-
-  parent = m_frame_cache.parent_frame_of(frame->closure_ctx());
-
-  if (!parent)
-  {
-    parent = find_parent_frame_in_process(frame);
-    if (parent)
-    {
-      m_frame_cache.insert_parent_frame(frame->closure_ctx(), parent);
-    }
-  }
+  frame->set_parent(find_parent_frame_in_process(frame));
 
-  frame->set_parent(parent);
+  m_frame_cache.insert_frame(frame);
 }
 
 // -----------------------------------------------------------------------------
@@ -789,6 +749,22 @@ Process::Impl::insert_attr_name(dyobj::attr_key_t attr_key, const char* attr_nam
 
 // -----------------------------------------------------------------------------
 
+void
+Process::Impl::insert_attr_names(const Compartment& compartment)
+{
+  for (size_t i = 0; i < compartment.string_literal_count(); ++i)
+  {
+    const auto key = static_cast<encoding_key_t>(i);
+
+    const char* attr_name = NULL;
+    compartment.get_string_literal(key, &attr_name);
+
+    insert_attr_name(compartment.get_attr_key(key), attr_name);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
 bool
 Process::Impl::get_attr_name(dyobj::attr_key_t attr_key, const char** attr_name) const
 {
@@ -906,6 +882,116 @@ Process::Impl::run()
   runtime::Frame** frame_ptr = &frame;
   InvocationCtx** invk_ctx_ptr = &invk_ctx;
 
+#if COREVM_USE_THREADED_DISPATCH && !__MEASURE_INSTRS__
+
+/**
+ * Direct-threaded dispatch.
+ *
+ * Every instruction code has its own label, generated from
+ * `COREVM_INSTR_HANDLERS`, which calls the corresponding handler directly and
+ * then jumps straight to the label of the next instruction.
+ * Each label therefore owns an indirect branch, which gives the branch
+ * predictor a lot more context than the single dispatch site of the loop
+ * below.
+ *
+ * The decoded instruction vector of the current frame is cached in `code` and
+ * `code_size`, and is only reloaded when a handler changes the current frame
+ * (e.g. `INVK`, `RTRN` and `EXC`), which all update `frame` through
+ * `frame_ptr`.
+ */
+
+#if defined(__clang__) and __clang__
+  #pragma clang diagnostic push
+  #pragma clang diagnostic ignored "-Wgnu-label-as-value"
+#endif
+
+#define THREADED_DISPATCH_LABEL(code) threaded_dispatch_##code
+
+#define THREADED_DISPATCH_LABEL_ADDR(code, handler)                           \
+  && THREADED_DISPATCH_LABEL(code),
+
+#define THREADED_DISPATCH_LOAD_FRAME()                                        \
+  {                                                                           \
+    const DecodedVector& decoded_vector =                                     \
+      frame->compartment()->get_decoded_vector(frame->closure());             \
+    cached_frame = frame;                                                     \
+    code = decoded_vector.data();                                             \
+    code_size = decoded_vector.size();                                        \
+  }
+
+#define THREADED_DISPATCH()                                                   \
+  if (m_execution_status != Process::EXECUTION_STATUS_ACTIVE)                 \
+  {                                                                           \
+    while (m_execution_status == Process::EXECUTION_STATUS_PAUSED) {}         \
+    if (m_execution_status != Process::EXECUTION_STATUS_ACTIVE)               \
+    {                                                                         \
+      goto threaded_dispatch_end;                                             \
+    }                                                                         \
+  }                                                                           \
+  if (static_cast<uint64_t>(frame->pc()) >= code_size)                        \
+  {                                                                           \
+    goto threaded_dispatch_end;                                               \
+  }                                                                           \
+  instr = code + frame->pc();                                                 \
+  goto *dispatch_table[instr->code];
+
+#define THREADED_DISPATCH_NEXT()                                              \
+  if (m_do_gc)                                                                \
+  {                                                                           \
+    do_gc();                                                                  \
+    m_do_gc = false;                                                          \
+  }                                                                           \
+  if (m_call_stack.empty())                                                   \
+  {                                                                           \
+    goto threaded_dispatch_end;                                               \
+  }                                                                           \
+  if (frame != cached_frame)                                                  \
+  {                                                                           \
+    THREADED_DISPATCH_LOAD_FRAME()                                            \
+  }                                                                           \
+  frame->inc_pc();                                                            \
+  THREADED_DISPATCH()
+
+#define THREADED_DISPATCH_INSTR(code, handler)                                \
+  THREADED_DISPATCH_LABEL(code):                                              \
+    handler(*instr, *m_owner, frame_ptr, invk_ctx_ptr);                       \
+    THREADED_DISPATCH_NEXT()
+
+  static void* const dispatch_table[] {
+    COREVM_INSTR_HANDLERS(THREADED_DISPATCH_LABEL_ADDR)
+  };
+
+  static_assert(
+    sizeof(dispatch_table) / sizeof(dispatch_table[0]) == INSTR_CODE_MAX,
+    "Threaded dispatch table size incompatibility"
+  );
+
+  Frame* cached_frame = nullptr;
+  const DecodedInstr* code = nullptr;
+  uint64_t code_size = 0;
+  const DecodedInstr* instr = nullptr;
+
+  THREADED_DISPATCH_LOAD_FRAME()
+  THREADED_DISPATCH()
+
+  COREVM_INSTR_HANDLERS(THREADED_DISPATCH_INSTR)
+
+threaded_dispatch_end:
+  return;
+
+#undef THREADED_DISPATCH_INSTR
+#undef THREADED_DISPATCH_NEXT
+#undef THREADED_DISPATCH
+#undef THREADED_DISPATCH_LOAD_FRAME
+#undef THREADED_DISPATCH_LABEL_ADDR
+#undef THREADED_DISPATCH_LABEL
+
+#if defined(__clang__) and __clang__
+  #pragma clang diagnostic pop
+#endif
+
+#else
+
 #if __MEASURE_INSTRS__
   std::array<InstrMeasurement, INSTR_CODE_MAX> measurements;
   boost::timer::cpu_timer t;
@@ -915,7 +1001,10 @@ Process::Impl::run()
   {
     while (m_execution_status == Process::EXECUTION_STATUS_PAUSED) {}
 
-    const Instr& instr = top_frame().current_instr();
+    Frame& current_frame = top_frame();
+
+    const DecodedInstr& instr = current_frame.compartment()->get_decoded_vector(
+      current_frame.closure())[static_cast<size_t>(current_frame.pc())];
 
 #if __MEASURE_INSTRS__
     t.start();
@@ -945,6 +1034,8 @@ Process::Impl::run()
 #if __MEASURE_INSTRS__
   pretty_print_measurements(measurements);
 #endif
+
+#endif /* COREVM_USE_THREADED_DISPATCH && !__MEASURE_INSTRS__ */
 }
 
 // -----------------------------------------------------------------------------
@@ -1023,17 +1114,13 @@ Process::Impl::set_pc(instr_addr_t addr)
 bool
 Process::Impl::get_frame_by_closure_ctx(ClosureCtx& closure_ctx, Frame** frame_ptr)
 {
-  auto itr = std::find_if(
-    m_call_stack.begin(),
-    m_call_stack.end(),
-    [&closure_ctx](const Frame& frame) -> bool {
-      return frame.closure_ctx() == closure_ctx;
-    }
-  );
+  // Frames on the call stack are indexed by the frame cache, which yields the
+  // bottom-most one of each closure context.
+  Frame* frame = m_frame_cache.frame_of(closure_ctx);
 
-  if (itr != m_call_stack.end())
+  if (frame)
   {
-    *frame_ptr = &(*itr);
+    *frame_ptr = frame;
     return true;
   }
 
@@ -1070,6 +1157,7 @@ compartment_id_t
 Process::Impl::insert_compartment(const Compartment& compartment)
 {
   m_compartments.push_back(compartment);
+  insert_attr_names(compartment);
   return static_cast<compartment_id_t>(m_compartments.size() - 1);
 }
 
@@ -1081,6 +1169,8 @@ Process::Impl::insert_compartment(const Compartment&& compartment)
   m_compartments.push_back(
     std::forward<const runtime::Compartment>(compartment));
 
+  insert_attr_names(m_compartments.back());
+
   return static_cast<compartment_id_t>(m_compartments.size() - 1);
 }
 
@@ -1103,6 +1193,7 @@ Process::Impl::reset()
   m_gc_flag = 0;
   m_dyobj_stack.clear();
   m_call_stack.clear();
+  m_frame_cache.clear();
   m_invocation_ctx_stack.clear();
   m_compartments.clear();
 }
@@ -204,6 +204,10 @@ public:
 
   size_t compartment_count() const;
 
+  /**
+   * Inserts a compartment, and registers the attribute names of its string
+   * literals with the process.
+   */
   compartment_id_t insert_compartment(const Compartment&);
 
   compartment_id_t insert_compartment(const Compartment&&);
@@ -24,7 +24,6 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include "compartment.h"
 #include "dyobj/common.h"
-#include "dyobj/util.h"
 
 #include <string>
 
@@ -40,9 +39,7 @@ get_attr_key(Compartment* compartment, encoding_key_t str_key,
 {
   compartment->get_string_literal(str_key, attr_str);
 
-  dyobj::attr_key_t attr_key = dyobj::hash_attr_str(*attr_str);
-
-  return attr_key;
+  return compartment->get_attr_key(str_key);
 }
 
 // -----------------------------------------------------------------------------
@@ -50,8 +47,7 @@ get_attr_key(Compartment* compartment, encoding_key_t str_key,
 dyobj::attr_key_t
 get_attr_key(Compartment* compartment, encoding_key_t str_key)
 {
-  std::string attr_str;
-  return get_attr_key(compartment, str_key, &attr_str);
+  return compartment->get_attr_key(str_key);
 }
 
 // -----------------------------------------------------------------------------
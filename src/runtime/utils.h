@@ -99,11 +99,20 @@ ObjPtrType
 getattr(const ObjPtrType& obj, Compartment* compartment,
   encoding_key_t attr_encoding_key)
 {
-  std::string attr_name;
-  dyobj::attr_key_t attr_key = get_attr_key(
-    compartment, attr_encoding_key, &attr_name);
+  ObjPtrType attr_ptr = NULL;
 
-  return getattr(obj, attr_key, attr_name);
+  if (!obj->getattr(get_attr_key(compartment, attr_encoding_key), &attr_ptr))
+  {
+    // The attribute name is only needed for reporting the error.
+    std::string attr_name;
+    dyobj::attr_key_t attr_key = get_attr_key(
+      compartment, attr_encoding_key, &attr_name);
+
+    THROW(dyobj::ObjectAttributeNotFoundError(
+      attr_key, obj->id(), attr_name.c_str()));
+  }
+
+  return attr_ptr;
 }
 
 // -----------------------------------------------------------------------------
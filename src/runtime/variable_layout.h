@@ -0,0 +1,117 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2016 Yanzheng Li
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#ifndef COREVM_VARIABLE_LAYOUT_H_
+#define COREVM_VARIABLE_LAYOUT_H_
+
+#include "common.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+namespace corevm {
+namespace runtime {
+
+/**
+ * Lexical layout of the visible variables of a closure, resolved when its
+ * compartment is loaded.
+ *
+ * Each variable stored by the closure itself (through STOBJ, GETARG or
+ * GETKWARG) is assigned a slot, in order of first appearance. Frames of the
+ * closure keep these variables in a flat slot array, and loads are resolved
+ * to a (depth, slot) address, where the depth is the number of lexical
+ * parents to go up to reach the closure that owns the variable.
+ *
+ * Variables created dynamically under other names (e.g. through STOBJN)
+ * are kept in the variable tables of frames instead.
+ */
+struct VariableLayout
+{
+  /** Maximum depth and slot that can be encoded in a decoded instruction. */
+  static const uint32_t MAX_DEPTH = 0xffff;
+  static const uint32_t MAX_SLOT = 0xffff;
+
+  bool find(variable_key_t, size_t* slot) const;
+
+  static int32_t encode_addr(uint32_t depth, uint32_t slot);
+
+  static uint32_t decode_depth(int32_t addr);
+
+  static uint32_t decode_slot(int32_t addr);
+
+  std::vector<variable_key_t> keys;
+};
+
+// -----------------------------------------------------------------------------
+
+typedef std::vector<VariableLayout> VariableLayoutTable;
+
+// -----------------------------------------------------------------------------
+
+inline bool
+VariableLayout::find(variable_key_t key, size_t* slot) const
+{
+  for (size_t i = 0; i < keys.size(); ++i)
+  {
+    if (keys[i] == key)
+    {
+      *slot = i;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+
+inline int32_t
+VariableLayout::encode_addr(uint32_t depth, uint32_t slot)
+{
+  return static_cast<int32_t>((depth << 16) | slot);
+}
+
+// -----------------------------------------------------------------------------
+
+inline uint32_t
+VariableLayout::decode_depth(int32_t addr)
+{
+  return static_cast<uint32_t>(addr) >> 16;
+}
+
+// -----------------------------------------------------------------------------
+
+inline uint32_t
+VariableLayout::decode_slot(int32_t addr)
+{
+  return static_cast<uint32_t>(addr) & MAX_SLOT;
+}
+
+// -----------------------------------------------------------------------------
+
+} /* end namespace runtime */
+} /* end namespace corevm */
+
+
+#endif /* COREVM_VARIABLE_LAYOUT_H_ */
@@ -37,6 +37,10 @@ typedef std::vector<Instr> Vector;
 
 // -----------------------------------------------------------------------------
 
+typedef std::vector<DecodedInstr> DecodedVector;
+
+// -----------------------------------------------------------------------------
+
 } /* end namespace runtime */
 } /* end namespace corevm */
 
@@ -0,0 +1,822 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2016 Yanzheng Li
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#ifndef COREVM_FLAT_HASH_MAP_H_
+#define COREVM_FLAT_HASH_MAP_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__)
+  #include <emmintrin.h>
+#endif
+
+
+namespace corevm {
+namespace types {
+
+/**
+ * A hash map of open addressing, laid out after "Swiss tables".
+ *
+ * Entries are kept in a single flat array of slots, alongside an array of
+ * one control byte per slot. A control byte tells whether its slot is empty,
+ * deleted, or full, and in the latter case also holds 7 bits of the hash of
+ * the key in the slot. Lookups probe slots in groups of 16, and compare the
+ * control bytes of a whole group against the hash bits of the key at once
+ * (with SSE2 where available), so that keys are only compared on likely
+ * matches.
+ *
+ * The interface is a subset of that of `std::unordered_map`. Unlike it,
+ * inserting entries may invalidate iterators and references to entries, and
+ * entries are not allocated one by one.
+ */
+template<typename K, typename V, typename Hash=std::hash<K>>
+class flat_hash_map
+{
+public:
+  typedef K key_type;
+  typedef V mapped_type;
+  typedef std::pair<const K, V> value_type;
+  typedef size_t size_type;
+  typedef Hash hasher;
+
+private:
+  typedef int8_t ctrl_t;
+
+  static const ctrl_t CTRL_EMPTY = -128;
+  static const ctrl_t CTRL_DELETED = -2;
+
+  static const size_t GROUP_WIDTH = 16;
+
+  typedef typename std::aligned_storage<
+    sizeof(value_type), alignof(value_type)>::type slot_type;
+
+  /**
+   * The control bytes of a group of slots, matched all at once.
+   */
+  class group
+  {
+  public:
+    explicit group(const ctrl_t* ctrl)
+#if defined(__SSE2__)
+      :
+      m_ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl)))
+#endif
+    {
+#if !defined(__SSE2__)
+      std::memcpy(m_ctrl, ctrl, GROUP_WIDTH);
+#endif
+    }
+
+    /** Bit mask of the slots whose control bytes equal the specified one. */
+    uint32_t match(ctrl_t h2) const
+    {
+#if defined(__SSE2__)
+      return static_cast<uint32_t>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), m_ctrl)));
+#else
+      uint32_t mask = 0;
+      for (size_t i = 0; i < GROUP_WIDTH; ++i)
+      {
+        mask |= static_cast<uint32_t>(m_ctrl[i] == h2) << i;
+      }
+      return mask;
+#endif
+    }
+
+    uint32_t match_empty() const
+    {
+      return match(CTRL_EMPTY);
+    }
+
+    /** Bit mask of the slots that are empty or deleted, i.e. not full. */
+    uint32_t match_non_full() const
+    {
+#if defined(__SSE2__)
+      return static_cast<uint32_t>(_mm_movemask_epi8(m_ctrl));
+#else
+      uint32_t mask = 0;
+      for (size_t i = 0; i < GROUP_WIDTH; ++i)
+      {
+        mask |= static_cast<uint32_t>(m_ctrl[i] < 0) << i;
+      }
+      return mask;
+#endif
+    }
+
+  private:
+#if defined(__SSE2__)
+    __m128i m_ctrl;
+#else
+    ctrl_t m_ctrl[GROUP_WIDTH];
+#endif
+  };
+
+  template<typename Value>
+  class basic_iterator
+  {
+  public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef typename std::remove_const<Value>::type value_type;
+    typedef ptrdiff_t difference_type;
+    typedef Value* pointer;
+    typedef Value& reference;
+
+    basic_iterator()
+      :
+      m_ctrl(nullptr),
+      m_ctrl_end(nullptr),
+      m_slot(nullptr)
+    {
+    }
+
+    /** Conversion from mutable iterators to const ones. */
+    template<typename OtherValue, typename = typename std::enable_if<
+      std::is_convertible<OtherValue*, Value*>::value>::type>
+    basic_iterator(const basic_iterator<OtherValue>& other)
+      :
+      m_ctrl(other.m_ctrl),
+      m_ctrl_end(other.m_ctrl_end),
+      m_slot(other.m_slot)
+    {
+    }
+
+    reference operator*() const
+    {
+      return *reinterpret_cast<pointer>(m_slot);
+    }
+
+    pointer operator->() const
+    {
+      return reinterpret_cast<pointer>(m_slot);
+    }
+
+    basic_iterator& operator++()
+    {
+      ++m_ctrl;
+      ++m_slot;
+      skip_non_full();
+      return *this;
+    }
+
+    basic_iterator operator++(int)
+    {
+      basic_iterator tmp(*this);
+      ++(*this);
+      return tmp;
+    }
+
+    bool operator==(const basic_iterator& other) const
+    {
+      return m_ctrl == other.m_ctrl;
+    }
+
+    bool operator!=(const basic_iterator& other) const
+    {
+      return m_ctrl != other.m_ctrl;
+    }
+
+  private:
+    friend class flat_hash_map;
+
+    template<typename> friend class basic_iterator;
+
+    basic_iterator(const ctrl_t* ctrl, const ctrl_t* ctrl_end,
+      slot_type* slot)
+      :
+      m_ctrl(ctrl),
+      m_ctrl_end(ctrl_end),
+      m_slot(slot)
+    {
+      skip_non_full();
+    }
+
+    /** Iterator to a slot known to be full, or to the end. */
+    basic_iterator(const ctrl_t* ctrl, const ctrl_t* ctrl_end,
+      slot_type* slot, bool /* full */)
+      :
+      m_ctrl(ctrl),
+      m_ctrl_end(ctrl_end),
+      m_slot(slot)
+    {
+    }
+
+    void skip_non_full()
+    {
+      while (m_ctrl != m_ctrl_end && *m_ctrl < 0)
+      {
+        ++m_ctrl;
+        ++m_slot;
+      }
+    }
+
+    const ctrl_t* m_ctrl;
+    const ctrl_t* m_ctrl_end;
+    slot_type* m_slot;
+  };
+
+public:
+  typedef basic_iterator<value_type> iterator;
+  typedef basic_iterator<const value_type> const_iterator;
+
+  flat_hash_map()
+    :
+    m_ctrl(nullptr),
+    m_slots(nullptr),
+    m_capacity(0),
+    m_size(0),
+    m_growth_left(0),
+    m_hash()
+  {
+  }
+
+  flat_hash_map(std::initializer_list<value_type> il)
+    :
+    flat_hash_map()
+  {
+    insert(il.begin(), il.end());
+  }
+
+  template<typename InputIterator>
+  flat_hash_map(InputIterator first, InputIterator last)
+    :
+    flat_hash_map()
+  {
+    insert(first, last);
+  }
+
+  flat_hash_map(const flat_hash_map& other)
+    :
+    flat_hash_map()
+  {
+    copy_from(other);
+  }
+
+  flat_hash_map(flat_hash_map&& other)
+    :
+    flat_hash_map()
+  {
+    swap(other);
+  }
+
+  ~flat_hash_map()
+  {
+    destroy_slots();
+    deallocate();
+  }
+
+  flat_hash_map& operator=(const flat_hash_map& other)
+  {
+    if (this != &other)
+    {
+      flat_hash_map tmp(other);
+      swap(tmp);
+    }
+
+    return *this;
+  }
+
+  flat_hash_map& operator=(flat_hash_map&& other)
+  {
+    if (this != &other)
+    {
+      flat_hash_map tmp(std::move(other));
+      swap(tmp);
+    }
+
+    return *this;
+  }
+
+  iterator begin()
+  {
+    return iterator(m_ctrl, m_ctrl + m_capacity, m_slots);
+  }
+
+  iterator end()
+  {
+    return iterator_at(m_capacity);
+  }
+
+  const_iterator begin() const
+  {
+    return const_cast<flat_hash_map*>(this)->begin();
+  }
+
+  const_iterator end() const
+  {
+    return const_cast<flat_hash_map*>(this)->end();
+  }
+
+  const_iterator cbegin() const
+  {
+    return begin();
+  }
+
+  const_iterator cend() const
+  {
+    return end();
+  }
+
+  size_type size() const
+  {
+    return m_size;
+  }
+
+  bool empty() const
+  {
+    return m_size == 0;
+  }
+
+  /**
+   * Number of slots, including the ones not in use.
+   */
+  size_type capacity() const
+  {
+    return m_capacity;
+  }
+
+  /**
+   * Makes room for at least the specified number of entries in total, so
+   * that inserting up to as many does not rehash.
+   */
+  void reserve(size_type n)
+  {
+    if (n > m_size + m_growth_left)
+    {
+      size_t capacity = GROUP_WIDTH;
+      while (max_load(capacity) < n)
+      {
+        capacity *= 2;
+      }
+
+      rehash(capacity);
+    }
+  }
+
+  void clear()
+  {
+    destroy_slots();
+
+    if (m_capacity)
+    {
+      std::memset(m_ctrl, CTRL_EMPTY, m_capacity);
+    }
+
+    m_size = 0;
+    m_growth_left = max_load(m_capacity);
+  }
+
+  void swap(flat_hash_map& other)
+  {
+    std::swap(m_ctrl, other.m_ctrl);
+    std::swap(m_slots, other.m_slots);
+    std::swap(m_capacity, other.m_capacity);
+    std::swap(m_size, other.m_size);
+    std::swap(m_growth_left, other.m_growth_left);
+    std::swap(m_hash, other.m_hash);
+  }
+
+  iterator find(const key_type& key)
+  {
+    size_t index = 0;
+    return find_index(key, hash_of(key), &index) ?
+      iterator_at(index) : end();
+  }
+
+  const_iterator find(const key_type& key) const
+  {
+    return const_cast<flat_hash_map*>(this)->find(key);
+  }
+
+  size_type count(const key_type& key) const
+  {
+    return find(key) != end() ? 1 : 0;
+  }
+
+  mapped_type& operator[](const key_type& key)
+  {
+    const size_t hash = hash_of(key);
+
+    size_t index = 0;
+    if (!find_index(key, hash, &index))
+    {
+      index = prepare_insert(hash);
+      construct_at(index, hash, key, mapped_type());
+    }
+
+    return slot_at(index)->second;
+  }
+
+  std::pair<iterator, bool> insert(const value_type& value)
+  {
+    const size_t hash = hash_of(value.first);
+
+    size_t index = 0;
+    if (find_index(value.first, hash, &index))
+    {
+      return std::make_pair(iterator_at(index), false);
+    }
+
+    index = prepare_insert(hash);
+    construct_at(index, hash, value.first, value.second);
+
+    return std::make_pair(iterator_at(index), true);
+  }
+
+  template<typename InputIterator>
+  void insert(InputIterator first, InputIterator last)
+  {
+    for (; first != last; ++first)
+    {
+      insert(*first);
+    }
+  }
+
+  void insert(std::initializer_list<value_type> il)
+  {
+    insert(il.begin(), il.end());
+  }
+
+  size_type erase(const key_type& key)
+  {
+    size_t index = 0;
+    if (!find_index(key, hash_of(key), &index))
+    {
+      return 0;
+    }
+
+    erase_at(index);
+
+    return 1;
+  }
+
+  /**
+   * Erases the entry at the specified position, and returns an iterator to
+   * the entry that follows.
+   */
+  iterator erase(const_iterator pos)
+  {
+    const size_t index = static_cast<size_t>(pos.m_ctrl - m_ctrl);
+
+    erase_at(index);
+
+    return iterator(m_ctrl + index, m_ctrl + m_capacity, m_slots + index);
+  }
+
+private:
+  /**
+   * At most 7/8 of the slots are in use, to keep probe sequences short.
+   */
+  static size_t max_load(size_t capacity)
+  {
+    return capacity - capacity / 8;
+  }
+
+  /**
+   * Mixes the bits of the hash of a key, since hashes of integers are the
+   * integers themselves for most standard libraries.
+   */
+  size_t hash_of(const key_type& key) const
+  {
+    const uint64_t hash = static_cast<uint64_t>(m_hash(key));
+
+#if defined(__SIZEOF_INT128__)
+    const unsigned __int128 product =
+      static_cast<unsigned __int128>(hash) * 0x9E3779B97F4A7C15ULL;
+
+    return static_cast<size_t>(
+      static_cast<uint64_t>(product) ^ static_cast<uint64_t>(product >> 64));
+#else
+    uint64_t mixed = hash ^ (hash >> 33);
+    mixed *= 0xff51afd7ed558ccdULL;
+    mixed ^= mixed >> 33;
+
+    return static_cast<size_t>(mixed);
+#endif
+  }
+
+  static ctrl_t h2_of(size_t hash)
+  {
+    return static_cast<ctrl_t>(hash & 0x7F);
+  }
+
+  /**
+   * Index of the first group to probe for a hash. Subsequent groups are
+   * probed in quadratic (triangular) steps, which visits every group as the
+   * number of groups is a power of 2.
+   */
+  size_t first_group_of(size_t hash) const
+  {
+    return (hash >> 7) & (m_capacity / GROUP_WIDTH - 1);
+  }
+
+  value_type* slot_at(size_t index) const
+  {
+    return reinterpret_cast<value_type*>(m_slots + index);
+  }
+
+  iterator iterator_at(size_t index)
+  {
+    return iterator(m_ctrl + index, m_ctrl + m_capacity, m_slots + index,
+      true);
+  }
+
+  bool find_index(const key_type& key, size_t hash, size_t* index) const
+  {
+    if (!m_capacity)
+    {
+      return false;
+    }
+
+    const ctrl_t h2 = h2_of(hash);
+    const size_t group_mask = m_capacity / GROUP_WIDTH - 1;
+
+    size_t g = first_group_of(hash);
+
+    for (size_t step = 1; ; ++step)
+    {
+      const size_t offset = g * GROUP_WIDTH;
+      const group grp(m_ctrl + offset);
+
+      for (uint32_t mask = grp.match(h2); mask; mask &= mask - 1)
+      {
+        const size_t i = offset + static_cast<size_t>(__builtin_ctz(mask));
+
+        if (slot_at(i)->first == key)
+        {
+          *index = i;
+          return true;
+        }
+      }
+
+      if (grp.match_empty())
+      {
+        return false;
+      }
+
+      g = (g + step) & group_mask;
+    }
+  }
+
+  size_t find_first_non_full(size_t hash) const
+  {
+    const size_t group_mask = m_capacity / GROUP_WIDTH - 1;
+
+    size_t g = first_group_of(hash);
+
+    for (size_t step = 1; ; ++step)
+    {
+      const size_t offset = g * GROUP_WIDTH;
+      const uint32_t mask = group(m_ctrl + offset).match_non_full();
+
+      if (mask)
+      {
+        return offset + static_cast<size_t>(__builtin_ctz(mask));
+      }
+
+      g = (g + step) & group_mask;
+    }
+  }
+
+  /**
+   * Finds the slot to insert an entry of the specified hash into, growing
+   * the table first if it is full.
+   */
+  size_t prepare_insert(size_t hash)
+  {
+    if (m_capacity)
+    {
+      const size_t index = find_first_non_full(hash);
+
+      // Deleted slots can be reused without taking up room.
+      if (m_growth_left || m_ctrl[index] == CTRL_DELETED)
+      {
+        return index;
+      }
+    }
+
+    // Rehash in place if deleted slots take up much of the table, and grow
+    // it otherwise.
+    if (m_capacity && m_size <= max_load(m_capacity) / 2)
+    {
+      rehash(m_capacity);
+    }
+    else
+    {
+      rehash(m_capacity ? m_capacity * 2 : GROUP_WIDTH);
+    }
+
+    return find_first_non_full(hash);
+  }
+
+  template<typename Key, typename Mapped>
+  void construct_at(size_t index, size_t hash, Key&& key, Mapped&& mapped)
+  {
+    new (m_slots + index) value_type(
+      std::forward<Key>(key), std::forward<Mapped>(mapped));
+
+    if (m_ctrl[index] == CTRL_EMPTY)
+    {
+      --m_growth_left;
+    }
+
+    m_ctrl[index] = h2_of(hash);
+    ++m_size;
+  }
+
+  void erase_at(size_t index)
+  {
+    slot_at(index)->~value_type();
+    --m_size;
+
+    // Probe sequences never go past a group with an empty slot, so a slot of
+    // such a group can be emptied right away. Otherwise it has to be marked
+    // as deleted, for lookups of keys past it to carry on.
+    const size_t offset = index - index % GROUP_WIDTH;
+    if (group(m_ctrl + offset).match_empty())
+    {
+      m_ctrl[index] = CTRL_EMPTY;
+      ++m_growth_left;
+    }
+    else
+    {
+      m_ctrl[index] = CTRL_DELETED;
+    }
+  }
+
+  void rehash(size_t capacity)
+  {
+    ctrl_t* old_ctrl = m_ctrl;
+    slot_type* old_slots = m_slots;
+    const size_t old_capacity = m_capacity;
+
+    allocate(capacity);
+
+    for (size_t i = 0; i < old_capacity; ++i)
+    {
+      if (old_ctrl[i] >= 0)
+      {
+        value_type* slot = reinterpret_cast<value_type*>(old_slots + i);
+
+        const size_t hash = hash_of(slot->first);
+        const size_t index = find_first_non_full(hash);
+
+        construct_at(index, hash, slot->first, std::move(slot->second));
+        slot->~value_type();
+      }
+    }
+
+    operator delete(old_ctrl);
+  }
+
+  void copy_from(const flat_hash_map& other)
+  {
+    if (!other.m_size)
+    {
+      return;
+    }
+
+    allocate(other.m_capacity);
+
+    std::memcpy(m_ctrl, other.m_ctrl, m_capacity);
+
+    for (size_t i = 0; i < m_capacity; ++i)
+    {
+      if (m_ctrl[i] >= 0)
+      {
+        new (m_slots + i) value_type(*other.slot_at(i));
+      }
+    }
+
+    m_size = other.m_size;
+    m_growth_left = other.m_growth_left;
+  }
+
+  /**
+   * Allocates an empty table of the specified capacity, in a single buffer
+   * that holds control bytes followed by slots.
+   */
+  void allocate(size_t capacity)
+  {
+    const size_t slots_offset = slots_offset_of(capacity);
+
+    char* buffer = static_cast<char*>(
+      operator new(slots_offset + capacity * sizeof(slot_type)));
+
+    m_ctrl = reinterpret_cast<ctrl_t*>(buffer);
+    m_slots = reinterpret_cast<slot_type*>(buffer + slots_offset);
+    m_capacity = capacity;
+    m_size = 0;
+    m_growth_left = max_load(capacity);
+
+    std::memset(m_ctrl, CTRL_EMPTY, capacity);
+  }
+
+  static size_t slots_offset_of(size_t capacity)
+  {
+    const size_t align = alignof(slot_type);
+    return (capacity + align - 1) / align * align;
+  }
+
+  void destroy_slots()
+  {
+    if (std::is_trivially_destructible<value_type>::value)
+    {
+      return;
+    }
+
+    for (size_t i = 0; i < m_capacity; ++i)
+    {
+      if (m_ctrl[i] >= 0)
+      {
+        slot_at(i)->~value_type();
+      }
+    }
+  }
+
+  void deallocate()
+  {
+    operator delete(m_ctrl);
+
+    m_ctrl = nullptr;
+    m_slots = nullptr;
+    m_capacity = 0;
+  }
+
+  ctrl_t* m_ctrl;
+  slot_type* m_slots;
+  size_t m_capacity;
+  size_t m_size;
+  size_t m_growth_left;
+  Hash m_hash;
+};
+
+// -----------------------------------------------------------------------------
+
+template<typename K, typename V, typename Hash>
+bool
+operator==(const flat_hash_map<K, V, Hash>& lhs,
+  const flat_hash_map<K, V, Hash>& rhs)
+{
+  if (lhs.size() != rhs.size())
+  {
+    return false;
+  }
+
+  for (const auto& value : lhs)
+  {
+    auto itr = rhs.find(value.first);
+
+    if (itr == rhs.end() || !(itr->second == value.second))
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename K, typename V, typename Hash>
+bool
+operator!=(const flat_hash_map<K, V, Hash>& lhs,
+  const flat_hash_map<K, V, Hash>& rhs)
+{
+  return !(lhs == rhs);
+}
+
+// -----------------------------------------------------------------------------
+
+} /* end namespace types */
+} /* end namespace corevm */
+
+
+#endif /* COREVM_FLAT_HASH_MAP_H_ */
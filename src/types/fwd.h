@@ -24,6 +24,8 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #define COREVM_TYPES_FWD_H_
 
 #include "types.h"
+#include "variant/boxed.h"
+#include "corevm/macros.h"
 
 
 namespace corevm {
@@ -36,6 +38,42 @@ namespace variant {
 template<typename... Types>
 class variant;
 
+#if COREVM_USE_COMPACT_NATIVE_TYPE_VALUE
+
+template <>
+struct boxed<string> : std::true_type {};
+
+template <>
+struct boxed<array> : std::true_type {};
+
+template <>
+struct boxed<map> : std::true_type {};
+
+template <>
+struct boxed<vector> : std::true_type {};
+
+#endif
+
+/** Strings in builder mode are flattened before they are used. */
+template <>
+struct access_hook<string>
+{
+  static void apply(const string& value)
+  {
+    value.flatten();
+  }
+};
+
+/** Arrays that are views are flattened before they are used. */
+template <>
+struct access_hook<array>
+{
+  static void apply(const array& value)
+  {
+    value.flatten();
+  }
+};
+
 } /* end namespace variant */
 
 // -----------------------------------------------------------------------------
@@ -54,7 +92,8 @@ typedef variant::variant<
   decimal2,
   string,
   array,
-  map
+  map,
+  vector
 > NativeTypeValue;
 
 // -----------------------------------------------------------------------------
@@ -21,7 +21,13 @@ IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
 CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 *******************************************************************************/
 #include "interfaces.h"
+#include "errors.h"
+#include "native_array_kernels.h"
 #include "native_type_value.h"
+#include "native_vector_kernels.h"
+#include "corevm/macros.h"
+
+#include <limits>
 
 
 namespace corevm {
@@ -120,7 +126,8 @@ void interface_apply_sqrt_operator(
 template<typename native_type_visitor_type>
 inline
 NativeTypeValue
-__interface_apply_binary_operator(NativeTypeValue& lhs, NativeTypeValue& rhs)
+__interface_apply_binary_operator(const NativeTypeValue& lhs,
+  const NativeTypeValue& rhs)
 {
   return apply_binary_visitor<native_type_visitor_type>(lhs, rhs);
 }
@@ -455,7 +462,7 @@ NativeTypeValue interface_compute_repr_value(const NativeTypeValue& operand)
 // -----------------------------------------------------------------------------
 
 NativeTypeValue
-interface_compute_hash_value(NativeTypeValue& operand)
+interface_compute_hash_value(const NativeTypeValue& operand)
 {
   return apply_unary_visitor<native_type_hash_visitor>(operand);
 }
@@ -468,6 +475,19 @@ NativeTypeValue interface_compute_slice(NativeTypeValue& operand,
   uint32_t start_value = get_intrinsic_value_from_type_value<uint32_t>(start);
   uint32_t stop_value = get_intrinsic_value_from_type_value<uint32_t>(stop);
 
+  // Strings and arrays are sliced as they are, so that slices of views are
+  // taken without flattening them.
+  if (operand.is<string>())
+  {
+    return slice(start_value, stop_value)(
+      get_raw_value_cref_from_type_value<string>(operand));
+  }
+  else if (operand.is<array>())
+  {
+    return slice(start_value, stop_value)(
+      get_raw_value_cref_from_type_value<array>(operand));
+  }
+
   return apply_unary_visitor_parameterized<
     native_type_slice_visitor>(operand, start_value, stop_value);
 }
@@ -524,7 +544,7 @@ NativeTypeValue
 interface_string_get_size(NativeTypeValue& operand)
 {
   const auto& string_value =
-    get_value_ref_from_type_value<native_string>(operand);
+    get_raw_value_cref_from_type_value<native_string>(operand);
 
   uint64 result_value = string_value.size();
 
@@ -548,7 +568,7 @@ NativeTypeValue
 interface_string_at(NativeTypeValue& operand, NativeTypeValue& index)
 {
   const auto& string_value =
-    get_value_ref_from_type_value<native_string>(operand);
+    get_raw_value_cref_from_type_value<native_string>(operand);
 
   const int32_t index_value =
     get_intrinsic_value_from_type_value<int32_t>(index);
@@ -565,7 +585,7 @@ NativeTypeValue
 interface_string_at_2(NativeTypeValue& operand, NativeTypeValue& index)
 {
   const auto& string_value =
-    get_value_ref_from_type_value<native_string>(operand);
+    get_raw_value_cref_from_type_value<native_string>(operand);
 
   const int32_t index_value = get_intrinsic_value_from_type_value<int32_t>(index);
 
@@ -581,12 +601,12 @@ void
 interface_string_append(NativeTypeValue& operand, NativeTypeValue& str)
 {
   auto& string_value =
-    get_value_ref_from_type_value<native_string>(operand);
+    get_raw_value_ref_from_type_value<native_string>(operand);
 
   const auto& other_string_value =
-    get_value_ref_from_type_value<native_string>(str);
+    get_value_cref_from_type_value<native_string>(str);
 
-  string_value.append(other_string_value);
+  string_value.lazy_append(other_string_value);
 }
 
 // -----------------------------------------------------------------------------
@@ -595,11 +615,11 @@ void
 interface_string_pushback(NativeTypeValue& operand, NativeTypeValue& c)
 {
   auto& string_value =
-    get_value_ref_from_type_value<native_string>(operand);
+    get_raw_value_ref_from_type_value<native_string>(operand);
 
   char char_value = get_intrinsic_value_from_type_value<char>(c);
 
-  string_value.push_back(char_value);
+  string_value.lazy_push_back(char_value);
 }
 
 // -----------------------------------------------------------------------------
@@ -609,14 +629,14 @@ interface_string_insert_str(NativeTypeValue& operand,
   NativeTypeValue& pos, NativeTypeValue& str)
 {
   auto& string_value =
-    get_value_ref_from_type_value<native_string>(operand);
+    get_raw_value_ref_from_type_value<native_string>(operand);
 
   size_t pos_value = get_intrinsic_value_from_type_value<size_t>(pos);
 
   const auto& other_string_value =
-    get_value_ref_from_type_value<native_string>(str);
+    get_value_cref_from_type_value<native_string>(str);
 
-  string_value.insert(pos_value, other_string_value);
+  string_value.lazy_insert(pos_value, other_string_value);
 }
 
 // -----------------------------------------------------------------------------
@@ -626,12 +646,12 @@ interface_string_insert_char(NativeTypeValue& operand,
   NativeTypeValue& pos, NativeTypeValue& c)
 {
   auto& string_value =
-    get_value_ref_from_type_value<native_string>(operand);
+    get_raw_value_ref_from_type_value<native_string>(operand);
 
   size_t pos_value = get_intrinsic_value_from_type_value<size_t>(pos);
   char char_value = get_intrinsic_value_from_type_value<char>(c);
 
-  string_value.insert(pos_value, 1, char_value);
+  string_value.lazy_insert(pos_value, 1, char_value);
 }
 
 // -----------------------------------------------------------------------------
@@ -676,7 +696,7 @@ interface_string_replace_str(NativeTypeValue& operand,
   size_t len_value = get_intrinsic_value_from_type_value<size_t>(len);
 
   const auto& str_value =
-    get_value_ref_from_type_value<native_string>(str);
+    get_value_cref_from_type_value<native_string>(str);
 
   string_value.replace(pos_value, len_value, str_value);
 }
@@ -700,14 +720,14 @@ interface_string_swap(NativeTypeValue& operand, NativeTypeValue& str)
 NativeTypeValue
 interface_string_substr(NativeTypeValue& operand, NativeTypeValue& pos)
 {
-  native_string string_value =
-    get_intrinsic_value_from_type_value<native_string>(operand);
+  const auto& string_value =
+    get_raw_value_cref_from_type_value<native_string>(operand);
 
   size_t pos_value = get_intrinsic_value_from_type_value<size_t>(pos);
 
   native_string result_value = string_value.substr(pos_value);
 
-  return NativeTypeValue(result_value);
+  return NativeTypeValue(std::move(result_value));
 }
 
 // -----------------------------------------------------------------------------
@@ -717,7 +737,7 @@ interface_string_substr2(NativeTypeValue& operand,
   NativeTypeValue& pos, NativeTypeValue& len)
 {
   const auto& string_value =
-    get_value_ref_from_type_value<native_string>(operand);
+    get_raw_value_cref_from_type_value<native_string>(operand);
 
   size_t pos_value = get_intrinsic_value_from_type_value<size_t>(pos);
   size_t len_value = get_intrinsic_value_from_type_value<size_t>(len);
@@ -725,7 +745,7 @@ interface_string_substr2(NativeTypeValue& operand,
   native_string result_value =
     string_value.substr(pos_value, len_value);
 
-  return NativeTypeValue(result_value);
+  return NativeTypeValue(std::move(result_value));
 }
 
 // -----------------------------------------------------------------------------
@@ -734,10 +754,10 @@ NativeTypeValue
 interface_string_find(NativeTypeValue& operand, NativeTypeValue& str)
 {
   const auto& string_value =
-    get_value_ref_from_type_value<native_string>(operand);
+    get_value_cref_from_type_value<native_string>(operand);
 
   const auto& other_string_value =
-    get_value_ref_from_type_value<native_string>(str);
+    get_value_cref_from_type_value<native_string>(str);
 
   uint64 result_value = string_value.find(other_string_value);
 
@@ -751,10 +771,10 @@ interface_string_find2(NativeTypeValue& operand, NativeTypeValue& str,
   NativeTypeValue& pos)
 {
   const auto& string_value =
-    get_value_ref_from_type_value<native_string>(operand);
+    get_value_cref_from_type_value<native_string>(operand);
 
   const auto& other_string_value =
-    get_value_ref_from_type_value<native_string>(str);
+    get_value_cref_from_type_value<native_string>(str);
 
   size_t pos_value = get_intrinsic_value_from_type_value<size_t>(pos);
 
@@ -770,10 +790,10 @@ NativeTypeValue
 interface_string_rfind(NativeTypeValue& operand, NativeTypeValue& str)
 {
   const auto& string_value =
-    get_value_ref_from_type_value<native_string>(operand);
+    get_value_cref_from_type_value<native_string>(operand);
 
   const auto& other_string_value =
-    get_value_ref_from_type_value<native_string>(str);
+    get_value_cref_from_type_value<native_string>(str);
 
   uint64 result_value = string_value.rfind(other_string_value);
 
@@ -787,10 +807,10 @@ interface_string_rfind2(NativeTypeValue& operand, NativeTypeValue& str,
   NativeTypeValue& pos)
 {
   const auto& string_value =
-    get_value_ref_from_type_value<native_string>(operand);
+    get_value_cref_from_type_value<native_string>(operand);
 
   const auto& other_string_value =
-    get_value_ref_from_type_value<native_string>(str);
+    get_value_cref_from_type_value<native_string>(str);
 
   size_t pos_value = get_intrinsic_value_from_type_value<size_t>(pos);
 
@@ -802,6 +822,146 @@ interface_string_rfind2(NativeTypeValue& operand, NativeTypeValue& str,
 
 // -----------------------------------------------------------------------------
 
+void
+interface_string_replace_all(NativeTypeValue& operand,
+  NativeTypeValue& old_str, NativeTypeValue& new_str)
+{
+  auto& string_value =
+    get_value_ref_from_type_value<native_string>(operand);
+
+  const auto& old_string_value =
+    get_value_cref_from_type_value<native_string>(old_str);
+
+  const auto& new_string_value =
+    get_value_cref_from_type_value<native_string>(new_str);
+
+  if (old_string_value.empty())
+  {
+    return;
+  }
+
+  size_t pos = string_value.find(old_string_value);
+
+  if (pos == native_string::npos)
+  {
+    return;
+  }
+
+  native_string_base result;
+  result.reserve(string_value.size());
+
+  const char* data = string_value.data();
+  size_t begin = 0;
+
+  do
+  {
+    result.append(data + begin, pos - begin);
+    result.append(new_string_value.data(), new_string_value.size());
+
+    begin = pos + old_string_value.size();
+    pos = string_value.find(old_string_value, begin);
+  }
+  while (pos != native_string::npos);
+
+  result.append(data + begin, string_value.size() - begin);
+
+  string_value.assign(std::move(result));
+}
+
+// -----------------------------------------------------------------------------
+
+NativeTypeValue
+interface_string_split(NativeTypeValue& operand, NativeTypeValue& sep)
+{
+  const auto& string_value =
+    get_value_cref_from_type_value<native_string>(operand);
+
+  const auto& sep_value =
+    get_value_cref_from_type_value<native_string>(sep);
+
+  native_array_base offsets;
+  size_t begin = 0;
+
+  if (!sep_value.empty())
+  {
+    size_t end = string_value.find(sep_value);
+
+    while (end != native_string::npos)
+    {
+      offsets.push_back(begin);
+      offsets.push_back(end);
+
+      begin = end + sep_value.size();
+      end = string_value.find(sep_value, begin);
+    }
+  }
+
+  offsets.push_back(begin);
+  offsets.push_back(string_value.size());
+
+  native_array result_value(std::move(offsets));
+
+  return NativeTypeValue(std::move(result_value));
+}
+
+// -----------------------------------------------------------------------------
+
+NativeTypeValue
+interface_string_join(NativeTypeValue& operand, NativeTypeValue& offsets,
+  NativeTypeValue& sep)
+{
+  const auto& string_value =
+    get_value_cref_from_type_value<native_string>(operand);
+
+  const auto& offsets_value =
+    get_value_cref_from_type_value<native_array>(offsets);
+
+  const auto& sep_value =
+    get_value_cref_from_type_value<native_string>(sep);
+
+  if (offsets_value.size() % 2)
+  {
+    THROW(OutOfRangeError("String offsets out of range"));
+  }
+
+  size_t result_size = 0;
+
+  for (size_t i = 0; i < offsets_value.size(); i += 2)
+  {
+    const auto begin = offsets_value[i];
+    const auto end = offsets_value[i + 1];
+
+    if (begin > end || end > string_value.size())
+    {
+      THROW(OutOfRangeError("String offsets out of range"));
+    }
+
+    result_size += (i ? sep_value.size() : 0) + (end - begin);
+  }
+
+  native_string_base result;
+  result.reserve(result_size);
+
+  const char* data = string_value.data();
+
+  for (size_t i = 0; i < offsets_value.size(); i += 2)
+  {
+    if (i)
+    {
+      result.append(sep_value.data(), sep_value.size());
+    }
+
+    result.append(data + offsets_value[i],
+      offsets_value[i + 1] - offsets_value[i]);
+  }
+
+  native_string result_value(std::move(result));
+
+  return NativeTypeValue(std::move(result_value));
+}
+
+// -----------------------------------------------------------------------------
+
 
 /* --------------------------- ARRAY OPERATIONS ----------------------------- */
 
@@ -812,7 +972,7 @@ NativeTypeValue
 interface_array_size(NativeTypeValue& operand)
 {
   const auto& array_value =
-    get_value_ref_from_type_value<native_array>(operand);
+    get_raw_value_cref_from_type_value<native_array>(operand);
 
   uint64 result_value = array_value.size();
 
@@ -825,7 +985,7 @@ NativeTypeValue
 interface_array_empty(NativeTypeValue& operand)
 {
   const auto& array_value =
-    get_value_ref_from_type_value<native_array>(operand);
+    get_raw_value_cref_from_type_value<native_array>(operand);
 
   boolean result_value = array_value.empty();
 
@@ -838,7 +998,7 @@ NativeTypeValue
 interface_array_at(NativeTypeValue& operand, NativeTypeValue& index)
 {
   const auto& array_value =
-    get_value_ref_from_type_value<native_array>(operand);
+    get_raw_value_cref_from_type_value<native_array>(operand);
 
   size_t index_value = get_intrinsic_value_from_type_value<size_t>(index);
 
@@ -853,7 +1013,7 @@ NativeTypeValue
 interface_array_front(NativeTypeValue& operand)
 {
   const auto& array_value =
-    get_value_ref_from_type_value<native_array>(operand);
+    get_value_cref_from_type_value<native_array>(operand);
 
   uint64 result_value = array_value.front();
 
@@ -866,7 +1026,7 @@ NativeTypeValue
 interface_array_back(NativeTypeValue& operand)
 {
   const auto& array_value =
-    get_value_ref_from_type_value<native_array>(operand);
+    get_value_cref_from_type_value<native_array>(operand);
 
   uint64 result_value = array_value.back();
 
@@ -921,15 +1081,13 @@ interface_array_erase(NativeTypeValue& operand, NativeTypeValue& index)
 
 // -----------------------------------------------------------------------------
 
-NativeTypeValue
+void
 interface_array_pop(NativeTypeValue& operand)
 {
-  native_array array_value =
-    get_intrinsic_value_from_type_value<native_array>(operand);
+  auto& array_value =
+    get_value_ref_from_type_value<native_array>(operand);
 
   array_value.pop_back();
-
-  return NativeTypeValue(array_value);
 }
 
 // -----------------------------------------------------------------------------
@@ -959,19 +1117,86 @@ interface_array_clear(NativeTypeValue& operand)
 
 // -----------------------------------------------------------------------------
 
-NativeTypeValue
+void
 interface_array_merge(NativeTypeValue& operand, NativeTypeValue& other_operand)
 {
-  native_array array_value =
-    get_intrinsic_value_from_type_value<native_array>(operand);
+  auto& array_value =
+    get_value_ref_from_type_value<native_array>(operand);
 
   const auto& other_array_value =
-    get_value_ref_from_type_value<native_array>(other_operand);
+    get_value_cref_from_type_value<native_array>(other_operand);
 
   array_value.insert(
     array_value.end(), other_array_value.begin(), other_array_value.end());
+}
 
-  return NativeTypeValue(array_value);
+// -----------------------------------------------------------------------------
+
+NativeTypeValue
+interface_array_sum(NativeTypeValue& operand)
+{
+  const auto& array_value =
+    get_value_cref_from_type_value<native_array>(operand);
+
+  uint64 result_value = array_sum(array_value.data(), array_value.size());
+
+  return NativeTypeValue(result_value);
+}
+
+// -----------------------------------------------------------------------------
+
+NativeTypeValue
+interface_array_min(NativeTypeValue& operand)
+{
+  const auto& array_value =
+    get_value_cref_from_type_value<native_array>(operand);
+
+  if (array_value.empty())
+  {
+    THROW(OutOfRangeError("Array is empty"));
+  }
+
+  uint64 result_value = array_min(array_value.data(), array_value.size());
+
+  return NativeTypeValue(result_value);
+}
+
+// -----------------------------------------------------------------------------
+
+NativeTypeValue
+interface_array_max(NativeTypeValue& operand)
+{
+  const auto& array_value =
+    get_value_cref_from_type_value<native_array>(operand);
+
+  if (array_value.empty())
+  {
+    THROW(OutOfRangeError("Array is empty"));
+  }
+
+  uint64 result_value = array_max(array_value.data(), array_value.size());
+
+  return NativeTypeValue(result_value);
+}
+
+// -----------------------------------------------------------------------------
+
+NativeTypeValue
+interface_array_find(NativeTypeValue& operand, NativeTypeValue& value)
+{
+  const auto& array_value =
+    get_value_cref_from_type_value<native_array>(operand);
+
+  auto data_value =
+    get_intrinsic_value_from_type_value<native_array::value_type>(value);
+
+  size_t index =
+    array_find(array_value.data(), array_value.size(), data_value);
+
+  uint64 result_value = index < array_value.size() ?
+    index : std::numeric_limits<uint64>::max();
+
+  return NativeTypeValue(result_value);
 }
 
 // -----------------------------------------------------------------------------
@@ -986,7 +1211,7 @@ NativeTypeValue
 interface_map_size(NativeTypeValue& operand)
 {
   const auto& map_value =
-    get_value_ref_from_type_value<native_map>(operand);
+    get_value_cref_from_type_value<native_map>(operand);
 
   uint64 result_value = map_value.size();
 
@@ -999,7 +1224,7 @@ NativeTypeValue
 interface_map_empty(NativeTypeValue& operand)
 {
   const auto& map_value =
-    get_value_ref_from_type_value<native_map>(operand);
+    get_value_cref_from_type_value<native_map>(operand);
 
   boolean result_value = map_value.empty();
 
@@ -1012,7 +1237,7 @@ NativeTypeValue
 interface_map_find(NativeTypeValue& operand, NativeTypeValue& key)
 {
   const auto& map_value =
-    get_value_ref_from_type_value<native_map>(operand);
+    get_value_cref_from_type_value<native_map>(operand);
 
   const auto key_value =
     get_intrinsic_value_from_type_value<native_map::key_type>(key);
@@ -1028,7 +1253,7 @@ NativeTypeValue
 interface_map_at(NativeTypeValue& operand, NativeTypeValue& key)
 {
   const auto& map_value =
-    get_value_ref_from_type_value<native_map>(operand);
+    get_value_cref_from_type_value<native_map>(operand);
 
   const auto key_value =
     get_intrinsic_value_from_type_value<native_map::key_type>(key);
@@ -1101,7 +1326,7 @@ NativeTypeValue
 interface_map_keys(NativeTypeValue& operand)
 {
   const auto& map_value =
-    get_value_ref_from_type_value<native_map>(operand);
+    get_value_cref_from_type_value<native_map>(operand);
 
   native_array array_value;
 
@@ -1125,7 +1350,7 @@ NativeTypeValue
 interface_map_vals(NativeTypeValue& operand)
 {
   const auto& map_value =
-    get_value_ref_from_type_value<native_map>(operand);
+    get_value_cref_from_type_value<native_map>(operand);
 
   native_array array_value;
 
@@ -1145,18 +1370,136 @@ interface_map_vals(NativeTypeValue& operand)
 
 // -----------------------------------------------------------------------------
 
-NativeTypeValue
+void
 interface_map_merge(NativeTypeValue& operand, NativeTypeValue& other_operand)
 {
-  native_map map_value =
-    get_intrinsic_value_from_type_value<native_map>(operand);
+  auto& map_value =
+    get_value_ref_from_type_value<native_map>(operand);
 
   const auto& other_map_value =
-    get_value_ref_from_type_value<native_map>(other_operand);
+    get_value_cref_from_type_value<native_map>(other_operand);
 
   map_value.insert(other_map_value.begin(), other_map_value.end());
+}
+
+// -----------------------------------------------------------------------------
+
+
+/* --------------------------- VECTOR OPERATIONS ---------------------------- */
+
+
+// -----------------------------------------------------------------------------
+
+NativeTypeValue
+interface_vector_size(NativeTypeValue& operand)
+{
+  const auto& vector_value =
+    get_value_cref_from_type_value<native_vector>(operand);
+
+  uint64 result_value = vector_value.size();
+
+  return NativeTypeValue(result_value);
+}
+
+// -----------------------------------------------------------------------------
+
+NativeTypeValue
+interface_vector_at(NativeTypeValue& operand, NativeTypeValue& index)
+{
+  const auto& vector_value =
+    get_value_cref_from_type_value<native_vector>(operand);
+
+  size_t index_value = get_intrinsic_value_from_type_value<size_t>(index);
+
+  decimal2 result_value = vector_value.at(index_value);
+
+  return NativeTypeValue(result_value);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+interface_vector_put(NativeTypeValue& operand, NativeTypeValue& index,
+  NativeTypeValue& value)
+{
+  auto& vector_value =
+    get_value_ref_from_type_value<native_vector>(operand);
+
+  size_t index_value = get_intrinsic_value_from_type_value<size_t>(index);
+
+  auto data_value =
+    get_intrinsic_value_from_type_value<native_vector::value_type>(value);
+
+  vector_value.at(index_value) = data_value;
+}
+
+// -----------------------------------------------------------------------------
+
+void
+interface_vector_append(NativeTypeValue& operand, NativeTypeValue& data)
+{
+  auto& vector_value =
+    get_value_ref_from_type_value<native_vector>(operand);
+
+  auto data_value =
+    get_intrinsic_value_from_type_value<native_vector::value_type>(data);
+
+  vector_value.push_back(data_value);
+}
+
+// -----------------------------------------------------------------------------
+
+NativeTypeValue
+interface_vector_sum(NativeTypeValue& operand)
+{
+  const auto& vector_value =
+    get_value_cref_from_type_value<native_vector>(operand);
+
+  decimal2 result_value = vector_sum(vector_value.data(), vector_value.size());
+
+  return NativeTypeValue(result_value);
+}
+
+// -----------------------------------------------------------------------------
+
+NativeTypeValue
+interface_vector_dot(NativeTypeValue& operand, NativeTypeValue& other_operand)
+{
+  const auto& vector_value =
+    get_value_cref_from_type_value<native_vector>(operand);
+
+  const auto& other_vector_value =
+    get_value_cref_from_type_value<native_vector>(other_operand);
+
+  if (vector_value.size() != other_vector_value.size())
+  {
+    THROW(OutOfRangeError("Vector sizes do not match"));
+  }
+
+  decimal2 result_value = vector_dot(vector_value.data(),
+    other_vector_value.data(), vector_value.size());
+
+  return NativeTypeValue(result_value);
+}
+
+// -----------------------------------------------------------------------------
+
+NativeTypeValue
+interface_vector_scale(NativeTypeValue& operand, NativeTypeValue& factor)
+{
+  const auto& vector_value =
+    get_value_cref_from_type_value<native_vector>(operand);
+
+  auto factor_value =
+    get_intrinsic_value_from_type_value<native_vector::value_type>(factor);
+
+  native_vector result_value;
+  result_value.resize(vector_value.size());
+
+  vector_scale(vector_value.data(), vector_value.size(), factor_value,
+    result_value.data());
 
-  return NativeTypeValue(map_value);
+  return NativeTypeValue(std::move(result_value));
 }
 
 // -----------------------------------------------------------------------------
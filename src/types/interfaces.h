@@ -257,7 +257,7 @@ NativeTypeValue interface_compute_repr_value(const NativeTypeValue& operand);
 
 // -----------------------------------------------------------------------------
 
-NativeTypeValue interface_compute_hash_value(NativeTypeValue& operand);
+NativeTypeValue interface_compute_hash_value(const NativeTypeValue& operand);
 
 // -----------------------------------------------------------------------------
 
@@ -382,6 +382,42 @@ interface_string_rfind2(NativeTypeValue& operand, NativeTypeValue& str,
 
 // -----------------------------------------------------------------------------
 
+/**
+ * Replaces all non-overlapping occurrences of `old_str` in the string, from
+ * left to right, with `new_str`. Leaves the string as is if `old_str` is
+ * empty.
+ */
+void
+interface_string_replace_all(NativeTypeValue& operand,
+  NativeTypeValue& old_str, NativeTypeValue& new_str);
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Splits the string by the specified separator, into an array of the
+ * offsets of the pieces, in which each piece takes the offset it begins at
+ * followed by the one it ends at. An empty separator gives a single piece.
+ *
+ * Native arrays hold integers, so pieces are given by their offsets rather
+ * than as strings, and can be extracted with the "string substring"
+ * operation or joined back with `interface_string_join()`.
+ */
+NativeTypeValue
+interface_string_split(NativeTypeValue& operand, NativeTypeValue& sep);
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Joins the pieces of the string at the specified offsets, as given by
+ * `interface_string_split()`, with the specified separator. Throws
+ * `OutOfRangeError` if the offsets are not pairs of offsets in the string.
+ */
+NativeTypeValue
+interface_string_join(NativeTypeValue& operand, NativeTypeValue& offsets,
+  NativeTypeValue& sep);
+
+// -----------------------------------------------------------------------------
+
 
 /* --------------------------- ARRAY OPERATIONS ----------------------------- */
 
@@ -427,7 +463,7 @@ interface_array_erase(NativeTypeValue& operand, NativeTypeValue& index);
 
 // -----------------------------------------------------------------------------
 
-NativeTypeValue interface_array_pop(NativeTypeValue& operand);
+void interface_array_pop(NativeTypeValue& operand);
 
 // -----------------------------------------------------------------------------
 
@@ -440,12 +476,40 @@ void interface_array_clear(NativeTypeValue& operand);
 
 // -----------------------------------------------------------------------------
 
-NativeTypeValue
+void
 interface_array_merge(NativeTypeValue& operand,
   NativeTypeValue& other_operand);
 
 // -----------------------------------------------------------------------------
 
+NativeTypeValue interface_array_sum(NativeTypeValue& operand);
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Throws `OutOfRangeError` if the array is empty.
+ */
+NativeTypeValue interface_array_min(NativeTypeValue& operand);
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Throws `OutOfRangeError` if the array is empty.
+ */
+NativeTypeValue interface_array_max(NativeTypeValue& operand);
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Finds the index of the first element equal to the specified value, or the
+ * maximum value of `uint64` if there is none, as the "string find" operation
+ * does.
+ */
+NativeTypeValue
+interface_array_find(NativeTypeValue& operand, NativeTypeValue& value);
+
+// -----------------------------------------------------------------------------
+
 
 /* ---------------------------- MAP OPERATIONS ------------------------------ */
 
@@ -498,11 +562,58 @@ NativeTypeValue interface_map_vals(NativeTypeValue& operand);
 
 // -----------------------------------------------------------------------------
 
-NativeTypeValue
+void
 interface_map_merge(NativeTypeValue& operand, NativeTypeValue& other_operand);
 
 // -----------------------------------------------------------------------------
 
+
+/* --------------------------- VECTOR OPERATIONS ---------------------------- */
+
+
+// -----------------------------------------------------------------------------
+
+NativeTypeValue interface_vector_size(NativeTypeValue& operand);
+
+// -----------------------------------------------------------------------------
+
+NativeTypeValue
+interface_vector_at(NativeTypeValue& operand, NativeTypeValue& index);
+
+// -----------------------------------------------------------------------------
+
+void
+interface_vector_put(NativeTypeValue& operand, NativeTypeValue& index,
+  NativeTypeValue& value);
+
+// -----------------------------------------------------------------------------
+
+void
+interface_vector_append(NativeTypeValue& operand, NativeTypeValue& data);
+
+// -----------------------------------------------------------------------------
+
+NativeTypeValue interface_vector_sum(NativeTypeValue& operand);
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Throws `OutOfRangeError` if the vectors are not of the same size.
+ */
+NativeTypeValue
+interface_vector_dot(NativeTypeValue& operand, NativeTypeValue& other_operand);
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Multiplies each element of the vector by the specified factor, into a new
+ * vector.
+ */
+NativeTypeValue
+interface_vector_scale(NativeTypeValue& operand, NativeTypeValue& factor);
+
+// -----------------------------------------------------------------------------
+
 } /* end namespace types */
 } /* end namespace corevm */
 
@@ -21,10 +21,12 @@ IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
 CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 *******************************************************************************/
 #include "native_array.h"
+#include "native_array_kernels.h"
 
 #include "errors.h"
 #include "corevm/macros.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <iterator>
 #include <stdexcept>
@@ -38,7 +40,13 @@ namespace types {
 
 native_array::native_array()
   :
-  native_array_base()
+  native_array_base(),
+  m_hash(0),
+  m_hash_cached(false),
+  m_shared(nullptr),
+  m_view_offset(0),
+  m_view_size(0),
+  m_shared_copy(nullptr)
 {
 }
 
@@ -46,7 +54,13 @@ native_array::native_array()
 
 native_array::native_array(const native_array_base& other)
   :
-  native_array_base(other)
+  native_array_base(other),
+  m_hash(0),
+  m_hash_cached(false),
+  m_shared(nullptr),
+  m_view_offset(0),
+  m_view_size(0),
+  m_shared_copy(nullptr)
 {
 }
 
@@ -54,7 +68,13 @@ native_array::native_array(const native_array_base& other)
 
 native_array::native_array(native_array_base&& other)
   :
-  native_array_base(std::forward<native_array_base>(other))
+  native_array_base(std::forward<native_array_base>(other)),
+  m_hash(0),
+  m_hash_cached(false),
+  m_shared(nullptr),
+  m_view_offset(0),
+  m_view_size(0),
+  m_shared_copy(nullptr)
 {
 }
 
@@ -62,15 +82,248 @@ native_array::native_array(native_array_base&& other)
 
 native_array::native_array(std::initializer_list<value_type> il)
   :
-  native_array_base(il)
+  native_array_base(il),
+  m_hash(0),
+  m_hash_cached(false),
+  m_shared(nullptr),
+  m_view_offset(0),
+  m_view_size(0),
+  m_shared_copy(nullptr)
 {
 }
 
 // -----------------------------------------------------------------------------
 
+native_array::native_array(const native_array& other)
+  :
+  native_array_base(),
+  m_hash(other.m_hash),
+  m_hash_cached(other.m_hash_cached),
+  m_shared(nullptr),
+  m_view_offset(0),
+  m_view_size(0),
+  m_shared_copy(nullptr)
+{
+  copy_elements(other);
+}
+
+// -----------------------------------------------------------------------------
+
+native_array::native_array(native_array&& other)
+  :
+  native_array_base(std::move(static_cast<native_array_base&>(other))),
+  m_hash(other.m_hash),
+  m_hash_cached(other.m_hash_cached),
+  m_shared(other.m_shared),
+  m_view_offset(other.m_view_offset),
+  m_view_size(other.m_view_size),
+  m_shared_copy(other.m_shared_copy)
+{
+  other.m_shared = nullptr;
+  other.m_shared_copy = nullptr;
+  other.drop_caches();
+}
+
+// -----------------------------------------------------------------------------
+
+native_array&
+native_array::operator=(const native_array& other)
+{
+  if (&other != this)
+  {
+    release_view();
+    release_shared_copy();
+
+    native_array_base::clear();
+    copy_elements(other);
+  }
+
+  m_hash = other.m_hash;
+  m_hash_cached = other.m_hash_cached;
+
+  return *this;
+}
+
+// -----------------------------------------------------------------------------
+
+native_array&
+native_array::operator=(native_array&& other)
+{
+  if (&other != this)
+  {
+    release_view();
+    release_shared_copy();
+
+    native_array_base::operator=(
+      std::move(static_cast<native_array_base&>(other)));
+    m_shared = other.m_shared;
+    m_view_offset = other.m_view_offset;
+    m_view_size = other.m_view_size;
+    m_shared_copy = other.m_shared_copy;
+    other.m_shared = nullptr;
+    other.m_shared_copy = nullptr;
+  }
+
+  m_hash = other.m_hash;
+  m_hash_cached = other.m_hash_cached;
+  other.drop_caches();
+
+  return *this;
+}
+
+// -----------------------------------------------------------------------------
+
+native_array::~native_array()
+{
+  release_view();
+  release_shared_copy();
+}
+
+// -----------------------------------------------------------------------------
+
+size_t
+native_array::compute_hash() const
+{
+  m_hash = static_cast<size_t>(array_hash(first_element(), size()));
+  m_hash_cached = true;
+
+  return m_hash;
+}
+
+// -----------------------------------------------------------------------------
+
+void
+native_array::release_view() const
+{
+  if (m_shared && --m_shared->refs == 0)
+  {
+    delete m_shared;
+  }
+
+  m_shared = nullptr;
+  m_view_offset = 0;
+  m_view_size = 0;
+}
+
+// -----------------------------------------------------------------------------
+
+void
+native_array::flatten_view() const
+{
+  // Flattening does not change the elements of the array, which are only
+  // out of date in its base while it is a view.
+  auto& elements =
+    *const_cast<native_array_base*>(static_cast<const native_array_base*>(this));
+
+  auto& shared = m_shared->elements;
+
+  if (m_shared->refs == 1)
+  {
+    elements = std::move(shared);
+    elements.erase(
+      elements.begin() + static_cast<difference_type>(m_view_offset + m_view_size),
+      elements.end());
+    elements.erase(
+      elements.begin(),
+      elements.begin() + static_cast<difference_type>(m_view_offset));
+  }
+  else
+  {
+    const auto first =
+      shared.begin() + static_cast<difference_type>(m_view_offset);
+    elements.assign(
+      first, first + static_cast<difference_type>(m_view_size));
+  }
+
+  release_view();
+}
+
+// -----------------------------------------------------------------------------
+
+void
+native_array::release_shared_copy() const
+{
+  if (m_shared_copy && --m_shared_copy->refs == 0)
+  {
+    delete m_shared_copy;
+  }
+
+  m_shared_copy = nullptr;
+}
+
+// -----------------------------------------------------------------------------
+
+void
+native_array::copy_elements(const native_array& other)
+{
+  // Copies of views, and of arrays with views of them, are views as well.
+  shared_elements* shared =
+    other.m_shared ? other.m_shared : other.m_shared_copy;
+
+  if (shared)
+  {
+    ++shared->refs;
+
+    m_shared = shared;
+    m_view_offset = other.m_shared ? other.m_view_offset : 0;
+    m_view_size = other.size();
+  }
+  else
+  {
+    native_array_base::operator=(other);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+native_array
+native_array::slice(size_type pos, size_type len) const
+{
+  const size_type n = size();
+
+  pos = std::min(pos, n);
+  len = std::min(len, n - pos);
+
+#if COREVM_USE_NATIVE_SLICE_VIEWS
+  // The copy of the elements of the array shared with its views is only
+  // made for slices of at least half of them, which then cost at most twice
+  // as much as copying the slice does.
+  if (len >= VIEW_MIN_SIZE && !m_shared && !m_shared_copy && len >= n - len)
+  {
+    m_shared_copy = new shared_elements { 1, native_array_base(*this) };
+  }
+
+  shared_elements* shared = m_shared ? m_shared : m_shared_copy;
+
+  if (len >= VIEW_MIN_SIZE && shared)
+  {
+    native_array res;
+    res.m_shared = shared;
+    res.m_view_offset = (m_shared ? m_view_offset : 0) + pos;
+    res.m_view_size = len;
+
+    ++shared->refs;
+
+    return res;
+  }
+#endif
+
+  const value_type* first = first_element() + pos;
+
+  return native_array(first, first + len);
+}
+
+// -----------------------------------------------------------------------------
+
 native_array::native_array(int8_t)
   :
-  native_array_base()
+  native_array_base(),
+  m_hash(0),
+  m_hash_cached(false),
+  m_shared(nullptr),
+  m_view_offset(0),
+  m_view_size(0),
+  m_shared_copy(nullptr)
 {
   THROW(ConversionError("int8", "array"));
 }
@@ -231,6 +484,9 @@ native_array::operator>>(const native_array&) const
 native_array::reference
 native_array::at(size_type n)
 {
+  flatten();
+  drop_caches();
+
   try
   {
     return native_array_base::at(n);
@@ -246,14 +502,12 @@ native_array::at(size_type n)
 native_array::const_reference
 native_array::at(size_type n) const
 {
-  try
-  {
-    return native_array_base::at(n);
-  }
-  catch (const std::out_of_range&)
+  if (n >= size())
   {
     THROW(OutOfRangeError("Array index out of range"));
   }
+
+  return first_element()[n];
 }
 
 // -----------------------------------------------------------------------------
@@ -266,6 +520,9 @@ native_array::erase(size_t n)
     THROW(OutOfRangeError("Array index out of range"));
   }
 
+  flatten();
+  drop_caches();
+
   auto itr = begin();
   std::advance(itr, n);
   native_array_base::erase(itr);
@@ -273,5 +530,49 @@ native_array::erase(size_t n)
 
 // -----------------------------------------------------------------------------
 
+void
+native_array::clear()
+{
+  release_view();
+  drop_caches();
+  native_array_base::clear();
+}
+
+// -----------------------------------------------------------------------------
+
+void
+native_array::pop_back()
+{
+  flatten();
+  drop_caches();
+  native_array_base::pop_back();
+}
+
+// -----------------------------------------------------------------------------
+
+void
+native_array::resize(size_type n)
+{
+  flatten();
+  drop_caches();
+  native_array_base::resize(n);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+native_array::swap(native_array& other)
+{
+  native_array_base::swap(other);
+  std::swap(m_hash, other.m_hash);
+  std::swap(m_hash_cached, other.m_hash_cached);
+  std::swap(m_shared, other.m_shared);
+  std::swap(m_view_offset, other.m_view_offset);
+  std::swap(m_view_size, other.m_view_size);
+  std::swap(m_shared_copy, other.m_shared_copy);
+}
+
+// -----------------------------------------------------------------------------
+
 } /* end namespace types */
 } /* end namespace corevm */
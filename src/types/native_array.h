@@ -25,8 +25,12 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include "errors.h"
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 
@@ -39,9 +43,32 @@ typedef uint64_t native_array_element_type;
 using native_array_base = typename std::vector<native_array_element_type>;
 
 
+/**
+ * Native arrays cache their hashes, which are computed on first use and
+ * dropped as the arrays are mutated.
+ *
+ * Slices of at least `VIEW_MIN_SIZE` elements (see `slice()`) are views of
+ * the elements of the arrays they are taken from. Arrays that are not views
+ * keep a copy of their elements shared with their views for this, which is
+ * dropped with the hash as they are mutated, so that the arrays themselves
+ * are left as they are. Copies of views, and of arrays with such a copy,
+ * are views as well. The elements viewed are copied into an array by
+ * `flatten()`, which the members declared here call before handing out
+ * iterators or mutating it, and native type values call on the arrays they
+ * hold as they are accessed.
+ *
+ * The caches and the views are only handled by the members declared here;
+ * arrays should be flattened before being read through a reference to their
+ * base class, and should not be mutated through one.
+ */
 class native_array : public native_array_base
 {
 public:
+  /**
+   * Size from which slices of arrays share their elements.
+   */
+  static const size_type VIEW_MIN_SIZE = 64;
+
   native_array();
 
   native_array(const native_array_base&);
@@ -56,10 +83,57 @@ public:
   template <class InputIterator>
   native_array(InputIterator first, InputIterator last)
     :
-    native_array_base(first, last)
+    native_array_base(first, last),
+    m_hash(0),
+    m_hash_cached(false),
+    m_shared(nullptr),
+    m_view_offset(0),
+    m_view_size(0),
+    m_shared_copy(nullptr)
   {
   }
 
+  native_array(const native_array&);
+
+  native_array(native_array&&);
+
+  native_array& operator=(const native_array&);
+
+  native_array& operator=(native_array&&);
+
+  ~native_array();
+
+  /**
+   * Hash of the elements of the array, in order.
+   */
+  size_t hash() const;
+
+  /**
+   * Whether the array is not a view of the elements of another.
+   */
+  bool flat() const;
+
+  /**
+   * Copies the elements viewed by the array into it, if it is a view. The
+   * elements are moved instead if no other array views them.
+   */
+  void flatten() const;
+
+  /**
+   * Returns the elements from the specified position on, up to the
+   * specified number of them, both clamped to the size of the array.
+   *
+   * Slices of at least `VIEW_MIN_SIZE` elements are views of the elements
+   * of the array if it is a view, or of its shared copy of them otherwise.
+   * Arrays that are not views only make that copy for slices of at least
+   * half of their elements, and copy smaller slices directly instead.
+   */
+  native_array slice(size_type pos, size_type len) const;
+
+  size_type size() const;
+
+  bool empty() const;
+
   operator int8_t() const;
 
   native_array& operator+() const;
@@ -102,9 +176,414 @@ public:
 
   const_reference at(size_type n) const;
 
+  reference operator[](size_type n);
+
+  const_reference operator[](size_type n) const;
+
+  /**
+   * Counterparts of the accessors of the base class. The ones that hand out
+   * iterators or mutable access flatten the array first, and the latter drop
+   * its caches as well.
+   */
+  iterator begin();
+
+  const_iterator begin() const;
+
+  iterator end();
+
+  const_iterator end() const;
+
+  const_iterator cbegin() const;
+
+  const_iterator cend() const;
+
+  reverse_iterator rbegin();
+
+  const_reverse_iterator rbegin() const;
+
+  reverse_iterator rend();
+
+  const_reverse_iterator rend() const;
+
+  const_reverse_iterator crbegin() const;
+
+  const_reverse_iterator crend() const;
+
+  reference front();
+
+  const_reference front() const;
+
+  reference back();
+
+  const_reference back() const;
+
+  value_type* data();
+
+  const value_type* data() const;
+
   void erase(size_type n);
+
+  template <typename... Arguments>
+  auto insert(Arguments&&... args)
+    -> decltype(native_array_base::insert(std::forward<Arguments>(args)...))
+  {
+    flatten();
+    drop_caches();
+    return native_array_base::insert(std::forward<Arguments>(args)...);
+  }
+
+  void clear();
+
+  void push_back(value_type value);
+
+  void pop_back();
+
+  void resize(size_type n);
+
+  void swap(native_array&);
+
+private:
+  template <typename T>
+  friend typename std::enable_if<
+    std::is_same<T, native_array>::value, bool>::type
+  operator==(const T&, const T&);
+
+  /** Elements shared by the arrays viewing them. */
+  struct shared_elements
+  {
+    size_t refs;
+    native_array_base elements;
+  };
+
+  size_t compute_hash() const;
+
+  void drop_caches();
+
+  /** First element of the array, or of the ones it views. */
+  const value_type* first_element() const;
+
+  void flatten_view() const;
+
+  void release_view() const;
+
+  void release_shared_copy() const;
+
+  void copy_elements(const native_array&);
+
+  mutable size_t m_hash;
+  mutable bool m_hash_cached;
+
+  /** Elements viewed by the array if it is a view, or null otherwise. */
+  mutable shared_elements* m_shared;
+  mutable size_type m_view_offset;
+  mutable size_type m_view_size;
+
+  /** Copy of the elements of the array shared with its views, if any. */
+  mutable shared_elements* m_shared_copy;
 };
 
+// -----------------------------------------------------------------------------
+
+inline size_t
+native_array::hash() const
+{
+  if (!m_hash_cached)
+  {
+    return compute_hash();
+  }
+
+  return m_hash;
+}
+
+// -----------------------------------------------------------------------------
+
+inline void
+native_array::drop_caches()
+{
+  m_hash_cached = false;
+
+  if (m_shared_copy)
+  {
+    release_shared_copy();
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+inline bool
+native_array::flat() const
+{
+  return m_shared == nullptr;
+}
+
+// -----------------------------------------------------------------------------
+
+inline void
+native_array::flatten() const
+{
+  if (m_shared)
+  {
+    flatten_view();
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+inline native_array::size_type
+native_array::size() const
+{
+  return m_shared ? m_view_size : native_array_base::size();
+}
+
+// -----------------------------------------------------------------------------
+
+inline bool
+native_array::empty() const
+{
+  return size() == 0;
+}
+
+// -----------------------------------------------------------------------------
+
+inline const native_array::value_type*
+native_array::first_element() const
+{
+  return m_shared ?
+    m_shared->elements.data() + m_view_offset : native_array_base::data();
+}
+
+// -----------------------------------------------------------------------------
+
+inline native_array::reference
+native_array::operator[](size_type n)
+{
+  flatten();
+  drop_caches();
+  return native_array_base::operator[](n);
+}
+
+// -----------------------------------------------------------------------------
+
+inline native_array::const_reference
+native_array::operator[](size_type n) const
+{
+  return first_element()[n];
+}
+
+// -----------------------------------------------------------------------------
+
+inline native_array::iterator
+native_array::begin()
+{
+  flatten();
+  drop_caches();
+  return native_array_base::begin();
+}
+
+// -----------------------------------------------------------------------------
+
+inline native_array::const_iterator
+native_array::begin() const
+{
+  flatten();
+  return native_array_base::begin();
+}
+
+// -----------------------------------------------------------------------------
+
+inline native_array::iterator
+native_array::end()
+{
+  flatten();
+  drop_caches();
+  return native_array_base::end();
+}
+
+// -----------------------------------------------------------------------------
+
+inline native_array::const_iterator
+native_array::end() const
+{
+  flatten();
+  return native_array_base::end();
+}
+
+// -----------------------------------------------------------------------------
+
+inline native_array::const_iterator
+native_array::cbegin() const
+{
+  flatten();
+  return native_array_base::cbegin();
+}
+
+// -----------------------------------------------------------------------------
+
+inline native_array::const_iterator
+native_array::cend() const
+{
+  flatten();
+  return native_array_base::cend();
+}
+
+// -----------------------------------------------------------------------------
+
+inline native_array::reverse_iterator
+native_array::rbegin()
+{
+  flatten();
+  drop_caches();
+  return native_array_base::rbegin();
+}
+
+// -----------------------------------------------------------------------------
+
+inline native_array::const_reverse_iterator
+native_array::rbegin() const
+{
+  flatten();
+  return native_array_base::rbegin();
+}
+
+// -----------------------------------------------------------------------------
+
+inline native_array::reverse_iterator
+native_array::rend()
+{
+  flatten();
+  drop_caches();
+  return native_array_base::rend();
+}
+
+// -----------------------------------------------------------------------------
+
+inline native_array::const_reverse_iterator
+native_array::rend() const
+{
+  flatten();
+  return native_array_base::rend();
+}
+
+// -----------------------------------------------------------------------------
+
+inline native_array::const_reverse_iterator
+native_array::crbegin() const
+{
+  flatten();
+  return native_array_base::crbegin();
+}
+
+// -----------------------------------------------------------------------------
+
+inline native_array::const_reverse_iterator
+native_array::crend() const
+{
+  flatten();
+  return native_array_base::crend();
+}
+
+// -----------------------------------------------------------------------------
+
+inline native_array::reference
+native_array::front()
+{
+  flatten();
+  drop_caches();
+  return native_array_base::front();
+}
+
+// -----------------------------------------------------------------------------
+
+inline native_array::const_reference
+native_array::front() const
+{
+  return first_element()[0];
+}
+
+// -----------------------------------------------------------------------------
+
+inline native_array::reference
+native_array::back()
+{
+  flatten();
+  drop_caches();
+  return native_array_base::back();
+}
+
+// -----------------------------------------------------------------------------
+
+inline native_array::const_reference
+native_array::back() const
+{
+  return first_element()[size() - 1];
+}
+
+// -----------------------------------------------------------------------------
+
+inline native_array::value_type*
+native_array::data()
+{
+  flatten();
+  drop_caches();
+  return native_array_base::data();
+}
+
+// -----------------------------------------------------------------------------
+
+inline const native_array::value_type*
+native_array::data() const
+{
+  return first_element();
+}
+
+// -----------------------------------------------------------------------------
+
+inline void
+native_array::push_back(value_type value)
+{
+  flatten();
+  drop_caches();
+  native_array_base::push_back(value);
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Only takes part in comparisons between two native arrays, which it
+ * shortcuts on cached hashes. Other comparisons are left to the ones of
+ * `native_array_base`.
+ */
+template <typename T>
+inline typename std::enable_if<
+  std::is_same<T, native_array>::value, bool>::type
+operator==(const T& lhs, const T& rhs)
+{
+  if (lhs.size() != rhs.size())
+  {
+    return false;
+  }
+
+  if (lhs.m_hash_cached && rhs.m_hash_cached && lhs.m_hash != rhs.m_hash)
+  {
+    return false;
+  }
+
+  return std::equal(
+    lhs.first_element(), lhs.first_element() + lhs.size(), rhs.first_element());
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+inline typename std::enable_if<
+  std::is_same<T, native_array>::value, bool>::type
+operator!=(const T& lhs, const T& rhs)
+{
+  return !(lhs == rhs);
+}
+
+// -----------------------------------------------------------------------------
+
 } /* end namespace types */
 } /* end namespace corevm */
 
@@ -0,0 +1,769 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2016 Yanzheng Li
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#include "native_array_kernels.h"
+#include "simd_support.h"
+
+#include "corevm/macros.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#define COREVM_ARRAY_KERNELS_SSE2 \
+  (COREVM_USE_SIMD_ARRAY_KERNELS && COREVM_SIMD_SSE2)
+#define COREVM_ARRAY_KERNELS_AVX2 \
+  (COREVM_USE_SIMD_ARRAY_KERNELS && COREVM_SIMD_AVX2)
+
+#if COREVM_ARRAY_KERNELS_SSE2
+  #include <emmintrin.h>
+#endif
+
+#if COREVM_ARRAY_KERNELS_AVX2
+  #include <immintrin.h>
+#endif
+
+
+namespace corevm {
+namespace types {
+
+// -----------------------------------------------------------------------------
+
+namespace {
+
+// -----------------------------------------------------------------------------
+
+typedef native_array_element_type element_type;
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Elements are hashed after the long input loop of XXH3. They are taken in
+ * stripes of `HASH_LANES` elements, and each element of a stripe is mixed
+ * into an accumulator of its own with a single 32 by 32 bit multiplication,
+ * which maps onto vector instructions (`pmuludq` of SSE2 and AVX2). Elements
+ * are mixed with keys that depend on their position in blocks of
+ * `HASH_BLOCK_STRIPES` stripes, and accumulators are scrambled between
+ * blocks, so that the hash depends on the order of the elements.
+ */
+const size_t HASH_LANES = 4;
+const size_t HASH_BLOCK_STRIPES = 16;
+
+const uint64_t PRIME32_1 = 0x9E3779B1ULL;
+const uint64_t PRIME64_1 = 0x9E3779B185EBCA87ULL;
+const uint64_t PRIME64_2 = 0xC2B2AE3D27D4EB4FULL;
+const uint64_t PRIME64_3 = 0x165667B19E3779F9ULL;
+const uint64_t PRIME64_4 = 0x85EBCA77C2B2AE63ULL;
+
+/**
+ * Keys of the elements of a stripe start at the index of the stripe in its
+ * block, followed by the keys for scrambling the accumulators.
+ */
+const uint64_t HASH_KEYS[HASH_BLOCK_STRIPES + HASH_LANES - 1 + HASH_LANES] = {
+  0x1AC046DDA8E86E2AULL,
+  0xBE2C3B00B1D348C8ULL,
+  0x9B1A66A95412FF75ULL,
+  0xC448C2B1F05F7E4CULL,
+  0xC111CA6B8F6E73C4ULL,
+  0xB54861920D05B01DULL,
+  0x8D61500F4A7BBE16ULL,
+  0x5E0C25471F89E02EULL,
+  0x48105A3D28F0E221ULL,
+  0x2169F8846B637746ULL,
+  0x3D628782E0C0D863ULL,
+  0xA5DDB2216078AA40ULL,
+  0xC8119D17F0571101ULL,
+  0x98E2E2EB8F33280FULL,
+  0x8CD1E28860679CC4ULL,
+  0x9DCA6189C923AEF3ULL,
+  0x9D8D3071BA4F04C4ULL,
+  0x5D395ADA34220C26ULL,
+  0xE6DE42A441A1E28EULL,
+  0x308FBF68CC864F59ULL,
+  0x216A3C81332862F9ULL,
+  0xBACECA0A77F3132EULL,
+  0xDF2A2215339CA69CULL,
+};
+
+const uint64_t* const HASH_SCRAMBLE_KEYS =
+  HASH_KEYS + HASH_BLOCK_STRIPES + HASH_LANES - 1;
+
+// -----------------------------------------------------------------------------
+
+inline uint64_t
+rotl(uint64_t x, int r)
+{
+  return (x << r) | (x >> (64 - r));
+}
+
+// -----------------------------------------------------------------------------
+
+inline uint64_t
+hash_round(uint64_t acc, uint64_t value)
+{
+  acc += value * PRIME64_2;
+  acc = rotl(acc, 31);
+  return acc * PRIME64_1;
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Mixes the accumulators, the `m` elements left over past the last stripe,
+ * and the number of elements into the hash, the same way for every
+ * implementation.
+ */
+inline uint64_t
+finish_hash(const uint64_t* lanes, const element_type* rest, size_t m,
+  size_t n)
+{
+  uint64_t h = static_cast<uint64_t>(n) * PRIME64_1;
+
+  for (size_t i = 0; i < HASH_LANES; ++i)
+  {
+    h ^= hash_round(0, lanes[i]);
+    h = h * PRIME64_1 + PRIME64_4;
+  }
+
+  for (size_t i = 0; i < m; ++i)
+  {
+    h ^= hash_round(0, rest[i]);
+    h = rotl(h, 27) * PRIME64_1 + PRIME64_4;
+  }
+
+  h ^= h >> 33;
+  h *= PRIME64_2;
+  h ^= h >> 29;
+  h *= PRIME64_3;
+  h ^= h >> 32;
+
+  return h;
+}
+
+// -----------------------------------------------------------------------------
+
+element_type
+sum_scalar(const element_type* elements, size_t n)
+{
+  element_type res = 0;
+
+  for (size_t i = 0; i < n; ++i)
+  {
+    res += elements[i];
+  }
+
+  return res;
+}
+
+// -----------------------------------------------------------------------------
+
+element_type
+min_scalar(const element_type* elements, size_t n)
+{
+  element_type res = elements[0];
+
+  for (size_t i = 1; i < n; ++i)
+  {
+    res = elements[i] < res ? elements[i] : res;
+  }
+
+  return res;
+}
+
+// -----------------------------------------------------------------------------
+
+element_type
+max_scalar(const element_type* elements, size_t n)
+{
+  element_type res = elements[0];
+
+  for (size_t i = 1; i < n; ++i)
+  {
+    res = elements[i] > res ? elements[i] : res;
+  }
+
+  return res;
+}
+
+// -----------------------------------------------------------------------------
+
+size_t
+find_scalar(const element_type* elements, size_t n, element_type value)
+{
+  for (size_t i = 0; i < n; ++i)
+  {
+    if (elements[i] == value)
+    {
+      return i;
+    }
+  }
+
+  return n;
+}
+
+// -----------------------------------------------------------------------------
+
+void
+reverse_copy_scalar(const element_type* elements, size_t n, element_type* dst)
+{
+  for (size_t i = 0; i < n; ++i)
+  {
+    dst[n - 1 - i] = elements[i];
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+uint64_t
+hash_scalar(const element_type* elements, size_t n)
+{
+  uint64_t acc[HASH_LANES] = { PRIME32_1, PRIME64_1, PRIME64_2, PRIME64_3 };
+
+  size_t i = 0;
+  size_t stripe = 0;
+
+  for (; i + HASH_LANES <= n; i += HASH_LANES)
+  {
+    for (size_t j = 0; j < HASH_LANES; ++j)
+    {
+      const uint64_t xk = elements[i + j] ^ HASH_KEYS[stripe + j];
+      acc[j] += (xk & 0xFFFFFFFFULL) * (xk >> 32) + elements[i + j];
+    }
+
+    if (++stripe == HASH_BLOCK_STRIPES)
+    {
+      for (size_t j = 0; j < HASH_LANES; ++j)
+      {
+        const uint64_t a = acc[j] ^ (acc[j] >> 47) ^ HASH_SCRAMBLE_KEYS[j];
+        acc[j] = a * PRIME32_1;
+      }
+
+      stripe = 0;
+    }
+  }
+
+  return finish_hash(acc, elements + i, n - i, n);
+}
+
+// -----------------------------------------------------------------------------
+
+#if COREVM_ARRAY_KERNELS_SSE2
+
+// -----------------------------------------------------------------------------
+
+inline __m128i
+load_sse2(const element_type* p)
+{
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+}
+
+// -----------------------------------------------------------------------------
+
+element_type
+sum_sse2(const element_type* elements, size_t n)
+{
+  __m128i acc0 = _mm_setzero_si128();
+  __m128i acc1 = _mm_setzero_si128();
+
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4)
+  {
+    acc0 = _mm_add_epi64(acc0, load_sse2(elements + i));
+    acc1 = _mm_add_epi64(acc1, load_sse2(elements + i + 2));
+  }
+
+  element_type lanes[2];
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes),
+    _mm_add_epi64(acc0, acc1));
+
+  return lanes[0] + lanes[1] + sum_scalar(elements + i, n - i);
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * SSE2 has no comparison of 64 bit integers, so the halves of elements are
+ * compared separately, and the results are combined with those of the other
+ * halves.
+ */
+inline int
+cmpeq_mask_sse2(__m128i x, __m128i value)
+{
+  const __m128i eq = _mm_cmpeq_epi32(x, value);
+  const __m128i eq64 = _mm_and_si128(eq, _mm_shuffle_epi32(eq, 0xB1));
+
+  return _mm_movemask_pd(_mm_castsi128_pd(eq64));
+}
+
+// -----------------------------------------------------------------------------
+
+size_t
+find_sse2(const element_type* elements, size_t n, element_type value)
+{
+  const __m128i v = _mm_set1_epi64x(static_cast<int64_t>(value));
+
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4)
+  {
+    const int mask0 = cmpeq_mask_sse2(load_sse2(elements + i), v);
+    const int mask1 = cmpeq_mask_sse2(load_sse2(elements + i + 2), v);
+
+    if (mask0 | mask1)
+    {
+      const int mask = mask0 | (mask1 << 2);
+      return i + static_cast<size_t>(__builtin_ctz(mask));
+    }
+  }
+
+  return i + find_scalar(elements + i, n - i, value);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+reverse_copy_sse2(const element_type* elements, size_t n, element_type* dst)
+{
+  size_t i = 0;
+  for (; i + 2 <= n; i += 2)
+  {
+    const __m128i x = _mm_shuffle_epi32(load_sse2(elements + i), 0x4E);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + n - i - 2), x);
+  }
+
+  reverse_copy_scalar(elements + i, n - i, dst);
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Accumulates the four lanes of the hash in two registers.
+ */
+uint64_t
+hash_sse2(const element_type* elements, size_t n)
+{
+  __m128i acc[2] = {
+    _mm_set_epi64x(static_cast<int64_t>(PRIME64_1),
+      static_cast<int64_t>(PRIME32_1)),
+    _mm_set_epi64x(static_cast<int64_t>(PRIME64_3),
+      static_cast<int64_t>(PRIME64_2))
+  };
+
+  const __m128i prime = _mm_set1_epi32(static_cast<int>(PRIME32_1));
+
+  size_t i = 0;
+  size_t stripe = 0;
+
+  for (; i + HASH_LANES <= n; i += HASH_LANES)
+  {
+    for (size_t j = 0; j < 2; ++j)
+    {
+      const __m128i x = load_sse2(elements + i + j * 2);
+      const __m128i k = load_sse2(HASH_KEYS + stripe + j * 2);
+      const __m128i xk = _mm_xor_si128(x, k);
+      const __m128i product = _mm_mul_epu32(xk, _mm_srli_epi64(xk, 32));
+
+      acc[j] = _mm_add_epi64(acc[j], _mm_add_epi64(product, x));
+    }
+
+    if (++stripe == HASH_BLOCK_STRIPES)
+    {
+      for (size_t j = 0; j < 2; ++j)
+      {
+        __m128i a = _mm_xor_si128(acc[j], _mm_srli_epi64(acc[j], 47));
+        a = _mm_xor_si128(a, load_sse2(HASH_SCRAMBLE_KEYS + j * 2));
+
+        const __m128i lo = _mm_mul_epu32(a, prime);
+        const __m128i hi = _mm_mul_epu32(_mm_srli_epi64(a, 32), prime);
+
+        acc[j] = _mm_add_epi64(lo, _mm_slli_epi64(hi, 32));
+      }
+
+      stripe = 0;
+    }
+  }
+
+  uint64_t lanes[HASH_LANES];
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), acc[0]);
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes + 2), acc[1]);
+
+  return finish_hash(lanes, elements + i, n - i, n);
+}
+
+// -----------------------------------------------------------------------------
+
+#endif // COREVM_ARRAY_KERNELS_SSE2
+
+// -----------------------------------------------------------------------------
+
+#if COREVM_ARRAY_KERNELS_AVX2
+
+// -----------------------------------------------------------------------------
+
+COREVM_AVX2 inline __m256i
+load_avx2(const element_type* p)
+{
+  return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+}
+
+// -----------------------------------------------------------------------------
+
+COREVM_AVX2 element_type
+sum_avx2(const element_type* elements, size_t n)
+{
+  __m256i acc0 = _mm256_setzero_si256();
+  __m256i acc1 = _mm256_setzero_si256();
+
+  size_t i = 0;
+  for (; i + 8 <= n; i += 8)
+  {
+    acc0 = _mm256_add_epi64(acc0, load_avx2(elements + i));
+    acc1 = _mm256_add_epi64(acc1, load_avx2(elements + i + 4));
+  }
+
+  element_type lanes[4];
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes),
+    _mm256_add_epi64(acc0, acc1));
+
+  return lanes[0] + lanes[1] + lanes[2] + lanes[3] +
+    sum_scalar(elements + i, n - i);
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * AVX2 only compares signed 64 bit integers, so elements are compared with
+ * their sign bits flipped, which orders them as unsigned integers.
+ */
+template<bool Max>
+COREVM_AVX2 inline __m256i
+select_avx2(__m256i acc, const element_type* p, __m256i bias)
+{
+  const __m256i x = _mm256_xor_si256(load_avx2(p), bias);
+  const __m256i take =
+    Max ? _mm256_cmpgt_epi64(x, acc) : _mm256_cmpgt_epi64(acc, x);
+
+  return _mm256_blendv_epi8(acc, x, take);
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Elements are taken into four accumulators, as each one depends on the
+ * comparison with its previous value.
+ */
+template<bool Max>
+COREVM_AVX2 element_type
+minmax_avx2(const element_type* elements, size_t n)
+{
+  if (n < 16)
+  {
+    return Max ? max_scalar(elements, n) : min_scalar(elements, n);
+  }
+
+  const __m256i bias = _mm256_set1_epi64x(INT64_MIN);
+
+  __m256i acc0 = _mm256_xor_si256(load_avx2(elements), bias);
+  __m256i acc1 = _mm256_xor_si256(load_avx2(elements + 4), bias);
+  __m256i acc2 = _mm256_xor_si256(load_avx2(elements + 8), bias);
+  __m256i acc3 = _mm256_xor_si256(load_avx2(elements + 12), bias);
+
+  size_t i = 16;
+  for (; i + 16 <= n; i += 16)
+  {
+    acc0 = select_avx2<Max>(acc0, elements + i, bias);
+    acc1 = select_avx2<Max>(acc1, elements + i + 4, bias);
+    acc2 = select_avx2<Max>(acc2, elements + i + 8, bias);
+    acc3 = select_avx2<Max>(acc3, elements + i + 12, bias);
+  }
+
+  element_type lanes[16];
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes),
+    _mm256_xor_si256(acc0, bias));
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes + 4),
+    _mm256_xor_si256(acc1, bias));
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes + 8),
+    _mm256_xor_si256(acc2, bias));
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes + 12),
+    _mm256_xor_si256(acc3, bias));
+
+  element_type res = Max ? max_scalar(lanes, 16) : min_scalar(lanes, 16);
+
+  if (i < n)
+  {
+    const element_type rest = Max ?
+      max_scalar(elements + i, n - i) : min_scalar(elements + i, n - i);
+
+    res = Max ? (rest > res ? rest : res) : (rest < res ? rest : res);
+  }
+
+  return res;
+}
+
+// -----------------------------------------------------------------------------
+
+COREVM_AVX2 element_type
+min_avx2(const element_type* elements, size_t n)
+{
+  return minmax_avx2<false>(elements, n);
+}
+
+// -----------------------------------------------------------------------------
+
+COREVM_AVX2 element_type
+max_avx2(const element_type* elements, size_t n)
+{
+  return minmax_avx2<true>(elements, n);
+}
+
+// -----------------------------------------------------------------------------
+
+COREVM_AVX2 size_t
+find_avx2(const element_type* elements, size_t n, element_type value)
+{
+  const __m256i v = _mm256_set1_epi64x(static_cast<int64_t>(value));
+
+  size_t i = 0;
+  for (; i + 8 <= n; i += 8)
+  {
+    const __m256i eq0 = _mm256_cmpeq_epi64(load_avx2(elements + i), v);
+    const __m256i eq1 = _mm256_cmpeq_epi64(load_avx2(elements + i + 4), v);
+
+    if (!_mm256_testz_si256(_mm256_or_si256(eq0, eq1),
+          _mm256_or_si256(eq0, eq1)))
+    {
+      const int mask = _mm256_movemask_pd(_mm256_castsi256_pd(eq0)) |
+        (_mm256_movemask_pd(_mm256_castsi256_pd(eq1)) << 4);
+      return i + static_cast<size_t>(__builtin_ctz(mask));
+    }
+  }
+
+  return i + find_scalar(elements + i, n - i, value);
+}
+
+// -----------------------------------------------------------------------------
+
+COREVM_AVX2 void
+reverse_copy_avx2(const element_type* elements, size_t n, element_type* dst)
+{
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4)
+  {
+    const __m256i x =
+      _mm256_permute4x64_epi64(load_avx2(elements + i), 0x1B);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + n - i - 4), x);
+  }
+
+  reverse_copy_scalar(elements + i, n - i, dst);
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Accumulates the four lanes of the hash in a single register.
+ */
+COREVM_AVX2 uint64_t
+hash_avx2(const element_type* elements, size_t n)
+{
+  __m256i acc = _mm256_set_epi64x(static_cast<int64_t>(PRIME64_3),
+    static_cast<int64_t>(PRIME64_2), static_cast<int64_t>(PRIME64_1),
+    static_cast<int64_t>(PRIME32_1));
+
+  const __m256i prime = _mm256_set1_epi32(static_cast<int>(PRIME32_1));
+  const __m256i scramble_keys = load_avx2(HASH_SCRAMBLE_KEYS);
+
+  size_t i = 0;
+  size_t stripe = 0;
+
+  for (; i + HASH_LANES <= n; i += HASH_LANES)
+  {
+    const __m256i x = load_avx2(elements + i);
+    const __m256i xk = _mm256_xor_si256(x, load_avx2(HASH_KEYS + stripe));
+    const __m256i product = _mm256_mul_epu32(xk, _mm256_srli_epi64(xk, 32));
+
+    acc = _mm256_add_epi64(acc, _mm256_add_epi64(product, x));
+
+    if (++stripe == HASH_BLOCK_STRIPES)
+    {
+      __m256i a = _mm256_xor_si256(acc, _mm256_srli_epi64(acc, 47));
+      a = _mm256_xor_si256(a, scramble_keys);
+
+      const __m256i lo = _mm256_mul_epu32(a, prime);
+      const __m256i hi = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), prime);
+
+      acc = _mm256_add_epi64(lo, _mm256_slli_epi64(hi, 32));
+
+      stripe = 0;
+    }
+  }
+
+  uint64_t lanes[HASH_LANES];
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), acc);
+
+  return finish_hash(lanes, elements + i, n - i, n);
+}
+
+// -----------------------------------------------------------------------------
+
+#endif // COREVM_ARRAY_KERNELS_AVX2
+
+// -----------------------------------------------------------------------------
+
+const ArrayKernels SCALAR_KERNELS {
+  "scalar", sum_scalar, min_scalar, max_scalar, find_scalar,
+  reverse_copy_scalar, hash_scalar
+};
+
+// -----------------------------------------------------------------------------
+
+#if COREVM_ARRAY_KERNELS_SSE2
+
+// SSE2 has no comparison of 64 bit integers to select the smaller or the
+// larger of elements with.
+const ArrayKernels SSE2_KERNELS {
+  "sse2", sum_sse2, min_scalar, max_scalar, find_sse2, reverse_copy_sse2,
+  hash_sse2
+};
+
+#endif
+
+// -----------------------------------------------------------------------------
+
+#if COREVM_ARRAY_KERNELS_AVX2
+
+const ArrayKernels AVX2_KERNELS {
+  "avx2", sum_avx2, min_avx2, max_avx2, find_avx2, reverse_copy_avx2,
+  hash_avx2
+};
+
+#endif
+
+// -----------------------------------------------------------------------------
+
+const ArrayKernels&
+kernels()
+{
+  static const ArrayKernels& KERNELS =
+    select_simd_kernels(array_kernel_tables());
+  return KERNELS;
+}
+
+// -----------------------------------------------------------------------------
+
+} /* end anonymous namespace */
+
+// -----------------------------------------------------------------------------
+
+const SimdKernelTables<ArrayKernels>&
+array_kernel_tables()
+{
+  static const SimdKernelTables<ArrayKernels> TABLES {
+    &SCALAR_KERNELS,
+#if COREVM_ARRAY_KERNELS_SSE2
+    &SSE2_KERNELS,
+#else
+    nullptr,
+#endif
+#if COREVM_ARRAY_KERNELS_AVX2
+    &AVX2_KERNELS,
+#else
+    nullptr,
+#endif
+  };
+
+  return TABLES;
+}
+
+// -----------------------------------------------------------------------------
+
+native_array_element_type
+array_sum(const native_array_element_type* elements, size_t n)
+{
+  return kernels().sum(elements, n);
+}
+
+// -----------------------------------------------------------------------------
+
+native_array_element_type
+array_min(const native_array_element_type* elements, size_t n)
+{
+  return kernels().min(elements, n);
+}
+
+// -----------------------------------------------------------------------------
+
+native_array_element_type
+array_max(const native_array_element_type* elements, size_t n)
+{
+  return kernels().max(elements, n);
+}
+
+// -----------------------------------------------------------------------------
+
+size_t
+array_find(const native_array_element_type* elements, size_t n,
+  native_array_element_type value)
+{
+  return kernels().find(elements, n, value);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+array_reverse_copy(const native_array_element_type* elements, size_t n,
+  native_array_element_type* dst)
+{
+  kernels().reverse_copy(elements, n, dst);
+}
+
+// -----------------------------------------------------------------------------
+
+uint64_t
+array_hash(const native_array_element_type* elements, size_t n)
+{
+  return kernels().hash(elements, n);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+array_stride_copy(const native_array_element_type* elements, size_t n,
+  size_t stride, native_array_element_type* dst)
+{
+  // Strided loads gain little from vector gathers, and are left to the
+  // compiler.
+  for (size_t i = 0; i < n; i += stride)
+  {
+    *dst++ = elements[i];
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+const char*
+array_kernels_isa()
+{
+  return kernels().isa;
+}
+
+// -----------------------------------------------------------------------------
+
+} /* end namespace types */
+} /* end namespace corevm */
@@ -0,0 +1,156 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2016 Yanzheng Li
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#ifndef COREVM_NATIVE_ARRAY_KERNELS_H_
+#define COREVM_NATIVE_ARRAY_KERNELS_H_
+
+#include "native_array.h"
+#include "simd_support.h"
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace corevm {
+namespace types {
+
+/**
+ * Kernels of bulk operations on the elements of native arrays.
+ *
+ * Each kernel has a scalar implementation, as well as ones with SSE2 and
+ * AVX2 where available. The implementations to use are selected on first use
+ * by the features of the CPU, unless turned off by
+ * `COREVM_USE_SIMD_ARRAY_KERNELS`. Elements are compared as unsigned
+ * integers, like the element type of native arrays.
+ */
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Sum of the elements, wrapping around on overflow.
+ */
+native_array_element_type array_sum(const native_array_element_type*,
+  size_t n);
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Smallest of the elements. There must be at least one element.
+ */
+native_array_element_type array_min(const native_array_element_type*,
+  size_t n);
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Largest of the elements. There must be at least one element.
+ */
+native_array_element_type array_max(const native_array_element_type*,
+  size_t n);
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Index of the first element equal to the specified value, or `n` if there
+ * is none.
+ */
+size_t array_find(const native_array_element_type*, size_t n,
+  native_array_element_type value);
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Copies the elements into the buffer starting at `dst` in reverse order.
+ * The buffer must not overlap with the elements.
+ */
+void array_reverse_copy(const native_array_element_type*, size_t n,
+  native_array_element_type* dst);
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Hash of the elements, which depends on their order. Every implementation
+ * gives the same hash.
+ */
+uint64_t array_hash(const native_array_element_type*, size_t n);
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Copies every `stride`-th element, starting from the first one, into the
+ * buffer starting at `dst`, which must hold `(n + stride - 1) / stride`
+ * elements.
+ */
+void array_stride_copy(const native_array_element_type*, size_t n,
+  size_t stride, native_array_element_type* dst);
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Name of the instruction set of the kernels in use, i.e. "avx2", "sse2" or
+ * "scalar".
+ */
+const char* array_kernels_isa();
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Implementations of the kernels above for one instruction set. Strided
+ * copies are only implemented in scalar code.
+ */
+struct ArrayKernels
+{
+  const char* isa;
+
+  native_array_element_type (*sum)(const native_array_element_type*,
+    size_t);
+
+  native_array_element_type (*min)(const native_array_element_type*,
+    size_t);
+
+  native_array_element_type (*max)(const native_array_element_type*,
+    size_t);
+
+  size_t (*find)(const native_array_element_type*, size_t,
+    native_array_element_type);
+
+  void (*reverse_copy)(const native_array_element_type*, size_t,
+    native_array_element_type*);
+
+  uint64_t (*hash)(const native_array_element_type*, size_t);
+};
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Implementations of the kernels for each of the instruction sets they are
+ * compiled for, e.g. to check them against each other.
+ */
+const SimdKernelTables<ArrayKernels>& array_kernel_tables();
+
+// -----------------------------------------------------------------------------
+
+} /* end namespace types */
+} /* end namespace corevm */
+
+
+#endif /* COREVM_NATIVE_ARRAY_KERNELS_H_ */
@@ -24,9 +24,15 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #define COREVM_NATIVE_MAP_H_
 
 #include "errors.h"
+#include "corevm/macros.h"
 
 #include <cstdint>
-#include <unordered_map>
+
+#if COREVM_USE_FLAT_NATIVE_MAP
+  #include "flat_hash_map.h"
+#else
+  #include <unordered_map>
+#endif
 
 
 namespace corevm {
@@ -36,7 +42,11 @@ typedef uint64_t native_map_key_type;
 typedef uint64_t native_map_mapped_type;
 
 
+#if COREVM_USE_FLAT_NATIVE_MAP
+using native_map_base = flat_hash_map<native_map_key_type, native_map_mapped_type>;
+#else
 using native_map_base = typename std::unordered_map<native_map_key_type, native_map_mapped_type>;
+#endif
 
 
 class native_map : public native_map_base
@@ -23,21 +23,75 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "native_string.h"
 
 #include "errors.h"
+#include "native_string_kernels.h"
 #include "corevm/macros.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <mutex>
 #include <stdexcept>
+#include <unordered_set>
 #include <utility>
 
 
 namespace corevm {
 namespace types {
 
+namespace {
+
+/**
+ * The atom table of the process. Entries are never removed, and stay at the
+ * same address as the table grows.
+ */
+class atom_table
+{
+public:
+  const native_string_base* intern(const native_string_base& str)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return &*m_atoms.insert(str).first;
+  }
+
+private:
+  std::mutex m_mutex;
+  std::unordered_set<native_string_base> m_atoms;
+};
+
+// -----------------------------------------------------------------------------
+
+atom_table&
+get_atom_table()
+{
+  static atom_table table;
+  return table;
+}
+
+} /* end anonymous namespace */
+
+// -----------------------------------------------------------------------------
+
+native_string
+native_string::intern(const native_string_base& str)
+{
+  const native_string_base* atom = get_atom_table().intern(str);
+
+  native_string result(*atom);
+  result.m_hash = std::hash<native_string_base>()(*atom);
+  result.m_hash_cached = true;
+  result.m_atom = atom;
+
+  return result;
+}
+
 // -----------------------------------------------------------------------------
 
 native_string::native_string()
   :
-  native_string_base()
+  native_string_base(),
+  m_hash(0),
+  m_atom(nullptr),
+  m_hash_cached(false),
+  m_rope()
 {
 }
 
@@ -45,7 +99,11 @@ native_string::native_string()
 
 native_string::native_string(const char* s)
   :
-  native_string_base(s)
+  native_string_base(s),
+  m_hash(0),
+  m_atom(nullptr),
+  m_hash_cached(false),
+  m_rope()
 {
 }
 
@@ -53,7 +111,11 @@ native_string::native_string(const char* s)
 
 native_string::native_string(const native_string_base& str)
   :
-  native_string_base(str)
+  native_string_base(str),
+  m_hash(0),
+  m_atom(nullptr),
+  m_hash_cached(false),
+  m_rope()
 {
 }
 
@@ -61,7 +123,11 @@ native_string::native_string(const native_string_base& str)
 
 native_string::native_string(native_string_base&& str)
   :
-  native_string_base(std::forward<native_string_base>(str))
+  native_string_base(std::forward<native_string_base>(str)),
+  m_hash(0),
+  m_atom(nullptr),
+  m_hash_cached(false),
+  m_rope()
 {
 }
 
@@ -69,15 +135,95 @@ native_string::native_string(native_string_base&& str)
 
 native_string::native_string(size_t n, char c)
   :
-  native_string_base(n, c)
+  native_string_base(n, c),
+  m_hash(0),
+  m_atom(nullptr),
+  m_hash_cached(false),
+  m_rope()
 {
 }
 
 // -----------------------------------------------------------------------------
 
+native_string::native_string(const native_string& str)
+  :
+  native_string_base(),
+  m_hash(str.m_hash),
+  m_atom(str.m_atom),
+  m_hash_cached(str.m_hash_cached),
+  m_rope()
+{
+  share_contents(str);
+}
+
+// -----------------------------------------------------------------------------
+
+native_string::native_string(native_string&& str)
+  :
+  native_string_base(std::move(static_cast<native_string_base&>(str))),
+  m_hash(str.m_hash),
+  m_atom(str.m_atom),
+  m_hash_cached(str.m_hash_cached),
+  m_rope(std::move(str.m_rope))
+{
+  str.drop_caches();
+}
+
+// -----------------------------------------------------------------------------
+
+native_string&
+native_string::operator=(const native_string& str)
+{
+  if (&str != this)
+  {
+    native_string_base::clear();
+    m_rope.clear();
+    share_contents(str);
+  }
+
+  m_hash = str.m_hash;
+  m_atom = str.m_atom;
+  m_hash_cached = str.m_hash_cached;
+
+  return *this;
+}
+
+// -----------------------------------------------------------------------------
+
+native_string&
+native_string::operator=(native_string&& str)
+{
+  native_string_base::operator=(std::move(static_cast<native_string_base&>(str)));
+  m_hash = str.m_hash;
+  m_atom = str.m_atom;
+  m_hash_cached = str.m_hash_cached;
+  m_rope = std::move(str.m_rope);
+
+  str.drop_caches();
+
+  return *this;
+}
+
+// -----------------------------------------------------------------------------
+
+size_t
+native_string::compute_hash() const
+{
+  m_hash = std::hash<native_string_base>()(*this);
+  m_hash_cached = true;
+
+  return m_hash;
+}
+
+// -----------------------------------------------------------------------------
+
 native_string::native_string(int8_t)
   :
-  native_string_base()
+  native_string_base(),
+  m_hash(0),
+  m_atom(nullptr),
+  m_hash_cached(false),
+  m_rope()
 {
   THROW(ConversionError("int8", "string"));
 }
@@ -238,6 +384,9 @@ native_string::operator>>(const native_string&) const
 native_string::reference
 native_string::at(size_type n)
 {
+  flatten();
+  drop_caches();
+
   try
   {
     return native_string_base::at(n);
@@ -253,6 +402,16 @@ native_string::at(size_type n)
 native_string::const_reference
 native_string::at(size_type n) const
 {
+  if (!flat())
+  {
+    if (n >= size())
+    {
+      THROW(OutOfRangeError("String index out of range"));
+    }
+
+    return m_rope.at(n);
+  }
+
   try
   {
     return native_string_base::at(n);
@@ -268,6 +427,10 @@ native_string::at(size_type n) const
 native_string&
 native_string::insert(size_type pos, const native_string& str)
 {
+  flatten();
+  str.flatten();
+  drop_caches();
+
   try
   {
     return static_cast<native_string&>(
@@ -284,6 +447,9 @@ native_string::insert(size_type pos, const native_string& str)
 native_string&
 native_string::insert(size_type pos, size_type n, value_type c)
 {
+  flatten();
+  drop_caches();
+
   try
   {
     return static_cast<native_string&>(
@@ -300,6 +466,9 @@ native_string::insert(size_type pos, size_type n, value_type c)
 native_string&
 native_string::erase(size_type pos)
 {
+  flatten();
+  drop_caches();
+
   try
   {
     return static_cast<native_string&>(
@@ -316,6 +485,9 @@ native_string::erase(size_type pos)
 native_string&
 native_string::erase(size_type pos, size_type len)
 {
+  flatten();
+  drop_caches();
+
   try
   {
     return static_cast<native_string&>(
@@ -332,6 +504,10 @@ native_string::erase(size_type pos, size_type len)
 native_string&
 native_string::replace(size_type pos, size_type len, const native_string& str)
 {
+  flatten();
+  str.flatten();
+  drop_caches();
+
   try
   {
     return static_cast<native_string&>(
@@ -345,5 +521,285 @@ native_string::replace(size_type pos, size_type len, const native_string& str)
 
 // -----------------------------------------------------------------------------
 
+native_string
+native_string::substr(size_type pos, size_type len) const
+{
+  const size_type n = size();
+
+  if (pos > n)
+  {
+    THROW(OutOfRangeError("String index out of range"));
+  }
+
+  len = std::min(len, n - pos);
+
+#if COREVM_USE_NATIVE_SLICE_VIEWS
+  // Large substrings of strings in builder mode share their characters.
+  // Other strings are left as they are, and their substrings are copied.
+  const bool view = len >= VIEW_MIN_SIZE;
+#else
+  const bool view = false;
+#endif
+
+  if (flat())
+  {
+    return native_string(native_string_base::substr(pos, len));
+  }
+
+  native_string res;
+  res.m_rope = m_rope.substr(pos, len);
+
+  // Other substrings are copied out of the rope right away.
+  if (!view)
+  {
+    res.flatten();
+  }
+
+  return res;
+}
+
+// -----------------------------------------------------------------------------
+
+native_string::size_type
+native_string::find(const native_string& str, size_type pos) const
+{
+  return string_find(data(), size(), str.data(), str.size(), pos);
+}
+
+// -----------------------------------------------------------------------------
+
+native_string::size_type
+native_string::rfind(const native_string& str, size_type pos) const
+{
+  return string_rfind(data(), size(), str.data(), str.size(), pos);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+native_string::clear()
+{
+  m_rope.clear();
+  drop_caches();
+  native_string_base::clear();
+}
+
+// -----------------------------------------------------------------------------
+
+void
+native_string::push_back(value_type c)
+{
+  flatten();
+  drop_caches();
+  native_string_base::push_back(c);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+native_string::pop_back()
+{
+  flatten();
+  drop_caches();
+  native_string_base::pop_back();
+}
+
+// -----------------------------------------------------------------------------
+
+void
+native_string::resize(size_type n)
+{
+  flatten();
+  drop_caches();
+  native_string_base::resize(n);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+native_string::resize(size_type n, value_type c)
+{
+  flatten();
+  drop_caches();
+  native_string_base::resize(n, c);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+native_string::swap(native_string& str)
+{
+  native_string_base::swap(str);
+  std::swap(m_hash, str.m_hash);
+  std::swap(m_atom, str.m_atom);
+  std::swap(m_hash_cached, str.m_hash_cached);
+  m_rope.swap(str.m_rope);
+}
+
+// -----------------------------------------------------------------------------
+
+native_string&
+native_string::append(const native_string& str)
+{
+  flatten();
+  str.flatten();
+  drop_caches();
+  native_string_base::append(str);
+  return *this;
+}
+
+// -----------------------------------------------------------------------------
+
+void
+native_string::flatten_rope() const
+{
+  // Flattening does not change the contents of the string, which are only
+  // out of date in its base while it is in builder mode.
+  m_rope.flatten(
+    const_cast<native_string_base*>(static_cast<const native_string_base*>(this)));
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Switches the string into builder mode if it is to grow to the specified
+ * size, and returns whether the string is in builder mode.
+ */
+bool
+native_string::enter_builder_mode(size_type n)
+{
+#if COREVM_USE_NATIVE_STRING_BUILDER
+  if (m_rope.empty() && n >= BUILDER_MODE_MIN_SIZE)
+  {
+    m_rope = native_string_rope(std::move(*static_cast<native_string_base*>(this)));
+    native_string_base::clear();
+  }
+#else
+  (void)n;
+#endif
+
+  return !m_rope.empty();
+}
+
+// -----------------------------------------------------------------------------
+
+void
+native_string::share_contents(const native_string& str)
+{
+  // Large strings switch into builder mode as they get copied, so that the
+  // copies share their characters instead. Interned strings are left alone.
+  if (!str.m_atom)
+  {
+    const_cast<native_string&>(str).enter_builder_mode(str.size());
+  }
+
+  if (str.m_rope.empty())
+  {
+    native_string_base::assign(str);
+  }
+  else
+  {
+    m_rope = str.m_rope;
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+void
+native_string::lazy_append(const native_string& str)
+{
+  if (&str == this)
+  {
+    const native_string copy(str);
+    lazy_append(copy);
+    return;
+  }
+
+  str.flatten();
+  drop_caches();
+
+  if (m_rope.empty())
+  {
+    native_string_base::append(str);
+  }
+  else
+  {
+    m_rope.append(str.data(), str.size());
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+void
+native_string::lazy_push_back(value_type c)
+{
+  drop_caches();
+
+  if (m_rope.empty())
+  {
+    native_string_base::push_back(c);
+  }
+  else
+  {
+    m_rope.append(&c, 1);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+void
+native_string::lazy_insert(size_type pos, const native_string& str)
+{
+  if (&str == this)
+  {
+    const native_string copy(str);
+    lazy_insert(pos, copy);
+    return;
+  }
+
+  if (pos > size())
+  {
+    THROW(OutOfRangeError("String index out of range"));
+  }
+
+  str.flatten();
+  drop_caches();
+
+  // Insertions at the end are appends, which do not need the rope.
+  if (pos < size() ? enter_builder_mode(size() + str.size()) : !flat())
+  {
+    m_rope.insert(pos, str.data(), str.size());
+  }
+  else
+  {
+    native_string_base::insert(pos, str);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+void
+native_string::lazy_insert(size_type pos, size_type n, value_type c)
+{
+  if (pos > size())
+  {
+    THROW(OutOfRangeError("String index out of range"));
+  }
+
+  drop_caches();
+
+  if (pos < size() ? enter_builder_mode(size() + n) : !flat())
+  {
+    const native_string_base chars(n, c);
+    m_rope.insert(pos, chars.data(), chars.size());
+  }
+  else
+  {
+    native_string_base::insert(pos, n, c);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
 } /* end namespace types */
 } /* end namespace corevm */
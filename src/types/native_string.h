@@ -24,9 +24,14 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #define COREVM_NATIVE_STRING_H_
 
 #include "errors.h"
+#include "native_string_rope.h"
 
+#include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <string>
+#include <type_traits>
+#include <utility>
 
 
 namespace corevm {
@@ -35,9 +40,54 @@ namespace types {
 typedef std::string native_string_base;
 
 
+/**
+ * Native strings cache their hashes, which are computed on first use and
+ * dropped as the strings are mutated.
+ *
+ * Strings can also be interned in a process-wide atom table, see `intern()`.
+ * Interned strings carry their hashes from the start, and two interned
+ * strings are equal if and only if they refer to the same atom, so they are
+ * compared in constant time.
+ *
+ * Strings of at least `BUILDER_MODE_MIN_SIZE` characters switch into builder
+ * mode as they are copied or inserted into through `lazy_insert()`, in which
+ * their contents are kept in a rope (see `native_string_rope`) shared with
+ * their copies. Neither inserting into a string in builder mode nor
+ * appending to it through `lazy_append()` and the like then copies all of
+ * its characters. The contents are flattened back into the string by
+ * `flatten()`, which the members declared here call as needed, and native
+ * type values call on the strings they hold as they are accessed.
+ *
+ * Substrings of at least `VIEW_MIN_SIZE` characters of strings in builder
+ * mode are taken in builder mode too, as ropes that share the characters of
+ * the string they are taken from (see `substr()`), which are only copied as
+ * the substrings are flattened.
+ *
+ * The caches and the builder mode are only handled by the members declared
+ * here, which flatten the string before handing out iterators; the string
+ * should be flattened before being read through a reference to its base
+ * class, and should not be mutated through one.
+ */
 class native_string : public native_string_base
 {
 public:
+  /**
+   * Returns a copy of the specified string interned in the atom table of
+   * the process. Atoms live as long as the process does.
+   */
+  static native_string intern(const native_string_base&);
+
+  /**
+   * Size from which strings switch into builder mode.
+   */
+  static const size_type BUILDER_MODE_MIN_SIZE = 1024;
+
+  /**
+   * Size from which substrings of strings in builder mode share their
+   * characters.
+   */
+  static const size_type VIEW_MIN_SIZE = 256;
+
   native_string();
 
   native_string(const char* s);
@@ -54,10 +104,63 @@ public:
   template <class InputIterator>
   native_string(InputIterator first, InputIterator last)
     :
-    native_string_base(first, last)
+    native_string_base(first, last),
+    m_hash(0),
+    m_atom(nullptr),
+    m_hash_cached(false),
+    m_rope()
   {
   }
 
+  native_string(const native_string&);
+
+  native_string(native_string&&);
+
+  native_string& operator=(const native_string&);
+
+  native_string& operator=(native_string&&);
+
+  /**
+   * Hash of the string, equal to the one of `std::hash<native_string_base>`.
+   */
+  size_t hash() const;
+
+  bool interned() const;
+
+  /**
+   * Whether the string is not in builder mode.
+   */
+  bool flat() const;
+
+  /**
+   * Moves the contents of the string back out of its rope, if it is in
+   * builder mode.
+   */
+  void flatten() const;
+
+  /**
+   * Counterparts of `append()`, `push_back()` and `insert()` that keep
+   * strings in builder mode, and switch large strings into it on insertions
+   * before their end.
+   */
+  void lazy_append(const native_string& str);
+
+  void lazy_push_back(value_type c);
+
+  void lazy_insert(size_type pos, const native_string& str);
+
+  void lazy_insert(size_type pos, size_type n, value_type c);
+
+  size_type size() const;
+
+  size_type length() const;
+
+  bool empty() const;
+
+  const value_type* c_str() const;
+
+  const value_type* data() const;
+
   operator int8_t() const;
 
   native_string& operator+() const;
@@ -109,8 +212,486 @@ public:
   native_string& erase(size_type pos, size_type len);
 
   native_string& replace(size_type pos, size_type len, const native_string& str);
+
+  /**
+   * Counterpart of `substr()` of the base class, which takes substrings
+   * without flattening the string.
+   */
+  native_string substr(size_type pos = 0, size_type len = npos) const;
+
+  using native_string_base::find;
+
+  using native_string_base::rfind;
+
+  /**
+   * Counterparts of `find()` and `rfind()` of the base class that run
+   * through the substring search kernels (see `native_string_kernels.h`).
+   */
+  size_type find(const native_string& str, size_type pos = 0) const;
+
+  size_type rfind(const native_string& str, size_type pos = npos) const;
+
+  reference operator[](size_type n);
+
+  const_reference operator[](size_type n) const;
+
+  /**
+   * Counterparts of the accessors of the base class, which flatten the
+   * string first. The ones that give mutable access to its characters drop
+   * its caches as well.
+   */
+  iterator begin();
+
+  const_iterator begin() const;
+
+  iterator end();
+
+  const_iterator end() const;
+
+  const_iterator cbegin() const;
+
+  const_iterator cend() const;
+
+  reverse_iterator rbegin();
+
+  const_reverse_iterator rbegin() const;
+
+  reverse_iterator rend();
+
+  const_reverse_iterator rend() const;
+
+  const_reverse_iterator crbegin() const;
+
+  const_reverse_iterator crend() const;
+
+  reference front();
+
+  const_reference front() const;
+
+  reference back();
+
+  const_reference back() const;
+
+  void clear();
+
+  void push_back(value_type c);
+
+  void pop_back();
+
+  void resize(size_type n);
+
+  void resize(size_type n, value_type c);
+
+  void swap(native_string& str);
+
+  native_string& append(const native_string& str);
+
+  /**
+   * Forward to the members of the base class, after flattening the string
+   * as well as the native strings among the arguments, whose bases are out
+   * of date while they are in builder mode.
+   */
+  template <typename... Arguments>
+  native_string& append(Arguments&&... args)
+  {
+    flatten_args(args...);
+    flatten();
+    drop_caches();
+    native_string_base::append(std::forward<Arguments>(args)...);
+    return *this;
+  }
+
+  template <typename... Arguments>
+  native_string& assign(Arguments&&... args)
+  {
+    flatten_args(args...);
+    m_rope.clear();
+    drop_caches();
+    native_string_base::assign(std::forward<Arguments>(args)...);
+    return *this;
+  }
+
+  template <typename T>
+  native_string& operator+=(const T& value)
+  {
+    flatten_args(value);
+    flatten();
+    drop_caches();
+    native_string_base::operator+=(value);
+    return *this;
+  }
+
+private:
+  static void flatten_args();
+
+  template <typename T, typename... Arguments>
+  static void flatten_args(const T&, const Arguments&... args);
+
+  template <typename... Arguments>
+  static void flatten_args(const native_string& str,
+    const Arguments&... args);
+
+  template <typename T>
+  friend typename std::enable_if<
+    std::is_same<T, native_string>::value, bool>::type
+  operator==(const T&, const T&);
+
+  size_t compute_hash() const;
+
+  void drop_caches();
+
+  void flatten_rope() const;
+
+  bool enter_builder_mode(size_type n);
+
+  void share_contents(const native_string&);
+
+  mutable size_t m_hash;
+
+  /** Address of the entry of the string in the atom table, if interned. */
+  const void* m_atom;
+
+  mutable bool m_hash_cached;
+
+  /** Contents of the string in builder mode, empty otherwise. */
+  mutable native_string_rope m_rope;
 };
 
+// -----------------------------------------------------------------------------
+
+inline size_t
+native_string::hash() const
+{
+  flatten();
+
+  if (!m_hash_cached)
+  {
+    return compute_hash();
+  }
+
+  return m_hash;
+}
+
+// -----------------------------------------------------------------------------
+
+inline bool
+native_string::interned() const
+{
+  return m_atom != nullptr;
+}
+
+// -----------------------------------------------------------------------------
+
+inline void
+native_string::drop_caches()
+{
+  m_hash_cached = false;
+  m_atom = nullptr;
+}
+
+// -----------------------------------------------------------------------------
+
+inline void
+native_string::flatten_args()
+{
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T, typename... Arguments>
+inline void
+native_string::flatten_args(const T&, const Arguments&... args)
+{
+  flatten_args(args...);
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename... Arguments>
+inline void
+native_string::flatten_args(const native_string& str,
+  const Arguments&... args)
+{
+  str.flatten();
+  flatten_args(args...);
+}
+
+// -----------------------------------------------------------------------------
+
+inline bool
+native_string::flat() const
+{
+  return m_rope.empty();
+}
+
+// -----------------------------------------------------------------------------
+
+inline void
+native_string::flatten() const
+{
+  if (!m_rope.empty())
+  {
+    flatten_rope();
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+inline native_string::size_type
+native_string::size() const
+{
+  return m_rope.empty() ? native_string_base::size() : m_rope.size();
+}
+
+// -----------------------------------------------------------------------------
+
+inline native_string::size_type
+native_string::length() const
+{
+  return size();
+}
+
+// -----------------------------------------------------------------------------
+
+inline bool
+native_string::empty() const
+{
+  return size() == 0;
+}
+
+// -----------------------------------------------------------------------------
+
+inline const native_string::value_type*
+native_string::c_str() const
+{
+  flatten();
+  return native_string_base::c_str();
+}
+
+// -----------------------------------------------------------------------------
+
+inline const native_string::value_type*
+native_string::data() const
+{
+  flatten();
+  return native_string_base::data();
+}
+
+// -----------------------------------------------------------------------------
+
+inline native_string::reference
+native_string::operator[](size_type n)
+{
+  flatten();
+  drop_caches();
+  return native_string_base::operator[](n);
+}
+
+// -----------------------------------------------------------------------------
+
+inline native_string::const_reference
+native_string::operator[](size_type n) const
+{
+  flatten();
+  return native_string_base::operator[](n);
+}
+
+// -----------------------------------------------------------------------------
+
+inline native_string::iterator
+native_string::begin()
+{
+  flatten();
+  drop_caches();
+  return native_string_base::begin();
+}
+
+// -----------------------------------------------------------------------------
+
+inline native_string::const_iterator
+native_string::begin() const
+{
+  flatten();
+  return native_string_base::begin();
+}
+
+// -----------------------------------------------------------------------------
+
+inline native_string::iterator
+native_string::end()
+{
+  flatten();
+  drop_caches();
+  return native_string_base::end();
+}
+
+// -----------------------------------------------------------------------------
+
+inline native_string::const_iterator
+native_string::end() const
+{
+  flatten();
+  return native_string_base::end();
+}
+
+// -----------------------------------------------------------------------------
+
+inline native_string::const_iterator
+native_string::cbegin() const
+{
+  flatten();
+  return native_string_base::cbegin();
+}
+
+// -----------------------------------------------------------------------------
+
+inline native_string::const_iterator
+native_string::cend() const
+{
+  flatten();
+  return native_string_base::cend();
+}
+
+// -----------------------------------------------------------------------------
+
+inline native_string::reverse_iterator
+native_string::rbegin()
+{
+  flatten();
+  drop_caches();
+  return native_string_base::rbegin();
+}
+
+// -----------------------------------------------------------------------------
+
+inline native_string::const_reverse_iterator
+native_string::rbegin() const
+{
+  flatten();
+  return native_string_base::rbegin();
+}
+
+// -----------------------------------------------------------------------------
+
+inline native_string::reverse_iterator
+native_string::rend()
+{
+  flatten();
+  drop_caches();
+  return native_string_base::rend();
+}
+
+// -----------------------------------------------------------------------------
+
+inline native_string::const_reverse_iterator
+native_string::rend() const
+{
+  flatten();
+  return native_string_base::rend();
+}
+
+// -----------------------------------------------------------------------------
+
+inline native_string::const_reverse_iterator
+native_string::crbegin() const
+{
+  flatten();
+  return native_string_base::crbegin();
+}
+
+// -----------------------------------------------------------------------------
+
+inline native_string::const_reverse_iterator
+native_string::crend() const
+{
+  flatten();
+  return native_string_base::crend();
+}
+
+// -----------------------------------------------------------------------------
+
+inline native_string::reference
+native_string::front()
+{
+  flatten();
+  drop_caches();
+  return native_string_base::front();
+}
+
+// -----------------------------------------------------------------------------
+
+inline native_string::const_reference
+native_string::front() const
+{
+  flatten();
+  return native_string_base::front();
+}
+
+// -----------------------------------------------------------------------------
+
+inline native_string::reference
+native_string::back()
+{
+  flatten();
+  drop_caches();
+  return native_string_base::back();
+}
+
+// -----------------------------------------------------------------------------
+
+inline native_string::const_reference
+native_string::back() const
+{
+  flatten();
+  return native_string_base::back();
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Only takes part in comparisons between two native strings, which it
+ * shortcuts on atoms and cached hashes. Other comparisons are left to the
+ * ones of `native_string_base`.
+ */
+template <typename T>
+inline typename std::enable_if<
+  std::is_same<T, native_string>::value, bool>::type
+operator==(const T& lhs, const T& rhs)
+{
+  if (lhs.m_atom && rhs.m_atom)
+  {
+    return lhs.m_atom == rhs.m_atom;
+  }
+
+  lhs.flatten();
+  rhs.flatten();
+
+  if (lhs.size() != rhs.size())
+  {
+    return false;
+  }
+
+  if (lhs.m_hash_cached && rhs.m_hash_cached && lhs.m_hash != rhs.m_hash)
+  {
+    return false;
+  }
+
+  return static_cast<const native_string_base&>(lhs) ==
+    static_cast<const native_string_base&>(rhs);
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+inline typename std::enable_if<
+  std::is_same<T, native_string>::value, bool>::type
+operator!=(const T& lhs, const T& rhs)
+{
+  return !(lhs == rhs);
+}
+
+// -----------------------------------------------------------------------------
+
 } /* end namespace types */
 } /* end namespace corevm */
 
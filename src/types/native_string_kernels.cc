@@ -0,0 +1,545 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2016 Yanzheng Li
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#include "native_string_kernels.h"
+#include "simd_support.h"
+
+#include "corevm/macros.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#define COREVM_STRING_KERNELS_SSE2 \
+  (COREVM_USE_SIMD_STRING_KERNELS && COREVM_SIMD_SSE2)
+#define COREVM_STRING_KERNELS_AVX2 \
+  (COREVM_USE_SIMD_STRING_KERNELS && COREVM_SIMD_AVX2)
+
+#if COREVM_STRING_KERNELS_SSE2
+  #include <emmintrin.h>
+#endif
+
+#if COREVM_STRING_KERNELS_AVX2
+  #include <immintrin.h>
+#endif
+
+
+namespace corevm {
+namespace types {
+
+// -----------------------------------------------------------------------------
+
+namespace {
+
+// -----------------------------------------------------------------------------
+
+const size_t NPOS = std::string::npos;
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Searches first skip to the occurrences of the first (or last) character
+ * of the needle with `memchr()` (or `memrchr()`), which outpaces the kernels
+ * below while that character is rare in the string. The rest of the search
+ * is left to the kernels once the needle does not match at an occurrence
+ * found less than `MIN_SKIP` characters away, or at `MAX_SKIP_MISSES`
+ * occurrences in all.
+ */
+const size_t MIN_SKIP = 32;
+const size_t MAX_SKIP_MISSES = 16;
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Whether the needle occurs at the specified position, given that its first
+ * and last characters do.
+ */
+inline bool
+matches_at(const char* s, size_t i, const char* needle, size_t m)
+{
+  return m <= 2 || std::memcmp(s + i + 1, needle + 1, m - 2) == 0;
+}
+
+// -----------------------------------------------------------------------------
+
+inline bool
+matches_ends_at(const char* s, size_t i, const char* needle, size_t m)
+{
+  return s[i] == needle[0] && s[i + m - 1] == needle[m - 1];
+}
+
+// -----------------------------------------------------------------------------
+
+inline unsigned int
+highest_bit(unsigned int mask)
+{
+  return 31 - static_cast<unsigned int>(__builtin_clz(mask));
+}
+
+// -----------------------------------------------------------------------------
+
+size_t
+find_scalar(const char* s, size_t begin, size_t last, const char* needle,
+  size_t m)
+{
+  for (size_t i = begin; i <= last; ++i)
+  {
+    if (matches_ends_at(s, i, needle, m) && matches_at(s, i, needle, m))
+    {
+      return i;
+    }
+  }
+
+  return NPOS;
+}
+
+// -----------------------------------------------------------------------------
+
+size_t
+rfind_scalar(const char* s, size_t start, const char* needle, size_t m)
+{
+  for (size_t i = start + 1; i-- > 0;)
+  {
+    if (matches_ends_at(s, i, needle, m) && matches_at(s, i, needle, m))
+    {
+      return i;
+    }
+  }
+
+  return NPOS;
+}
+
+// -----------------------------------------------------------------------------
+
+#if COREVM_STRING_KERNELS_SSE2
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Mask of the 16 positions from `i` on at which the first and the last
+ * characters of the needle both match.
+ */
+inline unsigned int
+candidates_sse2(const char* s, size_t i, size_t m, __m128i first,
+  __m128i last)
+{
+  const __m128i block_first =
+    _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+  const __m128i block_last =
+    _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i + m - 1));
+
+  const __m128i eq = _mm_and_si128(_mm_cmpeq_epi8(first, block_first),
+    _mm_cmpeq_epi8(last, block_last));
+
+  return static_cast<unsigned int>(_mm_movemask_epi8(eq));
+}
+
+// -----------------------------------------------------------------------------
+
+size_t
+find_sse2(const char* s, size_t begin, size_t last, const char* needle,
+  size_t m)
+{
+  const __m128i first = _mm_set1_epi8(needle[0]);
+  const __m128i last_char = _mm_set1_epi8(needle[m - 1]);
+
+  size_t i = begin;
+  for (; i + 16 <= last + 1; i += 16)
+  {
+    unsigned int mask = candidates_sse2(s, i, m, first, last_char);
+
+    while (mask)
+    {
+      const size_t j = i + static_cast<size_t>(__builtin_ctz(mask));
+
+      if (matches_at(s, j, needle, m))
+      {
+        return j;
+      }
+
+      mask &= mask - 1;
+    }
+  }
+
+  return find_scalar(s, i, last, needle, m);
+}
+
+// -----------------------------------------------------------------------------
+
+size_t
+rfind_sse2(const char* s, size_t start, const char* needle, size_t m)
+{
+  const __m128i first = _mm_set1_epi8(needle[0]);
+  const __m128i last_char = _mm_set1_epi8(needle[m - 1]);
+
+  size_t end = start + 1;
+  for (; end >= 16; end -= 16)
+  {
+    const size_t i = end - 16;
+    unsigned int mask = candidates_sse2(s, i, m, first, last_char);
+
+    while (mask)
+    {
+      const unsigned int bit = highest_bit(mask);
+
+      if (matches_at(s, i + bit, needle, m))
+      {
+        return i + bit;
+      }
+
+      mask &= ~(1u << bit);
+    }
+  }
+
+  return end ? rfind_scalar(s, end - 1, needle, m) : NPOS;
+}
+
+// -----------------------------------------------------------------------------
+
+#endif // COREVM_STRING_KERNELS_SSE2
+
+// -----------------------------------------------------------------------------
+
+#if COREVM_STRING_KERNELS_AVX2
+
+// -----------------------------------------------------------------------------
+
+COREVM_AVX2 inline unsigned int
+candidates_avx2(const char* s, size_t i, size_t m, __m256i first,
+  __m256i last)
+{
+  const __m256i block_first =
+    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i));
+  const __m256i block_last =
+    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i + m - 1));
+
+  const __m256i eq = _mm256_and_si256(_mm256_cmpeq_epi8(first, block_first),
+    _mm256_cmpeq_epi8(last, block_last));
+
+  return static_cast<unsigned int>(_mm256_movemask_epi8(eq));
+}
+
+// -----------------------------------------------------------------------------
+
+COREVM_AVX2 size_t
+find_avx2(const char* s, size_t begin, size_t last, const char* needle,
+  size_t m)
+{
+  const __m256i first = _mm256_set1_epi8(needle[0]);
+  const __m256i last_char = _mm256_set1_epi8(needle[m - 1]);
+
+  size_t i = begin;
+
+  // Two blocks are filtered per iteration, as most of them have no
+  // candidates at all.
+  for (; i + 64 <= last + 1; i += 64)
+  {
+    uint64_t mask = candidates_avx2(s, i, m, first, last_char) |
+      static_cast<uint64_t>(candidates_avx2(s, i + 32, m, first, last_char)) <<
+        32;
+
+    while (mask)
+    {
+      const size_t j = i + static_cast<size_t>(__builtin_ctzll(mask));
+
+      if (matches_at(s, j, needle, m))
+      {
+        return j;
+      }
+
+      mask &= mask - 1;
+    }
+  }
+
+  for (; i + 32 <= last + 1; i += 32)
+  {
+    unsigned int mask = candidates_avx2(s, i, m, first, last_char);
+
+    while (mask)
+    {
+      const size_t j = i + static_cast<size_t>(__builtin_ctz(mask));
+
+      if (matches_at(s, j, needle, m))
+      {
+        return j;
+      }
+
+      mask &= mask - 1;
+    }
+  }
+
+  return find_scalar(s, i, last, needle, m);
+}
+
+// -----------------------------------------------------------------------------
+
+COREVM_AVX2 size_t
+rfind_avx2(const char* s, size_t start, const char* needle, size_t m)
+{
+  const __m256i first = _mm256_set1_epi8(needle[0]);
+  const __m256i last_char = _mm256_set1_epi8(needle[m - 1]);
+
+  size_t end = start + 1;
+  for (; end >= 64; end -= 64)
+  {
+    const size_t i = end - 64;
+    uint64_t mask = candidates_avx2(s, i, m, first, last_char) |
+      static_cast<uint64_t>(candidates_avx2(s, i + 32, m, first, last_char)) <<
+        32;
+
+    while (mask)
+    {
+      const unsigned int bit =
+        63 - static_cast<unsigned int>(__builtin_clzll(mask));
+
+      if (matches_at(s, i + bit, needle, m))
+      {
+        return i + bit;
+      }
+
+      mask &= ~(uint64_t(1) << bit);
+    }
+  }
+
+  for (; end >= 32; end -= 32)
+  {
+    const size_t i = end - 32;
+    unsigned int mask = candidates_avx2(s, i, m, first, last_char);
+
+    while (mask)
+    {
+      const unsigned int bit = highest_bit(mask);
+
+      if (matches_at(s, i + bit, needle, m))
+      {
+        return i + bit;
+      }
+
+      mask &= ~(1u << bit);
+    }
+  }
+
+  return end ? rfind_scalar(s, end - 1, needle, m) : NPOS;
+}
+
+// -----------------------------------------------------------------------------
+
+#endif // COREVM_STRING_KERNELS_AVX2
+
+// -----------------------------------------------------------------------------
+
+const StringKernels SCALAR_KERNELS { "scalar", find_scalar, rfind_scalar };
+
+// -----------------------------------------------------------------------------
+
+#if COREVM_STRING_KERNELS_SSE2
+
+const StringKernels SSE2_KERNELS { "sse2", find_sse2, rfind_sse2 };
+
+#endif
+
+// -----------------------------------------------------------------------------
+
+#if COREVM_STRING_KERNELS_AVX2
+
+const StringKernels AVX2_KERNELS { "avx2", find_avx2, rfind_avx2 };
+
+#endif
+
+// -----------------------------------------------------------------------------
+
+const StringKernels&
+kernels()
+{
+  static const StringKernels& KERNELS =
+    select_simd_kernels(string_kernel_tables());
+  return KERNELS;
+}
+
+// -----------------------------------------------------------------------------
+
+} /* end anonymous namespace */
+
+// -----------------------------------------------------------------------------
+
+size_t
+string_find(const char* s, size_t n, const char* needle, size_t m,
+  size_t pos)
+{
+  return string_find(kernels(), s, n, needle, m, pos);
+}
+
+// -----------------------------------------------------------------------------
+
+size_t
+string_rfind(const char* s, size_t n, const char* needle, size_t m,
+  size_t pos)
+{
+  return string_rfind(kernels(), s, n, needle, m, pos);
+}
+
+// -----------------------------------------------------------------------------
+
+size_t
+string_find(const StringKernels& kernels, const char* s, size_t n,
+  const char* needle, size_t m, size_t pos)
+{
+  if (m == 0)
+  {
+    return pos <= n ? pos : NPOS;
+  }
+
+  if (pos > n || m > n - pos)
+  {
+    return NPOS;
+  }
+
+  const size_t last = n - m;
+
+  for (size_t misses = 0; misses < MAX_SKIP_MISSES; ++misses)
+  {
+    const char* p = static_cast<const char*>(
+      std::memchr(s + pos, needle[0], last + 1 - pos));
+
+    if (!p)
+    {
+      return NPOS;
+    }
+
+    const size_t skipped = static_cast<size_t>(p - s) - pos;
+    pos = static_cast<size_t>(p - s);
+
+    if (matches_ends_at(s, pos, needle, m) && matches_at(s, pos, needle, m))
+    {
+      return pos;
+    }
+
+    if (skipped < MIN_SKIP)
+    {
+      break;
+    }
+
+    if (++pos > last)
+    {
+      return NPOS;
+    }
+  }
+
+  return kernels.find(s, pos, last, needle, m);
+}
+
+// -----------------------------------------------------------------------------
+
+size_t
+string_rfind(const StringKernels& kernels, const char* s, size_t n,
+  const char* needle, size_t m, size_t pos)
+{
+  if (m > n)
+  {
+    return NPOS;
+  }
+
+  const size_t start = std::min(n - m, pos);
+
+  if (m == 0)
+  {
+    return start;
+  }
+
+#if defined(__GLIBC__)
+  // `memrchr()` is an extension of glibc. Occurrences of the last character
+  // of the needle are looked for before `end`.
+  size_t end = start + m;
+
+  for (size_t misses = 0; misses < MAX_SKIP_MISSES; ++misses)
+  {
+    const char* p = static_cast<const char*>(
+      memrchr(s + m - 1, needle[m - 1], end - (m - 1)));
+
+    if (!p)
+    {
+      return NPOS;
+    }
+
+    const size_t i = static_cast<size_t>(p - s) - (m - 1);
+
+    if (matches_ends_at(s, i, needle, m) && matches_at(s, i, needle, m))
+    {
+      return i;
+    }
+
+    if (i == 0)
+    {
+      return NPOS;
+    }
+
+    const size_t skipped = end - (i + m);
+    end = i + m - 1;
+
+    if (skipped < MIN_SKIP)
+    {
+      break;
+    }
+  }
+
+  return kernels.rfind(s, end - m, needle, m);
+#else
+  return kernels.rfind(s, start, needle, m);
+#endif
+}
+
+// -----------------------------------------------------------------------------
+
+const SimdKernelTables<StringKernels>&
+string_kernel_tables()
+{
+  static const SimdKernelTables<StringKernels> TABLES {
+    &SCALAR_KERNELS,
+#if COREVM_STRING_KERNELS_SSE2
+    &SSE2_KERNELS,
+#else
+    nullptr,
+#endif
+#if COREVM_STRING_KERNELS_AVX2
+    &AVX2_KERNELS,
+#else
+    nullptr,
+#endif
+  };
+
+  return TABLES;
+}
+
+// -----------------------------------------------------------------------------
+
+const char*
+string_kernels_isa()
+{
+  return kernels().isa;
+}
+
+// -----------------------------------------------------------------------------
+
+} /* end namespace types */
+} /* end namespace corevm */
@@ -0,0 +1,123 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2016 Yanzheng Li
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#ifndef COREVM_NATIVE_STRING_KERNELS_H_
+#define COREVM_NATIVE_STRING_KERNELS_H_
+
+#include "simd_support.h"
+
+#include <cstddef>
+
+
+namespace corevm {
+namespace types {
+
+/**
+ * Kernels of substring search on the characters of native strings.
+ *
+ * Searches skip to the occurrences of an end character of the needle with
+ * `memchr()` while they are rare. Otherwise, candidate positions are
+ * filtered by comparing the first and the last characters of the needle
+ * against blocks of positions at once, and only the positions at which both
+ * match are compared in full. Like the kernels
+ * of native arrays (see `native_array_kernels.h`), they have a scalar
+ * implementation as well as ones with SSE2 and AVX2, selected on first use
+ * by the features of the CPU unless turned off by
+ * `COREVM_USE_SIMD_STRING_KERNELS`.
+ *
+ * Both kernels follow the semantics of their counterparts of `std::string`,
+ * and return `std::string::npos` if there is no match.
+ */
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Position of the first occurrence of the needle of `m` characters in the
+ * string of `n` characters, at or after `pos`.
+ */
+size_t string_find(const char* s, size_t n, const char* needle, size_t m,
+  size_t pos);
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Position of the last occurrence of the needle of `m` characters in the
+ * string of `n` characters, at or before `pos`.
+ */
+size_t string_rfind(const char* s, size_t n, const char* needle, size_t m,
+  size_t pos);
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Name of the instruction set of the kernels in use, i.e. "avx2", "sse2" or
+ * "scalar".
+ */
+const char* string_kernels_isa();
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Implementations of the kernels above for one instruction set.
+ *
+ * They take needles of at least one character. The forward searches look
+ * for matches at positions `begin` through `last`, and the backward ones at
+ * positions `start` down through 0.
+ */
+struct StringKernels
+{
+  const char* isa;
+
+  size_t (*find)(const char* s, size_t begin, size_t last,
+    const char* needle, size_t m);
+
+  size_t (*rfind)(const char* s, size_t start, const char* needle,
+    size_t m);
+};
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Implementations of the kernels for each of the instruction sets they are
+ * compiled for, e.g. to check them against each other.
+ */
+const SimdKernelTables<StringKernels>& string_kernel_tables();
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Same as `string_find()` and `string_rfind()` above, but through the
+ * specified implementation of the kernels.
+ */
+size_t string_find(const StringKernels&, const char* s, size_t n,
+  const char* needle, size_t m, size_t pos);
+
+size_t string_rfind(const StringKernels&, const char* s, size_t n,
+  const char* needle, size_t m, size_t pos);
+
+// -----------------------------------------------------------------------------
+
+} /* end namespace types */
+} /* end namespace corevm */
+
+
+#endif /* COREVM_NATIVE_STRING_KERNELS_H_ */
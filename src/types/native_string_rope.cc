@@ -0,0 +1,712 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2016 Yanzheng Li
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#include "native_string_rope.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+
+namespace corevm {
+namespace types {
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Leaves hold their characters in `leaf`, and have no children. Concatenation
+ * nodes hold the concatenation of their two children.
+ *
+ * Leaves can also be views of the characters of another leaf, from `offset`
+ * on, which they keep a reference to in `source`. The characters of a view
+ * are copied into a leaf of its own before it gets changed.
+ */
+struct native_string_rope::node
+{
+  explicit node(std::string&& str)
+    :
+    refs(1),
+    size(str.size()),
+    leaves(1),
+    depth(0),
+    left(nullptr),
+    right(nullptr),
+    source(nullptr),
+    offset(0),
+    leaf(std::move(str))
+  {
+  }
+
+  node(node* left_, node* right_)
+    :
+    refs(1),
+    size(0),
+    leaves(0),
+    depth(0),
+    left(left_),
+    right(right_),
+    source(nullptr),
+    offset(0),
+    leaf()
+  {
+    update();
+  }
+
+  node(node* source_, size_t offset_, size_t size_)
+    :
+    refs(1),
+    size(size_),
+    leaves(1),
+    depth(0),
+    left(nullptr),
+    right(nullptr),
+    source(source_),
+    offset(offset_),
+    leaf()
+  {
+  }
+
+  bool is_leaf() const
+  {
+    return left == nullptr;
+  }
+
+  bool is_view() const
+  {
+    return source != nullptr;
+  }
+
+  /** Characters of a leaf. */
+  const char* chars() const
+  {
+    return source ? source->leaf.data() + offset : leaf.data();
+  }
+
+  void update()
+  {
+    size = left->size + right->size;
+    leaves = left->leaves + right->leaves;
+    depth = std::max(left->depth, right->depth) + 1;
+  }
+
+  size_t refs;
+  size_t size;
+  size_t leaves;
+  uint32_t depth;
+  node* left;
+  node* right;
+  node* source;
+  size_t offset;
+  std::string leaf;
+};
+
+// -----------------------------------------------------------------------------
+
+namespace {
+
+typedef native_string_rope::node node;
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Depth tolerated over the one of a balanced tree of the same number of
+ * leaves, before the tree gets rebalanced.
+ */
+const uint32_t MAX_EXTRA_DEPTH = 8;
+
+// -----------------------------------------------------------------------------
+
+node*
+retain(node* n)
+{
+  ++n->refs;
+  return n;
+}
+
+// -----------------------------------------------------------------------------
+
+void
+release(node* n)
+{
+  if (n && --n->refs == 0)
+  {
+    release(n->left);
+    release(n->right);
+    release(n->source);
+    delete n;
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+node*
+make_leaf(const char* s, size_t n)
+{
+  return new node(std::string(s, n));
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Returns a view of the specified range of the characters of a leaf. Views
+ * of views refer to the leaf the characters are held in.
+ */
+node*
+make_view(node* n, size_t pos, size_t len)
+{
+  if (pos == 0 && len == n->size)
+  {
+    return retain(n);
+  }
+
+  if (n->is_view())
+  {
+    return new node(retain(n->source), n->offset + pos, len);
+  }
+
+  return new node(retain(n), pos, len);
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Returns a node that is not shared with the contents of the specified one,
+ * taking over the reference to it. Concatenation nodes are copied shallowly,
+ * which leaves their children shared. Leaves are given characters of their
+ * own if they are views.
+ */
+node*
+unshare(node* n)
+{
+  if (n->refs == 1)
+  {
+    if (n->is_view())
+    {
+      n->leaf.assign(n->chars(), n->size);
+      release(n->source);
+      n->source = nullptr;
+      n->offset = 0;
+    }
+
+    return n;
+  }
+
+  node* copy = n->is_leaf() ?
+    new node(std::string(n->chars(), n->size)) :
+    new node(retain(n->left), retain(n->right));
+
+  --n->refs;
+
+  return copy;
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Whether the last leaf can take the specified number of characters, without
+ * copying more than `LEAF_CAPACITY` characters.
+ */
+bool
+can_append_to_last_leaf(const node* n, size_t len)
+{
+  bool shared = false;
+
+  for (;; n = n->right)
+  {
+    shared = shared || n->refs > 1;
+
+    if (n->is_leaf())
+    {
+      break;
+    }
+  }
+
+  // Views are copied before being appended to, like shared leaves.
+  shared = shared || n->is_view();
+
+  return !shared || n->size + len <= native_string_rope::LEAF_CAPACITY;
+}
+
+// -----------------------------------------------------------------------------
+
+node*
+append_to_last_leaf(node* n, const char* s, size_t len)
+{
+  n = unshare(n);
+
+  if (n->is_leaf())
+  {
+    n->leaf.append(s, len);
+    n->size = n->leaf.size();
+  }
+  else
+  {
+    n->right = append_to_last_leaf(n->right, s, len);
+    n->update();
+  }
+
+  return n;
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Adds a leaf to the end of the tree. The right subtree of a node is grown
+ * until it has as many leaves as the left one, like the digits of a binary
+ * counter, which keeps trees built by appending balanced.
+ */
+node*
+push_leaf(node* n, node* leaf)
+{
+  if (!n->is_leaf() && n->right->leaves < n->left->leaves)
+  {
+    n = unshare(n);
+    n->right = push_leaf(n->right, leaf);
+    n->update();
+    return n;
+  }
+
+  return new node(n, leaf);
+}
+
+// -----------------------------------------------------------------------------
+
+node*
+insert_into(node* n, size_t pos, const char* s, size_t len)
+{
+  if (n->is_leaf())
+  {
+    if (n->size + len <= native_string_rope::LEAF_CAPACITY)
+    {
+      n = unshare(n);
+      n->leaf.insert(pos, s, len);
+      n->size = n->leaf.size();
+      return n;
+    }
+
+    if (pos == 0)
+    {
+      return new node(make_leaf(s, len), n);
+    }
+    else if (pos == n->size)
+    {
+      return new node(n, make_leaf(s, len));
+    }
+
+    node* head = make_view(n, 0, pos);
+    node* tail = make_view(n, pos, n->size - pos);
+
+    release(n);
+
+    return new node(new node(head, make_leaf(s, len)), tail);
+  }
+
+  n = unshare(n);
+
+  if (pos <= n->left->size)
+  {
+    n->left = insert_into(n->left, pos, s, len);
+  }
+  else
+  {
+    n->right = insert_into(n->right, pos - n->left->size, s, len);
+  }
+
+  n->update();
+
+  return n;
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Invokes the specified function on the leaves of the tree, in order.
+ */
+template<typename Function>
+void
+for_each_leaf(node* root, Function func)
+{
+  std::vector<node*> stack(1, root);
+
+  while (!stack.empty())
+  {
+    node* n = stack.back();
+    stack.pop_back();
+
+    if (n->is_leaf())
+    {
+      func(n);
+    }
+    else
+    {
+      stack.push_back(n->right);
+      stack.push_back(n->left);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+node*
+build_balanced(node* const* leaves, size_t count)
+{
+  if (count == 1)
+  {
+    return leaves[0];
+  }
+
+  const size_t half = count / 2;
+
+  return new node(
+    build_balanced(leaves, half), build_balanced(leaves + half, count - half));
+}
+
+// -----------------------------------------------------------------------------
+
+uint32_t
+balanced_depth(size_t leaves)
+{
+  uint32_t depth = 0;
+
+  for (size_t i = 1; i < leaves; i <<= 1)
+  {
+    ++depth;
+  }
+
+  return depth;
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Rebuilds the tree balanced once it has grown too deep, merging adjacent
+ * leaves that fit in one along the way. Takes over the reference to the
+ * specified tree.
+ */
+node*
+rebalance(node* root)
+{
+  if (root->depth <= balanced_depth(root->leaves) + MAX_EXTRA_DEPTH)
+  {
+    return root;
+  }
+
+  std::vector<node*> leaves;
+  leaves.reserve(root->leaves);
+
+  for_each_leaf(root, [&leaves](node* leaf) {
+    if (!leaves.empty() &&
+        leaves.back()->size + leaf->size <= native_string_rope::LEAF_CAPACITY)
+    {
+      node* last = unshare(leaves.back());
+      last->leaf.append(leaf->chars(), leaf->size);
+      last->size = last->leaf.size();
+      leaves.back() = last;
+    }
+    else
+    {
+      leaves.push_back(retain(leaf));
+    }
+  });
+
+  release(root);
+
+  return build_balanced(leaves.data(), leaves.size());
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Returns a tree of the specified range of characters of the specified one,
+ * which shares the nodes of the latter that are entirely in the range, and
+ * views the characters of the leaves that are partly in it.
+ */
+node*
+subtree(node* n, size_t pos, size_t len)
+{
+  if (pos == 0 && len == n->size)
+  {
+    return retain(n);
+  }
+
+  if (n->is_leaf())
+  {
+    return make_view(n, pos, len);
+  }
+
+  const size_t left_size = n->left->size;
+
+  if (pos + len <= left_size)
+  {
+    return subtree(n->left, pos, len);
+  }
+  else if (pos >= left_size)
+  {
+    return subtree(n->right, pos - left_size, len);
+  }
+
+  return new node(
+    subtree(n->left, pos, left_size - pos),
+    subtree(n->right, 0, pos + len - left_size));
+}
+
+// -----------------------------------------------------------------------------
+
+} /* end anonymous namespace */
+
+// -----------------------------------------------------------------------------
+
+const size_t native_string_rope::LEAF_CAPACITY;
+
+// -----------------------------------------------------------------------------
+
+native_string_rope::native_string_rope()
+  :
+  m_root(nullptr)
+{
+}
+
+// -----------------------------------------------------------------------------
+
+native_string_rope::native_string_rope(std::string&& str)
+  :
+  m_root(str.empty() ? nullptr : new node(std::move(str)))
+{
+}
+
+// -----------------------------------------------------------------------------
+
+native_string_rope::native_string_rope(const native_string_rope& other)
+  :
+  m_root(other.m_root ? retain(other.m_root) : nullptr)
+{
+}
+
+// -----------------------------------------------------------------------------
+
+native_string_rope::native_string_rope(native_string_rope&& other)
+  :
+  m_root(other.m_root)
+{
+  other.m_root = nullptr;
+}
+
+// -----------------------------------------------------------------------------
+
+native_string_rope&
+native_string_rope::operator=(const native_string_rope& other)
+{
+  if (other.m_root)
+  {
+    retain(other.m_root);
+  }
+
+  release(m_root);
+  m_root = other.m_root;
+
+  return *this;
+}
+
+// -----------------------------------------------------------------------------
+
+native_string_rope&
+native_string_rope::operator=(native_string_rope&& other)
+{
+  if (this != &other)
+  {
+    release(m_root);
+    m_root = other.m_root;
+    other.m_root = nullptr;
+  }
+
+  return *this;
+}
+
+// -----------------------------------------------------------------------------
+
+native_string_rope::~native_string_rope()
+{
+  release(m_root);
+}
+
+// -----------------------------------------------------------------------------
+
+size_t
+native_string_rope::size() const
+{
+  return m_root ? m_root->size : 0;
+}
+
+// -----------------------------------------------------------------------------
+
+uint32_t
+native_string_rope::depth() const
+{
+  return m_root ? m_root->depth : 0;
+}
+
+// -----------------------------------------------------------------------------
+
+const char&
+native_string_rope::at(size_t pos) const
+{
+  const node* n = m_root;
+
+  while (!n->is_leaf())
+  {
+    if (pos < n->left->size)
+    {
+      n = n->left;
+    }
+    else
+    {
+      pos -= n->left->size;
+      n = n->right;
+    }
+  }
+
+  return n->chars()[pos];
+}
+
+// -----------------------------------------------------------------------------
+
+native_string_rope
+native_string_rope::substr(size_t pos, size_t n) const
+{
+  native_string_rope res;
+
+  if (n)
+  {
+    res.m_root = subtree(m_root, pos, n);
+  }
+
+  return res;
+}
+
+// -----------------------------------------------------------------------------
+
+void
+native_string_rope::append(const char* s, size_t n)
+{
+  if (!n)
+  {
+    return;
+  }
+
+  if (!m_root)
+  {
+    m_root = make_leaf(s, n);
+  }
+  else if (can_append_to_last_leaf(m_root, n))
+  {
+    m_root = append_to_last_leaf(m_root, s, n);
+  }
+  else
+  {
+    m_root = rebalance(push_leaf(m_root, make_leaf(s, n)));
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+void
+native_string_rope::insert(size_t pos, const char* s, size_t n)
+{
+  if (pos >= size())
+  {
+    append(s, n);
+  }
+  else if (n)
+  {
+    m_root = rebalance(insert_into(m_root, pos, s, n));
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+void
+native_string_rope::flatten(std::string* str)
+{
+  if (!m_root)
+  {
+    str->clear();
+    return;
+  }
+
+  // The first leaf can be moved into the string if neither it nor any node
+  // on the path to it is shared.
+  node* first = m_root;
+  bool shared = false;
+
+  for (;; first = first->left)
+  {
+    shared = shared || first->refs > 1;
+
+    if (first->is_leaf())
+    {
+      break;
+    }
+  }
+
+  shared = shared || first->is_view();
+
+  if (shared)
+  {
+    str->clear();
+    str->reserve(m_root->size);
+  }
+  else
+  {
+    *str = std::move(first->leaf);
+  }
+
+  for_each_leaf(m_root, [str, first, shared](node* leaf) {
+    if (shared || leaf != first)
+    {
+      str->append(leaf->chars(), leaf->size);
+    }
+  });
+
+  clear();
+}
+
+// -----------------------------------------------------------------------------
+
+void
+native_string_rope::clear()
+{
+  release(m_root);
+  m_root = nullptr;
+}
+
+// -----------------------------------------------------------------------------
+
+void
+native_string_rope::swap(native_string_rope& other)
+{
+  std::swap(m_root, other.m_root);
+}
+
+// -----------------------------------------------------------------------------
+
+} /* end namespace types */
+} /* end namespace corevm */
@@ -0,0 +1,129 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2016 Yanzheng Li
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#ifndef COREVM_NATIVE_STRING_ROPE_H_
+#define COREVM_NATIVE_STRING_ROPE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+
+namespace corevm {
+namespace types {
+
+/**
+ * Rope of characters, which native strings keep their contents in while in
+ * builder mode (see `native_string`).
+ *
+ * The rope is a binary tree whose leaves hold the characters. Appending to
+ * or inserting into the rope only touches the path to the leaf affected, and
+ * copies of a rope share their nodes. Nodes are reference counted, and only
+ * changed in place while not shared; the reference counts are not atomic, so
+ * copies of a rope should not be shared across threads.
+ *
+ * Substrings of a rope share its nodes as well, down to leaves that only
+ * view part of the characters of the ones of the rope.
+ */
+class native_string_rope
+{
+public:
+  /** Node of the tree of a rope, opaque outside of the translation unit. */
+  struct node;
+
+  /** Number of characters that leaves are filled up to by copying them. */
+  static const size_t LEAF_CAPACITY = 512;
+
+  native_string_rope();
+
+  /**
+   * Takes over the specified string as the only leaf of the rope.
+   */
+  explicit native_string_rope(std::string&&);
+
+  native_string_rope(const native_string_rope&);
+
+  native_string_rope(native_string_rope&&);
+
+  native_string_rope& operator=(const native_string_rope&);
+
+  native_string_rope& operator=(native_string_rope&&);
+
+  ~native_string_rope();
+
+  size_t size() const;
+
+  bool empty() const;
+
+  /**
+   * Depth of the tree of the rope, zero for ropes of a single leaf.
+   */
+  uint32_t depth() const;
+
+  /**
+   * Character at the specified position, which must be within the rope.
+   */
+  const char& at(size_t pos) const;
+
+  /**
+   * Returns a rope of the specified range of characters, which must be
+   * within the rope, in time proportional to its depth.
+   */
+  native_string_rope substr(size_t pos, size_t n) const;
+
+  void append(const char* s, size_t n);
+
+  void insert(size_t pos, const char* s, size_t n);
+
+  /**
+   * Assigns the contents of the rope to the specified string, and clears
+   * the rope.
+   *
+   * The first leaf of the rope is moved into the string when not shared,
+   * so flattening a rope that has only been appended to since it was
+   * created out of a string only copies the characters appended.
+   */
+  void flatten(std::string*);
+
+  void clear();
+
+  void swap(native_string_rope&);
+
+private:
+  node* m_root;
+};
+
+// -----------------------------------------------------------------------------
+
+inline bool
+native_string_rope::empty() const
+{
+  return m_root == nullptr;
+}
+
+// -----------------------------------------------------------------------------
+
+} /* end namespace types */
+} /* end namespace corevm */
+
+
+#endif /* COREVM_NATIVE_STRING_ROPE_H_ */
@@ -52,6 +52,47 @@ get_value_ref_from_type_value(NativeTypeValue& type_val)
 
 // -----------------------------------------------------------------------------
 
+/**
+ * Counterpart of `get_value_ref_from_type_value()` that leaves native strings
+ * in builder mode (see `native_string::lazy_append()`), for callers that only
+ * use the members of the values that handle it.
+ */
+template<typename T>
+T&
+get_raw_value_ref_from_type_value(NativeTypeValue& type_val)
+{
+  return type_val.get_raw<T>();
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Read-only counterpart of `get_raw_value_ref_from_type_value()`, which
+ * leaves native strings and arrays that are views unflattened as well (see
+ * `native_string::substr()` and `native_array::slice()`).
+ */
+template<typename T>
+const T&
+get_raw_value_cref_from_type_value(const NativeTypeValue& type_val)
+{
+  return type_val.get_raw<T>();
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Read-only counterpart of `get_value_ref_from_type_value()`, which does not
+ * copy values shared with other native type values.
+ */
+template<typename T>
+const T&
+get_value_cref_from_type_value(const NativeTypeValue& type_val)
+{
+  return type_val.get<T>();
+}
+
+// -----------------------------------------------------------------------------
+
 template<class operator_visitor>
 NativeTypeValue
 apply_unary_visitor(const NativeTypeValue& type_val)
@@ -70,10 +111,15 @@ apply_unary_visitor_parameterized(NativeTypeValue& type_val, Arguments... args)
 
 // -----------------------------------------------------------------------------
 
+/**
+ * Binary operator visitors only read their operands, so they are applied
+ * through const values, which does not copy values shared with other native
+ * type values.
+ */
 template<class operator_visitor>
 NativeTypeValue
 apply_binary_visitor(
-  NativeTypeValue& lhs, NativeTypeValue& rhs)
+  const NativeTypeValue& lhs, const NativeTypeValue& rhs)
 {
   return variant::apply_visitor(operator_visitor(), lhs, rhs);
 }
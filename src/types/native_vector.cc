@@ -0,0 +1,315 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2016 Yanzheng Li
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#include "native_vector.h"
+
+#include "errors.h"
+#include "native_vector_kernels.h"
+#include "corevm/macros.h"
+
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+
+namespace corevm {
+namespace types {
+
+// -----------------------------------------------------------------------------
+
+native_vector::native_vector()
+  :
+  native_vector_base()
+{
+}
+
+// -----------------------------------------------------------------------------
+
+native_vector::native_vector(const native_vector_base& other)
+  :
+  native_vector_base(other)
+{
+}
+
+// -----------------------------------------------------------------------------
+
+native_vector::native_vector(native_vector_base&& other)
+  :
+  native_vector_base(std::forward<native_vector_base>(other))
+{
+}
+
+// -----------------------------------------------------------------------------
+
+native_vector::native_vector(std::initializer_list<value_type> il)
+  :
+  native_vector_base(il)
+{
+}
+
+// -----------------------------------------------------------------------------
+
+native_vector::native_vector(int8_t)
+  :
+  native_vector_base()
+{
+  THROW(ConversionError("int8", "vector"));
+}
+
+// -----------------------------------------------------------------------------
+
+size_t
+native_vector::hash() const
+{
+  std::hash<value_type> element_hash;
+
+  size_t res = size();
+
+  for (const auto& element : *this)
+  {
+    res = res * 31 + element_hash(element);
+  }
+
+  return res;
+}
+
+// -----------------------------------------------------------------------------
+
+native_vector::operator int8_t() const
+{
+  THROW(ConversionError("vector", "int8"));
+}
+
+// -----------------------------------------------------------------------------
+
+native_vector&
+native_vector::operator+() const
+{
+  THROW(InvalidOperatorError("+", "vector"));
+}
+
+// -----------------------------------------------------------------------------
+
+native_vector&
+native_vector::operator-() const
+{
+  THROW(InvalidOperatorError("-", "vector"));
+}
+
+// -----------------------------------------------------------------------------
+
+native_vector&
+native_vector::operator++() const
+{
+  THROW(InvalidOperatorError("++", "vector"));
+}
+
+// -----------------------------------------------------------------------------
+
+native_vector&
+native_vector::operator--() const
+{
+  THROW(InvalidOperatorError("--", "vector"));
+}
+
+// -----------------------------------------------------------------------------
+
+native_vector&
+native_vector::operator!() const
+{
+  THROW(InvalidOperatorError("!", "vector"));
+}
+
+// -----------------------------------------------------------------------------
+
+native_vector&
+native_vector::operator~() const
+{
+  THROW(InvalidOperatorError("~", "vector"));
+}
+
+// -----------------------------------------------------------------------------
+
+native_vector
+native_vector::operator+(const native_vector& other) const
+{
+  check_size(other);
+
+  native_vector res;
+  res.resize(size());
+  vector_add(data(), other.data(), size(), res.data());
+
+  return res;
+}
+
+// -----------------------------------------------------------------------------
+
+native_vector
+native_vector::operator-(const native_vector& other) const
+{
+  check_size(other);
+
+  native_vector res;
+  res.resize(size());
+  vector_sub(data(), other.data(), size(), res.data());
+
+  return res;
+}
+
+// -----------------------------------------------------------------------------
+
+native_vector
+native_vector::operator*(const native_vector& other) const
+{
+  check_size(other);
+
+  native_vector res;
+  res.resize(size());
+  vector_mul(data(), other.data(), size(), res.data());
+
+  return res;
+}
+
+// -----------------------------------------------------------------------------
+
+native_vector
+native_vector::operator/(const native_vector& other) const
+{
+  check_size(other);
+
+  native_vector res;
+  res.resize(size());
+  vector_div(data(), other.data(), size(), res.data());
+
+  return res;
+}
+
+// -----------------------------------------------------------------------------
+
+native_vector&
+native_vector::operator%(const native_vector&) const
+{
+  THROW(InvalidOperatorError("%", "vector"));
+}
+
+// -----------------------------------------------------------------------------
+
+native_vector&
+native_vector::operator&&(const native_vector&) const
+{
+  THROW(InvalidOperatorError("&&", "vector"));
+}
+
+// -----------------------------------------------------------------------------
+
+native_vector&
+native_vector::operator||(const native_vector&) const
+{
+  THROW(InvalidOperatorError("||", "vector"));
+}
+
+// -----------------------------------------------------------------------------
+
+native_vector&
+native_vector::operator&(const native_vector&) const
+{
+  THROW(InvalidOperatorError("&", "vector"));
+}
+
+// -----------------------------------------------------------------------------
+
+native_vector&
+native_vector::operator|(const native_vector&) const
+{
+  THROW(InvalidOperatorError("|", "vector"));
+}
+
+// -----------------------------------------------------------------------------
+
+native_vector&
+native_vector::operator^(const native_vector&) const
+{
+  THROW(InvalidOperatorError("^", "vector"));
+}
+
+// -----------------------------------------------------------------------------
+
+native_vector&
+native_vector::operator<<(const native_vector&) const
+{
+  THROW(InvalidOperatorError("<<", "vector"));
+}
+
+// -----------------------------------------------------------------------------
+
+native_vector&
+native_vector::operator>>(const native_vector&) const
+{
+  THROW(InvalidOperatorError(">>", "vector"));
+}
+
+// -----------------------------------------------------------------------------
+
+native_vector::reference
+native_vector::at(size_type n)
+{
+  try
+  {
+    return native_vector_base::at(n);
+  }
+  catch (const std::out_of_range&)
+  {
+    THROW(OutOfRangeError("Vector index out of range"));
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+native_vector::const_reference
+native_vector::at(size_type n) const
+{
+  try
+  {
+    return native_vector_base::at(n);
+  }
+  catch (const std::out_of_range&)
+  {
+    THROW(OutOfRangeError("Vector index out of range"));
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+void
+native_vector::check_size(const native_vector& other) const
+{
+  if (size() != other.size())
+  {
+    THROW(OutOfRangeError("Vector sizes do not match"));
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+} /* end namespace types */
+} /* end namespace corevm */
@@ -0,0 +1,128 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2016 Yanzheng Li
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#ifndef COREVM_NATIVE_VECTOR_H_
+#define COREVM_NATIVE_VECTOR_H_
+
+#include "errors.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <vector>
+
+
+namespace corevm {
+namespace types {
+
+typedef double native_vector_element_type;
+
+
+using native_vector_base = typename std::vector<native_vector_element_type>;
+
+
+/**
+ * Packed vector of `decimal2` elements.
+ *
+ * Unlike the elements of native arrays, which are integers that often stand
+ * for object IDs, the elements of native vectors are plain numbers, so the
+ * arithmetic operators apply to them element by element, through the
+ * kernels in `native_vector_kernels.h`. Both operands of those operators
+ * must be of the same size.
+ */
+class native_vector : public native_vector_base
+{
+public:
+  native_vector();
+
+  native_vector(const native_vector_base&);
+
+  native_vector(native_vector_base&&);
+
+  native_vector(std::initializer_list<value_type>);
+
+  [[ noreturn ]] /** Avoid compiler warning [-Wmissing-noreturn]. */
+  native_vector(int8_t);
+
+  template <class InputIterator>
+  native_vector(InputIterator first, InputIterator last)
+    :
+    native_vector_base(first, last)
+  {
+  }
+
+  /**
+   * Hash of the elements of the vector, in order.
+   */
+  size_t hash() const;
+
+  operator int8_t() const;
+
+  native_vector& operator+() const;
+
+  native_vector& operator-() const;
+
+  native_vector& operator++() const;
+
+  native_vector& operator--() const;
+
+  native_vector& operator!() const;
+
+  native_vector& operator~() const;
+
+  native_vector operator+(const native_vector&) const;
+
+  native_vector operator-(const native_vector&) const;
+
+  native_vector operator*(const native_vector&) const;
+
+  native_vector operator/(const native_vector&) const;
+
+  native_vector& operator%(const native_vector&) const;
+
+  native_vector& operator&&(const native_vector&) const;
+
+  native_vector& operator||(const native_vector&) const;
+
+  native_vector& operator&(const native_vector&) const;
+
+  native_vector& operator|(const native_vector&) const;
+
+  native_vector& operator^(const native_vector&) const;
+
+  native_vector& operator<<(const native_vector&) const;
+
+  native_vector& operator>>(const native_vector&) const;
+
+  reference at(size_type n);
+
+  const_reference at(size_type n) const;
+
+private:
+  void check_size(const native_vector&) const;
+};
+
+} /* end namespace types */
+} /* end namespace corevm */
+
+
+#endif /* COREVM_NATIVE_VECTOR_H_ */
@@ -0,0 +1,621 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2016 Yanzheng Li
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#include "native_vector_kernels.h"
+#include "simd_support.h"
+
+#include "corevm/macros.h"
+
+#include <cstddef>
+
+#define COREVM_VECTOR_KERNELS_SSE2 \
+  (COREVM_USE_SIMD_VECTOR_KERNELS && COREVM_SIMD_SSE2)
+#define COREVM_VECTOR_KERNELS_AVX2 \
+  (COREVM_USE_SIMD_VECTOR_KERNELS && COREVM_SIMD_AVX2)
+
+#if COREVM_VECTOR_KERNELS_SSE2
+  #include <emmintrin.h>
+#endif
+
+#if COREVM_VECTOR_KERNELS_AVX2
+  #include <immintrin.h>
+#endif
+
+
+namespace corevm {
+namespace types {
+
+// -----------------------------------------------------------------------------
+
+namespace {
+
+// -----------------------------------------------------------------------------
+
+typedef native_vector_element_type element_type;
+
+// -----------------------------------------------------------------------------
+
+const size_t SUM_LANES = 8;
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Element-wise operators, applied by the kernels below to one element, or
+ * to a register of elements, at a time.
+ */
+
+struct add_op
+{
+  static element_type apply(element_type a, element_type b)
+  {
+    return a + b;
+  }
+};
+
+struct sub_op
+{
+  static element_type apply(element_type a, element_type b)
+  {
+    return a - b;
+  }
+};
+
+struct mul_op
+{
+  static element_type apply(element_type a, element_type b)
+  {
+    return a * b;
+  }
+};
+
+struct div_op
+{
+  static element_type apply(element_type a, element_type b)
+  {
+    return a / b;
+  }
+};
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Adds up the lanes of the reductions, in the order that the SIMD
+ * implementations fold their registers in.
+ */
+inline element_type
+fold_lanes(const element_type* lanes)
+{
+  return ((lanes[0] + lanes[4]) + (lanes[2] + lanes[6])) +
+    ((lanes[1] + lanes[5]) + (lanes[3] + lanes[7]));
+}
+
+// -----------------------------------------------------------------------------
+
+template<class Op>
+void
+elementwise_scalar(const element_type* a, const element_type* b, size_t n,
+  element_type* dst)
+{
+  for (size_t i = 0; i < n; ++i)
+  {
+    dst[i] = Op::apply(a[i], b[i]);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+void
+scale_scalar(const element_type* a, size_t n, element_type factor,
+  element_type* dst)
+{
+  for (size_t i = 0; i < n; ++i)
+  {
+    dst[i] = a[i] * factor;
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+element_type
+sum_scalar(const element_type* elements, size_t n)
+{
+  element_type lanes[SUM_LANES] = { 0 };
+
+  size_t i = 0;
+  for (; i + SUM_LANES <= n; i += SUM_LANES)
+  {
+    for (size_t j = 0; j < SUM_LANES; ++j)
+    {
+      lanes[j] += elements[i + j];
+    }
+  }
+
+  element_type res = fold_lanes(lanes);
+
+  for (; i < n; ++i)
+  {
+    res += elements[i];
+  }
+
+  return res;
+}
+
+// -----------------------------------------------------------------------------
+
+element_type
+dot_scalar(const element_type* a, const element_type* b, size_t n)
+{
+  element_type lanes[SUM_LANES] = { 0 };
+
+  size_t i = 0;
+  for (; i + SUM_LANES <= n; i += SUM_LANES)
+  {
+    for (size_t j = 0; j < SUM_LANES; ++j)
+    {
+      lanes[j] += a[i + j] * b[i + j];
+    }
+  }
+
+  element_type res = fold_lanes(lanes);
+
+  for (; i < n; ++i)
+  {
+    res += a[i] * b[i];
+  }
+
+  return res;
+}
+
+// -----------------------------------------------------------------------------
+
+#if COREVM_VECTOR_KERNELS_SSE2
+
+// -----------------------------------------------------------------------------
+
+inline __m128d
+apply_sse2(add_op, __m128d a, __m128d b)
+{
+  return _mm_add_pd(a, b);
+}
+
+inline __m128d
+apply_sse2(sub_op, __m128d a, __m128d b)
+{
+  return _mm_sub_pd(a, b);
+}
+
+inline __m128d
+apply_sse2(mul_op, __m128d a, __m128d b)
+{
+  return _mm_mul_pd(a, b);
+}
+
+inline __m128d
+apply_sse2(div_op, __m128d a, __m128d b)
+{
+  return _mm_div_pd(a, b);
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Folds the four accumulators of two lanes each of the reductions.
+ */
+inline element_type
+fold_sse2(__m128d acc0, __m128d acc1, __m128d acc2, __m128d acc3)
+{
+  const __m128d acc = _mm_add_pd(_mm_add_pd(acc0, acc2),
+    _mm_add_pd(acc1, acc3));
+
+  return _mm_cvtsd_f64(acc) + _mm_cvtsd_f64(_mm_unpackhi_pd(acc, acc));
+}
+
+// -----------------------------------------------------------------------------
+
+template<class Op>
+void
+elementwise_sse2(const element_type* a, const element_type* b, size_t n,
+  element_type* dst)
+{
+  size_t i = 0;
+  for (; i + 2 <= n; i += 2)
+  {
+    _mm_storeu_pd(dst + i,
+      apply_sse2(Op(), _mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+  }
+
+  elementwise_scalar<Op>(a + i, b + i, n - i, dst + i);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+scale_sse2(const element_type* a, size_t n, element_type factor,
+  element_type* dst)
+{
+  const __m128d f = _mm_set1_pd(factor);
+
+  size_t i = 0;
+  for (; i + 2 <= n; i += 2)
+  {
+    _mm_storeu_pd(dst + i, _mm_mul_pd(_mm_loadu_pd(a + i), f));
+  }
+
+  scale_scalar(a + i, n - i, factor, dst + i);
+}
+
+// -----------------------------------------------------------------------------
+
+element_type
+sum_sse2(const element_type* elements, size_t n)
+{
+  __m128d acc0 = _mm_setzero_pd();
+  __m128d acc1 = _mm_setzero_pd();
+  __m128d acc2 = _mm_setzero_pd();
+  __m128d acc3 = _mm_setzero_pd();
+
+  size_t i = 0;
+  for (; i + SUM_LANES <= n; i += SUM_LANES)
+  {
+    acc0 = _mm_add_pd(acc0, _mm_loadu_pd(elements + i));
+    acc1 = _mm_add_pd(acc1, _mm_loadu_pd(elements + i + 2));
+    acc2 = _mm_add_pd(acc2, _mm_loadu_pd(elements + i + 4));
+    acc3 = _mm_add_pd(acc3, _mm_loadu_pd(elements + i + 6));
+  }
+
+  element_type res = fold_sse2(acc0, acc1, acc2, acc3);
+
+  for (; i < n; ++i)
+  {
+    res += elements[i];
+  }
+
+  return res;
+}
+
+// -----------------------------------------------------------------------------
+
+element_type
+dot_sse2(const element_type* a, const element_type* b, size_t n)
+{
+  __m128d acc0 = _mm_setzero_pd();
+  __m128d acc1 = _mm_setzero_pd();
+  __m128d acc2 = _mm_setzero_pd();
+  __m128d acc3 = _mm_setzero_pd();
+
+  size_t i = 0;
+  for (; i + SUM_LANES <= n; i += SUM_LANES)
+  {
+    acc0 = _mm_add_pd(acc0,
+      _mm_mul_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+    acc1 = _mm_add_pd(acc1,
+      _mm_mul_pd(_mm_loadu_pd(a + i + 2), _mm_loadu_pd(b + i + 2)));
+    acc2 = _mm_add_pd(acc2,
+      _mm_mul_pd(_mm_loadu_pd(a + i + 4), _mm_loadu_pd(b + i + 4)));
+    acc3 = _mm_add_pd(acc3,
+      _mm_mul_pd(_mm_loadu_pd(a + i + 6), _mm_loadu_pd(b + i + 6)));
+  }
+
+  element_type res = fold_sse2(acc0, acc1, acc2, acc3);
+
+  for (; i < n; ++i)
+  {
+    res += a[i] * b[i];
+  }
+
+  return res;
+}
+
+// -----------------------------------------------------------------------------
+
+#endif // COREVM_VECTOR_KERNELS_SSE2
+
+// -----------------------------------------------------------------------------
+
+#if COREVM_VECTOR_KERNELS_AVX2
+
+// -----------------------------------------------------------------------------
+
+COREVM_AVX2 inline __m256d
+apply_avx2(add_op, __m256d a, __m256d b)
+{
+  return _mm256_add_pd(a, b);
+}
+
+COREVM_AVX2 inline __m256d
+apply_avx2(sub_op, __m256d a, __m256d b)
+{
+  return _mm256_sub_pd(a, b);
+}
+
+COREVM_AVX2 inline __m256d
+apply_avx2(mul_op, __m256d a, __m256d b)
+{
+  return _mm256_mul_pd(a, b);
+}
+
+COREVM_AVX2 inline __m256d
+apply_avx2(div_op, __m256d a, __m256d b)
+{
+  return _mm256_div_pd(a, b);
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Folds the two accumulators of four lanes each of the reductions.
+ */
+COREVM_AVX2 inline element_type
+fold_avx2(__m256d acc0, __m256d acc1)
+{
+  const __m256d acc = _mm256_add_pd(acc0, acc1);
+  const __m128d half = _mm_add_pd(_mm256_castpd256_pd128(acc),
+    _mm256_extractf128_pd(acc, 1));
+
+  return _mm_cvtsd_f64(half) + _mm_cvtsd_f64(_mm_unpackhi_pd(half, half));
+}
+
+// -----------------------------------------------------------------------------
+
+template<class Op>
+COREVM_AVX2 void
+elementwise_avx2(const element_type* a, const element_type* b, size_t n,
+  element_type* dst)
+{
+  size_t i = 0;
+  for (; i + 8 <= n; i += 8)
+  {
+    const __m256d res0 = apply_avx2(Op(), _mm256_loadu_pd(a + i),
+      _mm256_loadu_pd(b + i));
+    const __m256d res1 = apply_avx2(Op(), _mm256_loadu_pd(a + i + 4),
+      _mm256_loadu_pd(b + i + 4));
+
+    _mm256_storeu_pd(dst + i, res0);
+    _mm256_storeu_pd(dst + i + 4, res1);
+  }
+
+  elementwise_scalar<Op>(a + i, b + i, n - i, dst + i);
+}
+
+// -----------------------------------------------------------------------------
+
+COREVM_AVX2 void
+scale_avx2(const element_type* a, size_t n, element_type factor,
+  element_type* dst)
+{
+  const __m256d f = _mm256_set1_pd(factor);
+
+  size_t i = 0;
+  for (; i + 8 <= n; i += 8)
+  {
+    const __m256d res0 = _mm256_mul_pd(_mm256_loadu_pd(a + i), f);
+    const __m256d res1 = _mm256_mul_pd(_mm256_loadu_pd(a + i + 4), f);
+
+    _mm256_storeu_pd(dst + i, res0);
+    _mm256_storeu_pd(dst + i + 4, res1);
+  }
+
+  scale_scalar(a + i, n - i, factor, dst + i);
+}
+
+// -----------------------------------------------------------------------------
+
+COREVM_AVX2 element_type
+sum_avx2(const element_type* elements, size_t n)
+{
+  __m256d acc0 = _mm256_setzero_pd();
+  __m256d acc1 = _mm256_setzero_pd();
+
+  size_t i = 0;
+  for (; i + SUM_LANES <= n; i += SUM_LANES)
+  {
+    acc0 = _mm256_add_pd(acc0, _mm256_loadu_pd(elements + i));
+    acc1 = _mm256_add_pd(acc1, _mm256_loadu_pd(elements + i + 4));
+  }
+
+  element_type res = fold_avx2(acc0, acc1);
+
+  for (; i < n; ++i)
+  {
+    res += elements[i];
+  }
+
+  return res;
+}
+
+// -----------------------------------------------------------------------------
+
+COREVM_AVX2 element_type
+dot_avx2(const element_type* a, const element_type* b, size_t n)
+{
+  __m256d acc0 = _mm256_setzero_pd();
+  __m256d acc1 = _mm256_setzero_pd();
+
+  size_t i = 0;
+  for (; i + SUM_LANES <= n; i += SUM_LANES)
+  {
+    acc0 = _mm256_add_pd(acc0,
+      _mm256_mul_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i)));
+    acc1 = _mm256_add_pd(acc1,
+      _mm256_mul_pd(_mm256_loadu_pd(a + i + 4), _mm256_loadu_pd(b + i + 4)));
+  }
+
+  element_type res = fold_avx2(acc0, acc1);
+
+  for (; i < n; ++i)
+  {
+    res += a[i] * b[i];
+  }
+
+  return res;
+}
+
+// -----------------------------------------------------------------------------
+
+#endif // COREVM_VECTOR_KERNELS_AVX2
+
+// -----------------------------------------------------------------------------
+
+const VectorKernels SCALAR_KERNELS {
+  "scalar", elementwise_scalar<add_op>, elementwise_scalar<sub_op>,
+  elementwise_scalar<mul_op>, elementwise_scalar<div_op>, scale_scalar,
+  sum_scalar, dot_scalar
+};
+
+// -----------------------------------------------------------------------------
+
+#if COREVM_VECTOR_KERNELS_SSE2
+
+const VectorKernels SSE2_KERNELS {
+  "sse2", elementwise_sse2<add_op>, elementwise_sse2<sub_op>,
+  elementwise_sse2<mul_op>, elementwise_sse2<div_op>, scale_sse2, sum_sse2,
+  dot_sse2
+};
+
+#endif
+
+// -----------------------------------------------------------------------------
+
+#if COREVM_VECTOR_KERNELS_AVX2
+
+const VectorKernels AVX2_KERNELS {
+  "avx2", elementwise_avx2<add_op>, elementwise_avx2<sub_op>,
+  elementwise_avx2<mul_op>, elementwise_avx2<div_op>, scale_avx2, sum_avx2,
+  dot_avx2
+};
+
+#endif
+
+// -----------------------------------------------------------------------------
+
+const VectorKernels&
+kernels()
+{
+  static const VectorKernels& KERNELS =
+    select_simd_kernels(vector_kernel_tables());
+  return KERNELS;
+}
+
+// -----------------------------------------------------------------------------
+
+} /* end anonymous namespace */
+
+// -----------------------------------------------------------------------------
+
+const SimdKernelTables<VectorKernels>&
+vector_kernel_tables()
+{
+  static const SimdKernelTables<VectorKernels> TABLES {
+    &SCALAR_KERNELS,
+#if COREVM_VECTOR_KERNELS_SSE2
+    &SSE2_KERNELS,
+#else
+    nullptr,
+#endif
+#if COREVM_VECTOR_KERNELS_AVX2
+    &AVX2_KERNELS,
+#else
+    nullptr,
+#endif
+  };
+
+  return TABLES;
+}
+
+// -----------------------------------------------------------------------------
+
+void
+vector_add(const native_vector_element_type* a,
+  const native_vector_element_type* b, size_t n,
+  native_vector_element_type* dst)
+{
+  kernels().add(a, b, n, dst);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+vector_sub(const native_vector_element_type* a,
+  const native_vector_element_type* b, size_t n,
+  native_vector_element_type* dst)
+{
+  kernels().sub(a, b, n, dst);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+vector_mul(const native_vector_element_type* a,
+  const native_vector_element_type* b, size_t n,
+  native_vector_element_type* dst)
+{
+  kernels().mul(a, b, n, dst);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+vector_div(const native_vector_element_type* a,
+  const native_vector_element_type* b, size_t n,
+  native_vector_element_type* dst)
+{
+  kernels().div(a, b, n, dst);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+vector_scale(const native_vector_element_type* a, size_t n,
+  native_vector_element_type factor, native_vector_element_type* dst)
+{
+  kernels().scale(a, n, factor, dst);
+}
+
+// -----------------------------------------------------------------------------
+
+native_vector_element_type
+vector_sum(const native_vector_element_type* elements, size_t n)
+{
+  return kernels().sum(elements, n);
+}
+
+// -----------------------------------------------------------------------------
+
+native_vector_element_type
+vector_dot(const native_vector_element_type* a,
+  const native_vector_element_type* b, size_t n)
+{
+  return kernels().dot(a, b, n);
+}
+
+// -----------------------------------------------------------------------------
+
+const char*
+vector_kernels_isa()
+{
+  return kernels().isa;
+}
+
+// -----------------------------------------------------------------------------
+
+} /* end namespace types */
+} /* end namespace corevm */
@@ -0,0 +1,151 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2016 Yanzheng Li
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#ifndef COREVM_NATIVE_VECTOR_KERNELS_H_
+#define COREVM_NATIVE_VECTOR_KERNELS_H_
+
+#include "native_vector.h"
+#include "simd_support.h"
+
+#include <cstddef>
+
+
+namespace corevm {
+namespace types {
+
+/**
+ * Kernels of element-wise arithmetic and reductions on the elements of
+ * native vectors.
+ *
+ * Each kernel has a scalar implementation, as well as ones with SSE2 and
+ * AVX2 where available. The implementations to use are selected on first use
+ * by the features of the CPU, unless turned off by
+ * `COREVM_USE_SIMD_VECTOR_KERNELS`.
+ *
+ * The element-wise kernels write their results into the buffer starting at
+ * `dst`, which holds `n` elements and may be one of the operands.
+ */
+
+// -----------------------------------------------------------------------------
+
+void vector_add(const native_vector_element_type*,
+  const native_vector_element_type*, size_t n, native_vector_element_type* dst);
+
+// -----------------------------------------------------------------------------
+
+void vector_sub(const native_vector_element_type*,
+  const native_vector_element_type*, size_t n, native_vector_element_type* dst);
+
+// -----------------------------------------------------------------------------
+
+void vector_mul(const native_vector_element_type*,
+  const native_vector_element_type*, size_t n, native_vector_element_type* dst);
+
+// -----------------------------------------------------------------------------
+
+void vector_div(const native_vector_element_type*,
+  const native_vector_element_type*, size_t n, native_vector_element_type* dst);
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Multiplies each of the elements by the specified factor.
+ */
+void vector_scale(const native_vector_element_type*, size_t n,
+  native_vector_element_type factor, native_vector_element_type* dst);
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Sum of the elements.
+ *
+ * Elements are summed in 8 interleaved lanes, which are then added up in the
+ * same order by every implementation, followed by the elements left over.
+ */
+native_vector_element_type vector_sum(const native_vector_element_type*,
+  size_t n);
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Dot product of two sequences of `n` elements, summed in the same order as
+ * `vector_sum()`.
+ */
+native_vector_element_type vector_dot(const native_vector_element_type*,
+  const native_vector_element_type*, size_t n);
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Name of the instruction set of the kernels in use, i.e. "avx2", "sse2" or
+ * "scalar".
+ */
+const char* vector_kernels_isa();
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Implementations of the kernels above for one instruction set. All of them
+ * give bit-identical results, since they apply the same operations to each
+ * element and sum reductions in the same order.
+ */
+struct VectorKernels
+{
+  const char* isa;
+
+  void (*add)(const native_vector_element_type*,
+    const native_vector_element_type*, size_t, native_vector_element_type*);
+
+  void (*sub)(const native_vector_element_type*,
+    const native_vector_element_type*, size_t, native_vector_element_type*);
+
+  void (*mul)(const native_vector_element_type*,
+    const native_vector_element_type*, size_t, native_vector_element_type*);
+
+  void (*div)(const native_vector_element_type*,
+    const native_vector_element_type*, size_t, native_vector_element_type*);
+
+  void (*scale)(const native_vector_element_type*, size_t,
+    native_vector_element_type, native_vector_element_type*);
+
+  native_vector_element_type (*sum)(const native_vector_element_type*,
+    size_t);
+
+  native_vector_element_type (*dot)(const native_vector_element_type*,
+    const native_vector_element_type*, size_t);
+};
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Implementations of the kernels for each of the instruction sets they are
+ * compiled for, e.g. to check them against each other.
+ */
+const SimdKernelTables<VectorKernels>& vector_kernel_tables();
+
+// -----------------------------------------------------------------------------
+
+} /* end namespace types */
+} /* end namespace corevm */
+
+
+#endif /* COREVM_NATIVE_VECTOR_KERNELS_H_ */
@@ -0,0 +1,679 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2016 Yanzheng Li
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#include "number_format.h"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+
+namespace corevm {
+namespace types {
+
+// -----------------------------------------------------------------------------
+
+namespace {
+
+// -----------------------------------------------------------------------------
+
+const char DIGIT_PAIRS[] =
+  "00010203040506070809"
+  "10111213141516171819"
+  "20212223242526272829"
+  "30313233343536373839"
+  "40414243444546474849"
+  "50515253545556575859"
+  "60616263646566676869"
+  "70717273747576777879"
+  "80818283848586878889"
+  "90919293949596979899";
+
+// -----------------------------------------------------------------------------
+
+uint32_t
+count_digits(uint64_t value)
+{
+  uint32_t n = 1;
+
+  for (;;)
+  {
+    if (value < 10) return n;
+    if (value < 100) return n + 1;
+    if (value < 1000) return n + 2;
+    if (value < 10000) return n + 3;
+
+    value /= 10000;
+    n += 4;
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Writes out the digits of the specified value, two at a time from the last
+ * ones.
+ */
+char*
+write_digits(char* buf, uint64_t value)
+{
+  char* end = buf + count_digits(value);
+  char* p = end;
+
+  while (value >= 100)
+  {
+    const size_t i = static_cast<size_t>(value % 100) * 2;
+    value /= 100;
+    *--p = DIGIT_PAIRS[i + 1];
+    *--p = DIGIT_PAIRS[i];
+  }
+
+  if (value >= 10)
+  {
+    const size_t i = static_cast<size_t>(value) * 2;
+    *--p = DIGIT_PAIRS[i + 1];
+    *--p = DIGIT_PAIRS[i];
+  }
+  else
+  {
+    *--p = static_cast<char>('0' + value);
+  }
+
+  return end;
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Floating point numbers are formatted with the Grisu2 algorithm, from
+ * "Printing Floating-Point Numbers Quickly and Accurately with Integers" by
+ * Florian Loitsch. It looks for the shortest digits within the range of
+ * numbers that round to the value being formatted, with 64 bit integer
+ * arithmetic on approximations of the bounds of the range. The
+ * approximations only err on the safe side, so the digits always parse back
+ * into the same value. They are not the shortest ones for a small fraction
+ * of values, which Grisu3 or Ryu would be needed for.
+ */
+
+/**
+ * Unpacked floating point number, of value `f * 2^e`.
+ */
+struct diy_fp
+{
+  diy_fp(uint64_t f_, int e_)
+    :
+    f(f_),
+    e(e_)
+  {
+  }
+
+  uint64_t f;
+  int e;
+};
+
+// -----------------------------------------------------------------------------
+
+diy_fp
+diy_fp_sub(const diy_fp& x, const diy_fp& y)
+{
+  return diy_fp(x.f - y.f, x.e);
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Product of the two numbers, with the significand rounded to its upper
+ * 64 bits.
+ */
+diy_fp
+diy_fp_mul(const diy_fp& x, const diy_fp& y)
+{
+  const uint64_t x_lo = x.f & 0xFFFFFFFFu;
+  const uint64_t x_hi = x.f >> 32;
+  const uint64_t y_lo = y.f & 0xFFFFFFFFu;
+  const uint64_t y_hi = y.f >> 32;
+
+  const uint64_t p0 = x_lo * y_lo;
+  const uint64_t p1 = x_lo * y_hi;
+  const uint64_t p2 = x_hi * y_lo;
+  const uint64_t p3 = x_hi * y_hi;
+
+  uint64_t mid = (p0 >> 32) + (p1 & 0xFFFFFFFFu) + (p2 & 0xFFFFFFFFu);
+  mid += uint64_t(1) << 31;
+
+  return diy_fp(p3 + (p1 >> 32) + (p2 >> 32) + (mid >> 32), x.e + y.e + 64);
+}
+
+// -----------------------------------------------------------------------------
+
+diy_fp
+diy_fp_normalize(diy_fp x)
+{
+  while ((x.f >> 63) == 0)
+  {
+    x.f <<= 1;
+    --x.e;
+  }
+
+  return x;
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * The value to format, and the bounds of the range of numbers that round to
+ * it, with normalized significands. The bounds share the same exponent.
+ */
+struct boundaries
+{
+  boundaries(const diy_fp& w_, const diy_fp& minus_, const diy_fp& plus_)
+    :
+    w(w_),
+    minus(minus_),
+    plus(plus_)
+  {
+  }
+
+  diy_fp w;
+  diy_fp minus;
+  diy_fp plus;
+};
+
+// -----------------------------------------------------------------------------
+
+template<typename FloatType, typename BitsType>
+boundaries
+compute_boundaries(FloatType value)
+{
+  const int precision = std::numeric_limits<FloatType>::digits;
+  const int bias =
+    std::numeric_limits<FloatType>::max_exponent - 1 + (precision - 1);
+  const int min_exp = 1 - bias;
+  const uint64_t hidden_bit = uint64_t(1) << (precision - 1);
+
+  BitsType bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+
+  const uint64_t biased_exp = static_cast<uint64_t>(bits) >> (precision - 1);
+  const uint64_t fraction = static_cast<uint64_t>(bits) & (hidden_bit - 1);
+
+  const diy_fp v = biased_exp == 0 ?
+    diy_fp(fraction, min_exp) :
+    diy_fp(fraction + hidden_bit, static_cast<int>(biased_exp) - bias);
+
+  // The gap below powers of two is half the one above them, except for the
+  // smallest normalized number.
+  const bool lower_boundary_is_closer = fraction == 0 && biased_exp > 1;
+
+  const diy_fp m_plus(2 * v.f + 1, v.e - 1);
+  const diy_fp m_minus = lower_boundary_is_closer ?
+    diy_fp(4 * v.f - 1, v.e - 2) :
+    diy_fp(2 * v.f - 1, v.e - 1);
+
+  const diy_fp w_plus = diy_fp_normalize(m_plus);
+  const diy_fp w_minus(m_minus.f << (m_minus.e - w_plus.e), w_plus.e);
+
+  return boundaries(diy_fp_normalize(v), w_minus, w_plus);
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Positions of the decimal point relative to the first digit of numbers
+ * formatted in fixed notation.
+ */
+const int FIXED_NOTATION_MIN_EXP = -4;
+const int FIXED_NOTATION_MAX_EXP = 16;
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Range of binary exponents that scaled values are brought into, in which
+ * their integral parts fit in 32 bits.
+ */
+const int ALPHA = -60;
+const int GAMMA = -32;
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Normalized approximation of `10^k`, of value `f * 2^e`.
+ */
+struct cached_power
+{
+  uint64_t f;
+  int e;
+  int k;
+};
+
+// -----------------------------------------------------------------------------
+
+const int CACHED_POWERS_MIN_DEC_EXP = -300;
+const int CACHED_POWERS_DEC_STEP = 8;
+
+const cached_power CACHED_POWERS[] = {
+  { UINT64_C(0xAB70FE17C79AC6CA), -1060, -300 },
+  { UINT64_C(0xFF77B1FCBEBCDC4F), -1034, -292 },
+  { UINT64_C(0xBE5691EF416BD60C), -1007, -284 },
+  { UINT64_C(0x8DD01FAD907FFC3C),  -980, -276 },
+  { UINT64_C(0xD3515C2831559A83),  -954, -268 },
+  { UINT64_C(0x9D71AC8FADA6C9B5),  -927, -260 },
+  { UINT64_C(0xEA9C227723EE8BCB),  -901, -252 },
+  { UINT64_C(0xAECC49914078536D),  -874, -244 },
+  { UINT64_C(0x823C12795DB6CE57),  -847, -236 },
+  { UINT64_C(0xC21094364DFB5637),  -821, -228 },
+  { UINT64_C(0x9096EA6F3848984F),  -794, -220 },
+  { UINT64_C(0xD77485CB25823AC7),  -768, -212 },
+  { UINT64_C(0xA086CFCD97BF97F4),  -741, -204 },
+  { UINT64_C(0xEF340A98172AACE5),  -715, -196 },
+  { UINT64_C(0xB23867FB2A35B28E),  -688, -188 },
+  { UINT64_C(0x84C8D4DFD2C63F3B),  -661, -180 },
+  { UINT64_C(0xC5DD44271AD3CDBA),  -635, -172 },
+  { UINT64_C(0x936B9FCEBB25C996),  -608, -164 },
+  { UINT64_C(0xDBAC6C247D62A584),  -582, -156 },
+  { UINT64_C(0xA3AB66580D5FDAF6),  -555, -148 },
+  { UINT64_C(0xF3E2F893DEC3F126),  -529, -140 },
+  { UINT64_C(0xB5B5ADA8AAFF80B8),  -502, -132 },
+  { UINT64_C(0x87625F056C7C4A8B),  -475, -124 },
+  { UINT64_C(0xC9BCFF6034C13053),  -449, -116 },
+  { UINT64_C(0x964E858C91BA2655),  -422, -108 },
+  { UINT64_C(0xDFF9772470297EBD),  -396, -100 },
+  { UINT64_C(0xA6DFBD9FB8E5B88F),  -369,  -92 },
+  { UINT64_C(0xF8A95FCF88747D94),  -343,  -84 },
+  { UINT64_C(0xB94470938FA89BCF),  -316,  -76 },
+  { UINT64_C(0x8A08F0F8BF0F156B),  -289,  -68 },
+  { UINT64_C(0xCDB02555653131B6),  -263,  -60 },
+  { UINT64_C(0x993FE2C6D07B7FAC),  -236,  -52 },
+  { UINT64_C(0xE45C10C42A2B3B06),  -210,  -44 },
+  { UINT64_C(0xAA242499697392D3),  -183,  -36 },
+  { UINT64_C(0xFD87B5F28300CA0E),  -157,  -28 },
+  { UINT64_C(0xBCE5086492111AEB),  -130,  -20 },
+  { UINT64_C(0x8CBCCC096F5088CC),  -103,  -12 },
+  { UINT64_C(0xD1B71758E219652C),   -77,   -4 },
+  { UINT64_C(0x9C40000000000000),   -50,    4 },
+  { UINT64_C(0xE8D4A51000000000),   -24,   12 },
+  { UINT64_C(0xAD78EBC5AC620000),     3,   20 },
+  { UINT64_C(0x813F3978F8940984),    30,   28 },
+  { UINT64_C(0xC097CE7BC90715B3),    56,   36 },
+  { UINT64_C(0x8F7E32CE7BEA5C70),    83,   44 },
+  { UINT64_C(0xD5D238A4ABE98068),   109,   52 },
+  { UINT64_C(0x9F4F2726179A2245),   136,   60 },
+  { UINT64_C(0xED63A231D4C4FB27),   162,   68 },
+  { UINT64_C(0xB0DE65388CC8ADA8),   189,   76 },
+  { UINT64_C(0x83C7088E1AAB65DB),   216,   84 },
+  { UINT64_C(0xC45D1DF942711D9A),   242,   92 },
+  { UINT64_C(0x924D692CA61BE758),   269,  100 },
+  { UINT64_C(0xDA01EE641A708DEA),   295,  108 },
+  { UINT64_C(0xA26DA3999AEF774A),   322,  116 },
+  { UINT64_C(0xF209787BB47D6B85),   348,  124 },
+  { UINT64_C(0xB454E4A179DD1877),   375,  132 },
+  { UINT64_C(0x865B86925B9BC5C2),   402,  140 },
+  { UINT64_C(0xC83553C5C8965D3D),   428,  148 },
+  { UINT64_C(0x952AB45CFA97A0B3),   455,  156 },
+  { UINT64_C(0xDE469FBD99A05FE3),   481,  164 },
+  { UINT64_C(0xA59BC234DB398C25),   508,  172 },
+  { UINT64_C(0xF6C69A72A3989F5C),   534,  180 },
+  { UINT64_C(0xB7DCBF5354E9BECE),   561,  188 },
+  { UINT64_C(0x88FCF317F22241E2),   588,  196 },
+  { UINT64_C(0xCC20CE9BD35C78A5),   614,  204 },
+  { UINT64_C(0x98165AF37B2153DF),   641,  212 },
+  { UINT64_C(0xE2A0B5DC971F303A),   667,  220 },
+  { UINT64_C(0xA8D9D1535CE3B396),   694,  228 },
+  { UINT64_C(0xFB9B7CD9A4A7443C),   720,  236 },
+  { UINT64_C(0xBB764C4CA7A44410),   747,  244 },
+  { UINT64_C(0x8BAB8EEFB6409C1A),   774,  252 },
+  { UINT64_C(0xD01FEF10A657842C),   800,  260 },
+  { UINT64_C(0x9B10A4E5E9913129),   827,  268 },
+  { UINT64_C(0xE7109BFBA19C0C9D),   853,  276 },
+  { UINT64_C(0xAC2820D9623BF429),   880,  284 },
+  { UINT64_C(0x80444B5E7AA7CF85),   907,  292 },
+  { UINT64_C(0xBF21E44003ACDD2D),   933,  300 },
+  { UINT64_C(0x8E679C2F5E44FF8F),   960,  308 },
+  { UINT64_C(0xD433179D9C8CB841),   986,  316 },
+  { UINT64_C(0x9E19DB92B4E31BA9),  1013,  324 },
+};
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Returns a power of ten `c` such that the product of `c` and any normalized
+ * number of binary exponent `e` has its exponent in [ALPHA, GAMMA].
+ */
+const cached_power&
+get_cached_power_for_binary_exponent(int e)
+{
+  // ceil((ALPHA - e - 1) * log10(2)), with 78913 / 2^18 for log10(2).
+  const int f = ALPHA - e - 1;
+  const int k = (f * 78913) / (1 << 18) + static_cast<int>(f > 0);
+
+  const int index = (-CACHED_POWERS_MIN_DEC_EXP + k +
+    (CACHED_POWERS_DEC_STEP - 1)) / CACHED_POWERS_DEC_STEP;
+
+  return CACHED_POWERS[index];
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Returns the number of digits of `n`, and sets `pow10` to the largest power
+ * of ten not greater than `n`.
+ */
+int
+find_largest_pow10(uint32_t n, uint32_t& pow10)
+{
+  if (n >= 1000000000) { pow10 = 1000000000; return 10; }
+  if (n >= 100000000) { pow10 = 100000000; return 9; }
+  if (n >= 10000000) { pow10 = 10000000; return 8; }
+  if (n >= 1000000) { pow10 = 1000000; return 7; }
+  if (n >= 100000) { pow10 = 100000; return 6; }
+  if (n >= 10000) { pow10 = 10000; return 5; }
+  if (n >= 1000) { pow10 = 1000; return 4; }
+  if (n >= 100) { pow10 = 100; return 3; }
+  if (n >= 10) { pow10 = 10; return 2; }
+
+  pow10 = 1;
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Moves the last digit generated towards the scaled value `dist`, while the
+ * digits stay within the range of width `delta`.
+ */
+void
+grisu2_round(char* buf, int len, uint64_t dist, uint64_t delta,
+  uint64_t rest, uint64_t ten_k)
+{
+  while (rest < dist && delta - rest >= ten_k &&
+    (rest + ten_k < dist || dist - rest > rest + ten_k - dist))
+  {
+    --buf[len - 1];
+    rest += ten_k;
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Generates the shortest digits within the approximate range
+ * [`m_minus`, `m_plus`], closest to `w`. The value of the digits is `buf * 10^decimal_exponent`.
+ */
+void
+grisu2_digit_gen(char* buf, int& len, int& decimal_exponent,
+  const diy_fp& m_minus, const diy_fp& w, const diy_fp& m_plus)
+{
+  uint64_t delta = diy_fp_sub(m_plus, m_minus).f;
+  uint64_t dist = diy_fp_sub(m_plus, w).f;
+
+  // Splits `m_plus` into its integral part `p1` and fractional part `p2`.
+  const diy_fp one(uint64_t(1) << -m_plus.e, m_plus.e);
+
+  uint32_t p1 = static_cast<uint32_t>(m_plus.f >> -one.e);
+  uint64_t p2 = m_plus.f & (one.f - 1);
+
+  uint32_t pow10 = 0;
+  int n = find_largest_pow10(p1, pow10);
+
+  while (n > 0)
+  {
+    const uint32_t d = p1 / pow10;
+    p1 %= pow10;
+
+    buf[len++] = static_cast<char>('0' + d);
+    --n;
+
+    const uint64_t rest = (static_cast<uint64_t>(p1) << -one.e) + p2;
+
+    if (rest <= delta)
+    {
+      decimal_exponent += n;
+      grisu2_round(buf, len, dist, delta, rest,
+        static_cast<uint64_t>(pow10) << -one.e);
+      return;
+    }
+
+    pow10 /= 10;
+  }
+
+  int m = 0;
+
+  for (;;)
+  {
+    p2 *= 10;
+    const uint64_t d = p2 >> -one.e;
+    p2 &= one.f - 1;
+
+    buf[len++] = static_cast<char>('0' + d);
+    ++m;
+
+    delta *= 10;
+    dist *= 10;
+
+    if (p2 <= delta)
+    {
+      break;
+    }
+  }
+
+  decimal_exponent -= m;
+  grisu2_round(buf, len, dist, delta, p2, one.f);
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Writes out the digits of the specified positive value, usually the
+ * shortest ones, and returns their number. The value of the digits is
+ * `buf * 10^decimal_exponent`.
+ */
+template<typename FloatType, typename BitsType>
+int
+grisu2(char* buf, int& decimal_exponent, FloatType value)
+{
+  const boundaries b = compute_boundaries<FloatType, BitsType>(value);
+
+  const cached_power& cached = get_cached_power_for_binary_exponent(b.plus.e);
+  const diy_fp c(cached.f, cached.e);
+
+  const diy_fp w = diy_fp_mul(b.w, c);
+  const diy_fp w_minus = diy_fp_mul(b.minus, c);
+  const diy_fp w_plus = diy_fp_mul(b.plus, c);
+
+  // Narrows the range by the error of the products, so that all digits in
+  // it are within the exact range.
+  const diy_fp m_minus(w_minus.f + 1, w_minus.e);
+  const diy_fp m_plus(w_plus.f - 1, w_plus.e);
+
+  int len = 0;
+  decimal_exponent = -cached.k;
+
+  grisu2_digit_gen(buf, len, decimal_exponent, m_minus, w, m_plus);
+
+  return len;
+}
+
+// -----------------------------------------------------------------------------
+
+char*
+write_exponent(char* buf, int e)
+{
+  if (e < 0)
+  {
+    e = -e;
+    *buf++ = '-';
+  }
+  else
+  {
+    *buf++ = '+';
+  }
+
+  if (e < 10)
+  {
+    *buf++ = '0';
+  }
+
+  return write_digits(buf, static_cast<uint64_t>(e));
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Lays out the `len` digits in `buf`, of value `buf * 10^decimal_exponent`,
+ * in fixed notation if their decimal point falls within
+ * (`min_exp`, `max_exp`], and in scientific notation otherwise.
+ */
+char*
+format_digits(char* buf, int len, int decimal_exponent, int min_exp,
+  int max_exp)
+{
+  // Position of the decimal point relative to the first digit.
+  const int n = len + decimal_exponent;
+
+  if (len <= n && n <= max_exp)
+  {
+    // digits[000].0
+    std::memset(buf + len, '0', static_cast<size_t>(n - len));
+    buf[n] = '.';
+    buf[n + 1] = '0';
+    return buf + n + 2;
+  }
+
+  if (0 < n && n <= max_exp)
+  {
+    // dig.its
+    std::memmove(buf + n + 1, buf + n, static_cast<size_t>(len - n));
+    buf[n] = '.';
+    return buf + len + 1;
+  }
+
+  if (min_exp < n && n <= 0)
+  {
+    // 0.[000]digits
+    std::memmove(buf + 2 - n, buf, static_cast<size_t>(len));
+    buf[0] = '0';
+    buf[1] = '.';
+    std::memset(buf + 2, '0', static_cast<size_t>(-n));
+    return buf + 2 - n + len;
+  }
+
+  if (len == 1)
+  {
+    // de+00
+    buf += 1;
+  }
+  else
+  {
+    // d.igitse+00
+    std::memmove(buf + 2, buf + 1, static_cast<size_t>(len - 1));
+    buf[1] = '.';
+    buf += len + 1;
+  }
+
+  *buf++ = 'e';
+
+  return write_exponent(buf, n - 1);
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename FloatType, typename BitsType>
+char*
+format_floating_point(char* buf, FloatType value)
+{
+  if (value != value)
+  {
+    std::memcpy(buf, "nan", 3);
+    return buf + 3;
+  }
+
+  if (std::signbit(value))
+  {
+    value = -value;
+    *buf++ = '-';
+  }
+
+  if (value == std::numeric_limits<FloatType>::infinity())
+  {
+    std::memcpy(buf, "inf", 3);
+    return buf + 3;
+  }
+
+  if (value == 0)
+  {
+    std::memcpy(buf, "0.0", 3);
+    return buf + 3;
+  }
+
+  int decimal_exponent = 0;
+  const int len = grisu2<FloatType, BitsType>(buf, decimal_exponent, value);
+
+  return format_digits(buf, len, decimal_exponent, FIXED_NOTATION_MIN_EXP,
+    FIXED_NOTATION_MAX_EXP);
+}
+
+// -----------------------------------------------------------------------------
+
+} /* end anonymous namespace */
+
+// -----------------------------------------------------------------------------
+
+char*
+format_integer(char* buf, int64_t value)
+{
+  if (value < 0)
+  {
+    *buf++ = '-';
+    return write_digits(buf, 0 - static_cast<uint64_t>(value));
+  }
+
+  return write_digits(buf, static_cast<uint64_t>(value));
+}
+
+// -----------------------------------------------------------------------------
+
+char*
+format_integer(char* buf, uint64_t value)
+{
+  return write_digits(buf, value);
+}
+
+// -----------------------------------------------------------------------------
+
+char*
+format_decimal(char* buf, float value)
+{
+  return format_floating_point<float, uint32_t>(buf, value);
+}
+
+// -----------------------------------------------------------------------------
+
+char*
+format_decimal(char* buf, double value)
+{
+  return format_floating_point<double, uint64_t>(buf, value);
+}
+
+// -----------------------------------------------------------------------------
+
+} /* end namespace types */
+} /* end namespace corevm */
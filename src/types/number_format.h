@@ -0,0 +1,114 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2016 Yanzheng Li
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#ifndef COREVM_NUMBER_FORMAT_H_
+#define COREVM_NUMBER_FORMAT_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+
+namespace corevm {
+namespace types {
+
+/**
+ * Formatting of numbers into their textual representations, as given by
+ * the `repr` operator.
+ *
+ * Integers are written out in decimal. Floating point numbers are written
+ * out with digits that always parse back into the same number, and are
+ * usually, but not always, the fewest that do (see `format_decimal()`). They
+ * are in fixed notation unless too large or too small for it (e.g. "1.0",
+ * "0.001", "1e+16", "1.5e-05"), or written as "inf", "-inf" or "nan".
+ *
+ * Every function writes the representation into the buffer starting at
+ * `buf`, which should hold at least `NUMBER_REPR_MAX_SIZE` characters, and
+ * returns the end of the representation. The representation is not null
+ * terminated.
+ */
+
+/** Size of buffers that fit the representation of any number. */
+const size_t NUMBER_REPR_MAX_SIZE = 32;
+
+// -----------------------------------------------------------------------------
+
+char* format_integer(char* buf, int64_t value);
+
+// -----------------------------------------------------------------------------
+
+char* format_integer(char* buf, uint64_t value);
+
+// -----------------------------------------------------------------------------
+
+/**
+ * The representation of single precision numbers parses back into the same
+ * single precision number.
+ *
+ * Representations round-trip, and are usually the shortest ones that do.
+ * Grisu2, which they are computed with, gives more digits than needed for
+ * less than 0.1% of random doubles, e.g. "20.359213250517598" where 15
+ * significant digits would do.
+ */
+char* format_decimal(char* buf, float value);
+
+// -----------------------------------------------------------------------------
+
+char* format_decimal(char* buf, double value);
+
+// -----------------------------------------------------------------------------
+
+template<typename T>
+inline
+typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value, char*>::type
+format_number(char* buf, T value)
+{
+  return format_integer(buf, static_cast<int64_t>(value));
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename T>
+inline
+typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value, char*>::type
+format_number(char* buf, T value)
+{
+  return format_integer(buf, static_cast<uint64_t>(value));
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename T>
+inline
+typename std::enable_if<std::is_floating_point<T>::value, char*>::type
+format_number(char* buf, T value)
+{
+  return format_decimal(buf, value);
+}
+
+// -----------------------------------------------------------------------------
+
+} /* end namespace types */
+} /* end namespace corevm */
+
+
+#endif /* COREVM_NUMBER_FORMAT_H_ */
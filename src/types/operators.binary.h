@@ -61,6 +61,21 @@ addition::operator()<string>(
 
 // -----------------------------------------------------------------------------
 
+/**
+ * Vectors are operated on element by element, directly rather than through
+ * copies of them.
+ */
+template<>
+inline
+vector
+addition::operator()<vector>(
+  const vector& lhs, const vector& rhs)
+{
+  return lhs + rhs;
+}
+
+// -----------------------------------------------------------------------------
+
 class subtraction : public op<binary_op_tag>
 {
 public:
@@ -73,6 +88,17 @@ public:
 
 // -----------------------------------------------------------------------------
 
+template<>
+inline
+vector
+subtraction::operator()<vector>(
+  const vector& lhs, const vector& rhs)
+{
+  return lhs - rhs;
+}
+
+// -----------------------------------------------------------------------------
+
 class multiplication : public op<binary_op_tag>
 {
 public:
@@ -85,6 +111,17 @@ public:
 
 // -----------------------------------------------------------------------------
 
+template<>
+inline
+vector
+multiplication::operator()<vector>(
+  const vector& lhs, const vector& rhs)
+{
+  return lhs * rhs;
+}
+
+// -----------------------------------------------------------------------------
+
 class division : public op<binary_op_tag>
 {
 public:
@@ -97,6 +134,17 @@ public:
 
 // -----------------------------------------------------------------------------
 
+template<>
+inline
+vector
+division::operator()<vector>(
+  const vector& lhs, const vector& rhs)
+{
+  return lhs / rhs;
+}
+
+// -----------------------------------------------------------------------------
+
 class modulus : public op<binary_op_tag>
 {
 public:
@@ -170,6 +218,17 @@ modulus::operator()<map>(
 
 // -----------------------------------------------------------------------------
 
+template<>
+inline
+vector
+modulus::operator()<vector>(
+  const vector& lhs, const vector& rhs)
+{
+  return static_cast<vector>(lhs % rhs);
+}
+
+// -----------------------------------------------------------------------------
+
 class pow_op : public op<binary_op_tag>
 {
 public:
@@ -300,6 +359,20 @@ public:
 
 // -----------------------------------------------------------------------------
 
+/**
+ * Strings are compared in place rather than through copies, which keeps the
+ * atoms and cached hashes they carry.
+ */
+template<>
+inline
+eq::result_type
+eq::operator()<string>(const string& lhs, const string& rhs)
+{
+  return lhs == rhs;
+}
+
+// -----------------------------------------------------------------------------
+
 class neq : public op<typed_binary_op_tag, boolean>
 {
 public:
@@ -312,6 +385,16 @@ public:
 
 // -----------------------------------------------------------------------------
 
+template<>
+inline
+neq::result_type
+neq::operator()<string>(const string& lhs, const string& rhs)
+{
+  return lhs != rhs;
+}
+
+// -----------------------------------------------------------------------------
+
 class gt : public op<typed_binary_op_tag, boolean>
 {
 public:
@@ -24,12 +24,12 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #define COREVM_OPERATORS_COMPLEX_H_
 
 #include "errors.h"
+#include "native_array_kernels.h"
+#include "number_format.h"
 #include "operators.base.h"
 #include "types.h"
 #include "corevm/macros.h"
 
-#include <boost/lexical_cast.hpp>
-
 #include <algorithm>
 #include <cmath>
 #include <cstdio>
@@ -94,6 +94,17 @@ absolute::operator()(const map& oprd)
 
 // -----------------------------------------------------------------------------
 
+template<>
+inline
+vector
+absolute::operator()(const vector& oprd)
+{
+  return vector(
+    std::abs(static_cast<int64>(oprd)));
+}
+
+// -----------------------------------------------------------------------------
+
 class sqrt : public op<unary_op_tag>
 {
 public:
@@ -140,6 +151,17 @@ sqrt::operator()(const map& oprd)
 
 // -----------------------------------------------------------------------------
 
+template<>
+inline
+vector
+sqrt::operator()(const vector& oprd)
+{
+  return vector(
+    std::sqrt(static_cast<int64>(oprd)));
+}
+
+// -----------------------------------------------------------------------------
+
 class truthy : public op<typed_unary_op_tag, boolean>
 {
 public:
@@ -183,22 +205,27 @@ truthy::operator()(const map& oprd)
 
 // -----------------------------------------------------------------------------
 
+template<>
+inline
+truthy::result_type
+truthy::operator()(const vector& oprd)
+{
+  return !oprd.empty();
+}
+
+// -----------------------------------------------------------------------------
+
 class repr: public op<typed_unary_op_tag, string>
 {
 public:
   template<typename T>
   result_type operator()(const T& oprd)
   {
-    // NOTES:
-    //  (1) The curent approach has precision and accuracy issues.
-    //  (2) Using `boost::lexical_cast` has ~ 3x performance gain over
-    //      using `std::stringstream`, obeserved in micro benchmark.
-    //
-    // Benchmarks for `boost::lexical_cast` vs. `std::stringstream` vs. `sprintf`:
-    // http://www.boost.org/doc/libs/1_58_0/doc/html/boost_lexical_cast/performance.html
-    //
-    // TODO: consider using `sprintf` here.
-    return boost::lexical_cast<string>(oprd);
+    // Numbers are formatted on the stack, and the string is then allocated
+    // once at its final size.
+    char buf[NUMBER_REPR_MAX_SIZE];
+    const char* end = format_number(buf, oprd);
+    return string(static_cast<const char*>(buf), end);
   }
 };
 
@@ -207,23 +234,9 @@ public:
 template<>
 inline
 repr::result_type
-repr::operator()(const decimal& oprd)
-{
-  char buf[20];
-  snprintf(buf, sizeof(buf), "%0.6f", oprd);
-  return string(buf);
-}
-
-// -----------------------------------------------------------------------------
-
-template<>
-inline
-repr::result_type
-repr::operator()(const decimal2& oprd)
+repr::operator()(const string& oprd)
 {
-  char buf[20];
-  snprintf(buf, sizeof(buf), "%0.6f", oprd);
-  return string(buf);
+  return oprd;
 }
 
 // -----------------------------------------------------------------------------
@@ -231,9 +244,9 @@ repr::operator()(const decimal2& oprd)
 template<>
 inline
 repr::result_type
-repr::operator()(const string& oprd)
+repr::operator()(const array& /* oprd */)
 {
-  return oprd;
+  return static_cast<string>("<array>");
 }
 
 // -----------------------------------------------------------------------------
@@ -241,9 +254,9 @@ repr::operator()(const string& oprd)
 template<>
 inline
 repr::result_type
-repr::operator()(const array& /* oprd */)
+repr::operator()(const map& /* oprd */)
 {
-  return static_cast<string>("<array>");
+  return static_cast<string>("<map>");
 }
 
 // -----------------------------------------------------------------------------
@@ -251,9 +264,9 @@ repr::operator()(const array& /* oprd */)
 template<>
 inline
 repr::result_type
-repr::operator()(const map& /* oprd */)
+repr::operator()(const vector& /* oprd */)
 {
-  return static_cast<string>("<map>");
+  return static_cast<string>("<vector>");
 }
 
 // -----------------------------------------------------------------------------
@@ -277,11 +290,7 @@ inline
 hash::result_type
 hash::operator()(const string& oprd)
 {
-  uint64_t res = 0;
-
-  std::hash<native_string_base> hash_func;
-
-  res = hash_func(oprd);
+  uint64_t res = oprd.hash();
 
   return static_cast<int64>(res);
 }
@@ -293,15 +302,7 @@ inline
 hash::result_type
 hash::operator()(const array& oprd)
 {
-  uint64_t res = 0;
-
-  std::hash<native_array_element_type> element_hash;
-
-  for (auto itr = oprd.cbegin(); itr != oprd.cend(); ++itr)
-  {
-    const auto& value = *itr;
-    res += element_hash(value);
-  }
+  uint64_t res = oprd.hash();
 
   return static_cast<int64>(res);
 }
@@ -332,6 +333,18 @@ hash::operator()(const map& oprd)
 
 // -----------------------------------------------------------------------------
 
+template<>
+inline
+hash::result_type
+hash::operator()(const vector& oprd)
+{
+  uint64_t res = oprd.hash();
+
+  return static_cast<int64>(res);
+}
+
+// -----------------------------------------------------------------------------
+
 class slice : public op<unary_op_tag>
 {
 public:
@@ -369,12 +382,21 @@ private:
 
 // -----------------------------------------------------------------------------
 
+/**
+ * Strings and arrays are sliced through members that share the contents of
+ * large slices instead of copying them.
+ */
 template<>
 inline
 string
 slice::operator()(const string& oprd) const
 {
-  return slice_impl(oprd);
+  if (m_start < m_stop && m_start < oprd.size())
+  {
+    return oprd.substr(m_start, m_stop - m_start);
+  }
+
+  return string();
 }
 
 // -----------------------------------------------------------------------------
@@ -383,6 +405,21 @@ template<>
 inline
 array
 slice::operator()(const array& oprd) const
+{
+  if (m_start < m_stop)
+  {
+    return oprd.slice(m_start, m_stop - m_start);
+  }
+
+  return array();
+}
+
+// -----------------------------------------------------------------------------
+
+template<>
+inline
+vector
+slice::operator()(const vector& oprd) const
 {
   return slice_impl(oprd);
 }
@@ -449,6 +486,26 @@ template<>
 inline
 array
 stride::operator()(const array& oprd) const
+{
+  array res;
+
+  if (m_stride > 0)
+  {
+    const size_t stride_val = static_cast<size_t>(m_stride);
+
+    res.resize((oprd.size() + stride_val - 1) / stride_val);
+    array_stride_copy(oprd.data(), oprd.size(), stride_val, res.data());
+  }
+
+  return res;
+}
+
+// -----------------------------------------------------------------------------
+
+template<>
+inline
+vector
+stride::operator()(const vector& oprd) const
 {
   return stride_impl(oprd);
 }
@@ -493,6 +550,21 @@ template<>
 inline
 array
 reverse::operator()(const array& oprd) const
+{
+  array res;
+  res.resize(oprd.size());
+
+  array_reverse_copy(oprd.data(), oprd.size(), res.data());
+
+  return res;
+}
+
+// -----------------------------------------------------------------------------
+
+template<>
+inline
+vector
+reverse::operator()(const vector& oprd) const
 {
   return reverse_impl(oprd);
 }
@@ -567,6 +639,17 @@ cmp::operator()<map>(
 
 // -----------------------------------------------------------------------------
 
+template<>
+inline
+cmp::result_type
+cmp::operator()<vector>(
+  const vector& /* lhs */, const vector& /* rhs */)
+{
+  THROW(RuntimeError("Calling 'cmp' operator on invalid type"));
+}
+
+// -----------------------------------------------------------------------------
+
 } /* end namespace types */
 } /* end namespace corevm */
 
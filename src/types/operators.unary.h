@@ -188,6 +188,16 @@ bitwise_not::operator()(const map& oprd)
 
 // -----------------------------------------------------------------------------
 
+template<>
+inline
+vector
+bitwise_not::operator()(const vector& oprd)
+{
+  return static_cast<vector>(~oprd);
+}
+
+// -----------------------------------------------------------------------------
+
 } /* end namespace types */
 } /* end namespace corevm */
 
@@ -0,0 +1,108 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2016 Yanzheng Li
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#ifndef COREVM_SIMD_SUPPORT_H_
+#define COREVM_SIMD_SUPPORT_H_
+
+/**
+ * SSE2 kernels are compiled whenever the rest of the tree is compiled for
+ * SSE2, which is always the case on x86-64.
+ */
+#if defined(__SSE2__)
+  #define COREVM_SIMD_SSE2 1
+#else
+  #define COREVM_SIMD_SSE2 0
+#endif
+
+/**
+ * AVX2 kernels are compiled with the `target` attribute of GCC and Clang,
+ * regardless of the instruction set the rest of the tree is compiled for,
+ * and are only used if the CPU turns out to support AVX2. Their functions,
+ * including the inline ones they call, are declared with `COREVM_AVX2`.
+ */
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+  #define COREVM_SIMD_AVX2 1
+  #define COREVM_AVX2 __attribute__((target("avx2")))
+#else
+  #define COREVM_SIMD_AVX2 0
+#endif
+
+
+namespace corevm {
+namespace types {
+
+/**
+ * Detection of the instruction sets of the CPU, shared by the kernels of
+ * native types to select their SIMD implementations with on first use.
+ */
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Whether the CPU supports AVX2.
+ *
+ * The CPU is queried once, and always reported as not supporting AVX2 on
+ * other architectures than x86-64 or compilers other than GCC and Clang,
+ * for which the AVX2 kernels are not compiled.
+ */
+bool cpu_supports_avx2();
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Tables of the implementations of a set of kernels, one per instruction
+ * set. The tables of the instruction sets that the kernels are not compiled
+ * for are null.
+ */
+template <typename Kernels>
+struct SimdKernelTables
+{
+  const Kernels* scalar;
+  const Kernels* sse2;
+  const Kernels* avx2;
+};
+
+// -----------------------------------------------------------------------------
+
+/**
+ * The table of the widest instruction set that the kernels are compiled for
+ * and that the CPU supports.
+ */
+template <typename Kernels>
+const Kernels&
+select_simd_kernels(const SimdKernelTables<Kernels>& tables)
+{
+  if (tables.avx2 && cpu_supports_avx2())
+  {
+    return *tables.avx2;
+  }
+
+  return tables.sse2 ? *tables.sse2 : *tables.scalar;
+}
+
+// -----------------------------------------------------------------------------
+
+} /* end namespace types */
+} /* end namespace corevm */
+
+
+#endif /* COREVM_SIMD_SUPPORT_H_ */
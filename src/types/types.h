@@ -26,6 +26,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "native_array.h"
 #include "native_map.h"
 #include "native_string.h"
+#include "native_vector.h"
 
 #include <cstdint>
 
@@ -47,6 +48,7 @@ typedef double decimal2;
 typedef native_string string;
 typedef native_array array;
 typedef native_map map;
+typedef native_vector vector;
 
 } /* end namespace types */
 } /* end namespace corevm */
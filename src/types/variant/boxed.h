@@ -0,0 +1,70 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2016 Yanzheng Li
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#ifndef COREVM_VARIANT_BOXED_H_
+#define COREVM_VARIANT_BOXED_H_
+
+#include <type_traits>
+
+
+namespace corevm {
+namespace types {
+namespace variant {
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Whether a variant holds values of type `T` out of line, in a box shared
+ * between copies of the variant and copied on write, rather than in its own
+ * storage.
+ *
+ * Specialize for types large enough that storing them inline would inflate
+ * the size of every value of the variant.
+ */
+template <typename T>
+struct boxed : std::false_type {};
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Invoked on values of type `T` held by a variant as they are accessed
+ * through it, except through `variant::get_raw()`.
+ *
+ * Specialize for types that keep part of their state lazily, to bring it up
+ * to date before the values are used.
+ */
+template <typename T>
+struct access_hook
+{
+  static void apply(const T&)
+  {
+  }
+};
+
+// -----------------------------------------------------------------------------
+
+} /* end namespace variant */
+} /* end namespace types */
+} /* end namespace corevm */
+
+
+#endif /* COREVM_VARIANT_BOXED_H_ */
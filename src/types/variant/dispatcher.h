@@ -23,8 +23,10 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #ifndef COREVM_VARIANT_DISPATCHER_H_
 #define COREVM_VARIANT_DISPATCHER_H_
 
+#include "impl.h"
 #include "corevm/macros.h"
 
+#include <cstdlib>
 #include <stdexcept>
 #include <string>
 
@@ -36,239 +38,166 @@ namespace impl {
 
 // -----------------------------------------------------------------------------
 
+/**
+ * Dispatches a unary visitor on the value of a variant.
+ *
+ * Dispatch goes through a table of functions indexed by the type index of
+ * the variant, one for each of the types, so it costs a single indirect call
+ * regardless of the position of the type in the template list.
+ */
 template <typename F, typename V, typename R, typename...Types>
-struct dispatcher;
-
-// -----------------------------------------------------------------------------
-
-template <typename F, typename V, typename R, typename T, typename...Types>
-struct dispatcher<F, V, R, T, Types...>
+struct dispatcher
 {
   using result_type = R;
 
   static result_type apply_const(V const& v, F f)
   {
-    if (v.type_index() == sizeof...(Types))
-    {
-      return f(v. template get<T>());
-    }
-    else
+    const std::size_t index = v.type_index();
+
+    if (index >= sizeof...(Types))
     {
-      return dispatcher<F, V, R, Types...>::apply_const(v, f);
+      THROW(std::runtime_error("unary dispatch failed"));
     }
+
+    return const_funcs(make_index_sequence<sizeof...(Types)>())[index](v, f);
   }
 
   static result_type apply(V & v, F f)
   {
-    if (v.type_index() == sizeof...(Types))
-    {
-      return f(v. template get<T>());
-    }
-    else
+    const std::size_t index = v.type_index();
+
+    if (index >= sizeof...(Types))
     {
-      return dispatcher<F, V, R, Types...>::apply(v, f);
+      THROW(std::runtime_error("unary dispatch failed"));
     }
-  }
-};
 
-// -----------------------------------------------------------------------------
+    return funcs(make_index_sequence<sizeof...(Types)>())[index](v, f);
+  }
 
-template<typename F, typename V, typename R>
-struct dispatcher<F, V, R>
-{
-  using result_type = R;
+private:
+  using const_func = result_type (*)(V const&, F&);
+  using func = result_type (*)(V &, F&);
 
-  static result_type apply_const(V const&, F)
+  template <typename T>
+  static result_type invoke_const(V const& v, F& f)
   {
-    THROW(std::runtime_error("unary dispatch failed"));
+    return f(v. template get_unchecked<T>());
   }
 
-  static result_type apply(V &, F)
+  template <typename T>
+  static result_type invoke(V & v, F& f)
   {
-    THROW(std::runtime_error("unary dispatch failed"));
+    return f(v. template get_unchecked<T>());
   }
-};
-
-// -----------------------------------------------------------------------------
-
-template <typename F, typename V, typename R, typename T, typename...Types>
-struct binary_dispatcher_rhs;
-
-// -----------------------------------------------------------------------------
 
-template <typename F, typename V, typename R, typename T0, typename T1, typename...Types>
-struct binary_dispatcher_rhs<F, V, R, T0, T1, Types...>
-{
-  using result_type = R;
-
-  static result_type apply_const(V const& lhs, V const& rhs, F f)
+  template <std::size_t...Is>
+  static const const_func* const_funcs(index_sequence<Is...>)
   {
-    if (rhs.type_index() == sizeof...(Types))
-    {
-      return f(lhs. template get<T0>(), rhs. template get<T1>());
-    }
-    else
-    {
-      return binary_dispatcher_rhs<F, V, R, T0, Types...>::apply_const(lhs, rhs, f);
-    }
-  }
+    static const const_func table[] {
+      &invoke_const<typename select_indexed_type<Is, Types...>::type>...
+    };
 
-  static result_type apply(V & lhs, V & rhs, F f)
-  {
-    if (rhs.type_index() == sizeof...(Types))
-    {
-      return f(lhs. template get<T0>(), rhs. template get<T1>());
-    }
-    else
-    {
-      return binary_dispatcher_rhs<F, V, R, T0, Types...>::apply(lhs, rhs, f);
-    }
+    return table;
   }
-};
 
-// -----------------------------------------------------------------------------
-
-template<typename F, typename V, typename R, typename T>
-struct binary_dispatcher_rhs<F, V, R, T>
-{
-  using result_type = R;
-
-  static result_type apply_const(V const&, V const&, F)
+  template <std::size_t...Is>
+  static const func* funcs(index_sequence<Is...>)
   {
-    THROW(std::runtime_error("binary dispatch failed"));
-  }
+    static const func table[] {
+      &invoke<typename select_indexed_type<Is, Types...>::type>...
+    };
 
-  static result_type apply(V &, V &, F)
-  {
-    THROW(std::runtime_error("binary dispatch failed"));
+    return table;
   }
 };
 
 // -----------------------------------------------------------------------------
 
-template <typename F, typename V, typename R,  typename T, typename...Types>
-struct binary_dispatcher_lhs;
-
-// -----------------------------------------------------------------------------
-
-template <typename F, typename V, typename R, typename T0, typename T1, typename...Types>
-struct binary_dispatcher_lhs<F, V, R, T0, T1, Types...>
+/**
+ * Dispatches a binary visitor on the values of two variants.
+ *
+ * Dispatch goes through an N x N table of functions indexed by the type
+ * indices of both variants, one for each pair of types, so it costs a single
+ * indirect call regardless of the positions of the types in the template
+ * list.
+ */
+template <typename F, typename V, typename R, typename...Types>
+struct binary_dispatcher
 {
   using result_type = R;
 
-  static result_type apply_const(V const& lhs, V const& rhs, F f)
+  static result_type apply_const(V const& v0, V const& v1, F f)
   {
-    if (lhs.type_index() == sizeof...(Types))
-    {
-      return f(lhs. template get<T1>(), rhs. template get<T0>());
-    }
-    else
+    const std::size_t index0 = v0.type_index();
+    const std::size_t index1 = v1.type_index();
+
+    if (index0 >= sizeof...(Types) || index1 >= sizeof...(Types))
     {
-      return binary_dispatcher_lhs<F, V, R, T0, Types...>::apply_const(lhs, rhs, f);
+      THROW(std::runtime_error("binary dispatch failed"));
     }
+
+    return const_funcs(make_index_sequence<table_size>())[
+      index0 * sizeof...(Types) + index1](v0, v1, f);
   }
 
-  static result_type apply(V & lhs, V & rhs, F f)
+  static result_type apply(V & v0, V & v1, F f)
   {
-    if (lhs.type_index() == sizeof...(Types))
-    {
-      return f(lhs. template get<T1>(), rhs. template get<T0>());
-    }
-    else
+    const std::size_t index0 = v0.type_index();
+    const std::size_t index1 = v1.type_index();
+
+    if (index0 >= sizeof...(Types) || index1 >= sizeof...(Types))
     {
-      return binary_dispatcher_lhs<F, V, R, T0, Types...>::apply(lhs, rhs, f);
+      THROW(std::runtime_error("binary dispatch failed"));
     }
-  }
-};
 
-// -----------------------------------------------------------------------------
-
-template<typename F, typename V, typename R, typename T>
-struct binary_dispatcher_lhs<F, V, R, T>
-{
-  using result_type = R;
-
-  static result_type apply_const(V const&, V const&, F)
-  {
-    THROW(std::runtime_error("binary dispatch failed"));
+    return funcs(make_index_sequence<table_size>())[
+      index0 * sizeof...(Types) + index1](v0, v1, f);
   }
 
-  static result_type apply(V &, V &, F)
-  {
-    THROW(std::runtime_error("binary dispatch failed"));
-  }
-};
+private:
+  static constexpr std::size_t table_size = sizeof...(Types) * sizeof...(Types);
 
-// -----------------------------------------------------------------------------
-
-template <typename F, typename V, typename R, typename...Types>
-struct binary_dispatcher;
+  using const_func = result_type (*)(V const&, V const&, F&);
+  using func = result_type (*)(V &, V &, F&);
 
-// -----------------------------------------------------------------------------
+  template <std::size_t I>
+  using lhs_type =
+    typename select_indexed_type<I / sizeof...(Types), Types...>::type;
 
-template <typename F, typename V, typename R, typename T, typename...Types>
-struct binary_dispatcher<F, V, R, T, Types...>
-{
-  using result_type = R;
+  template <std::size_t I>
+  using rhs_type =
+    typename select_indexed_type<I % sizeof...(Types), Types...>::type;
 
-  static result_type apply_const(V const& v0, V const& v1, F f)
+  template <typename T0, typename T1>
+  static result_type invoke_const(V const& v0, V const& v1, F& f)
   {
-    if (v0.type_index() == sizeof...(Types))
-    {
-      if (v0.type_index() == v1.type_index())
-      {
-        return f(v0. template get<T>(), v1. template get<T>());
-      }
-      else
-      {
-        return binary_dispatcher_rhs<F, V, R, T, Types...>::apply_const(v0, v1, f);
-      }
-    }
-    else if (v1.type_index() == sizeof...(Types))
-    {
-      return binary_dispatcher_lhs<F, V, R, T, Types...>::apply_const(v0, v1, f);
-    }
-
-    return binary_dispatcher<F, V, R, Types...>::apply_const(v0, v1, f);
+    return f(v0. template get_unchecked<T0>(), v1. template get_unchecked<T1>());
   }
 
-  static result_type apply(V & v0, V & v1, F f)
+  template <typename T0, typename T1>
+  static result_type invoke(V & v0, V & v1, F& f)
   {
-    if (v0.type_index() == sizeof...(Types))
-    {
-      if (v0.type_index() == v1.type_index())
-      {
-        return f(v0. template get<T>(), v1. template get<T>());
-      }
-      else
-      {
-        return binary_dispatcher_rhs<F, V, R, T, Types...>::apply(v0, v1, f);
-      }
-    }
-    else if (v1.type_index() == sizeof...(Types))
-    {
-      return binary_dispatcher_lhs<F, V, R, T, Types...>::apply(v0, v1, f);
-    }
-
-    return binary_dispatcher<F, V, R, Types...>::apply(v0, v1, f);
+    return f(v0. template get_unchecked<T0>(), v1. template get_unchecked<T1>());
   }
-};
-
-// -----------------------------------------------------------------------------
 
-template<typename F, typename V, typename R>
-struct binary_dispatcher<F, V, R>
-{
-  using result_type = R;
-
-  static result_type apply_const(V const&, V const&, F)
+  template <std::size_t...Is>
+  static const const_func* const_funcs(index_sequence<Is...>)
   {
-    THROW(std::runtime_error("binary dispatch failed"));
+    static const const_func table[] {
+      &invoke_const<lhs_type<Is>, rhs_type<Is>>...
+    };
+
+    return table;
   }
 
-  static result_type apply(V &, V &, F)
+  template <std::size_t...Is>
+  static const func* funcs(index_sequence<Is...>)
   {
-    THROW(std::runtime_error("binary dispatch failed"));
+    static const func table[] {
+      &invoke<lhs_type<Is>, rhs_type<Is>>...
+    };
+
+    return table;
   }
 };
 
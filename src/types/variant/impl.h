@@ -23,8 +23,14 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #ifndef COREVM_VARIANT_IMPL_H_
 #define COREVM_VARIANT_IMPL_H_
 
+#include "boxed.h"
+
+#include <cstdint>
 #include <cstdlib>
+#include <cstring>
+#include <new>
 #include <type_traits>
+#include <utility>
 
 
 namespace corevm {
@@ -135,6 +141,33 @@ struct select_type<0, T, Types...>
 
 // -----------------------------------------------------------------------------
 
+/**
+ * Selects the type of the specified type index (see `variant::type_index()`),
+ * which counts from the last type in the template list.
+ */
+template <std::size_t I, typename ... Types>
+struct select_indexed_type
+{
+  using type = typename select_type<sizeof...(Types) - I - 1, Types...>::type;
+};
+
+// -----------------------------------------------------------------------------
+
+template <std::size_t ... Is>
+struct index_sequence {};
+
+// -----------------------------------------------------------------------------
+
+template <std::size_t N, std::size_t ... Is>
+struct make_index_sequence : make_index_sequence<N - 1, N - 1, Is...> {};
+
+// -----------------------------------------------------------------------------
+
+template <std::size_t ... Is>
+struct make_index_sequence<0, Is...> : index_sequence<Is...> {};
+
+// -----------------------------------------------------------------------------
+
 template <typename T, typename R = void>
 struct enable_if_type
 {
@@ -197,58 +230,343 @@ struct static_max<arg1, arg2, others...>
 
 // -----------------------------------------------------------------------------
 
-template<typename... Types>
-struct variant_helper;
+/**
+ * Stores values of type `T` in the storage of a variant, either in place or
+ * behind a pointer (see `boxed`).
+ */
+template <typename T, bool Boxed = boxed<T>::value>
+struct storage
+{
+  static const std::size_t size = sizeof(T);
+  static const std::size_t align = alignof(T);
+
+  template <typename... Args>
+  static void construct(void * data, Args&&... args)
+  {
+    new (data) T(std::forward<Args>(args)...);
+  }
+
+  static T& get(void * data)
+  {
+    T& value = get_raw(data);
+    access_hook<T>::apply(value);
+    return value;
+  }
+
+  static T const& get(const void * data)
+  {
+    T const& value = get_raw(data);
+    access_hook<T>::apply(value);
+    return value;
+  }
+
+  static T& get_raw(void * data)
+  {
+    return *reinterpret_cast<T*>(data);
+  }
+
+  static T const& get_raw(const void * data)
+  {
+    return *reinterpret_cast<T const*>(data);
+  }
+
+  static void destroy(void * data)
+  {
+    get_raw(data).~T();
+  }
+
+  static void move(void * old_value, void * new_value)
+  {
+    new (new_value) T(std::move(get_raw(old_value)));
+  }
+
+  static void copy(const void * old_value, void * new_value)
+  {
+    new (new_value) T(get_raw(old_value));
+  }
+};
 
 // -----------------------------------------------------------------------------
 
-template<typename T, typename... Types>
-struct variant_helper<T, Types...>
+/**
+ * Boxed values are shared between copies of a variant, and copied on write:
+ * copying the variant only takes another reference to the box, and the
+ * value is copied into a box of its own the first time it is accessed
+ * through a non-const variant while shared.
+ *
+ * References to boxed values taken through a non-const variant should not be
+ * kept across copies of the variant. The reference counts are not atomic, so
+ * copies of a variant should not be shared across threads either.
+ */
+template <typename T>
+struct storage<T, true>
+{
+  struct box
+  {
+    template <typename... Args>
+    explicit box(Args&&... args)
+      :
+      value(std::forward<Args>(args)...),
+      refs(1)
+    {
+    }
+
+    T value;
+    mutable std::size_t refs;
+  };
+
+  static const std::size_t size = sizeof(box*);
+  static const std::size_t align = alignof(box*);
+
+  template <typename... Args>
+  static void construct(void * data, Args&&... args)
+  {
+    *reinterpret_cast<box**>(data) = new box(std::forward<Args>(args)...);
+  }
+
+  static T& get(void * data)
+  {
+    T& value = get_raw(data);
+    access_hook<T>::apply(value);
+    return value;
+  }
+
+  static T const& get(const void * data)
+  {
+    T const& value = get_raw(data);
+    access_hook<T>::apply(value);
+    return value;
+  }
+
+  static T& get_raw(void * data)
+  {
+    box*& b = *reinterpret_cast<box**>(data);
+
+    if (b->refs > 1)
+    {
+      box* copy = new box(b->value);
+      --b->refs;
+      b = copy;
+    }
+
+    return b->value;
+  }
+
+  static T const& get_raw(const void * data)
+  {
+    return (*reinterpret_cast<box* const*>(data))->value;
+  }
+
+  static void destroy(void * data)
+  {
+    box* b = *reinterpret_cast<box**>(data);
+
+    if (--b->refs == 0)
+    {
+      delete b;
+    }
+  }
+
+  /**
+   * Takes over the reference, which leaves the old value to be discarded
+   * without being destroyed.
+   */
+  static void move(void * old_value, void * new_value)
+  {
+    *reinterpret_cast<box**>(new_value) = *reinterpret_cast<box**>(old_value);
+  }
+
+  static void copy(const void * old_value, void * new_value)
+  {
+    box* b = *reinterpret_cast<box* const*>(old_value);
+    ++b->refs;
+    *reinterpret_cast<box**>(new_value) = b;
+  }
+};
+
+// -----------------------------------------------------------------------------
+
+/** Values that are left as is on destruction. */
+template <typename T>
+struct is_trivially_destructible_storage
+{
+  static constexpr bool value =
+    !boxed<T>::value && std::is_trivially_destructible<T>::value;
+};
+
+// -----------------------------------------------------------------------------
+
+/** Values that can be copied bitwise. */
+template <typename T>
+struct is_trivially_copyable_storage
+{
+  static constexpr bool value =
+    !boxed<T>::value && std::is_trivially_copyable<T>::value;
+};
+
+// -----------------------------------------------------------------------------
+
+/** Values that can be moved bitwise. */
+template <typename T>
+struct is_trivially_movable_storage
+{
+  static constexpr bool value =
+    boxed<T>::value || std::is_trivially_copyable<T>::value;
+};
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Mask of the type indices (see `variant::type_index()`) of the types that
+ * satisfy the specified trait.
+ */
+template <template <typename> class Trait, typename...Types>
+struct type_index_mask;
+
+// -----------------------------------------------------------------------------
+
+template <template <typename> class Trait, typename T, typename...Types>
+struct type_index_mask<Trait, T, Types...>
+{
+  static_assert(sizeof...(Types) < 64, "Too many types");
+
+  static constexpr std::uint64_t value =
+    (Trait<T>::value ? (std::uint64_t(1) << sizeof...(Types)) : 0) |
+    type_index_mask<Trait, Types...>::value;
+};
+
+// -----------------------------------------------------------------------------
+
+template <template <typename> class Trait>
+struct type_index_mask<Trait>
+{
+  static constexpr std::uint64_t value = 0;
+};
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Destroys, moves and copies the value of a variant through tables of
+ * functions indexed by type index, rather than by testing the type index
+ * against each of the types in turn.
+ *
+ * Values that are trivial to destroy, move or copy skip the tables, and are
+ * left as is on destruction or moved and copied bitwise.
+ */
+template<typename... Types>
+struct variant_helper
 {
   static void destroy(const std::size_t id, void * m_data)
   {
-    if (id == sizeof...(Types))
+    if (is_trivially_destructible(id))
     {
-      reinterpret_cast<T*>(m_data)->~T();
+      return;
     }
-    else
+
+    if (id < sizeof...(Types))
     {
-      variant_helper<Types...>::destroy(id, m_data);
+      destroy_funcs(make_index_sequence<sizeof...(Types)>())[id](m_data);
     }
   }
 
   static void move(const std::size_t old_id, void * old_value, void * new_value)
   {
-    if (old_id == sizeof...(Types))
+    if (is_trivially_movable(old_id))
     {
-      new (new_value) T(std::move(*reinterpret_cast<T*>(old_value)));
+      std::memcpy(new_value, old_value, data_size);
     }
-    else
+    else if (old_id < sizeof...(Types))
     {
-      variant_helper<Types...>::move(old_id, old_value, new_value);
+      move_funcs(make_index_sequence<sizeof...(Types)>())[old_id](
+        old_value, new_value);
     }
   }
 
   static void copy(const std::size_t old_id, const void * old_value, void * new_value)
   {
-    if (old_id == sizeof...(Types))
+    if (is_trivially_copyable(old_id))
     {
-      new (new_value) T(*reinterpret_cast<const T*>(old_value));
+      std::memcpy(new_value, old_value, data_size);
     }
-    else
+    else if (old_id < sizeof...(Types))
     {
-      variant_helper<Types...>::copy(old_id, old_value, new_value);
+      copy_funcs(make_index_sequence<sizeof...(Types)>())[old_id](
+        old_value, new_value);
     }
   }
-};
 
-// -----------------------------------------------------------------------------
+private:
+  static const std::size_t data_size = static_max<storage<Types>::size...>::value;
 
-template<> struct variant_helper<>
-{
-  static void destroy(const std::size_t, void *) {}
-  static void move(const std::size_t, void *, void *) {}
-  static void copy(const std::size_t, const void *, void *) {}
+  static bool is_trivially_destructible(const std::size_t id)
+  {
+    return id < sizeof...(Types) &&
+      ((type_index_mask<is_trivially_destructible_storage, Types...>::value >> id) & 1);
+  }
+
+  static bool is_trivially_movable(const std::size_t id)
+  {
+    return id < sizeof...(Types) &&
+      ((type_index_mask<is_trivially_movable_storage, Types...>::value >> id) & 1);
+  }
+
+  static bool is_trivially_copyable(const std::size_t id)
+  {
+    return id < sizeof...(Types) &&
+      ((type_index_mask<is_trivially_copyable_storage, Types...>::value >> id) & 1);
+  }
+
+  using destroy_func = void (*)(void *);
+  using move_func = void (*)(void *, void *);
+  using copy_func = void (*)(const void *, void *);
+
+  template <typename T>
+  static void destroy_value(void * m_data)
+  {
+    storage<T>::destroy(m_data);
+  }
+
+  template <typename T>
+  static void move_value(void * old_value, void * new_value)
+  {
+    storage<T>::move(old_value, new_value);
+  }
+
+  template <typename T>
+  static void copy_value(const void * old_value, void * new_value)
+  {
+    storage<T>::copy(old_value, new_value);
+  }
+
+  template <std::size_t ... Is>
+  static const destroy_func* destroy_funcs(index_sequence<Is...>)
+  {
+    static const destroy_func funcs[] {
+      &destroy_value<typename select_indexed_type<Is, Types...>::type>...
+    };
+
+    return funcs;
+  }
+
+  template <std::size_t ... Is>
+  static const move_func* move_funcs(index_sequence<Is...>)
+  {
+    static const move_func funcs[] {
+      &move_value<typename select_indexed_type<Is, Types...>::type>...
+    };
+
+    return funcs;
+  }
+
+  template <std::size_t ... Is>
+  static const copy_func* copy_funcs(index_sequence<Is...>)
+  {
+    static const copy_func funcs[] {
+      &copy_value<typename select_indexed_type<Is, Types...>::type>...
+    };
+
+    return funcs;
+  }
 };
 
 // -----------------------------------------------------------------------------
@@ -27,6 +27,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "dispatcher.h"
 #include "impl.h"
 
+#include <cstdint>
 #include <cstdlib>
 #include <new>
 #include <stdexcept>
@@ -44,13 +45,23 @@ template<typename... Types>
 class variant
 {
 private:
-  static const std::size_t data_size = impl::static_max<sizeof(Types)...>::value;
-  static const std::size_t data_align = impl::static_max<alignof(Types)...>::value;
+  static_assert(sizeof...(Types) < 255, "Too many types");
+
+  static const std::size_t data_size =
+    impl::static_max<impl::storage<Types>::size...>::value;
+  static const std::size_t data_align =
+    impl::static_max<impl::storage<Types>::align...>::value;
 
   using data_type = typename std::aligned_storage<data_size, data_align>::type;
   using helper_type = impl::variant_helper<Types...>;
 
-  std::size_t m_type_index;
+  /**
+   * The type index is kept in a single byte, with `invalid_type_tag`
+   * standing for `impl::invalid_type_index`.
+   */
+  static const std::uint8_t invalid_type_tag = std::uint8_t(-1);
+
+  std::uint8_t m_type_index;
   data_type m_data;
 
   void swap(variant<Types...>& lhs, variant<Types...>& rhs)
@@ -63,7 +74,7 @@ public:
 
   variant()
     :
-    m_type_index(impl::invalid_type_index)
+    m_type_index(invalid_type_tag)
   {
   }
 
@@ -79,7 +90,7 @@ public:
     m_type_index(other.m_type_index)
   {
     helper_type::move(other.m_type_index, &other.m_data, &m_data);
-    other.m_type_index = impl::invalid_type_index;
+    other.m_type_index = invalid_type_tag;
   }
 
   template <typename T, class = typename std::enable_if<
@@ -92,7 +103,7 @@ public:
       sizeof...(Types) - impl::value_traits<typename std::remove_reference<T>::type, Types...>::index - 1;
 
     using target_type = typename impl::select_type<index, Types...>::type;
-    new (&m_data) target_type(std::forward<T>(val));
+    impl::storage<target_type>::construct(&m_data, std::forward<T>(val));
   }
 
   ~variant() noexcept
@@ -169,7 +180,7 @@ public:
 
   bool valid() const
   {
-    return (m_type_index != impl::invalid_type_index);
+    return (m_type_index != invalid_type_tag);
   }
 
   template <typename T, typename std::enable_if<
@@ -179,7 +190,7 @@ public:
   {
     if (m_type_index == impl::direct_type<T, Types...>::index)
     {
-      return *reinterpret_cast<T*>(&m_data);
+      return impl::storage<T>::get(&m_data);
     }
     else
     {
@@ -194,7 +205,7 @@ public:
   {
     if (m_type_index == impl::direct_type<T, Types...>::index)
     {
-      return *reinterpret_cast<T const*>(&m_data);
+      return impl::storage<T>::get(&m_data);
     }
     else
     {
@@ -202,13 +213,69 @@ public:
     }
   }
 
+  /**
+   * Same as `get()`, except that the access hook of the value is not invoked
+   * (see `access_hook`), for callers that handle the value in whatever state
+   * it is in.
+   */
+  template <typename T, typename std::enable_if<
+                       (impl::direct_type<T, Types...>::index != impl::invalid_type_index)
+                       >::type* = nullptr>
+  T& get_raw()
+  {
+    if (m_type_index == impl::direct_type<T, Types...>::index)
+    {
+      return impl::storage<T>::get_raw(&m_data);
+    }
+    else
+    {
+      THROW(std::runtime_error("failed get_raw<T>() in variant type"));
+    }
+  }
+
+  template <typename T, typename std::enable_if<
+                        (impl::direct_type<T, Types...>::index != impl::invalid_type_index)
+                        >::type* = nullptr>
+  T const& get_raw() const
+  {
+    if (m_type_index == impl::direct_type<T, Types...>::index)
+    {
+      return impl::storage<T>::get_raw(&m_data);
+    }
+    else
+    {
+      THROW(std::runtime_error("failed get_raw<T>() in variant type"));
+    }
+  }
+
+  /**
+   * Returns the value of the specified type, without checking that it is the
+   * current type of the variant.
+   */
+  template <typename T, typename std::enable_if<
+                       (impl::direct_type<T, Types...>::index != impl::invalid_type_index)
+                       >::type* = nullptr>
+  T& get_unchecked()
+  {
+    return impl::storage<T>::get(&m_data);
+  }
+
+  template <typename T, typename std::enable_if<
+                        (impl::direct_type<T, Types...>::index != impl::invalid_type_index)
+                        >::type* = nullptr>
+  T const& get_unchecked() const
+  {
+    return impl::storage<T>::get(&m_data);
+  }
+
   /**
    * Returns the zero-based type index of the current type used internally,
    * starting from the last type in the template list.
    */
   std::size_t type_index() const
   {
-    return m_type_index;
+    return m_type_index == invalid_type_tag ?
+      impl::invalid_type_index : m_type_index;
   }
 
   /**
@@ -217,7 +284,7 @@ public:
    */
   int which() const noexcept
   {
-    return static_cast<int>(sizeof...(Types) - m_type_index - 1);
+    return static_cast<int>(sizeof...(Types) - type_index() - 1);
   }
 
   /** Unary visitation (const operand) */
@@ -153,6 +153,145 @@ TEST_F(DynamicObjectUnitTest, TestGetattr)
 
 // -----------------------------------------------------------------------------
 
+TEST_F(DynamicObjectUnitTest, TestAttrSlots)
+{
+  dynamic_object_type obj;
+  dynamic_object_type attr_obj1;
+  dynamic_object_type attr_obj2;
+
+  corevm::dyobj::attr_key_t key1 = 1;
+  corevm::dyobj::attr_key_t key2 = 2;
+
+  size_t slot1 = 0xff;
+  size_t slot2 = 0xff;
+
+  ASSERT_FALSE(obj.hasattr(key1, &slot1));
+
+  obj.putattr(key1, &attr_obj1, &slot1);
+  obj.putattr(key2, &attr_obj2, &slot2);
+
+  ASSERT_EQ(0, slot1);
+  ASSERT_EQ(1, slot2);
+
+  size_t slot = 0xff;
+  dynamic_object_type* actual_attr_obj = NULL;
+
+  ASSERT_TRUE(obj.getattr(key2, &actual_attr_obj, &slot));
+  ASSERT_EQ(&attr_obj2, actual_attr_obj);
+  ASSERT_EQ(slot2, slot);
+
+  ASSERT_EQ(&attr_obj1, obj.attr_at(slot1));
+
+  obj.set_attr_at(slot1, &attr_obj2);
+  ASSERT_EQ(&attr_obj2, obj.getattr(key1));
+
+  // Deleting an attribute shifts the slots of the ones after it.
+  obj.delattr(key1);
+
+  ASSERT_TRUE(obj.hasattr(key2, &slot));
+  ASSERT_EQ(0, slot);
+  ASSERT_EQ(&attr_obj2, obj.attr_at(slot));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(DynamicObjectUnitTest, TestShapes)
+{
+  dynamic_object_type obj1;
+  dynamic_object_type obj2;
+  dynamic_object_type attr_obj;
+
+  corevm::dyobj::attr_key_t key1 = 1;
+  corevm::dyobj::attr_key_t key2 = 2;
+
+  ASSERT_EQ(corevm::dyobj::Shape::root(), obj1.shape());
+
+  obj1.putattr(key1, &attr_obj);
+  obj1.putattr(key2, &attr_obj);
+
+  obj2.putattr(key1, &obj1);
+  obj2.putattr(key2, &obj1);
+
+  // Objects with the same attributes added in the same order share a shape.
+  ASSERT_EQ(obj1.shape(), obj2.shape());
+  ASSERT_EQ(&obj1, obj2.attr_at(1));
+
+  obj2.set_attr_at(1, &attr_obj);
+  ASSERT_EQ(&attr_obj, obj2.getattr(key2));
+
+  obj1.delattr(key1);
+  ASSERT_NE(obj1.shape(), obj2.shape());
+  ASSERT_EQ(obj1.shape(), obj1.shape()->parent()->add(key2));
+
+  // Adding through a cached transition.
+  dynamic_object_type obj3;
+  obj3.add_attr(obj1.shape(), &attr_obj);
+  ASSERT_EQ(&attr_obj, obj3.getattr(key2));
+  ASSERT_EQ(1, obj3.attr_count());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(DynamicObjectUnitTest, TestDictionaryMode)
+{
+  dynamic_object_type obj;
+  dynamic_object_type attr_obj1;
+  dynamic_object_type attr_obj2;
+
+  const size_t attr_count = corevm::dyobj::Shape::DICTIONARY_MODE_MIN_SIZE;
+
+  for (size_t i = 0; i < attr_count - 1; ++i)
+  {
+    obj.putattr(static_cast<corevm::dyobj::attr_key_t>(i), &attr_obj1);
+  }
+
+  ASSERT_FALSE(obj.shape()->is_dictionary());
+
+  // Objects switch to a dictionary shape of their own past the threshold.
+  size_t slot = 0;
+  obj.putattr(static_cast<corevm::dyobj::attr_key_t>(attr_count - 1),
+    &attr_obj2, &slot);
+
+  const corevm::dyobj::Shape* shape = obj.shape();
+
+  ASSERT_TRUE(shape->is_dictionary());
+  ASSERT_EQ(attr_count, obj.attr_count());
+  ASSERT_EQ(attr_count - 1, slot);
+  ASSERT_EQ(&attr_obj2, obj.getattr(
+    static_cast<corevm::dyobj::attr_key_t>(attr_count - 1)));
+
+  // Which is changed in place from then on.
+  obj.putattr(static_cast<corevm::dyobj::attr_key_t>(attr_count), &attr_obj2);
+  obj.delattr(0);
+
+  ASSERT_EQ(shape, obj.shape());
+  ASSERT_EQ(attr_count, obj.attr_count());
+  ASSERT_FALSE(obj.hasattr(0));
+
+  size_t i = 1;
+  for (auto itr = obj.begin(); itr != obj.end(); ++itr, ++i)
+  {
+    ASSERT_EQ(i, itr->first);
+    ASSERT_EQ(i < attr_count - 1 ? &attr_obj1 : &attr_obj2, itr->second);
+  }
+
+  // Copies get dictionary shapes of their own.
+  dynamic_object_type copy;
+  copy.copy_from(obj);
+
+  ASSERT_TRUE(copy.shape()->is_dictionary());
+  ASSERT_NE(obj.shape(), copy.shape());
+
+  copy.delattr(1);
+
+  ASSERT_FALSE(copy.hasattr(1));
+  ASSERT_TRUE(obj.hasattr(1));
+  ASSERT_EQ(&attr_obj2, copy.getattr(
+    static_cast<corevm::dyobj::attr_key_t>(attr_count)));
+}
+
+// -----------------------------------------------------------------------------
+
 TEST_F(DynamicObjectUnitTest, TestGetAndSetAttrs)
 {
   dynamic_object_type obj;
@@ -0,0 +1,228 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2016 Yanzheng Li
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#include "dyobj/shape.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+
+// -----------------------------------------------------------------------------
+
+class ShapeUnitTest : public ::testing::Test
+{
+protected:
+  typedef corevm::dyobj::Shape Shape;
+
+  /**
+   * Shapes are shared by all tests, so use keys no other test uses.
+   */
+  static const corevm::dyobj::attr_key_t KEY_BASE = 0x5a5a0000;
+};
+
+// -----------------------------------------------------------------------------
+
+TEST_F(ShapeUnitTest, TestRoot)
+{
+  const Shape* root = Shape::root();
+
+  ASSERT_NE(nullptr, root);
+  ASSERT_EQ(root, Shape::root());
+  ASSERT_EQ(0, root->attr_count());
+  ASSERT_EQ(nullptr, root->parent());
+
+  size_t slot = 0;
+  ASSERT_FALSE(root->find(KEY_BASE, &slot));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(ShapeUnitTest, TestAdd)
+{
+  const Shape* root = Shape::root();
+
+  const Shape* shape1 = root->add(KEY_BASE + 1);
+  const Shape* shape2 = shape1->add(KEY_BASE + 2);
+
+  ASSERT_EQ(root, shape1->parent());
+  ASSERT_EQ(shape1, shape2->parent());
+  ASSERT_EQ(2, shape2->attr_count());
+  ASSERT_EQ(KEY_BASE + 1, shape2->key_at(0));
+  ASSERT_EQ(KEY_BASE + 2, shape2->key_at(1));
+
+  size_t slot = 0;
+  ASSERT_TRUE(shape2->find(KEY_BASE + 2, &slot));
+  ASSERT_EQ(1, slot);
+  ASSERT_FALSE(shape1->find(KEY_BASE + 2, &slot));
+
+  // Adding the same keys in the same order leads to the same shapes.
+  const size_t transition_count = root->transition_count();
+
+  ASSERT_EQ(shape1, root->add(KEY_BASE + 1));
+  ASSERT_EQ(shape2, root->add(KEY_BASE + 1)->add(KEY_BASE + 2));
+  ASSERT_EQ(transition_count, root->transition_count());
+  ASSERT_EQ(1, shape1->transition_count());
+
+  // But not in a different order.
+  const Shape* shape3 = root->add(KEY_BASE + 2)->add(KEY_BASE + 1);
+  ASSERT_NE(shape2, shape3);
+  ASSERT_EQ(transition_count + 1, root->transition_count());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(ShapeUnitTest, TestRemove)
+{
+  const Shape* root = Shape::root();
+
+  const Shape* shape = root->add(KEY_BASE + 11)->add(KEY_BASE + 12)->add(
+    KEY_BASE + 13);
+
+  const Shape* res = shape->remove(KEY_BASE + 12);
+
+  ASSERT_EQ(2, res->attr_count());
+  ASSERT_EQ(KEY_BASE + 11, res->key_at(0));
+  ASSERT_EQ(KEY_BASE + 13, res->key_at(1));
+  ASSERT_EQ(res, root->add(KEY_BASE + 11)->add(KEY_BASE + 13));
+
+  ASSERT_EQ(root, res->remove(KEY_BASE + 11)->remove(KEY_BASE + 13));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(ShapeUnitTest, TestFindOnLargeShape)
+{
+  const size_t attr_count = 64;
+
+  const Shape* shape = Shape::root();
+
+  for (size_t i = 0; i < attr_count; ++i)
+  {
+    shape = shape->add(KEY_BASE + 100 + i);
+  }
+
+  ASSERT_EQ(attr_count, shape->attr_count());
+
+  for (size_t i = 0; i < attr_count; ++i)
+  {
+    size_t slot = 0;
+    ASSERT_TRUE(shape->find(KEY_BASE + 100 + i, &slot));
+    ASSERT_EQ(i, slot);
+  }
+
+  size_t slot = 0;
+  ASSERT_FALSE(shape->find(KEY_BASE, &slot));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(ShapeUnitTest, TestAddOnSharedKeys)
+{
+  const size_t attr_count = 32;
+
+  const Shape* root = Shape::root();
+
+  std::vector<const Shape*> shapes { root };
+
+  for (size_t i = 0; i < attr_count; ++i)
+  {
+    shapes.push_back(shapes.back()->add(KEY_BASE + 200 + i));
+  }
+
+  // Shapes branching off the chain, before and after the keys get indexed,
+  // do not see the keys of the chain past them.
+  for (const size_t branch_count : { 4, 24 })
+  {
+    const Shape* parent = shapes[branch_count];
+    const Shape* branch = parent->add(KEY_BASE + 300 + branch_count);
+
+    ASSERT_EQ(parent, branch->parent());
+    ASSERT_EQ(branch_count + 1, branch->attr_count());
+    ASSERT_EQ(KEY_BASE + 300 + branch_count, branch->key_at(branch_count));
+
+    size_t slot = 0;
+    ASSERT_TRUE(branch->find(KEY_BASE + 300 + branch_count, &slot));
+    ASSERT_EQ(branch_count, slot);
+    ASSERT_FALSE(branch->find(KEY_BASE + 200 + branch_count, &slot));
+    ASSERT_FALSE(parent->find(KEY_BASE + 300 + branch_count, &slot));
+
+    for (size_t i = 0; i < branch_count; ++i)
+    {
+      ASSERT_TRUE(branch->find(KEY_BASE + 200 + i, &slot));
+      ASSERT_EQ(i, slot);
+      ASSERT_EQ(KEY_BASE + 200 + i, branch->key_at(i));
+    }
+  }
+
+  // Shapes on the chain only see their own keys.
+  for (size_t i = 0; i <= attr_count; ++i)
+  {
+    ASSERT_EQ(i, shapes[i]->attr_count());
+
+    size_t slot = 0;
+    ASSERT_EQ(i > 0, shapes[i]->find(KEY_BASE + 200, &slot));
+    ASSERT_FALSE(shapes[i]->find(KEY_BASE + 200 + i, &slot));
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(ShapeUnitTest, TestDictionary)
+{
+  const Shape* shape = Shape::root()->add(KEY_BASE + 401)->add(KEY_BASE + 402);
+
+  std::unique_ptr<Shape> dictionary(Shape::create_dictionary(shape));
+
+  ASSERT_TRUE(dictionary->is_dictionary());
+  ASSERT_FALSE(shape->is_dictionary());
+  ASSERT_EQ(nullptr, dictionary->parent());
+  ASSERT_EQ(2, dictionary->attr_count());
+
+  const size_t attr_count = 64;
+
+  for (size_t i = 0; i < attr_count; ++i)
+  {
+    dictionary->add_in_place(KEY_BASE + 500 + i);
+  }
+
+  ASSERT_EQ(attr_count + 2, dictionary->attr_count());
+  ASSERT_EQ(2, shape->attr_count());
+
+  size_t slot = 0;
+  ASSERT_TRUE(dictionary->find(KEY_BASE + 500 + 10, &slot));
+  ASSERT_EQ(12, slot);
+  ASSERT_FALSE(shape->find(KEY_BASE + 500 + 10, &slot));
+
+  // Removing a key shifts the slots of the ones after it.
+  dictionary->remove_in_place(KEY_BASE + 402);
+
+  ASSERT_EQ(attr_count + 1, dictionary->attr_count());
+  ASSERT_FALSE(dictionary->find(KEY_BASE + 402, &slot));
+  ASSERT_TRUE(dictionary->find(KEY_BASE + 500 + 10, &slot));
+  ASSERT_EQ(11, slot);
+  ASSERT_EQ(KEY_BASE + 500 + 10, dictionary->key_at(11));
+  ASSERT_EQ(0, dictionary->transition_count());
+}
+
+// -----------------------------------------------------------------------------
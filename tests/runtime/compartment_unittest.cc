@@ -23,8 +23,10 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "runtime/catch_site.h"
 #include "runtime/compartment.h"
 #include "runtime/closure.h"
+#include "runtime/instr.h"
 #include "runtime/loc_info.h"
 #include "runtime/vector.h"
+#include "dyobj/util.h"
 
 #include <gtest/gtest.h>
 
@@ -146,3 +148,604 @@ TEST_F(CompartmentUnitTest, TestGetFptLiteral)
 }
 
 // -----------------------------------------------------------------------------
+
+TEST_F(CompartmentUnitTest, TestGetDecodedVector)
+{
+  corevm::runtime::Compartment compartment("./example.core");
+
+  compartment.set_string_literal_table({ "", "Hello world" });
+  compartment.set_fpt_literal_table({ 3.14 });
+
+  corevm::runtime::Vector vector {
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::STR, 1, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::DEC2, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::UINT32, 5, 6),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::STR, 0, 0),
+  };
+  corevm::runtime::LocTable locs;
+  corevm::runtime::CatchSiteList catch_sites;
+
+  corevm::runtime::ClosureTable closure_table {
+    corevm::runtime::Closure(
+      /* name */ "__main__",
+      /* id */ 0,
+      /* parent_id */ corevm::runtime::NONESET_CLOSURE_ID,
+      /* vector */ vector,
+      /* locs */ locs,
+      /* catch_sites */ catch_sites)
+  };
+
+  compartment.set_closure_table(std::move(closure_table));
+
+  corevm::runtime::Closure* closure = nullptr;
+  compartment.get_closure_by_id(0, &closure);
+
+  ASSERT_NE(nullptr, closure);
+
+  const corevm::runtime::DecodedVector& decoded_vector =
+    compartment.get_decoded_vector(closure);
+
+  ASSERT_EQ(vector.size(), decoded_vector.size());
+
+  ASSERT_EQ(corevm::runtime::InstrEnum::STR, decoded_vector[0].code);
+  ASSERT_EQ(corevm::runtime::DecodedInstr::FLAG_STR_LITERAL, decoded_vector[0].flags);
+  ASSERT_EQ("Hello world", *decoded_vector[0].str_literal);
+  ASSERT_TRUE(decoded_vector[0].str_literal->interned());
+
+  ASSERT_EQ(corevm::runtime::InstrEnum::DEC2, decoded_vector[1].code);
+  ASSERT_EQ(corevm::runtime::DecodedInstr::FLAG_FPT_LITERAL, decoded_vector[1].flags);
+  ASSERT_EQ(3.14, decoded_vector[1].fpt_literal);
+
+  ASSERT_EQ(corevm::runtime::InstrEnum::UINT32, decoded_vector[2].code);
+  ASSERT_EQ(0, decoded_vector[2].flags);
+  ASSERT_EQ(5, decoded_vector[2].oprd1);
+  ASSERT_EQ(6, decoded_vector[2].oprd2);
+
+  ASSERT_EQ(corevm::runtime::InstrEnum::STR, decoded_vector[3].code);
+  ASSERT_EQ(0, decoded_vector[3].flags);
+  ASSERT_EQ(0, decoded_vector[3].oprd1);
+
+  // Subsequent accesses return the same decoded vector.
+  ASSERT_EQ(&decoded_vector, &compartment.get_decoded_vector(closure));
+
+  // Copies carry over decoded closures, which refer to their own literal
+  // tables.
+  corevm::runtime::Compartment compartment2(compartment);
+
+  corevm::runtime::Closure* closure2 = nullptr;
+  compartment2.get_closure_by_id(0, &closure2);
+
+  ASSERT_NE(nullptr, closure2);
+
+  const corevm::runtime::DecodedVector& decoded_vector2 =
+    compartment2.get_decoded_vector(closure2);
+
+  ASSERT_EQ("Hello world", *decoded_vector2[0].str_literal);
+  ASSERT_NE(decoded_vector[0].str_literal, decoded_vector2[0].str_literal);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(CompartmentUnitTest, TestGetDecodedVectorWithInvalidClosure)
+{
+  corevm::runtime::Compartment compartment("./example.core");
+
+  corevm::runtime::Vector vector;
+  corevm::runtime::LocTable locs;
+  corevm::runtime::CatchSiteList catch_sites;
+
+  corevm::runtime::Closure closure(
+    /* name */ "__main__",
+    /* id */ 0,
+    /* parent_id */ corevm::runtime::NONESET_CLOSURE_ID,
+    /* vector */ vector,
+    /* locs */ locs,
+    /* catch_sites */ catch_sites);
+
+  // Closure is not owned by the compartment.
+  ASSERT_THROW(
+    {
+      compartment.get_decoded_vector(&closure);
+    },
+    corevm::runtime::ClosureNotFoundError
+  );
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(CompartmentUnitTest, TestGetDecodedVectorWithInvalidInstr)
+{
+  corevm::runtime::Compartment compartment("./example.core");
+
+  corevm::runtime::Vector vector {
+    corevm::runtime::Instr(corevm::runtime::INSTR_CODE_MAX, 0, 0),
+  };
+  corevm::runtime::LocTable locs;
+  corevm::runtime::CatchSiteList catch_sites;
+
+  corevm::runtime::ClosureTable closure_table {
+    corevm::runtime::Closure(
+      /* name */ "__main__",
+      /* id */ 0,
+      /* parent_id */ corevm::runtime::NONESET_CLOSURE_ID,
+      /* vector */ vector,
+      /* locs */ locs,
+      /* catch_sites */ catch_sites)
+  };
+
+  compartment.set_closure_table(std::move(closure_table));
+
+  corevm::runtime::Closure* closure = nullptr;
+  compartment.get_closure_by_id(0, &closure);
+
+  ASSERT_NE(nullptr, closure);
+
+  ASSERT_THROW(
+    {
+      compartment.get_decoded_vector(closure);
+    },
+    corevm::runtime::InvalidInstrError
+  );
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(CompartmentUnitTest, TestGetDecodedVectorWithSuperinstrAsInput)
+{
+  corevm::runtime::Compartment compartment("./example.core");
+
+  // Superinstructions are only synthesized by decoding.
+  corevm::runtime::Vector vector {
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::PUTINVK, 0, 0),
+  };
+  corevm::runtime::LocTable locs;
+  corevm::runtime::CatchSiteList catch_sites;
+
+  corevm::runtime::ClosureTable closure_table {
+    corevm::runtime::Closure(
+      /* name */ "__main__",
+      /* id */ 0,
+      /* parent_id */ corevm::runtime::NONESET_CLOSURE_ID,
+      /* vector */ vector,
+      /* locs */ locs,
+      /* catch_sites */ catch_sites)
+  };
+
+  compartment.set_closure_table(std::move(closure_table));
+
+  corevm::runtime::Closure* closure = nullptr;
+  compartment.get_closure_by_id(0, &closure);
+
+  ASSERT_NE(nullptr, closure);
+
+  ASSERT_THROW(
+    {
+      compartment.get_decoded_vector(closure);
+    },
+    corevm::runtime::InvalidInstrError
+  );
+}
+
+// -----------------------------------------------------------------------------
+
+#if COREVM_USE_SUPERINSTRS
+
+TEST_F(CompartmentUnitTest, TestGetDecodedVectorWithSuperinstrs)
+{
+  corevm::runtime::Compartment compartment("./example.core");
+
+  compartment.set_string_literal_table({ "", "f", "x", "y", "Hello world" });
+
+  corevm::runtime::Vector vector {
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::LDOBJ, 1, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::PINVK, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::LDOBJ, 2, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::PUTARG, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::LDOBJ, 3, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::PUTARG, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::INVK, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::NEW, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::STR, 4, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::SETVAL, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::STOBJ, 2, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::NEW, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::SETVAL, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::STOBJ, 3, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::PUTARG, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::LDOBJ, 1, 0),
+  };
+  corevm::runtime::LocTable locs;
+  corevm::runtime::CatchSiteList catch_sites;
+
+  corevm::runtime::ClosureTable closure_table {
+    corevm::runtime::Closure(
+      /* name */ "__main__",
+      /* id */ 0,
+      /* parent_id */ corevm::runtime::NONESET_CLOSURE_ID,
+      /* vector */ vector,
+      /* locs */ locs,
+      /* catch_sites */ catch_sites)
+  };
+
+  compartment.set_closure_table(std::move(closure_table));
+
+  corevm::runtime::Closure* closure = nullptr;
+  compartment.get_closure_by_id(0, &closure);
+
+  ASSERT_NE(nullptr, closure);
+
+  const corevm::runtime::DecodedVector& decoded_vector =
+    compartment.get_decoded_vector(closure);
+
+  // Only the first instruction of each fused sequence is replaced, along with
+  // its code; the rest are decoded as usual.
+  const std::vector<corevm::runtime::instr_code_t> expected_codes {
+    corevm::runtime::InstrEnum::LDPINVK,
+    corevm::runtime::InstrEnum::PINVK,
+    corevm::runtime::InstrEnum::LDPUTARG,
+    corevm::runtime::InstrEnum::PUTARG,
+    corevm::runtime::InstrEnum::LDPUTINVK,
+    corevm::runtime::InstrEnum::PUTARG,
+    corevm::runtime::InstrEnum::INVK,
+    corevm::runtime::InstrEnum::NEWSTR,
+    corevm::runtime::InstrEnum::STR,
+    corevm::runtime::InstrEnum::SETVAL,
+    corevm::runtime::InstrEnum::STOBJ,
+    corevm::runtime::InstrEnum::NEWSTOBJ,
+    corevm::runtime::InstrEnum::SETVAL,
+    corevm::runtime::InstrEnum::STOBJ,
+    corevm::runtime::InstrEnum::PUTARG,
+    corevm::runtime::InstrEnum::LDOBJ,
+  };
+
+  ASSERT_EQ(expected_codes.size(), decoded_vector.size());
+
+  for (size_t i = 0; i < expected_codes.size(); ++i)
+  {
+    ASSERT_EQ(expected_codes[i], decoded_vector[i].code);
+
+    if (!(decoded_vector[i].flags & corevm::runtime::DecodedInstr::FLAG_STR_LITERAL))
+    {
+      ASSERT_EQ(vector[i].oprd1, decoded_vector[i].oprd1);
+    }
+  }
+
+  ASSERT_EQ(corevm::runtime::DecodedInstr::FLAG_STR_LITERAL, decoded_vector[8].flags);
+  ASSERT_EQ("Hello world", *decoded_vector[8].str_literal);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(CompartmentUnitTest, TestGetDecodedVectorWithInPlaceMutationSuperinstrs)
+{
+  corevm::runtime::Compartment compartment("./example.core");
+
+  compartment.set_string_literal_table({ "", "self", "other" });
+
+  corevm::runtime::Vector vector {
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::GETVAL2, 2, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::LDOBJ, 1, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::GETVAL, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::STRAPD, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::SETVAL, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::GETVAL2, 1, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::ARYAPND, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::LDOBJ, 1, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::SETVAL, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::GETVAL, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::STRLEN, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::SETVAL, 0, 0),
+  };
+  corevm::runtime::LocTable locs;
+  corevm::runtime::CatchSiteList catch_sites;
+
+  corevm::runtime::ClosureTable closure_table {
+    corevm::runtime::Closure(
+      /* name */ "__main__",
+      /* id */ 0,
+      /* parent_id */ corevm::runtime::NONESET_CLOSURE_ID,
+      /* vector */ vector,
+      /* locs */ locs,
+      /* catch_sites */ catch_sites)
+  };
+
+  compartment.set_closure_table(std::move(closure_table));
+
+  corevm::runtime::Closure* closure = nullptr;
+  compartment.get_closure_by_id(0, &closure);
+
+  ASSERT_NE(nullptr, closure);
+
+  const corevm::runtime::DecodedVector& decoded_vector =
+    compartment.get_decoded_vector(closure);
+
+  // Only instructions that mutate their operand in place are fused, which
+  // `strlen` does not.
+  const std::vector<corevm::runtime::instr_code_t> expected_codes {
+    corevm::runtime::InstrEnum::GETVAL2,
+    corevm::runtime::InstrEnum::LDOBJ,
+    corevm::runtime::InstrEnum::GETMUTVAL,
+    corevm::runtime::InstrEnum::STRAPD,
+    corevm::runtime::InstrEnum::SETVAL,
+    corevm::runtime::InstrEnum::GETMUTVAL2,
+    corevm::runtime::InstrEnum::ARYAPND,
+    corevm::runtime::InstrEnum::LDOBJ,
+    corevm::runtime::InstrEnum::SETVAL,
+    corevm::runtime::InstrEnum::GETVAL,
+    corevm::runtime::InstrEnum::STRLEN,
+    corevm::runtime::InstrEnum::SETVAL,
+  };
+
+  ASSERT_EQ(expected_codes.size(), decoded_vector.size());
+
+  for (size_t i = 0; i < expected_codes.size(); ++i)
+  {
+    ASSERT_EQ(expected_codes[i], decoded_vector[i].code);
+    ASSERT_EQ(vector[i].oprd1, decoded_vector[i].oprd1);
+  }
+}
+
+#endif /* COREVM_USE_SUPERINSTRS */
+
+// -----------------------------------------------------------------------------
+
+TEST_F(CompartmentUnitTest, TestGetAttrKey)
+{
+  corevm::runtime::Compartment compartment("./example.core");
+
+  const std::string attr_name("__init__");
+
+  compartment.set_string_literal_table({ "", attr_name });
+
+  ASSERT_EQ(2, compartment.string_literal_count());
+
+  ASSERT_EQ(corevm::dyobj::hash_attr_str(attr_name), compartment.get_attr_key(1));
+
+  // Unknown string literals are treated as empty strings.
+  ASSERT_EQ(corevm::dyobj::hash_attr_str(""), compartment.get_attr_key(0));
+  ASSERT_EQ(corevm::dyobj::hash_attr_str(""), compartment.get_attr_key(2));
+
+  corevm::runtime::Compartment compartment2(compartment);
+
+  ASSERT_EQ(corevm::dyobj::hash_attr_str(attr_name), compartment2.get_attr_key(1));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(CompartmentUnitTest, TestGetVariableLayout)
+{
+  corevm::runtime::Compartment compartment("./example.core");
+
+  const corevm::runtime::variable_key_t key1 = 1;
+  const corevm::runtime::variable_key_t key2 = 2;
+  const corevm::runtime::variable_key_t key3 = 3;
+  const corevm::runtime::variable_key_t key4 = 4;
+
+  corevm::runtime::Vector vector1 {
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::NEW, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::STOBJ, key1, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::NEW, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::STOBJ, key2, 0),
+  };
+
+  corevm::runtime::Vector vector2 {
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::GETARG, key3, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::LDOBJ, key3, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::LDOBJ, key2, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::LDOBJ, key4, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::STOBJ, key1, 0),
+  };
+
+  corevm::runtime::LocTable locs;
+  corevm::runtime::CatchSiteList catch_sites;
+
+  corevm::runtime::ClosureTable closure_table {
+    corevm::runtime::Closure(
+      /* name */ "__main__",
+      /* id */ 0,
+      /* parent_id */ corevm::runtime::NONESET_CLOSURE_ID,
+      /* vector */ vector1,
+      /* locs */ locs,
+      /* catch_sites */ catch_sites),
+    corevm::runtime::Closure(
+      /* name */ "inner",
+      /* id */ 1,
+      /* parent_id */ 0,
+      /* vector */ vector2,
+      /* locs */ locs,
+      /* catch_sites */ catch_sites)
+  };
+
+  compartment.set_closure_table(std::move(closure_table));
+
+  corevm::runtime::Closure* closure1 = nullptr;
+  corevm::runtime::Closure* closure2 = nullptr;
+  compartment.get_closure_by_id(0, &closure1);
+  compartment.get_closure_by_id(1, &closure2);
+
+  const corevm::runtime::VariableLayout* layout1 =
+    compartment.get_variable_layout(closure1);
+  const corevm::runtime::VariableLayout* layout2 =
+    compartment.get_variable_layout(closure2);
+
+  ASSERT_NE(nullptr, layout1);
+  ASSERT_NE(nullptr, layout2);
+
+  const std::vector<corevm::runtime::variable_key_t> expected_keys1 { key1, key2 };
+  const std::vector<corevm::runtime::variable_key_t> expected_keys2 { key3, key1 };
+
+  ASSERT_EQ(expected_keys1, layout1->keys);
+  ASSERT_EQ(expected_keys2, layout2->keys);
+
+  corevm::runtime::Closure closure3;
+  ASSERT_EQ(nullptr, compartment.get_variable_layout(&closure3));
+
+  const corevm::runtime::DecodedVector& decoded_vector =
+    compartment.get_decoded_vector(closure2);
+
+  const auto flag = corevm::runtime::DecodedInstr::FLAG_VAR_ADDR;
+
+  // GETARG
+  ASSERT_EQ(flag, decoded_vector[0].flags);
+  ASSERT_EQ(corevm::runtime::VariableLayout::encode_addr(0, 0),
+    decoded_vector[0].oprd2);
+
+  // LDOBJ of a variable of the closure itself.
+  ASSERT_EQ(flag, decoded_vector[1].flags);
+  ASSERT_EQ(corevm::runtime::VariableLayout::encode_addr(0, 0),
+    decoded_vector[1].oprd2);
+
+  // LDOBJ of a variable of the parent closure.
+  ASSERT_EQ(flag, decoded_vector[2].flags);
+  ASSERT_EQ(1, corevm::runtime::VariableLayout::decode_depth(
+    decoded_vector[2].oprd2));
+  ASSERT_EQ(1, corevm::runtime::VariableLayout::decode_slot(
+    decoded_vector[2].oprd2));
+
+  // LDOBJ of an unknown variable is left to the dynamic lookup.
+  ASSERT_EQ(0, decoded_vector[3].flags);
+
+  // STOBJ
+  ASSERT_EQ(flag, decoded_vector[4].flags);
+  ASSERT_EQ(corevm::runtime::VariableLayout::encode_addr(0, 1),
+    decoded_vector[4].oprd2);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(CompartmentUnitTest, TestGetEvalStackDepth)
+{
+  corevm::runtime::Compartment compartment("./example.core");
+
+  corevm::runtime::Vector vector1 {
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::NEW, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::STOBJ, 1, 0),
+  };
+
+  corevm::runtime::Vector vector2 {
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::INT32, 1, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::INT32, 2, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::ADD, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::LDOBJ, 1, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::SETVAL, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::SETVAL, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::SETVAL, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::GETVAL, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::STR, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::STR, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::STR, 0, 0),
+  };
+
+  corevm::runtime::LocTable locs;
+  corevm::runtime::CatchSiteList catch_sites;
+
+  corevm::runtime::ClosureTable closure_table {
+    corevm::runtime::Closure(
+      /* name */ "__main__",
+      /* id */ 0,
+      /* parent_id */ corevm::runtime::NONESET_CLOSURE_ID,
+      /* vector */ vector1,
+      /* locs */ locs,
+      /* catch_sites */ catch_sites),
+    corevm::runtime::Closure(
+      /* name */ "inner",
+      /* id */ 1,
+      /* parent_id */ 0,
+      /* vector */ vector2,
+      /* locs */ locs,
+      /* catch_sites */ catch_sites)
+  };
+
+  compartment.set_closure_table(std::move(closure_table));
+
+  corevm::runtime::Closure* closure1 = nullptr;
+  corevm::runtime::Closure* closure2 = nullptr;
+  compartment.get_closure_by_id(0, &closure1);
+  compartment.get_closure_by_id(1, &closure2);
+
+  ASSERT_EQ(0, compartment.get_eval_stack_depth(closure1));
+
+  // Pops off an empty eval stack do not count towards later pushes.
+  ASSERT_EQ(4, compartment.get_eval_stack_depth(closure2));
+
+  corevm::runtime::Closure closure3;
+  ASSERT_EQ(0, compartment.get_eval_stack_depth(&closure3));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(CompartmentUnitTest, TestGetExcTable)
+{
+  corevm::runtime::Compartment compartment("./example.core");
+
+  corevm::runtime::Vector vector;
+  corevm::runtime::LocTable locs;
+
+  corevm::runtime::CatchSiteList catch_sites1;
+  corevm::runtime::CatchSiteList catch_sites2 {
+    corevm::runtime::CatchSite(2, 3, 10),
+    corevm::runtime::CatchSite(0, 5, 20),
+  };
+
+  corevm::runtime::ClosureTable closure_table {
+    corevm::runtime::Closure(
+      /* name */ "__main__",
+      /* id */ 0,
+      /* parent_id */ corevm::runtime::NONESET_CLOSURE_ID,
+      /* vector */ vector,
+      /* locs */ locs,
+      /* catch_sites */ catch_sites1),
+    corevm::runtime::Closure(
+      /* name */ "inner",
+      /* id */ 1,
+      /* parent_id */ 0,
+      /* vector */ vector,
+      /* locs */ locs,
+      /* catch_sites */ catch_sites2)
+  };
+
+  compartment.set_closure_table(std::move(closure_table));
+
+  corevm::runtime::Closure* closure1 = nullptr;
+  corevm::runtime::Closure* closure2 = nullptr;
+  compartment.get_closure_by_id(0, &closure1);
+  compartment.get_closure_by_id(1, &closure2);
+
+  const corevm::runtime::ExcTable* exc_table1 =
+    compartment.get_exc_table(closure1);
+  const corevm::runtime::ExcTable* exc_table2 =
+    compartment.get_exc_table(closure2);
+
+  ASSERT_NE(nullptr, exc_table1);
+  ASSERT_NE(nullptr, exc_table2);
+
+  ASSERT_TRUE(exc_table1->empty());
+  ASSERT_EQ(3, exc_table2->size());
+
+  int64_t dst = 0;
+
+  ASSERT_TRUE(exc_table2->find(1, &dst));
+  ASSERT_EQ(20, dst);
+
+  ASSERT_TRUE(exc_table2->find(3, &dst));
+  ASSERT_EQ(10, dst);
+
+  ASSERT_FALSE(exc_table2->find(6, &dst));
+
+  // Tables are carried over by copies.
+  corevm::runtime::Compartment compartment2(compartment);
+
+  corevm::runtime::Closure* closure3 = nullptr;
+  compartment2.get_closure_by_id(1, &closure3);
+
+  const corevm::runtime::ExcTable* exc_table3 =
+    compartment2.get_exc_table(closure3);
+
+  ASSERT_NE(nullptr, exc_table3);
+  ASSERT_EQ(3, exc_table3->size());
+
+  corevm::runtime::Closure closure4;
+  ASSERT_EQ(nullptr, compartment.get_exc_table(&closure4));
+}
+
+// -----------------------------------------------------------------------------
@@ -0,0 +1,158 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2016 Yanzheng Li
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#include "runtime/catch_site.h"
+#include "runtime/exc_table.h"
+
+#include <gtest/gtest.h>
+
+
+// -----------------------------------------------------------------------------
+
+class ExcTableUnitTest : public ::testing::Test
+{
+protected:
+  /**
+   * Checks that the table resolves every address in the specified range
+   * the same way as a linear search over the catch sites does.
+   */
+  void check_against_catch_sites(const corevm::runtime::ExcTable& table,
+    const corevm::runtime::CatchSiteList& catch_sites,
+    int64_t from, int64_t to)
+  {
+    for (int64_t addr = from; addr <= to; ++addr)
+    {
+      int64_t expected_dst = -1;
+      int64_t actual_dst = -1;
+
+      const bool expected_res = corevm::runtime::ExcTable::find(
+        catch_sites, addr, &expected_dst);
+      const bool actual_res = table.find(addr, &actual_dst);
+
+      ASSERT_EQ(expected_res, actual_res);
+      ASSERT_EQ(expected_dst, actual_dst);
+    }
+  }
+};
+
+// -----------------------------------------------------------------------------
+
+TEST_F(ExcTableUnitTest, TestInitialization)
+{
+  corevm::runtime::ExcTable table;
+
+  ASSERT_TRUE(table.empty());
+
+  int64_t dst = 0;
+  ASSERT_FALSE(table.find(0, &dst));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(ExcTableUnitTest, TestDisjointCatchSites)
+{
+  corevm::runtime::CatchSiteList catch_sites {
+    corevm::runtime::CatchSite(10, 19, 100),
+    corevm::runtime::CatchSite(0, 4, 200),
+    corevm::runtime::CatchSite(20, 20, 300),
+  };
+
+  corevm::runtime::ExcTable table(catch_sites);
+
+  ASSERT_EQ(3, table.size());
+
+  ASSERT_EQ(0, table[0].from);
+  ASSERT_EQ(4, table[0].to);
+  ASSERT_EQ(200, table[0].dst);
+
+  ASSERT_EQ(10, table[1].from);
+  ASSERT_EQ(19, table[1].to);
+  ASSERT_EQ(100, table[1].dst);
+
+  ASSERT_EQ(20, table[2].from);
+  ASSERT_EQ(20, table[2].to);
+  ASSERT_EQ(300, table[2].dst);
+
+  check_against_catch_sites(table, catch_sites, -2, 25);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(ExcTableUnitTest, TestNestedCatchSites)
+{
+  // Inner try blocks are listed ahead of outer ones.
+  corevm::runtime::CatchSiteList catch_sites {
+    corevm::runtime::CatchSite(4, 6, 100),
+    corevm::runtime::CatchSite(12, 13, 200),
+    corevm::runtime::CatchSite(2, 15, 300),
+    corevm::runtime::CatchSite(0, 20, 400),
+  };
+
+  corevm::runtime::ExcTable table(catch_sites);
+
+  ASSERT_EQ(7, table.size());
+
+  int64_t dst = 0;
+
+  ASSERT_TRUE(table.find(5, &dst));
+  ASSERT_EQ(100, dst);
+
+  ASSERT_TRUE(table.find(9, &dst));
+  ASSERT_EQ(300, dst);
+
+  ASSERT_TRUE(table.find(20, &dst));
+  ASSERT_EQ(400, dst);
+
+  ASSERT_FALSE(table.find(21, &dst));
+
+  check_against_catch_sites(table, catch_sites, -2, 25);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(ExcTableUnitTest, TestShadowedCatchSites)
+{
+  // Catch sites listed after one that covers them are never reached, and
+  // empty ones are ignored.
+  corevm::runtime::CatchSiteList catch_sites {
+    corevm::runtime::CatchSite(0, 9, 100),
+    corevm::runtime::CatchSite(3, 5, 200),
+    corevm::runtime::CatchSite(8, 12, 300),
+    corevm::runtime::CatchSite(14, 13, 400),
+  };
+
+  corevm::runtime::ExcTable table(catch_sites);
+
+  ASSERT_EQ(2, table.size());
+
+  ASSERT_EQ(0, table[0].from);
+  ASSERT_EQ(9, table[0].to);
+  ASSERT_EQ(100, table[0].dst);
+
+  ASSERT_EQ(10, table[1].from);
+  ASSERT_EQ(12, table[1].to);
+  ASSERT_EQ(300, table[1].dst);
+
+  check_against_catch_sites(table, catch_sites, -2, 16);
+}
+
+// -----------------------------------------------------------------------------
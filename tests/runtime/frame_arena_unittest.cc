@@ -0,0 +1,165 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2016 Yanzheng Li
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#include "runtime/frame_arena.h"
+#include "runtime/common.h"
+#include "runtime/closure.h"
+#include "runtime/compartment.h"
+#include "runtime/frame.h"
+#include "runtime/runtime_types.h"
+#include "types/native_type_value.h"
+
+#include <gtest/gtest.h>
+
+
+class FrameArenaUnitTest : public ::testing::Test
+{
+protected:
+  FrameArenaUnitTest()
+    :
+    m_compartment(""),
+    m_closure_ctx(corevm::runtime::NONESET_COMPARTMENT_ID, corevm::runtime::NONESET_CLOSURE_ID),
+    m_closure()
+  {
+  }
+
+  corevm::runtime::Compartment m_compartment;
+  corevm::runtime::ClosureCtx m_closure_ctx;
+  corevm::runtime::Closure m_closure;
+};
+
+// -----------------------------------------------------------------------------
+
+TEST_F(FrameArenaUnitTest, TestInitialization)
+{
+  corevm::runtime::FrameArena arena;
+
+  ASSERT_EQ(0, arena.size());
+  ASSERT_TRUE(arena.empty());
+  ASSERT_EQ(0, arena.capacity());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(FrameArenaUnitTest, TestPushAndPop)
+{
+  corevm::runtime::FrameArena arena;
+
+  const corevm::runtime::instr_addr_t return_addr = 10;
+
+  arena.emplace_back(m_closure_ctx, &m_compartment, &m_closure, return_addr);
+
+  ASSERT_EQ(1, arena.size());
+  ASSERT_EQ(return_addr, arena.back().return_addr());
+
+  corevm::runtime::Frame frame(m_closure_ctx, &m_compartment, &m_closure);
+  arena.push_back(frame);
+
+  ASSERT_EQ(2, arena.size());
+  ASSERT_EQ(corevm::runtime::NONESET_INSTR_ADDR, arena.back().return_addr());
+  ASSERT_EQ(&arena[1], &arena.back());
+
+  arena.pop_back();
+  arena.pop_back();
+
+  ASSERT_TRUE(arena.empty());
+  ASSERT_EQ(2, arena.capacity());
+
+  arena.clear();
+  ASSERT_EQ(0, arena.capacity());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(FrameArenaUnitTest, TestFramesAreRecycled)
+{
+  corevm::runtime::FrameArena arena;
+
+  arena.emplace_back(m_closure_ctx, &m_compartment, &m_closure, 1);
+  arena.emplace_back(m_closure_ctx, &m_compartment, &m_closure, 2);
+
+  corevm::runtime::Frame* frame1 = &arena[0];
+  corevm::runtime::Frame* frame2 = &arena[1];
+
+  corevm::runtime::RuntimeTypes::dynamic_object_type obj;
+
+  frame2->set_visible_var(1, &obj);
+  frame2->set_invisible_var(2, &obj);
+  frame2->set_exc_obj(&obj);
+  frame2->push_eval_stack(corevm::types::uint32(5));
+  frame2->set_parent(frame1);
+
+  arena.pop_back();
+
+  ASSERT_EQ(0, frame2->eval_stack_size());
+
+  arena.emplace_back(m_closure_ctx, &m_compartment, &m_closure, 3);
+
+  // Frames stay in place, and come back as new.
+  ASSERT_EQ(frame1, &arena[0]);
+  ASSERT_EQ(frame2, &arena[1]);
+  ASSERT_EQ(2, arena.capacity());
+
+  ASSERT_EQ(3, frame2->return_addr());
+  ASSERT_EQ(corevm::runtime::NONESET_INSTR_ADDR, frame2->pc());
+  ASSERT_EQ(0, frame2->visible_var_count());
+  ASSERT_EQ(0, frame2->invisible_var_count());
+  ASSERT_EQ(0, frame2->eval_stack_size());
+  ASSERT_EQ(NULL, frame2->exc_obj());
+  ASSERT_EQ(nullptr, frame2->parent());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(FrameArenaUnitTest, TestEvalStacksOnOperandStack)
+{
+  corevm::runtime::FrameArena arena;
+
+  arena.emplace_back(m_closure_ctx, &m_compartment, &m_closure, 1);
+  arena.back().push_eval_stack(corevm::types::uint32(1));
+
+  arena.emplace_back(m_closure_ctx, &m_compartment, &m_closure, 2);
+  arena.back().push_eval_stack(corevm::types::uint32(2));
+
+  corevm::runtime::Frame& frame1 = arena[0];
+  corevm::runtime::Frame& frame2 = arena[1];
+
+  // Eval stacks of consecutive frames are laid out next to each other.
+  ASSERT_EQ(&frame1.eval_stack_element(0) + frame1.eval_stack_capacity(),
+    &frame2.eval_stack_element(0));
+  ASSERT_EQ(1, arena.operand_stack().chunk_count());
+
+  corevm::types::NativeTypeValue* window = &frame2.eval_stack_element(0);
+
+  arena.pop_back();
+
+  ASSERT_TRUE(arena.operand_stack().is_top(
+    &frame1.eval_stack_element(0) + frame1.eval_stack_capacity()));
+
+  // Windows of popped frames are reused.
+  arena.emplace_back(m_closure_ctx, &m_compartment, &m_closure, 3);
+  arena.back().push_eval_stack(corevm::types::uint32(3));
+
+  ASSERT_EQ(window, &arena.back().eval_stack_element(0));
+}
+
+// -----------------------------------------------------------------------------
@@ -0,0 +1,160 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2016 Yanzheng Li
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#include "runtime/closure.h"
+#include "runtime/closure_ctx.h"
+#include "runtime/common.h"
+#include "runtime/compartment.h"
+#include "runtime/frame.h"
+#include "runtime/frame_cache.h"
+
+#include <gtest/gtest.h>
+
+
+// -----------------------------------------------------------------------------
+
+class FrameCacheUnitTest : public ::testing::Test
+{
+protected:
+  FrameCacheUnitTest()
+    :
+    m_compartment(""),
+    m_closure()
+  {
+  }
+
+  corevm::runtime::Compartment m_compartment;
+  corevm::runtime::Closure m_closure;
+};
+
+// -----------------------------------------------------------------------------
+
+TEST_F(FrameCacheUnitTest, TestInsertAndEraseFrames)
+{
+  corevm::runtime::ClosureCtx ctx1(0, 0);
+  corevm::runtime::ClosureCtx ctx2(0, 3);
+  corevm::runtime::ClosureCtx ctx3(2, 0);
+
+  corevm::runtime::Frame frame1(ctx1, &m_compartment, &m_closure);
+  corevm::runtime::Frame frame2(ctx2, &m_compartment, &m_closure);
+  corevm::runtime::Frame frame3(ctx3, &m_compartment, &m_closure);
+
+  corevm::runtime::FrameCache cache;
+
+  ASSERT_EQ(nullptr, cache.frame_of(ctx1));
+
+  cache.insert_frame(&frame1);
+  cache.insert_frame(&frame2);
+  cache.insert_frame(&frame3);
+
+  ASSERT_EQ(&frame1, cache.frame_of(ctx1));
+  ASSERT_EQ(&frame2, cache.frame_of(ctx2));
+  ASSERT_EQ(&frame3, cache.frame_of(ctx3));
+  ASSERT_EQ(nullptr, cache.frame_of(corevm::runtime::ClosureCtx(0, 1)));
+  ASSERT_EQ(nullptr, cache.frame_of(corevm::runtime::ClosureCtx(1, 0)));
+  ASSERT_EQ(nullptr, cache.frame_of(corevm::runtime::ClosureCtx(3, 0)));
+
+  cache.erase_frame(&frame3);
+  cache.erase_frame(&frame2);
+
+  ASSERT_EQ(&frame1, cache.frame_of(ctx1));
+  ASSERT_EQ(nullptr, cache.frame_of(ctx2));
+  ASSERT_EQ(nullptr, cache.frame_of(ctx3));
+
+  cache.erase_frame(&frame1);
+
+  ASSERT_EQ(nullptr, cache.frame_of(ctx1));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(FrameCacheUnitTest, TestRecursiveFrames)
+{
+  corevm::runtime::ClosureCtx ctx(0, 1);
+
+  corevm::runtime::Frame frame1(ctx, &m_compartment, &m_closure);
+  corevm::runtime::Frame frame2(ctx, &m_compartment, &m_closure);
+  corevm::runtime::Frame frame3(ctx, &m_compartment, &m_closure);
+
+  corevm::runtime::FrameCache cache;
+
+  cache.insert_frame(&frame1);
+  cache.insert_frame(&frame2);
+  cache.insert_frame(&frame3);
+
+  // The bottom-most frame of the closure context is kept.
+  ASSERT_EQ(&frame1, cache.frame_of(ctx));
+
+  cache.erase_frame(&frame3);
+  cache.erase_frame(&frame2);
+
+  ASSERT_EQ(&frame1, cache.frame_of(ctx));
+
+  cache.erase_frame(&frame1);
+
+  ASSERT_EQ(nullptr, cache.frame_of(ctx));
+
+  cache.insert_frame(&frame2);
+
+  ASSERT_EQ(&frame2, cache.frame_of(ctx));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(FrameCacheUnitTest, TestFramesWithoutClosureCtx)
+{
+  corevm::runtime::ClosureCtx ctx(corevm::runtime::NONESET_COMPARTMENT_ID,
+    corevm::runtime::NONESET_CLOSURE_ID);
+
+  corevm::runtime::Frame frame(ctx, &m_compartment, &m_closure);
+
+  corevm::runtime::FrameCache cache;
+
+  cache.insert_frame(&frame);
+
+  ASSERT_EQ(nullptr, cache.frame_of(ctx));
+
+  cache.erase_frame(&frame);
+
+  ASSERT_EQ(nullptr, cache.frame_of(ctx));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(FrameCacheUnitTest, TestClear)
+{
+  corevm::runtime::ClosureCtx ctx(1, 2);
+
+  corevm::runtime::Frame frame(ctx, &m_compartment, &m_closure);
+
+  corevm::runtime::FrameCache cache;
+
+  cache.insert_frame(&frame);
+
+  ASSERT_EQ(&frame, cache.frame_of(ctx));
+
+  cache.clear();
+
+  ASSERT_EQ(nullptr, cache.frame_of(ctx));
+}
+
+// -----------------------------------------------------------------------------
@@ -21,10 +21,16 @@ IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
 CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 *******************************************************************************/
 #include "runtime/frame.h"
+#include "runtime/catch_site.h"
 #include "runtime/common.h"
 #include "runtime/closure.h"
 #include "runtime/compartment.h"
+#include "runtime/instr.h"
+#include "runtime/loc_info.h"
+#include "runtime/operand_stack.h"
 #include "runtime/runtime_types.h"
+#include "runtime/variable_layout.h"
+#include "runtime/vector.h"
 #include "types/native_type_value.h"
 
 #include <gtest/gtest.h>
@@ -122,6 +128,170 @@ TEST_F(FrameUnitTest, TestMovePushAndPopEvalStack)
 
 // -----------------------------------------------------------------------------
 
+TEST_F(FrameUnitTest, TestEvalStackOnOperandStack)
+{
+  corevm::runtime::Frame::operand_stack_type operand_stack;
+
+  corevm::runtime::Frame frame1(m_closure_ctx, m_compartment, &m_closure);
+  corevm::runtime::Frame frame2(m_closure_ctx, m_compartment, &m_closure);
+
+  frame1.set_operand_stack(&operand_stack);
+  frame2.set_operand_stack(&operand_stack);
+
+  // Windows are reserved on first push.
+  ASSERT_EQ(0, frame1.eval_stack_capacity());
+
+  frame1.push_eval_stack(corevm::types::uint32(1));
+
+  ASSERT_EQ(1, frame1.eval_stack_size());
+  ASSERT_EQ(1, operand_stack.chunk_count());
+
+  corevm::types::NativeTypeValue* window = &frame1.eval_stack_element(0);
+
+  // The window on top of the operand stack grows in place.
+  const size_t capacity = frame1.eval_stack_capacity();
+
+  while (frame1.eval_stack_size() <= capacity)
+  {
+    frame1.push_eval_stack(corevm::types::uint32(2));
+  }
+
+  ASSERT_LT(capacity, frame1.eval_stack_capacity());
+
+  ASSERT_EQ(window, &frame1.eval_stack_element(0));
+
+  while (frame1.eval_stack_size() > 2)
+  {
+    frame1.pop_eval_stack();
+  }
+
+  ASSERT_EQ(2, frame1.eval_stack_size());
+  ASSERT_EQ(1, operand_stack.chunk_count());
+  ASSERT_TRUE(operand_stack.is_top(
+    &frame1.eval_stack_element(0) + frame1.eval_stack_capacity()));
+
+  frame2.push_eval_stack(corevm::types::uint32(3));
+
+  ASSERT_EQ(&frame1.eval_stack_element(0) + frame1.eval_stack_capacity(),
+    &frame2.eval_stack_element(0));
+
+  // Windows below the top move to buffers of their own once full.
+  for (uint32_t i = 3; i <= 100; ++i)
+  {
+    frame1.push_eval_stack(corevm::types::uint32(i));
+  }
+
+  ASSERT_EQ(100, frame1.eval_stack_size());
+
+  for (uint32_t i = 100; i > 0; --i)
+  {
+    ASSERT_EQ(i, corevm::types::get_intrinsic_value_from_type_value<uint32_t>(
+      frame1.pop_eval_stack()));
+  }
+
+  ASSERT_EQ(3, corevm::types::get_intrinsic_value_from_type_value<uint32_t>(
+    frame2.top_eval_stack()));
+
+  frame2.release_eval_stack();
+
+  ASSERT_EQ(0, frame2.eval_stack_size());
+  ASSERT_EQ(0, frame2.eval_stack_capacity());
+
+  frame1.release_eval_stack();
+
+  // Both windows are released.
+  corevm::runtime::Frame::operand_stack_type::Mark mark;
+  ASSERT_EQ(window, operand_stack.allocate(1, &mark));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(FrameUnitTest, TestEvalStackPastEstimatedDepth)
+{
+  // A loop that pushes an operand on every iteration, which the estimate of
+  // the eval stack depth counts once.
+  corevm::runtime::Vector vector {
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::UINT32, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::JMP, 0, 0),
+  };
+
+  corevm::runtime::LocTable locs;
+  corevm::runtime::CatchSiteList catch_sites;
+
+  corevm::runtime::ClosureTable closure_table {
+    corevm::runtime::Closure("__main__", 0, corevm::runtime::NONESET_CLOSURE_ID,
+      vector, locs, catch_sites)
+  };
+
+  m_compartment->set_closure_table(std::move(closure_table));
+
+  corevm::runtime::Closure* closure = nullptr;
+  m_compartment->get_closure_by_id(0, &closure);
+
+  ASSERT_EQ(1, m_compartment->get_eval_stack_depth(closure));
+
+  corevm::runtime::Frame::operand_stack_type operand_stack;
+
+  corevm::runtime::Frame frame1(m_closure_ctx, m_compartment, closure);
+  corevm::runtime::Frame frame2(m_closure_ctx, m_compartment, closure);
+
+  frame1.set_operand_stack(&operand_stack);
+  frame2.set_operand_stack(&operand_stack);
+
+  frame1.push_eval_stack(corevm::types::uint32(0));
+  frame2.push_eval_stack(corevm::types::uint32(0));
+
+  // The window of the first frame can no longer grow in place.
+  for (uint32_t i = 1; i < 1000; ++i)
+  {
+    frame1.push_eval_stack(corevm::types::uint32(i));
+  }
+
+  ASSERT_EQ(1000, frame1.eval_stack_size());
+
+  for (uint32_t i = 1000; i > 0; --i)
+  {
+    ASSERT_EQ(i - 1,
+      corevm::types::get_intrinsic_value_from_type_value<uint32_t>(
+        frame1.pop_eval_stack()));
+  }
+
+  ASSERT_EQ(1, frame2.eval_stack_size());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(FrameUnitTest, TestCopyEvalStack)
+{
+  corevm::runtime::Frame::operand_stack_type operand_stack;
+
+  corevm::runtime::Frame frame(m_closure_ctx, m_compartment, &m_closure);
+  frame.set_operand_stack(&operand_stack);
+
+  frame.push_eval_stack(corevm::types::uint32(1));
+  frame.push_eval_stack(corevm::types::string("Hello world"));
+
+  corevm::runtime::Frame frame_copy(frame);
+  corevm::runtime::Frame frame_assigned(m_closure_ctx, m_compartment, &m_closure);
+  frame_assigned.push_eval_stack(corevm::types::uint32(2));
+  frame_assigned = frame;
+
+  frame.release_eval_stack();
+
+  for (auto other : { &frame_copy, &frame_assigned })
+  {
+    ASSERT_EQ(2, other->eval_stack_size());
+    ASSERT_EQ(corevm::types::string("Hello world"),
+      corevm::types::get_intrinsic_value_from_type_value<corevm::types::string>(
+        other->eval_stack_element(1)));
+    ASSERT_EQ(1,
+      corevm::types::get_intrinsic_value_from_type_value<uint32_t>(
+        other->eval_stack_element(0)));
+  }
+}
+
+// -----------------------------------------------------------------------------
+
 TEST_F(FrameUnitTest, TestVisibleVars)
 {
   corevm::runtime::Frame frame(m_closure_ctx, m_compartment, &m_closure);
@@ -150,6 +320,157 @@ TEST_F(FrameUnitTest, TestVisibleVars)
 
 // -----------------------------------------------------------------------------
 
+TEST_F(FrameUnitTest, TestVisibleVarsWithVariableLayout)
+{
+  const corevm::runtime::variable_key_t key1 = 1;
+  const corevm::runtime::variable_key_t key2 = 2;
+  const corevm::runtime::variable_key_t key3 = 3;
+
+  corevm::runtime::Vector vector1 {
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::STOBJ, key1, 0),
+  };
+
+  corevm::runtime::Vector vector2 {
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::STOBJ, key2, 0),
+  };
+
+  corevm::runtime::LocTable locs;
+  corevm::runtime::CatchSiteList catch_sites;
+
+  corevm::runtime::ClosureTable closure_table {
+    corevm::runtime::Closure("__main__", 0, corevm::runtime::NONESET_CLOSURE_ID,
+      vector1, locs, catch_sites),
+    corevm::runtime::Closure("inner", 1, 0, vector2, locs, catch_sites)
+  };
+
+  m_compartment->set_closure_table(std::move(closure_table));
+
+  corevm::runtime::Closure* closure1 = nullptr;
+  corevm::runtime::Closure* closure2 = nullptr;
+  m_compartment->get_closure_by_id(0, &closure1);
+  m_compartment->get_closure_by_id(1, &closure2);
+
+  corevm::runtime::Frame frame1(m_closure_ctx, m_compartment, closure1);
+  corevm::runtime::Frame frame2(m_closure_ctx, m_compartment, closure2);
+  frame2.set_parent(&frame1);
+
+  ASSERT_EQ(m_compartment->get_variable_layout(closure2), frame2.variable_layout());
+
+  corevm::runtime::RuntimeTypes::dynamic_object_type obj1;
+  corevm::runtime::RuntimeTypes::dynamic_object_type obj2;
+  corevm::runtime::Frame::dyobj_ptr res = NULL;
+
+  // Not set yet.
+  ASSERT_FALSE(frame2.get_visible_var_at(1, 0, key1, &res));
+
+  frame1.set_visible_var(key1, &obj1);
+  frame2.set_visible_var_at(0, &obj2);
+
+  ASSERT_TRUE(frame2.get_visible_var_at(1, 0, key1, &res));
+  ASSERT_EQ(&obj1, res);
+
+  ASSERT_TRUE(frame2.get_visible_var_at(0, 0, key2, &res));
+  ASSERT_EQ(&obj2, res);
+  ASSERT_EQ(&obj2, frame2.get_visible_var(key2));
+
+  // Mismatching key.
+  ASSERT_FALSE(frame2.get_visible_var_at(0, 0, key1, &res));
+
+  // Variables created under other names shadow the ones of the parents.
+  frame2.set_visible_var(key3, &obj2);
+  ASSERT_FALSE(frame2.get_visible_var_at(1, 0, key1, &res));
+
+  ASSERT_EQ(2, frame2.visible_var_count());
+  ASSERT_EQ(2, frame2.get_visible_objs().size());
+
+  const std::vector<corevm::runtime::variable_key_t> expected_keys { key2, key3 };
+  ASSERT_EQ(expected_keys, frame2.visible_var_keys());
+
+  ASSERT_EQ(&obj2, frame2.pop_visible_var(key2));
+  ASSERT_FALSE(frame2.get_visible_var_fast(key2, &res));
+  ASSERT_EQ(1, frame2.visible_var_count());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(FrameUnitTest, TestVisibleVarsWithVariableLayoutAndSkippedParent)
+{
+  const corevm::runtime::variable_key_t key1 = 1;
+  const corevm::runtime::variable_key_t key2 = 2;
+
+  // The module and the outer closure both store `key1`, which the innermost
+  // closure loads from the outer one, two lexical levels up.
+  corevm::runtime::Vector module_vector {
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::STOBJ, key1, 0),
+  };
+
+  corevm::runtime::Vector outer_vector {
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::STOBJ, key1, 0),
+  };
+
+  corevm::runtime::Vector middle_vector {
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::STOBJ, key2, 0),
+  };
+
+  corevm::runtime::Vector inner_vector {
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::LDOBJ, key1, 0),
+  };
+
+  corevm::runtime::LocTable locs;
+  corevm::runtime::CatchSiteList catch_sites;
+
+  corevm::runtime::ClosureTable closure_table {
+    corevm::runtime::Closure("__main__", 0, corevm::runtime::NONESET_CLOSURE_ID,
+      module_vector, locs, catch_sites),
+    corevm::runtime::Closure("outer", 1, 0, outer_vector, locs, catch_sites),
+    corevm::runtime::Closure("middle", 2, 1, middle_vector, locs, catch_sites),
+    corevm::runtime::Closure("inner", 3, 2, inner_vector, locs, catch_sites)
+  };
+
+  m_compartment->set_closure_table(std::move(closure_table));
+
+  corevm::runtime::Closure* module_closure = nullptr;
+  corevm::runtime::Closure* outer_closure = nullptr;
+  corevm::runtime::Closure* inner_closure = nullptr;
+  m_compartment->get_closure_by_id(0, &module_closure);
+  m_compartment->get_closure_by_id(1, &outer_closure);
+  m_compartment->get_closure_by_id(3, &inner_closure);
+
+  const corevm::runtime::DecodedInstr& instr =
+    m_compartment->get_decoded_vector(inner_closure)[0];
+
+  ASSERT_TRUE(instr.flags & corevm::runtime::DecodedInstr::FLAG_VAR_ADDR);
+
+  const uint32_t depth = corevm::runtime::VariableLayout::decode_depth(instr.oprd2);
+  const uint32_t slot = corevm::runtime::VariableLayout::decode_slot(instr.oprd2);
+
+  ASSERT_EQ(2, depth);
+  ASSERT_EQ(0, slot);
+
+  // The middle closure has returned, so the parent frame of the innermost one
+  // is the one of the outer closure.
+  corevm::runtime::Frame module_frame(m_closure_ctx, m_compartment, module_closure);
+  corevm::runtime::Frame outer_frame(m_closure_ctx, m_compartment, outer_closure);
+  corevm::runtime::Frame inner_frame(m_closure_ctx, m_compartment, inner_closure);
+  outer_frame.set_parent(&module_frame);
+  inner_frame.set_parent(&outer_frame);
+
+  corevm::runtime::RuntimeTypes::dynamic_object_type obj1;
+  corevm::runtime::RuntimeTypes::dynamic_object_type obj2;
+  corevm::runtime::Frame::dyobj_ptr res = NULL;
+
+  module_frame.set_visible_var_at(0, &obj1);
+  outer_frame.set_visible_var_at(0, &obj2);
+
+  // The address does not hold, as the frame two levels up is the module's.
+  ASSERT_FALSE(inner_frame.get_visible_var_at(depth, slot, key1, &res));
+
+  ASSERT_TRUE(inner_frame.get_visible_var_through_ancestry(key1, &res));
+  ASSERT_EQ(&obj2, res);
+}
+
+// -----------------------------------------------------------------------------
+
 TEST_F(FrameUnitTest, TestInvisibleVars)
 {
   corevm::runtime::Frame frame(m_closure_ctx, m_compartment, &m_closure);
@@ -178,6 +499,31 @@ TEST_F(FrameUnitTest, TestInvisibleVars)
 
 // -----------------------------------------------------------------------------
 
+TEST_F(FrameUnitTest, TestIterateObjs)
+{
+  corevm::runtime::Frame frame(m_closure_ctx, m_compartment, &m_closure);
+  corevm::runtime::RuntimeTypes::dynamic_object_type obj1;
+  corevm::runtime::RuntimeTypes::dynamic_object_type obj2;
+
+  frame.set_visible_var(1, &obj1);
+  frame.set_invisible_var(2, &obj2);
+
+  std::vector<corevm::runtime::Frame::dyobj_ptr> objs;
+
+  frame.iterate_objs(
+    [&objs](corevm::runtime::Frame::dyobj_ptr obj) {
+      objs.push_back(obj);
+    }
+  );
+
+  const std::vector<corevm::runtime::Frame::dyobj_ptr> expected_objs {
+    &obj1, &obj2 };
+
+  ASSERT_EQ(expected_objs, objs);
+}
+
+// -----------------------------------------------------------------------------
+
 TEST_F(FrameUnitTest, TestGetAndSetExcObj)
 {
   corevm::runtime::Frame frame(m_closure_ctx, m_compartment, &m_closure);
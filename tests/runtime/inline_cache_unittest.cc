@@ -0,0 +1,284 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2016 Yanzheng Li
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#include "dyobj/dynamic_object.h"
+#include "dyobj/dynamic_object_manager.h"
+#include "runtime/inline_cache.h"
+
+#include <gtest/gtest.h>
+
+
+// -----------------------------------------------------------------------------
+
+class DummyDynamicObjectManager : public corevm::dyobj::DynamicObjectManager
+{
+public:
+  DummyDynamicObjectManager() : corevm::dyobj::DynamicObjectManager() {}
+  virtual bool garbage_collectible() const noexcept { return false; }
+  virtual void on_create() noexcept {}
+  virtual void on_setattr() noexcept {}
+  virtual void on_delattr() noexcept {}
+  virtual void on_delete() noexcept {}
+  virtual void on_exit() noexcept {}
+};
+
+// -----------------------------------------------------------------------------
+
+class AttrInlineCacheUnitTest : public ::testing::Test
+{
+public:
+  using DynamicObjectType = typename corevm::dyobj::DynamicObject<DummyDynamicObjectManager>;
+};
+
+// -----------------------------------------------------------------------------
+
+TEST_F(AttrInlineCacheUnitTest, TestInitialization)
+{
+  corevm::runtime::AttrInlineCache cache;
+
+  ASSERT_EQ(0, cache.size());
+  ASSERT_EQ(0, cache.hit_count());
+  ASSERT_EQ(0, cache.miss_count());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(AttrInlineCacheUnitTest, TestMonomorphicAccess)
+{
+  corevm::runtime::AttrInlineCache cache;
+
+  DynamicObjectType obj1;
+  DynamicObjectType obj2;
+  DynamicObjectType attr_obj;
+
+  const corevm::dyobj::attr_key_t key1 = 1;
+  const corevm::dyobj::attr_key_t key2 = 2;
+
+  DynamicObjectType* obj1_ptr = &obj1;
+  DynamicObjectType* obj2_ptr = &obj2;
+  DynamicObjectType* attr_obj_ptr = &attr_obj;
+
+  obj1.putattr(key1, attr_obj_ptr);
+  obj1.putattr(key2, attr_obj_ptr);
+
+  obj2.putattr(key1, obj1_ptr);
+  obj2.putattr(key2, obj1_ptr);
+
+  DynamicObjectType* res = NULL;
+
+  ASSERT_TRUE(cache.getattr(obj1_ptr, key2, &res));
+  ASSERT_EQ(attr_obj_ptr, res);
+  ASSERT_EQ(1, cache.size());
+  ASSERT_EQ(0, cache.hit_count());
+  ASSERT_EQ(1, cache.miss_count());
+
+  // Receivers with the same layout hit.
+  ASSERT_TRUE(cache.getattr(obj2_ptr, key2, &res));
+  ASSERT_EQ(obj1_ptr, res);
+  ASSERT_EQ(1, cache.size());
+  ASSERT_EQ(1, cache.hit_count());
+  ASSERT_EQ(1, cache.miss_count());
+
+  ASSERT_TRUE(cache.hasattr(obj1_ptr, key2));
+  ASSERT_EQ(2, cache.hit_count());
+
+  cache.putattr(obj1_ptr, key2, obj2_ptr);
+  ASSERT_EQ(obj2_ptr, obj1.getattr(key2));
+  ASSERT_EQ(3, cache.hit_count());
+  ASSERT_EQ(1, cache.miss_count());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(AttrInlineCacheUnitTest, TestInvalidation)
+{
+  corevm::runtime::AttrInlineCache cache;
+
+  DynamicObjectType obj;
+  DynamicObjectType attr_obj;
+
+  const corevm::dyobj::attr_key_t key1 = 1;
+  const corevm::dyobj::attr_key_t key2 = 2;
+
+  DynamicObjectType* obj_ptr = &obj;
+  DynamicObjectType* attr_obj_ptr = &attr_obj;
+
+  obj.putattr(key1, attr_obj_ptr);
+  obj.putattr(key2, attr_obj_ptr);
+
+  ASSERT_TRUE(cache.hasattr(obj_ptr, key2));
+  ASSERT_EQ(1, cache.miss_count());
+
+  obj.delattr(key1);
+
+  // The cached slot no longer holds the key.
+  ASSERT_TRUE(cache.hasattr(obj_ptr, key2));
+  ASSERT_EQ(0, cache.hit_count());
+  ASSERT_EQ(2, cache.miss_count());
+  ASSERT_EQ(2, cache.size());
+
+  obj.delattr(key2);
+
+  ASSERT_FALSE(cache.hasattr(obj_ptr, key2));
+
+  DynamicObjectType* res = NULL;
+  ASSERT_FALSE(cache.getattr(obj_ptr, key2, &res));
+  ASSERT_EQ(NULL, res);
+
+  ASSERT_EQ(0, cache.hit_count());
+  ASSERT_EQ(4, cache.miss_count());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(AttrInlineCacheUnitTest, TestPolymorphicAccess)
+{
+  corevm::runtime::AttrInlineCache cache;
+
+  const uint32_t max_entry_count = corevm::runtime::AttrInlineCache::MAX_ENTRY_COUNT;
+  const uint32_t obj_count = max_entry_count + 1;
+
+  DynamicObjectType objs[obj_count];
+  DynamicObjectType attr_obj;
+  DynamicObjectType* attr_obj_ptr = &attr_obj;
+
+  const corevm::dyobj::attr_key_t key = 0xff;
+
+  // Each receiver holds the attribute at a different slot.
+  for (uint32_t i = 0; i < obj_count; ++i)
+  {
+    for (uint32_t j = 0; j < i; ++j)
+    {
+      objs[i].putattr(j, attr_obj_ptr);
+    }
+
+    DynamicObjectType* obj_ptr = &objs[i];
+    cache.putattr(obj_ptr, key, attr_obj_ptr);
+  }
+
+  ASSERT_EQ(max_entry_count, cache.size());
+  ASSERT_EQ(0, cache.hit_count());
+  ASSERT_EQ(obj_count, cache.miss_count());
+
+  // The entry of the first receiver was replaced by the one of the last.
+  for (uint32_t i = 1; i < obj_count; ++i)
+  {
+    DynamicObjectType* obj_ptr = &objs[i];
+    ASSERT_TRUE(cache.hasattr(obj_ptr, key));
+  }
+
+  ASSERT_EQ(obj_count - 1, cache.hit_count());
+
+  DynamicObjectType* obj_ptr = &objs[0];
+  ASSERT_TRUE(cache.hasattr(obj_ptr, key));
+  ASSERT_EQ(obj_count + 1, cache.miss_count());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(AttrInlineCacheUnitTest, TestAccessWithDifferentKeys)
+{
+  corevm::runtime::AttrInlineCache cache;
+
+  DynamicObjectType obj;
+  DynamicObjectType attr_obj1;
+  DynamicObjectType attr_obj2;
+
+  const corevm::dyobj::attr_key_t key1 = 1;
+  const corevm::dyobj::attr_key_t key2 = 2;
+  const corevm::dyobj::attr_key_t key3 = 3;
+
+  DynamicObjectType* obj_ptr = &obj;
+  DynamicObjectType* attr_obj1_ptr = &attr_obj1;
+  DynamicObjectType* attr_obj2_ptr = &attr_obj2;
+
+  obj.putattr(key1, attr_obj1_ptr);
+  obj.putattr(key2, attr_obj2_ptr);
+
+  DynamicObjectType* res = NULL;
+
+  // Entries for one key do not hit for another on the same shape.
+  ASSERT_TRUE(cache.getattr(obj_ptr, key1, &res));
+  ASSERT_EQ(attr_obj1_ptr, res);
+
+  ASSERT_TRUE(cache.getattr(obj_ptr, key2, &res));
+  ASSERT_EQ(attr_obj2_ptr, res);
+
+  ASSERT_EQ(2, cache.size());
+  ASSERT_EQ(0, cache.hit_count());
+  ASSERT_EQ(2, cache.miss_count());
+
+  ASSERT_TRUE(cache.getattr(obj_ptr, key1, &res));
+  ASSERT_EQ(attr_obj1_ptr, res);
+  ASSERT_EQ(1, cache.hit_count());
+
+  ASSERT_TRUE(cache.hasattr(obj_ptr, key2));
+  ASSERT_FALSE(cache.hasattr(obj_ptr, key3));
+  ASSERT_EQ(2, cache.hit_count());
+  ASSERT_EQ(3, cache.miss_count());
+
+  // Stores of a new key do not overwrite the slot cached for another.
+  cache.putattr(obj_ptr, key3, attr_obj1_ptr);
+
+  ASSERT_EQ(attr_obj1_ptr, obj.getattr(key1));
+  ASSERT_EQ(attr_obj2_ptr, obj.getattr(key2));
+  ASSERT_EQ(attr_obj1_ptr, obj.getattr(key3));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(AttrInlineCacheUnitTest, TestAccessInDictionaryMode)
+{
+  corevm::runtime::AttrInlineCache cache;
+
+  DynamicObjectType obj;
+  DynamicObjectType attr_obj;
+
+  DynamicObjectType* obj_ptr = &obj;
+  DynamicObjectType* attr_obj_ptr = &attr_obj;
+
+  const corevm::dyobj::attr_key_t key_count =
+    corevm::dyobj::Shape::DICTIONARY_MODE_MIN_SIZE;
+
+  for (corevm::dyobj::attr_key_t key = 0; key < key_count; ++key)
+  {
+    cache.putattr(obj_ptr, key, attr_obj_ptr);
+  }
+
+  ASSERT_TRUE(obj.shape()->is_dictionary());
+
+  // Receivers in dictionary mode are not cached.
+  const uint32_t size = cache.size();
+
+  DynamicObjectType* res = NULL;
+  ASSERT_TRUE(cache.getattr(obj_ptr, 0, &res));
+  ASSERT_EQ(attr_obj_ptr, res);
+
+  obj.delattr(0);
+
+  ASSERT_FALSE(cache.getattr(obj_ptr, 0, &res));
+  ASSERT_FALSE(cache.hasattr(obj_ptr, 0));
+  ASSERT_EQ(size, cache.size());
+  ASSERT_EQ(0, cache.hit_count());
+}
+
+// -----------------------------------------------------------------------------
@@ -41,3 +41,24 @@ TEST_F(InstrInfoUnitTest, TestInstrInfo)
 }
 
 // -----------------------------------------------------------------------------
+
+TEST_F(InstrInfoUnitTest, TestBytecodeOpcodesAreStable)
+{
+  // Opcodes are part of the bytecode format, so new instructions must be
+  // appended rather than inserted.
+  ASSERT_EQ(105, corevm::runtime::InstrEnum::TOINT8);
+  ASSERT_EQ(143, corevm::runtime::InstrEnum::ARYLEN);
+  ASSERT_EQ(155, corevm::runtime::InstrEnum::MAPLEN);
+  ASSERT_EQ(166, corevm::runtime::InstrEnum::MAPMRG);
+
+  ASSERT_STREQ("2int8",
+    corevm::runtime::InstrSetInfo::instr_infos[105].name);
+  ASSERT_STREQ("arylen",
+    corevm::runtime::InstrSetInfo::instr_infos[143].name);
+  ASSERT_STREQ("maplen",
+    corevm::runtime::InstrSetInfo::instr_infos[155].name);
+  ASSERT_STREQ("mapmrg",
+    corevm::runtime::InstrSetInfo::instr_infos[166].name);
+}
+
+// -----------------------------------------------------------------------------
@@ -77,7 +77,7 @@ public:
   }
 
   void execute_instr(corevm::runtime::InstrHandler handler,
-    const corevm::runtime::Instr& instr)
+    const corevm::runtime::DecodedInstr& instr)
   {
     corevm::runtime::Frame* frame = &m_process.top_frame();
     corevm::runtime::InvocationCtx* invk_ctx = &m_process.top_invocation_ctx();
@@ -104,7 +104,7 @@ class InstrsObjUnitTest : public InstrsUnitTest
 {
 protected:
   void execute_instr(corevm::runtime::InstrHandler handler,
-    const corevm::runtime::Instr& instr, uint64_t expected_stack_size=1)
+    const corevm::runtime::DecodedInstr& instr, uint64_t expected_stack_size=1)
   {
     InstrsUnitTest::execute_instr(handler, instr);
 
@@ -346,6 +346,109 @@ TEST_F(InstrsObjUnitTest, TestInstrSETATTR)
 
 // -----------------------------------------------------------------------------
 
+TEST_F(InstrsObjUnitTest, TestInstrGETATTRAndSETATTRWithInlineCache)
+{
+  corevm::runtime::compartment_id_t compartment_id = 0;
+  corevm::runtime::Compartment compartment(DUMMY_PATH);
+
+  const std::string attr_str = "Hello world";
+
+  corevm::runtime::StringLiteralTable str_literal_table { attr_str };
+
+  compartment.set_string_literal_table(str_literal_table);
+
+  corevm::runtime::Vector vector {
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::SETATTR, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::GETATTR, 0, 0),
+  };
+  corevm::runtime::LocTable locs;
+  corevm::runtime::CatchSiteList catch_sites;
+
+  corevm::runtime::Closure closure(
+    "",
+    0,
+    corevm::runtime::NONESET_CLOSURE_ID,
+    vector,
+    locs,
+    catch_sites);
+
+  corevm::runtime::ClosureTable closure_table { closure };
+
+  compartment.set_closure_table(std::move(closure_table));
+
+  corevm::runtime::Closure* closure_ptr = nullptr;
+  compartment.get_closure_by_id(closure.id, &closure_ptr);
+
+  ASSERT_NE(nullptr, closure_ptr);
+
+  corevm::runtime::ClosureCtx ctx(compartment_id, closure.id);
+
+  m_process.emplace_frame(ctx, &compartment, closure_ptr);
+
+  const corevm::runtime::DecodedVector& decoded_vector =
+    compartment.get_decoded_vector(closure_ptr);
+
+  const corevm::runtime::DecodedInstr& setattr_instr = decoded_vector[0];
+  const corevm::runtime::DecodedInstr& getattr_instr = decoded_vector[1];
+
+  ASSERT_TRUE(setattr_instr.flags & corevm::runtime::DecodedInstr::FLAG_ATTR_CACHE);
+  ASSERT_TRUE(getattr_instr.flags & corevm::runtime::DecodedInstr::FLAG_ATTR_CACHE);
+
+  const corevm::runtime::AttrInlineCache& setattr_cache =
+    compartment.get_attr_cache(setattr_instr.oprd2);
+  const corevm::runtime::AttrInlineCache& getattr_cache =
+    compartment.get_attr_cache(getattr_instr.oprd2);
+
+  auto obj1 = m_process.create_dyobj();
+  auto obj2 = m_process.create_dyobj();
+  auto obj3 = m_process.create_dyobj();
+
+  // First store misses, and second one hits.
+  m_process.push_stack(obj1);
+  m_process.push_stack(obj2);
+
+  execute_instr(corevm::runtime::instr_handler_setattr, setattr_instr, 1);
+
+  m_process.push_stack(obj3);
+
+  execute_instr(corevm::runtime::instr_handler_setattr, setattr_instr, 1);
+
+  ASSERT_EQ(1, setattr_cache.miss_count());
+  ASSERT_EQ(1, setattr_cache.hit_count());
+
+  corevm::dyobj::attr_key_t attr_key = corevm::dyobj::hash_attr_str(attr_str);
+
+  ASSERT_EQ(obj3, obj1->getattr(attr_key));
+
+  // First load misses, and second one hits.
+  execute_instr(corevm::runtime::instr_handler_getattr, getattr_instr, 1);
+
+  ASSERT_EQ(obj3, m_process.top_stack());
+
+  m_process.pop_stack();
+  m_process.push_stack(obj1);
+
+  execute_instr(corevm::runtime::instr_handler_getattr, getattr_instr, 1);
+
+  ASSERT_EQ(obj3, m_process.top_stack());
+
+  ASSERT_EQ(1, getattr_cache.miss_count());
+  ASSERT_EQ(1, getattr_cache.hit_count());
+
+  // Missing attribute.
+  m_process.pop_stack();
+  m_process.push_stack(obj2);
+
+  ASSERT_THROW(
+    {
+      execute_instr(corevm::runtime::instr_handler_getattr, getattr_instr, 1);
+    },
+    corevm::dyobj::ObjectAttributeNotFoundError
+  );
+}
+
+// -----------------------------------------------------------------------------
+
 TEST_F(InstrsObjUnitTest, TestInstrDELATTR)
 {
   corevm::dyobj::attr_key_t attr_key = 777;
@@ -372,6 +475,105 @@ TEST_F(InstrsObjUnitTest, TestInstrDELATTR)
 
 // -----------------------------------------------------------------------------
 
+TEST_F(InstrsObjUnitTest, TestInstrGETATTR2AndHASATTR2WithInlineCache)
+{
+  corevm::runtime::compartment_id_t compartment_id = 0;
+  corevm::runtime::Compartment compartment(DUMMY_PATH);
+
+  corevm::runtime::Vector vector {
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::GETATTR2, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::HASATTR2, 0, 0),
+  };
+  corevm::runtime::LocTable locs;
+  corevm::runtime::CatchSiteList catch_sites;
+
+  corevm::runtime::Closure closure(
+    "",
+    0,
+    corevm::runtime::NONESET_CLOSURE_ID,
+    vector,
+    locs,
+    catch_sites);
+
+  corevm::runtime::ClosureTable closure_table { closure };
+
+  compartment.set_closure_table(std::move(closure_table));
+
+  corevm::runtime::Closure* closure_ptr = nullptr;
+  compartment.get_closure_by_id(closure.id, &closure_ptr);
+
+  ASSERT_NE(nullptr, closure_ptr);
+
+  corevm::runtime::ClosureCtx ctx(compartment_id, closure.id);
+
+  m_process.emplace_frame(ctx, &compartment, closure_ptr);
+
+  const corevm::runtime::DecodedVector& decoded_vector =
+    compartment.get_decoded_vector(closure_ptr);
+
+  const corevm::runtime::DecodedInstr& getattr2_instr = decoded_vector[0];
+  const corevm::runtime::DecodedInstr& hasattr2_instr = decoded_vector[1];
+
+  ASSERT_TRUE(getattr2_instr.flags & corevm::runtime::DecodedInstr::FLAG_ATTR_CACHE);
+  ASSERT_TRUE(hasattr2_instr.flags & corevm::runtime::DecodedInstr::FLAG_ATTR_CACHE);
+
+  auto obj = m_process.create_dyobj();
+  auto attr_obj1 = m_process.create_dyobj();
+  auto attr_obj2 = m_process.create_dyobj();
+
+  obj->putattr(corevm::dyobj::hash_attr_str("a"), attr_obj1);
+  obj->putattr(corevm::dyobj::hash_attr_str("b"), attr_obj2);
+
+  corevm::runtime::Frame& frame = m_process.top_frame();
+
+  // The same site reads different attributes of the same receiver.
+  const std::string attr_strs[] { "a", "b", "a" };
+  const decltype(obj) expected_attr_objs[] { attr_obj1, attr_obj2, attr_obj1 };
+
+  for (size_t i = 0; i < 3; ++i)
+  {
+    frame.clear_eval_stack();
+    frame.push_eval_stack(
+      corevm::types::NativeTypeValue(corevm::types::native_string(attr_strs[i])));
+    m_process.push_stack(obj);
+
+    execute_instr(corevm::runtime::instr_handler_getattr2, getattr2_instr, 1);
+
+    ASSERT_EQ(expected_attr_objs[i], m_process.top_stack());
+
+    m_process.pop_stack();
+  }
+
+  const corevm::runtime::AttrInlineCache& getattr2_cache =
+    compartment.get_attr_cache(getattr2_instr.oprd2);
+
+  ASSERT_EQ(2, getattr2_cache.miss_count());
+  ASSERT_EQ(1, getattr2_cache.hit_count());
+
+  // Missing attributes are not reported present after a hit on another one.
+  const std::string hasattr_strs[] { "a", "a", "c" };
+  const bool expected_results[] { true, true, false };
+
+  for (size_t i = 0; i < 3; ++i)
+  {
+    frame.clear_eval_stack();
+    frame.push_eval_stack(
+      corevm::types::NativeTypeValue(corevm::types::native_string(hasattr_strs[i])));
+    m_process.push_stack(obj);
+
+    execute_instr(corevm::runtime::instr_handler_hasattr2, hasattr2_instr, 1);
+
+    corevm::types::NativeTypeValue res_val = frame.top_eval_stack();
+
+    ASSERT_EQ(expected_results[i],
+      corevm::types::get_intrinsic_value_from_type_value<bool>(res_val));
+
+    m_process.pop_stack();
+  }
+}
+
+// -----------------------------------------------------------------------------
+
 TEST_F(InstrsObjUnitTest, TestInstrHASATTR2)
 {
   const std::string attr_str = "hello_world";
@@ -714,6 +916,51 @@ TEST_F(InstrsObjUnitTest, TestInstrGETVAL2)
 
 // -----------------------------------------------------------------------------
 
+TEST_F(InstrsObjUnitTest, TestInstrGETVAL2WithStringValue)
+{
+  const corevm::types::string expected_value("Hello world");
+
+  auto obj = m_process.create_dyobj();
+
+  corevm::runtime::Frame frame(m_ctx, m_compartment, &m_closure);
+  corevm::runtime::variable_key_t key = 1;
+  frame.set_visible_var(key, obj);
+  m_process.push_frame(frame);
+
+  corevm::types::NativeTypeValue type_val =
+    corevm::types::string(expected_value);
+  auto saved_type_val = m_process.insert_type_value(type_val);
+
+  obj->set_type_value(saved_type_val);
+
+  corevm::runtime::Instr instr(
+    0, static_cast<corevm::runtime::instr_oprd_t>(key), 0);
+
+  execute_instr(corevm::runtime::instr_handler_getval2, instr, 0);
+
+  corevm::runtime::Frame& actual_frame = m_process.top_frame();
+  corevm::types::NativeTypeValue& actual_type_val = actual_frame.top_eval_stack();
+
+  const corevm::types::NativeTypeValue& const_type_val = actual_type_val;
+
+#if COREVM_USE_COMPACT_NATIVE_TYPE_VALUE
+  // The value on the eval stack is shared with the one of the object.
+  ASSERT_EQ(&obj->type_value().get<corevm::types::string>(),
+    &const_type_val.get<corevm::types::string>());
+#endif
+
+  ASSERT_EQ(expected_value, const_type_val.get<corevm::types::string>());
+
+  // Writing to the value on the eval stack leaves the one of the object as is.
+  actual_type_val.get<corevm::types::string>().append("!");
+
+  ASSERT_EQ(corevm::types::string("Hello world!"),
+    const_type_val.get<corevm::types::string>());
+  ASSERT_EQ(expected_value, obj->type_value().get<corevm::types::string>());
+}
+
+// -----------------------------------------------------------------------------
+
 TEST_F(InstrsObjUnitTest, TestInstrCLRVAL)
 {
   auto obj = m_process.create_dyobj();
@@ -1491,13 +1738,13 @@ TEST_F(InstrsFunctionsInstrsTest, TestInstrGETARGS)
   corevm::types::NativeTypeValue type_val = actual_frame.pop_eval_stack();
 
   auto result_val3 = corevm::types::interface_array_back(type_val);
-  type_val = corevm::types::interface_array_pop(type_val);
+  corevm::types::interface_array_pop(type_val);
 
   auto result_val2 = corevm::types::interface_array_back(type_val);
-  type_val = corevm::types::interface_array_pop(type_val);
+  corevm::types::interface_array_pop(type_val);
 
   auto result_val1 = corevm::types::interface_array_back(type_val);
-  type_val = corevm::types::interface_array_pop(type_val);
+  corevm::types::interface_array_pop(type_val);
 
   auto actual_id1 = corevm::types::get_intrinsic_value_from_type_value<corevm::dyobj::dyobj_id_t>(result_val1);
   auto actual_id2 = corevm::types::get_intrinsic_value_from_type_value<corevm::dyobj::dyobj_id_t>(result_val2);
@@ -1882,6 +2129,81 @@ TEST_F(InstrsControlInstrsTest, TestInstrEXC)
 
 // -----------------------------------------------------------------------------
 
+TEST_F(InstrsControlInstrsTest, TestInstrEXCWithNestedCatchSites)
+{
+  const corevm::runtime::compartment_id_t compartment_id = 0;
+
+  corevm::runtime::Vector vector(10, corevm::runtime::Instr(0, 0, 0));
+
+  corevm::runtime::LocTable locs;
+
+  // An inner try block nested in an outer one.
+  corevm::runtime::CatchSite inner_catch_site(4, 5, 8);
+  corevm::runtime::CatchSite outer_catch_site(2, 7, 9);
+
+  corevm::runtime::CatchSiteList catch_sites1 {
+    inner_catch_site, outer_catch_site };
+  corevm::runtime::CatchSiteList catch_sites2;
+
+  corevm::runtime::Closure closure1(
+    "__main__",
+    0,
+    corevm::runtime::NONESET_CLOSURE_ID,
+    vector,
+    locs,
+    catch_sites1);
+
+  corevm::runtime::Closure closure2(
+    "hello_world",
+    1,
+    0,
+    vector,
+    locs,
+    catch_sites2);
+
+  corevm::runtime::ClosureTable closure_table { closure1, closure2 };
+  corevm::runtime::Compartment compartment(DUMMY_PATH);
+  compartment.set_closure_table(std::move(closure_table));
+  m_process.insert_compartment(compartment);
+
+  corevm::runtime::Compartment* compartment_ptr = nullptr;
+  m_process.get_compartment(compartment_id, &compartment_ptr);
+
+  corevm::runtime::Closure* closure_ptr1 = nullptr;
+  corevm::runtime::Closure* closure_ptr2 = nullptr;
+  compartment_ptr->get_closure_by_id(0, &closure_ptr1);
+  compartment_ptr->get_closure_by_id(1, &closure_ptr2);
+
+  corevm::runtime::ClosureCtx ctx1(compartment_id, 0);
+  corevm::runtime::ClosureCtx ctx2(compartment_id, 1);
+
+  m_process.emplace_frame(ctx1, compartment_ptr, closure_ptr1,
+    corevm::runtime::NONESET_INSTR_ADDR);
+  m_process.emplace_invocation_ctx(ctx1, compartment_ptr, closure_ptr1);
+  m_process.set_pc(5);
+
+  // The exception is raised in a frame without catch sites.
+  m_process.emplace_frame(ctx2, compartment_ptr, closure_ptr2, 5);
+  m_process.emplace_invocation_ctx(ctx2, compartment_ptr, closure_ptr2);
+  m_process.set_pc(0);
+
+  auto obj = m_process.create_dyobj();
+  m_process.push_stack(obj);
+
+  corevm::runtime::Instr instr(0, 1, 0);
+
+  execute_instr(corevm::runtime::instr_handler_exc, instr);
+
+  // Checks that the frame without catch sites is unwound, and the exception
+  // is caught by the inner try block of the previous frame. The frame set up
+  // by the fixture stays below.
+  ASSERT_EQ(2, m_process.call_stack_size());
+  ASSERT_EQ(inner_catch_site.dst - 1, m_process.pc());
+  ASSERT_EQ(obj, m_process.top_frame().exc_obj());
+}
+
+// -----------------------------------------------------------------------------
+
 TEST_F(InstrsObjUnitTest, TestInstrEXCOBJ)
 {
   corevm::runtime::ClosureCtx ctx(0, 0);
@@ -2367,76 +2689,312 @@ TEST_F(InstrsBinaryArithmeticInstrsTest, TestInstrCMP)
 
 // -----------------------------------------------------------------------------
 
-class InstrsNativeTypesInstrsTest : public InstrsEvalStackInstrsTest {};
+#if COREVM_USE_QUICKENED_INSTRS
 
-// -----------------------------------------------------------------------------
+class InstrsQuickenedInstrsTest : public InstrsEvalStackInstrsTest
+{
+protected:
+  struct QuickenedInstr
+  {
+    corevm::runtime::instr_code_t generic_code;
+    corevm::runtime::InstrHandler* generic_handler;
+    corevm::runtime::instr_code_t int64_code;
+    corevm::runtime::InstrHandler* int64_handler;
+    corevm::runtime::instr_code_t decimal2_code;
+    corevm::runtime::InstrHandler* decimal2_handler;
+  };
 
-class InstrsNativeIntegerTypeCreationInstrsTest : public InstrsNativeTypesInstrsTest {};
+  static const std::vector<QuickenedInstr> QUICKENED_INSTRS;
 
-// -----------------------------------------------------------------------------
+  /**
+   * Runs a handler on the specified operands, with `lhs` on top of the eval
+   * stack, and returns the result.
+   */
+  corevm::types::NativeTypeValue execute_instr_on_operands(
+    corevm::runtime::InstrHandler handler,
+    const corevm::runtime::DecodedInstr& instr,
+    const corevm::types::NativeTypeValue& lhs,
+    const corevm::types::NativeTypeValue& rhs)
+  {
+    push_eval_stack({rhs, lhs});
 
-TEST_F(InstrsNativeIntegerTypeCreationInstrsTest, TestInstrINT8)
-{
-  corevm::runtime::Instr instr(
-    corevm::runtime::InstrEnum::INT8, std::numeric_limits<int8_t>::max(), 0);
+    execute_instr(handler, instr);
 
-  execute_instr_and_assert_result_equals_operand<int8_t>(
-    corevm::runtime::instr_handler_int8, instr);
-}
+    corevm::runtime::Frame& frame = m_process.top_frame();
+
+    corevm::types::NativeTypeValue res = frame.pop_eval_stack();
+    frame.clear_eval_stack();
+
+    return res;
+  }
+};
 
 // -----------------------------------------------------------------------------
 
-TEST_F(InstrsNativeIntegerTypeCreationInstrsTest, TestInstrUINT8)
-{
-  corevm::runtime::Instr instr(
-    corevm::runtime::InstrEnum::UINT8, std::numeric_limits<uint8_t>::max(), 0);
+#define QUICKENED_INSTR(op, OP)                                               \
+  {                                                                           \
+    corevm::runtime::InstrEnum::OP,                                           \
+    corevm::runtime::instr_handler_##op,                                      \
+    corevm::runtime::InstrEnum::OP##I64,                                      \
+    corevm::runtime::instr_handler_##op##i64,                                 \
+    corevm::runtime::InstrEnum::OP##DEC2,                                     \
+    corevm::runtime::instr_handler_##op##dec2                                 \
+  }
 
-  execute_instr_and_assert_result_equals_operand<uint8_t>(
-    corevm::runtime::instr_handler_uint8, instr);
-}
+const std::vector<InstrsQuickenedInstrsTest::QuickenedInstr>
+InstrsQuickenedInstrsTest::QUICKENED_INSTRS {
+  QUICKENED_INSTR(add, ADD),
+  QUICKENED_INSTR(sub, SUB),
+  QUICKENED_INSTR(mul, MUL),
+  QUICKENED_INSTR(div, DIV),
+  QUICKENED_INSTR(mod, MOD),
+  QUICKENED_INSTR(eq, EQ),
+  QUICKENED_INSTR(neq, NEQ),
+  QUICKENED_INSTR(gt, GT),
+  QUICKENED_INSTR(lt, LT),
+  QUICKENED_INSTR(gte, GTE),
+  QUICKENED_INSTR(lte, LTE),
+};
+
+#undef QUICKENED_INSTR
 
 // -----------------------------------------------------------------------------
 
-TEST_F(InstrsNativeIntegerTypeCreationInstrsTest, TestInstrINT16)
+TEST_F(InstrsQuickenedInstrsTest, TestQuickeningOnInt64Operands)
 {
-  corevm::runtime::Instr instr(
-    corevm::runtime::InstrEnum::INT16, std::numeric_limits<int16_t>::max(), 0);
+  for (const auto& quickened_instr : QUICKENED_INSTRS)
+  {
+    corevm::runtime::DecodedInstr instr(
+      corevm::runtime::Instr(quickened_instr.generic_code, 0, 0));
 
-  execute_instr_and_assert_result_equals_operand<int16_t>(
-    corevm::runtime::instr_handler_int16, instr);
+    execute_instr_on_operands(quickened_instr.generic_handler, instr,
+      corevm::types::int64(7), corevm::types::int64(-3));
+
+    ASSERT_EQ(quickened_instr.int64_code, instr.code);
+    ASSERT_EQ(0, instr.flags);
+  }
 }
 
 // -----------------------------------------------------------------------------
 
-TEST_F(InstrsNativeIntegerTypeCreationInstrsTest, TestInstrUINT16)
+TEST_F(InstrsQuickenedInstrsTest, TestQuickeningOnDecimal2Operands)
 {
-  corevm::runtime::Instr instr(
-    corevm::runtime::InstrEnum::UINT16, std::numeric_limits<uint16_t>::max(), 0);
+  for (const auto& quickened_instr : QUICKENED_INSTRS)
+  {
+    corevm::runtime::DecodedInstr instr(
+      corevm::runtime::Instr(quickened_instr.generic_code, 0, 0));
 
-  execute_instr_and_assert_result_equals_operand<uint16_t>(
-    corevm::runtime::instr_handler_uint16, instr);
+    execute_instr_on_operands(quickened_instr.generic_handler, instr,
+      corevm::types::decimal2(7.5), corevm::types::decimal2(-2.25));
+
+    ASSERT_EQ(quickened_instr.decimal2_code, instr.code);
+    ASSERT_EQ(0, instr.flags);
+  }
 }
 
 // -----------------------------------------------------------------------------
 
-TEST_F(InstrsNativeIntegerTypeCreationInstrsTest, TestInstrINT32)
+TEST_F(InstrsQuickenedInstrsTest, TestNoQuickeningOnOtherOperands)
 {
-  corevm::runtime::Instr instr(
-    corevm::runtime::InstrEnum::INT32, std::numeric_limits<int32_t>::max(), 0);
+  for (const auto& quickened_instr : QUICKENED_INSTRS)
+  {
+    corevm::runtime::DecodedInstr instr(
+      corevm::runtime::Instr(quickened_instr.generic_code, 0, 0));
 
-  execute_instr_and_assert_result_equals_operand<int32_t>(
-    corevm::runtime::instr_handler_int32, instr);
-}
+    execute_instr_on_operands(quickened_instr.generic_handler, instr,
+      corevm::types::int64(7), corevm::types::decimal2(-2.25));
 
-// -----------------------------------------------------------------------------
+    ASSERT_EQ(quickened_instr.generic_code, instr.code);
 
-TEST_F(InstrsNativeIntegerTypeCreationInstrsTest, TestInstrUINT32)
-{
-  corevm::runtime::Instr instr(
-    corevm::runtime::InstrEnum::UINT32, std::numeric_limits<uint32_t>::max(), 0);
+    execute_instr_on_operands(quickened_instr.generic_handler, instr,
+      corevm::types::uint32(7), corevm::types::uint32(3));
 
-  execute_instr_and_assert_result_equals_operand<uint32_t>(
-    corevm::runtime::instr_handler_uint32, instr);
+    ASSERT_EQ(quickened_instr.generic_code, instr.code);
+    ASSERT_EQ(0, instr.flags);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(InstrsQuickenedInstrsTest, TestQuickenedInstrsMatchGenericInstrs)
+{
+  typedef corevm::types::int64 int64;
+  typedef corevm::types::decimal2 decimal2;
+
+  typedef std::pair<corevm::types::NativeTypeValue,
+    corevm::types::NativeTypeValue> OperandPair;
+
+  const std::vector<OperandPair> int64_oprds {
+    { int64(7), int64(-3) },
+    { int64(-3), int64(7) },
+    { int64(7), int64(7) },
+    { int64(0), int64(5) },
+  };
+
+  const std::vector<OperandPair> decimal2_oprds {
+    { decimal2(7.5), decimal2(-2.25) },
+    { decimal2(-2.25), decimal2(7.5) },
+    { decimal2(7.5), decimal2(7.5) },
+    { decimal2(0.0), decimal2(5.0) },
+  };
+
+  for (const auto& quickened_instr : QUICKENED_INSTRS)
+  {
+    for (const auto& oprds : int64_oprds)
+    {
+      corevm::runtime::DecodedInstr instr(
+        corevm::runtime::Instr(quickened_instr.int64_code, 0, 0));
+
+      const auto expected_result = execute_instr_on_operands(
+        quickened_instr.generic_handler,
+        corevm::runtime::Instr(quickened_instr.generic_code, 0, 0),
+        oprds.first, oprds.second);
+
+      const auto actual_result = execute_instr_on_operands(
+        quickened_instr.int64_handler, instr, oprds.first, oprds.second);
+
+      ASSERT_TRUE(expected_result == actual_result);
+      ASSERT_EQ(quickened_instr.int64_code, instr.code);
+    }
+
+    for (const auto& oprds : decimal2_oprds)
+    {
+      corevm::runtime::DecodedInstr instr(
+        corevm::runtime::Instr(quickened_instr.decimal2_code, 0, 0));
+
+      const auto expected_result = execute_instr_on_operands(
+        quickened_instr.generic_handler,
+        corevm::runtime::Instr(quickened_instr.generic_code, 0, 0),
+        oprds.first, oprds.second);
+
+      const auto actual_result = execute_instr_on_operands(
+        quickened_instr.decimal2_handler, instr, oprds.first, oprds.second);
+
+      ASSERT_TRUE(expected_result == actual_result);
+      ASSERT_EQ(quickened_instr.decimal2_code, instr.code);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(InstrsQuickenedInstrsTest, TestDequickeningOnOtherOperands)
+{
+  for (const auto& quickened_instr : QUICKENED_INSTRS)
+  {
+    corevm::runtime::DecodedInstr instr(
+      corevm::runtime::Instr(quickened_instr.int64_code, 0, 0));
+
+    const auto expected_result = execute_instr_on_operands(
+      quickened_instr.generic_handler,
+      corevm::runtime::Instr(quickened_instr.generic_code, 0, 0),
+      corevm::types::int64(7), corevm::types::decimal2(-2.25));
+
+    const auto actual_result = execute_instr_on_operands(
+      quickened_instr.int64_handler, instr,
+      corevm::types::int64(7), corevm::types::decimal2(-2.25));
+
+    ASSERT_TRUE(expected_result == actual_result);
+    ASSERT_EQ(quickened_instr.generic_code, instr.code);
+    ASSERT_EQ(corevm::runtime::DecodedInstr::FLAG_POLYMORPHIC, instr.flags);
+
+    // Not quickened again.
+    execute_instr_on_operands(quickened_instr.generic_handler, instr,
+      corevm::types::int64(7), corevm::types::int64(-3));
+
+    ASSERT_EQ(quickened_instr.generic_code, instr.code);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(InstrsQuickenedInstrsTest, TestQuickenedInstrsWithEmptyEvalStack)
+{
+  corevm::runtime::DecodedInstr instr(
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::ADDI64, 0, 0));
+
+  ASSERT_THROW(
+    {
+      execute_instr(corevm::runtime::instr_handler_addi64, instr);
+    },
+    corevm::runtime::EvaluationStackEmptyError
+  );
+}
+
+#endif /* COREVM_USE_QUICKENED_INSTRS */
+
+// -----------------------------------------------------------------------------
+
+class InstrsNativeTypesInstrsTest : public InstrsEvalStackInstrsTest {};
+
+// -----------------------------------------------------------------------------
+
+class InstrsNativeIntegerTypeCreationInstrsTest : public InstrsNativeTypesInstrsTest {};
+
+// -----------------------------------------------------------------------------
+
+TEST_F(InstrsNativeIntegerTypeCreationInstrsTest, TestInstrINT8)
+{
+  corevm::runtime::Instr instr(
+    corevm::runtime::InstrEnum::INT8, std::numeric_limits<int8_t>::max(), 0);
+
+  execute_instr_and_assert_result_equals_operand<int8_t>(
+    corevm::runtime::instr_handler_int8, instr);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(InstrsNativeIntegerTypeCreationInstrsTest, TestInstrUINT8)
+{
+  corevm::runtime::Instr instr(
+    corevm::runtime::InstrEnum::UINT8, std::numeric_limits<uint8_t>::max(), 0);
+
+  execute_instr_and_assert_result_equals_operand<uint8_t>(
+    corevm::runtime::instr_handler_uint8, instr);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(InstrsNativeIntegerTypeCreationInstrsTest, TestInstrINT16)
+{
+  corevm::runtime::Instr instr(
+    corevm::runtime::InstrEnum::INT16, std::numeric_limits<int16_t>::max(), 0);
+
+  execute_instr_and_assert_result_equals_operand<int16_t>(
+    corevm::runtime::instr_handler_int16, instr);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(InstrsNativeIntegerTypeCreationInstrsTest, TestInstrUINT16)
+{
+  corevm::runtime::Instr instr(
+    corevm::runtime::InstrEnum::UINT16, std::numeric_limits<uint16_t>::max(), 0);
+
+  execute_instr_and_assert_result_equals_operand<uint16_t>(
+    corevm::runtime::instr_handler_uint16, instr);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(InstrsNativeIntegerTypeCreationInstrsTest, TestInstrINT32)
+{
+  corevm::runtime::Instr instr(
+    corevm::runtime::InstrEnum::INT32, std::numeric_limits<int32_t>::max(), 0);
+
+  execute_instr_and_assert_result_equals_operand<int32_t>(
+    corevm::runtime::instr_handler_int32, instr);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(InstrsNativeIntegerTypeCreationInstrsTest, TestInstrUINT32)
+{
+  corevm::runtime::Instr instr(
+    corevm::runtime::InstrEnum::UINT32, std::numeric_limits<uint32_t>::max(), 0);
+
+  execute_instr_and_assert_result_equals_operand<uint32_t>(
+    corevm::runtime::instr_handler_uint32, instr);
 }
 
 // -----------------------------------------------------------------------------
@@ -2515,6 +3073,34 @@ TEST_F(InstrsNativeTypeCreationInstrsTest, TestInstrSTR)
 
 // -----------------------------------------------------------------------------
 
+TEST_F(InstrsNativeTypeCreationInstrsTest, TestInstrSTRWithDecodedLiteral)
+{
+  const corevm::types::native_string str_literal(
+    corevm::types::native_string::intern("Hello world"));
+
+  corevm::runtime::DecodedInstr instr;
+  instr.code = corevm::runtime::InstrEnum::STR;
+  instr.str_literal = &str_literal;
+  instr.flags = corevm::runtime::DecodedInstr::FLAG_STR_LITERAL;
+
+  corevm::runtime::Frame* frame = &m_process.top_frame();
+  corevm::runtime::InvocationCtx* invk_ctx = &m_process.top_invocation_ctx();
+
+  corevm::runtime::instr_handler_str(instr, m_process, &frame, &invk_ctx);
+
+  ASSERT_EQ(1, frame->eval_stack_size());
+
+  corevm::types::NativeTypeValue result_val = frame->pop_eval_stack();
+
+  corevm::types::native_string actual_result =
+    corevm::types::get_intrinsic_value_from_type_value<corevm::types::native_string>(result_val);
+
+  ASSERT_EQ(str_literal, actual_result);
+  ASSERT_TRUE(actual_result.interned());
+}
+
+// -----------------------------------------------------------------------------
+
 TEST_F(InstrsNativeTypeCreationInstrsTest, TestInstrARY)
 {
   corevm::types::native_array expected_result;
@@ -2533,6 +3119,15 @@ TEST_F(InstrsNativeTypeCreationInstrsTest, TestInstrMAP)
 
 // -----------------------------------------------------------------------------
 
+TEST_F(InstrsNativeTypeCreationInstrsTest, TestInstrVEC)
+{
+  corevm::types::native_vector expected_result;
+  execute_instr_and_assert_result<corevm::types::native_vector>(
+    corevm::runtime::instr_handler_vec, expected_result);
+}
+
+// -----------------------------------------------------------------------------
+
 class InstrsNativeTypeConversionInstrsTest : public InstrsNativeTypesInstrsTest
 {
 public:
@@ -3194,6 +3789,61 @@ TEST_F(InstrsNativeStringTypeComplexInstrsTest, TestInstrSTRRFND2)
 
 // -----------------------------------------------------------------------------
 
+TEST_F(InstrsNativeStringTypeComplexInstrsTest, TestInstrSTRRPLCALL)
+{
+  corevm::types::native_string hello_world = "Hello world";
+  corevm::types::native_string o = "o";
+  corevm::types::native_string zero = "0";
+  corevm::types::native_string expected_result = "Hell0 w0rld";
+
+  corevm::types::NativeTypeValue oprd1 = hello_world;
+  corevm::types::NativeTypeValue oprd2 = o;
+  corevm::types::NativeTypeValue oprd3 = zero;
+
+  push_eval_stack(eval_oprds_list{ oprd3, oprd2, oprd1 });
+
+  execute_instr_and_assert_result<corevm::types::native_string>(
+    corevm::runtime::instr_handler_strrplcall, expected_result);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(InstrsNativeStringTypeComplexInstrsTest, TestInstrSTRSPLIT)
+{
+  corevm::types::native_string hello_world = "Hello world";
+  corevm::types::native_string space = " ";
+  corevm::types::native_array expected_result { 0, 5, 6, 11 };
+
+  corevm::types::NativeTypeValue oprd1 = hello_world;
+  corevm::types::NativeTypeValue oprd2 = space;
+
+  push_eval_stack(eval_oprds_list{ oprd2, oprd1 });
+
+  execute_instr_and_assert_result<corevm::types::native_array>(
+    corevm::runtime::instr_handler_strsplit, expected_result);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(InstrsNativeStringTypeComplexInstrsTest, TestInstrSTRJOIN)
+{
+  corevm::types::native_string hello_world = "Hello world";
+  corevm::types::native_array offsets { 0, 5, 6, 11 };
+  corevm::types::native_string comma = ",";
+  corevm::types::native_string expected_result = "Hello,world";
+
+  corevm::types::NativeTypeValue oprd1 = hello_world;
+  corevm::types::NativeTypeValue oprd2 = offsets;
+  corevm::types::NativeTypeValue oprd3 = comma;
+
+  push_eval_stack(eval_oprds_list{ oprd3, oprd2, oprd1 });
+
+  execute_instr_and_assert_result<corevm::types::native_string>(
+    corevm::runtime::instr_handler_strjoin, expected_result);
+}
+
+// -----------------------------------------------------------------------------
+
 class InstrsNativeArrayTypeComplexInstrsTest : public InstrsNativeTypeComplexInstrsTest {};
 
 // -----------------------------------------------------------------------------
@@ -3388,6 +4038,65 @@ TEST_F(InstrsNativeArrayTypeComplexInstrsTest, TestInstrARYMRG)
 
 // -----------------------------------------------------------------------------
 
+TEST_F(InstrsNativeArrayTypeComplexInstrsTest, TestInstrARYSUM)
+{
+  corevm::types::native_array array { 1, 2, 3 };
+  corevm::types::uint64 expected_result = 6;
+  corevm::types::NativeTypeValue oprd = array;
+
+  push_eval_stack(eval_oprds_list{oprd});
+
+  execute_instr_and_assert_result<corevm::types::uint64>(
+    corevm::runtime::instr_handler_arysum, expected_result);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(InstrsNativeArrayTypeComplexInstrsTest, TestInstrARYMIN)
+{
+  corevm::types::native_array array { 3, 1, 2 };
+  corevm::types::uint64 expected_result = 1;
+  corevm::types::NativeTypeValue oprd = array;
+
+  push_eval_stack(eval_oprds_list{oprd});
+
+  execute_instr_and_assert_result<corevm::types::uint64>(
+    corevm::runtime::instr_handler_arymin, expected_result);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(InstrsNativeArrayTypeComplexInstrsTest, TestInstrARYMAX)
+{
+  corevm::types::native_array array { 3, 1, 2 };
+  corevm::types::uint64 expected_result = 3;
+  corevm::types::NativeTypeValue oprd = array;
+
+  push_eval_stack(eval_oprds_list{oprd});
+
+  execute_instr_and_assert_result<corevm::types::uint64>(
+    corevm::runtime::instr_handler_arymax, expected_result);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(InstrsNativeArrayTypeComplexInstrsTest, TestInstrARYFND)
+{
+  corevm::types::native_array array { 1, 2, 3 };
+  corevm::types::uint64 value = 3;
+  corevm::types::uint64 expected_result = 2;
+
+  corevm::types::NativeTypeValue oprd1 = array;
+  corevm::types::NativeTypeValue oprd2 = value;
+
+  push_eval_stack(eval_oprds_list{ oprd2, oprd1 });
+
+  execute_instr_and_assert_result<corevm::types::uint64>(
+    corevm::runtime::instr_handler_aryfnd, expected_result);
+}
+
+// -----------------------------------------------------------------------------
+
 class InstrsNativeMapTypeComplexInstrsTest : public InstrsNativeTypeComplexInstrsTest {};
 
 // -----------------------------------------------------------------------------
@@ -3710,3 +4419,608 @@ TEST_F(InstrsNativeMapTypeComplexInstrsTest, TestInstrMAPMRG)
 }
 
 // -----------------------------------------------------------------------------
+
+class InstrsNativeVectorTypeComplexInstrsTest : public InstrsNativeTypeComplexInstrsTest {};
+
+// -----------------------------------------------------------------------------
+
+TEST_F(InstrsNativeVectorTypeComplexInstrsTest, TestInstrVECLEN)
+{
+  corevm::types::native_vector vector { 1.0, 2.0, 3.0 };
+  corevm::types::uint64 expected_result = 3;
+  corevm::types::NativeTypeValue oprd = vector;
+
+  push_eval_stack(eval_oprds_list{oprd});
+
+  execute_instr_and_assert_result<corevm::types::uint64>(
+    corevm::runtime::instr_handler_veclen, expected_result);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(InstrsNativeVectorTypeComplexInstrsTest, TestInstrVECAT)
+{
+  corevm::types::native_vector vector { 1.5, 2.5, 3.5 };
+  corevm::types::uint64 index = 1;
+  corevm::types::decimal2 expected_result = 2.5;
+
+  corevm::types::NativeTypeValue oprd1 = vector;
+  corevm::types::NativeTypeValue oprd2 = index;
+
+  push_eval_stack(eval_oprds_list{oprd2, oprd1});
+
+  execute_instr_and_assert_result<corevm::types::decimal2>(
+    corevm::runtime::instr_handler_vecat, expected_result);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(InstrsNativeVectorTypeComplexInstrsTest, TestInstrVECPUT)
+{
+  corevm::types::native_vector vector { 1.0, 2.0, 3.0 };
+  corevm::types::uint64 index = 2;
+  corevm::types::decimal2 data = 4.5;
+  corevm::types::native_vector expected_result { 1.0, 2.0, 4.5 };
+
+  corevm::types::NativeTypeValue oprd1 = vector;
+  corevm::types::NativeTypeValue oprd2 = index;
+  corevm::types::NativeTypeValue oprd3 = data;
+
+  push_eval_stack(eval_oprds_list{ oprd3, oprd2, oprd1 });
+
+  execute_instr_and_assert_result<corevm::types::native_vector>(
+    corevm::runtime::instr_handler_vecput, expected_result);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(InstrsNativeVectorTypeComplexInstrsTest, TestInstrVECAPND)
+{
+  corevm::types::native_vector vector { 1.0, 2.0, 3.0 };
+  corevm::types::decimal2 data = 4.0;
+  corevm::types::native_vector expected_result { 1.0, 2.0, 3.0, 4.0 };
+
+  corevm::types::NativeTypeValue oprd1 = vector;
+  corevm::types::NativeTypeValue oprd2 = data;
+
+  push_eval_stack(eval_oprds_list{oprd2, oprd1});
+
+  execute_instr_and_assert_result<corevm::types::native_vector>(
+    corevm::runtime::instr_handler_vecapnd, expected_result);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(InstrsNativeVectorTypeComplexInstrsTest, TestInstrVECSUM)
+{
+  corevm::types::native_vector vector { 1.0, 2.0, 3.5 };
+  corevm::types::decimal2 expected_result = 6.5;
+  corevm::types::NativeTypeValue oprd = vector;
+
+  push_eval_stack(eval_oprds_list{oprd});
+
+  execute_instr_and_assert_result<corevm::types::decimal2>(
+    corevm::runtime::instr_handler_vecsum, expected_result);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(InstrsNativeVectorTypeComplexInstrsTest, TestInstrVECDOT)
+{
+  corevm::types::native_vector vector { 1.0, 2.0, 3.0 };
+  corevm::types::native_vector other_vector { 4.0, 5.0, 6.0 };
+  corevm::types::decimal2 expected_result = 32.0;
+
+  corevm::types::NativeTypeValue oprd1 = vector;
+  corevm::types::NativeTypeValue oprd2 = other_vector;
+
+  push_eval_stack(eval_oprds_list{oprd2, oprd1});
+
+  execute_instr_and_assert_result<corevm::types::decimal2>(
+    corevm::runtime::instr_handler_vecdot, expected_result);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(InstrsNativeVectorTypeComplexInstrsTest, TestInstrVECSCL)
+{
+  corevm::types::native_vector vector { 1.0, 2.0, 3.0 };
+  corevm::types::decimal2 factor = 2.0;
+  corevm::types::native_vector expected_result { 2.0, 4.0, 6.0 };
+
+  corevm::types::NativeTypeValue oprd1 = vector;
+  corevm::types::NativeTypeValue oprd2 = factor;
+
+  push_eval_stack(eval_oprds_list{oprd2, oprd1});
+
+  execute_instr_and_assert_result<corevm::types::native_vector>(
+    corevm::runtime::instr_handler_vecscl, expected_result);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(InstrsNativeVectorTypeComplexInstrsTest, TestInstrADDOnVectors)
+{
+  corevm::types::native_vector vector { 1.0, 2.0, 3.0 };
+  corevm::types::native_vector other_vector { 0.5, -2.0, 4.0 };
+  corevm::types::native_vector expected_result { 1.5, 0.0, 7.0 };
+
+  corevm::types::NativeTypeValue oprd1 = vector;
+  corevm::types::NativeTypeValue oprd2 = other_vector;
+
+  push_eval_stack(eval_oprds_list{oprd2, oprd1});
+
+  execute_instr_and_assert_result<corevm::types::native_vector>(
+    corevm::runtime::instr_handler_add, expected_result);
+}
+
+// -----------------------------------------------------------------------------
+
+class InstrsSuperinstrsTest : public InstrsUnitTest
+{
+protected:
+  virtual void SetUp()
+  {
+    InstrsUnitTest::SetUp();
+
+    m_process.top_frame().set_pc_safe(0);
+  }
+
+  /**
+   * Inserts a compartment with a single closure into the process, and returns
+   * an object that can be invoked to run it.
+   */
+  Process::dyobj_ptr create_callable_obj()
+  {
+    corevm::runtime::Vector vector {
+      corevm::runtime::Instr(0, 0, 0),
+    };
+    corevm::runtime::LocTable locs;
+    corevm::runtime::CatchSiteList catch_sites;
+
+    corevm::runtime::ClosureTable closure_table {
+      corevm::runtime::Closure(
+        "",
+        0,
+        corevm::runtime::NONESET_CLOSURE_ID,
+        vector,
+        locs,
+        catch_sites)
+    };
+
+    corevm::runtime::Compartment compartment(DUMMY_PATH);
+    compartment.set_closure_table(std::move(closure_table));
+
+    m_process.insert_compartment(compartment);
+
+    auto obj = m_process.create_dyobj();
+    obj->set_closure_ctx(corevm::runtime::ClosureCtx(0, 0));
+
+    return obj;
+  }
+
+  /**
+   * Asserts that the frame the superinstruction ran in is at the last of its
+   * fused instructions.
+   */
+  void assert_pc(corevm::runtime::instr_addr_t expected_pc)
+  {
+    ASSERT_EQ(expected_pc, m_process.top_nth_frame(0).pc());
+  }
+};
+
+// -----------------------------------------------------------------------------
+
+TEST_F(InstrsSuperinstrsTest, TestInstrLDPINVK)
+{
+  const corevm::runtime::variable_key_t key = 1;
+
+  auto obj = create_callable_obj();
+  m_process.top_frame().set_visible_var(key, obj);
+
+  const std::vector<corevm::runtime::DecodedInstr> instrs {
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::LDPINVK, key, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::PINVK, 0, 0),
+  };
+
+  execute_instr(corevm::runtime::instr_handler_ldpinvk, instrs[0]);
+
+  ASSERT_EQ(1, m_process.stack_size());
+  ASSERT_EQ(obj, m_process.top_stack());
+
+  corevm::runtime::ClosureCtx ctx =
+    m_process.top_invocation_ctx().closure_ctx();
+
+  ASSERT_TRUE(obj->closure_ctx() == ctx);
+
+  assert_pc(1);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(InstrsSuperinstrsTest, TestInstrLDPUTARG)
+{
+  const corevm::runtime::variable_key_t key = 1;
+
+  auto obj = m_process.create_dyobj();
+  m_process.top_frame().set_visible_var(key, obj);
+
+  const std::vector<corevm::runtime::DecodedInstr> instrs {
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::LDPUTARG, key, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::PUTARG, 0, 0),
+  };
+
+  execute_instr(corevm::runtime::instr_handler_ldputarg, instrs[0]);
+
+  ASSERT_EQ(0, m_process.stack_size());
+  ASSERT_EQ(obj, m_process.top_invocation_ctx().pop_param());
+
+  assert_pc(1);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(InstrsSuperinstrsTest, TestInstrLDPUTARGWithMissingVariable)
+{
+  m_compartment->set_string_literal_table({ "", "x" });
+
+  const std::vector<corevm::runtime::DecodedInstr> instrs {
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::LDPUTARG, 1, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::PUTARG, 0, 0),
+  };
+
+  ASSERT_THROW(
+    {
+      execute_instr(corevm::runtime::instr_handler_ldputarg, instrs[0]);
+    },
+    corevm::runtime::NameNotFoundError
+  );
+
+  // The error is raised at the address of the `ldobj` instruction.
+  assert_pc(0);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(InstrsSuperinstrsTest, TestInstrLDPUTINVK)
+{
+  const corevm::runtime::variable_key_t key = 1;
+
+  auto obj = m_process.create_dyobj();
+  m_process.top_frame().set_visible_var(key, obj);
+
+  auto callable_obj = create_callable_obj();
+  m_process.push_stack(callable_obj);
+  execute_instr(corevm::runtime::instr_handler_pinvk,
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::PINVK, 0, 0));
+
+  const std::vector<corevm::runtime::DecodedInstr> instrs {
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::LDPUTINVK, key, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::PUTARG, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::INVK, 0, 0),
+  };
+
+  const size_t call_stack_size = m_process.call_stack_size();
+
+  execute_instr(corevm::runtime::instr_handler_ldputinvk, instrs[0]);
+
+  ASSERT_EQ(call_stack_size + 1, m_process.call_stack_size());
+
+  // Returns to the address of the `invk` instruction.
+  ASSERT_EQ(2, m_process.top_frame().return_addr());
+  ASSERT_TRUE(callable_obj->closure_ctx() == m_process.top_frame().closure_ctx());
+
+  ASSERT_EQ(obj, m_process.top_invocation_ctx().pop_param());
+
+  assert_pc(corevm::runtime::NONESET_INSTR_ADDR);
+  ASSERT_EQ(2, m_process.top_nth_frame(1).pc());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(InstrsSuperinstrsTest, TestInstrPUTINVK)
+{
+  auto obj = m_process.create_dyobj();
+
+  auto callable_obj = create_callable_obj();
+  m_process.push_stack(callable_obj);
+  execute_instr(corevm::runtime::instr_handler_pinvk,
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::PINVK, 0, 0));
+
+  m_process.push_stack(obj);
+
+  const std::vector<corevm::runtime::DecodedInstr> instrs {
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::PUTINVK, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::INVK, 0, 0),
+  };
+
+  const size_t call_stack_size = m_process.call_stack_size();
+
+  execute_instr(corevm::runtime::instr_handler_putinvk, instrs[0]);
+
+  ASSERT_EQ(call_stack_size + 1, m_process.call_stack_size());
+  ASSERT_EQ(1, m_process.top_frame().return_addr());
+  ASSERT_EQ(1, m_process.stack_size());
+
+  ASSERT_EQ(obj, m_process.top_invocation_ctx().pop_param());
+
+  ASSERT_EQ(1, m_process.top_nth_frame(1).pc());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(InstrsSuperinstrsTest, TestInstrLDGETATTR)
+{
+  const corevm::runtime::variable_key_t key = 1;
+  const std::string attr_str = "Hello world";
+
+  m_compartment->set_string_literal_table({ attr_str });
+
+  auto obj1 = m_process.create_dyobj();
+  auto obj2 = m_process.create_dyobj();
+
+  corevm::dyobj::attr_key_t attr_key = corevm::dyobj::hash_attr_str(attr_str);
+  obj1->putattr(attr_key, obj2);
+
+  m_process.top_frame().set_visible_var(key, obj1);
+
+  const std::vector<corevm::runtime::DecodedInstr> instrs {
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::LDGETATTR, key, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::GETATTR, 0, 0),
+  };
+
+  execute_instr(corevm::runtime::instr_handler_ldgetattr, instrs[0]);
+
+  ASSERT_EQ(1, m_process.stack_size());
+  ASSERT_EQ(obj2, m_process.top_stack());
+
+  assert_pc(1);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(InstrsSuperinstrsTest, TestInstrNEWINT64)
+{
+  const std::vector<corevm::runtime::DecodedInstr> instrs {
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::NEWINT64, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::INT64, 123, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::SETVAL, 0, 0),
+  };
+
+  execute_instr(corevm::runtime::instr_handler_newint64, instrs[0]);
+
+  ASSERT_EQ(1, m_process.stack_size());
+  ASSERT_EQ(0, m_process.top_frame().eval_stack_size());
+
+  auto obj = m_process.top_stack();
+
+  ASSERT_TRUE(obj->has_type_value());
+
+  auto& res_val = m_process.get_type_value(&obj->type_value());
+
+  ASSERT_EQ(123,
+    corevm::types::get_intrinsic_value_from_type_value<int64_t>(res_val));
+
+  assert_pc(2);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(InstrsSuperinstrsTest, TestInstrNEWSTR)
+{
+  m_compartment->set_string_literal_table({ "", "Hello world" });
+
+  const std::vector<corevm::runtime::DecodedInstr> instrs {
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::NEWSTR, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::STR, 1, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::SETVAL, 0, 0),
+  };
+
+  execute_instr(corevm::runtime::instr_handler_newstr, instrs[0]);
+
+  ASSERT_EQ(1, m_process.stack_size());
+  ASSERT_EQ(0, m_process.top_frame().eval_stack_size());
+
+  auto obj = m_process.top_stack();
+
+  ASSERT_TRUE(obj->has_type_value());
+
+  auto& res_val = m_process.get_type_value(&obj->type_value());
+
+  ASSERT_EQ("Hello world",
+    corevm::types::get_intrinsic_value_from_type_value<corevm::types::native_string>(res_val));
+
+  assert_pc(2);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(InstrsSuperinstrsTest, TestInstrNEWSTOBJ)
+{
+  const corevm::runtime::variable_key_t key = 1;
+
+  m_process.top_frame().push_eval_stack(
+    corevm::types::NativeTypeValue(corevm::types::int64(123)));
+
+  const std::vector<corevm::runtime::DecodedInstr> instrs {
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::NEWSTOBJ, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::SETVAL, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::STOBJ, key, 0),
+  };
+
+  execute_instr(corevm::runtime::instr_handler_newstobj, instrs[0]);
+
+  ASSERT_EQ(0, m_process.stack_size());
+  ASSERT_EQ(0, m_process.top_frame().eval_stack_size());
+
+  auto obj = m_process.top_frame().get_visible_var(key);
+
+  ASSERT_TRUE(obj->has_type_value());
+
+  auto& res_val = m_process.get_type_value(&obj->type_value());
+
+  ASSERT_EQ(123,
+    corevm::types::get_intrinsic_value_from_type_value<int64_t>(res_val));
+
+  assert_pc(2);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(InstrsSuperinstrsTest, TestInstrGETMUTVAL)
+{
+  auto obj = m_process.create_dyobj();
+  obj->set_type_value(m_process.insert_type_value(
+    corevm::types::NativeTypeValue(corevm::types::string("Hello"))));
+
+  m_process.push_stack(obj);
+
+  m_process.top_frame().push_eval_stack(
+    corevm::types::NativeTypeValue(corevm::types::string(" world")));
+
+  const std::vector<corevm::runtime::DecodedInstr> instrs {
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::GETMUTVAL, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::STRAPD, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::SETVAL, 0, 0),
+  };
+
+  execute_instr(corevm::runtime::instr_handler_getmutval, instrs[0]);
+
+  ASSERT_EQ(1, m_process.stack_size());
+  ASSERT_EQ(obj, m_process.top_stack());
+  ASSERT_EQ(1, m_process.top_frame().eval_stack_size());
+
+  auto& res_val = m_process.get_type_value(&obj->type_value());
+
+  ASSERT_EQ("Hello world",
+    corevm::types::get_intrinsic_value_from_type_value<corevm::types::native_string>(res_val));
+
+  assert_pc(2);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(InstrsSuperinstrsTest, TestInstrGETMUTVALRestoresValueOnError)
+{
+  auto obj = m_process.create_dyobj();
+  obj->set_type_value(m_process.insert_type_value(
+    corevm::types::NativeTypeValue(corevm::types::array {1, 2, 3})));
+
+  m_process.push_stack(obj);
+
+  m_process.top_frame().push_eval_stack(
+    corevm::types::NativeTypeValue(corevm::types::uint32(10)));
+
+  const std::vector<corevm::runtime::DecodedInstr> instrs {
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::GETMUTVAL, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::ARYERS, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::SETVAL, 0, 0),
+  };
+
+  ASSERT_THROW(
+    {
+      execute_instr(corevm::runtime::instr_handler_getmutval, instrs[0]);
+    },
+    corevm::types::OutOfRangeError
+  );
+
+  auto& res_val = m_process.get_type_value(&obj->type_value());
+
+  const corevm::types::native_array expected_value {1, 2, 3};
+
+  ASSERT_EQ(expected_value,
+    corevm::types::get_intrinsic_value_from_type_value<corevm::types::native_array>(res_val));
+
+  ASSERT_EQ(2, m_process.top_frame().eval_stack_size());
+
+  assert_pc(1);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(InstrsSuperinstrsTest, TestInstrGETMUTVAL2)
+{
+  const corevm::runtime::variable_key_t key = 1;
+
+  auto obj = m_process.create_dyobj();
+  obj->set_type_value(m_process.insert_type_value(
+    corevm::types::NativeTypeValue(corevm::types::array {1, 2, 3})));
+
+  m_process.top_frame().set_visible_var(key, obj);
+
+  m_process.top_frame().push_eval_stack(
+    corevm::types::NativeTypeValue(corevm::types::uint64(4)));
+
+  const std::vector<corevm::runtime::DecodedInstr> instrs {
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::GETMUTVAL2, key, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::ARYAPND, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::LDOBJ, key, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::SETVAL, 0, 0),
+  };
+
+  execute_instr(corevm::runtime::instr_handler_getmutval2, instrs[0]);
+
+  ASSERT_EQ(1, m_process.stack_size());
+  ASSERT_EQ(obj, m_process.top_stack());
+  ASSERT_EQ(1, m_process.top_frame().eval_stack_size());
+
+  auto& res_val = m_process.get_type_value(&obj->type_value());
+
+  const corevm::types::native_array expected_value {1, 2, 3, 4};
+
+  ASSERT_EQ(expected_value,
+    corevm::types::get_intrinsic_value_from_type_value<corevm::types::native_array>(res_val));
+
+  assert_pc(3);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(InstrsSuperinstrsTest, TestInstrGETMUTVAL2OnDifferentObjects)
+{
+  const corevm::runtime::variable_key_t key1 = 1;
+  const corevm::runtime::variable_key_t key2 = 2;
+
+  auto obj1 = m_process.create_dyobj();
+  obj1->set_type_value(m_process.insert_type_value(
+    corevm::types::NativeTypeValue(corevm::types::array {1, 2, 3})));
+
+  auto obj2 = m_process.create_dyobj();
+  obj2->set_type_value(m_process.insert_type_value(
+    corevm::types::NativeTypeValue(corevm::types::array {})));
+
+  m_process.top_frame().set_visible_var(key1, obj1);
+  m_process.top_frame().set_visible_var(key2, obj2);
+
+  m_process.top_frame().push_eval_stack(
+    corevm::types::NativeTypeValue(corevm::types::uint64(4)));
+
+  const std::vector<corevm::runtime::DecodedInstr> instrs {
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::GETMUTVAL2, key1, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::ARYAPND, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::LDOBJ, key2, 0),
+    corevm::runtime::Instr(corevm::runtime::InstrEnum::SETVAL, 0, 0),
+  };
+
+  execute_instr(corevm::runtime::instr_handler_getmutval2, instrs[0]);
+
+  ASSERT_EQ(1, m_process.stack_size());
+  ASSERT_EQ(obj2, m_process.top_stack());
+
+  // The value of the first object is copied rather than moved, and is left
+  // unchanged.
+  auto& res_val1 = m_process.get_type_value(&obj1->type_value());
+  auto& res_val2 = m_process.get_type_value(&obj2->type_value());
+
+  const corevm::types::native_array expected_value1 {1, 2, 3};
+  const corevm::types::native_array expected_value2 {1, 2, 3, 4};
+
+  ASSERT_EQ(expected_value1,
+    corevm::types::get_intrinsic_value_from_type_value<corevm::types::native_array>(res_val1));
+  ASSERT_EQ(expected_value2,
+    corevm::types::get_intrinsic_value_from_type_value<corevm::types::native_array>(res_val2));
+
+  assert_pc(3);
+}
+
+// -----------------------------------------------------------------------------
@@ -0,0 +1,141 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2016 Yanzheng Li
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#include "runtime/operand_stack.h"
+#include "types/native_type_value.h"
+
+#include <gtest/gtest.h>
+
+
+class OperandStackUnitTest : public ::testing::Test
+{
+protected:
+  typedef corevm::runtime::OperandStack<corevm::types::NativeTypeValue> OperandStack;
+};
+
+// -----------------------------------------------------------------------------
+
+TEST_F(OperandStackUnitTest, TestInitialization)
+{
+  OperandStack stack;
+
+  ASSERT_EQ(0, stack.chunk_count());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(OperandStackUnitTest, TestAllocateAndRelease)
+{
+  OperandStack stack;
+
+  OperandStack::Mark mark1;
+  auto window1 = stack.allocate(4, &mark1);
+
+  ASSERT_NE(nullptr, window1);
+  ASSERT_EQ(1, stack.chunk_count());
+  ASSERT_TRUE(stack.is_top(window1 + 4));
+
+  OperandStack::Mark mark2;
+  auto window2 = stack.allocate(8, &mark2);
+
+  // Windows are laid out contiguously.
+  ASSERT_EQ(window1 + 4, window2);
+  ASSERT_FALSE(stack.is_top(window1 + 4));
+  ASSERT_TRUE(stack.is_top(window2 + 8));
+
+  stack.release(mark2);
+
+  ASSERT_TRUE(stack.is_top(window1 + 4));
+
+  stack.release(mark1);
+
+  OperandStack::Mark mark3;
+  ASSERT_EQ(window1, stack.allocate(2, &mark3));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(OperandStackUnitTest, TestExtend)
+{
+  OperandStack stack;
+
+  OperandStack::Mark mark;
+  auto window1 = stack.allocate(4, &mark);
+
+  ASSERT_TRUE(stack.extend(window1 + 4, 4));
+  ASSERT_TRUE(stack.is_top(window1 + 8));
+
+  auto window2 = stack.allocate(4, &mark);
+
+  ASSERT_EQ(window1 + 8, window2);
+
+  // Only the window on top can be extended.
+  ASSERT_FALSE(stack.extend(window1 + 8, 4));
+
+  // Windows cannot be extended past their chunk.
+  const size_t capacity = OperandStack::CHUNK_CAPACITY;
+  ASSERT_FALSE(stack.extend(window2 + 4, capacity));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(OperandStackUnitTest, TestAllocateAcrossChunks)
+{
+  OperandStack stack;
+
+  const size_t capacity = OperandStack::CHUNK_CAPACITY;
+
+  OperandStack::Mark mark1;
+  auto window1 = stack.allocate(capacity - 1, &mark1);
+
+  OperandStack::Mark mark2;
+  auto window2 = stack.allocate(2, &mark2);
+
+  ASSERT_EQ(2, stack.chunk_count());
+  ASSERT_NE(window1 + capacity - 1, window2);
+  ASSERT_TRUE(stack.is_top(window2 + 2));
+
+  // Windows larger than a chunk get a chunk of their own.
+  OperandStack::Mark mark3;
+  auto window3 = stack.allocate(capacity * 2, &mark3);
+
+  ASSERT_EQ(3, stack.chunk_count());
+  ASSERT_TRUE(stack.is_top(window3 + capacity * 2));
+
+  stack.release(mark2);
+
+  ASSERT_TRUE(stack.is_top(window1 + capacity - 1));
+
+  // Chunks are kept for later windows.
+  ASSERT_EQ(window2, stack.allocate(2, &mark2));
+  ASSERT_EQ(3, stack.chunk_count());
+
+  stack.release(mark1);
+
+  ASSERT_EQ(window1, stack.allocate(1, &mark1));
+
+  stack.clear();
+
+  ASSERT_EQ(0, stack.chunk_count());
+}
+
+// -----------------------------------------------------------------------------
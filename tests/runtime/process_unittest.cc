@@ -27,6 +27,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "runtime/compartment.h"
 #include "runtime/frame.h"
 #include "runtime/gc_rule.h"
+#include "runtime/instr.h"
 #include "runtime/loc_info.h"
 #include "runtime/process.h"
 #include "runtime/process_runner.h"
@@ -489,6 +490,144 @@ TEST_F(ProcessUnitTest, TestInsertCompartment)
 
 // -----------------------------------------------------------------------------
 
+TEST_F(ProcessUnitTest, TestInsertCompartmentRegistersAttrNames)
+{
+  corevm::runtime::Process process;
+
+  corevm::runtime::Compartment compartment("./example.core");
+  compartment.set_string_literal_table({ "__init__" });
+
+  const corevm::dyobj::attr_key_t attr_key = compartment.get_attr_key(0);
+
+  const char* attr_name = nullptr;
+  ASSERT_FALSE(process.get_attr_name(attr_key, &attr_name));
+
+  process.insert_compartment(compartment);
+
+  ASSERT_TRUE(process.get_attr_name(attr_key, &attr_name));
+  ASSERT_STREQ("__init__", attr_name);
+}
+
+// -----------------------------------------------------------------------------
+
+class ProcessRunUnitTest : public ProcessUnitTest
+{
+protected:
+  void run(const corevm::runtime::ClosureTable& closure_table)
+  {
+    corevm::runtime::Compartment compartment("./example.core");
+    corevm::runtime::ClosureTable closure_table_copy(closure_table);
+    compartment.set_closure_table(std::move(closure_table_copy));
+
+    m_process.insert_compartment(compartment);
+    m_process.run();
+  }
+
+  corevm::runtime::Closure make_closure(corevm::runtime::closure_id_t id,
+    corevm::runtime::closure_id_t parent_id,
+    const corevm::runtime::Vector& vector)
+  {
+    corevm::runtime::LocTable locs;
+    corevm::runtime::CatchSiteList catch_sites;
+
+    return corevm::runtime::Closure(
+      "", id, parent_id, vector, locs, catch_sites);
+  }
+
+  uint32_t top_eval_stack_value()
+  {
+    return corevm::types::get_intrinsic_value_from_type_value<uint32_t>(
+      m_process.top_frame().top_eval_stack());
+  }
+
+  corevm::runtime::Process m_process;
+};
+
+// -----------------------------------------------------------------------------
+
+TEST_F(ProcessRunUnitTest, TestRunStraightLineClosure)
+{
+  corevm::runtime::Vector vector {
+    corevm::runtime::Instr(corevm::runtime::UINT32, 1, 0),
+    corevm::runtime::Instr(corevm::runtime::INC, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::INC, 0, 0),
+  };
+
+  run(corevm::runtime::ClosureTable {
+    make_closure(0, corevm::runtime::NONESET_CLOSURE_ID, vector) });
+
+  ASSERT_EQ(1, m_process.call_stack_size());
+  ASSERT_EQ(1, m_process.top_frame().eval_stack_size());
+  ASSERT_EQ(3, top_eval_stack_value());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(ProcessRunUnitTest, TestRunLoop)
+{
+  corevm::runtime::Vector vector {
+    corevm::runtime::Instr(corevm::runtime::UINT32, 10, 0),
+    corevm::runtime::Instr(corevm::runtime::DEC, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::JMPIF, -2, 0),
+    corevm::runtime::Instr(corevm::runtime::INC, 0, 0),
+  };
+
+  run(corevm::runtime::ClosureTable {
+    make_closure(0, corevm::runtime::NONESET_CLOSURE_ID, vector) });
+
+  ASSERT_EQ(1, m_process.top_frame().eval_stack_size());
+  ASSERT_EQ(1, top_eval_stack_value());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(ProcessRunUnitTest, TestRunInvokeAndReturn)
+{
+  corevm::runtime::Vector vector1 {
+    corevm::runtime::Instr(corevm::runtime::NEW, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::SETCTX, 1, 0),
+    corevm::runtime::Instr(corevm::runtime::PINVK, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::INVK, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::UINT32, 5, 0),
+  };
+
+  corevm::runtime::Vector vector2 {
+    corevm::runtime::Instr(corevm::runtime::NEW, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::UINT32, 7, 0),
+    corevm::runtime::Instr(corevm::runtime::RTRN, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::UINT32, 8, 0),
+  };
+
+  run(corevm::runtime::ClosureTable {
+    make_closure(0, corevm::runtime::NONESET_CLOSURE_ID, vector1),
+    make_closure(1, 0, vector2) });
+
+  ASSERT_EQ(1, m_process.call_stack_size());
+  ASSERT_EQ(2, m_process.stack_size());
+  ASSERT_EQ(1, m_process.top_frame().eval_stack_size());
+  ASSERT_EQ(5, top_eval_stack_value());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(ProcessRunUnitTest, TestRunUntilExit)
+{
+  corevm::runtime::Vector vector {
+    corevm::runtime::Instr(corevm::runtime::UINT32, 1, 0),
+    corevm::runtime::Instr(corevm::runtime::EXIT, 0, 0),
+    corevm::runtime::Instr(corevm::runtime::INC, 0, 0),
+  };
+
+  run(corevm::runtime::ClosureTable {
+    make_closure(0, corevm::runtime::NONESET_CLOSURE_ID, vector) });
+
+  ASSERT_EQ(corevm::runtime::Process::EXECUTION_STATUS_TERMINATED,
+    m_process.execution_status());
+  ASSERT_EQ(1, top_eval_stack_value());
+}
+
+// -----------------------------------------------------------------------------
+
 class ProcessGCRuleUnitTest : public ProcessUnitTest
 {
 protected:
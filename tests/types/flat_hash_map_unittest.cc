@@ -0,0 +1,330 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2016 Yanzheng Li
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#include "types/flat_hash_map.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <unordered_map>
+
+
+// -----------------------------------------------------------------------------
+
+class FlatHashMapUnitTest : public ::testing::Test
+{
+protected:
+  typedef corevm::types::flat_hash_map<uint64_t, uint64_t> map_type;
+
+  /**
+   * Hashes all keys alike, so that they all probe the same groups.
+   */
+  struct ConstantHash
+  {
+    size_t operator()(uint64_t) const
+    {
+      return 0;
+    }
+  };
+};
+
+// -----------------------------------------------------------------------------
+
+TEST_F(FlatHashMapUnitTest, TestEmptyInitialization)
+{
+  const map_type map;
+
+  ASSERT_TRUE(map.empty());
+  ASSERT_EQ(0, map.size());
+  ASSERT_EQ(0, map.capacity());
+  ASSERT_TRUE(map.begin() == map.end());
+  ASSERT_TRUE(map.find(1) == map.end());
+  ASSERT_EQ(0, map.count(1));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(FlatHashMapUnitTest, TestInsertAndFind)
+{
+  const uint64_t N = 10000;
+
+  map_type map;
+
+  for (uint64_t i = 0; i < N; ++i)
+  {
+    auto res = map.insert(std::make_pair(i, i * 2));
+
+    ASSERT_TRUE(res.second);
+    ASSERT_EQ(i, res.first->first);
+  }
+
+  ASSERT_EQ(N, map.size());
+
+  // Inserting existing keys does not overwrite them.
+  auto res = map.insert(std::make_pair(1, 123));
+
+  ASSERT_FALSE(res.second);
+  ASSERT_EQ(2, res.first->second);
+
+  for (uint64_t i = 0; i < N; ++i)
+  {
+    auto itr = map.find(i);
+
+    ASSERT_NE(map.end(), itr);
+    ASSERT_EQ(i * 2, itr->second);
+  }
+
+  ASSERT_EQ(map.end(), map.find(N));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(FlatHashMapUnitTest, TestSubscriptOperator)
+{
+  map_type map;
+
+  ASSERT_EQ(0, map[1]);
+  ASSERT_EQ(1, map.size());
+
+  map[1] = 11;
+  map[2] = 22;
+
+  ASSERT_EQ(11, map[1]);
+  ASSERT_EQ(22, map[2]);
+  ASSERT_EQ(2, map.size());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(FlatHashMapUnitTest, TestErase)
+{
+  const uint64_t N = 1000;
+
+  map_type map;
+
+  for (uint64_t i = 0; i < N; ++i)
+  {
+    map[i] = i;
+  }
+
+  for (uint64_t i = 0; i < N; i += 2)
+  {
+    ASSERT_EQ(1, map.erase(i));
+  }
+
+  ASSERT_EQ(0, map.erase(0));
+  ASSERT_EQ(N / 2, map.size());
+
+  for (uint64_t i = 0; i < N; ++i)
+  {
+    ASSERT_EQ(i % 2, map.count(i));
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(FlatHashMapUnitTest, TestEraseWhileIterating)
+{
+  map_type map;
+
+  for (uint64_t i = 0; i < 100; ++i)
+  {
+    map[i] = i;
+  }
+
+  for (auto itr = map.begin(); itr != map.end(); )
+  {
+    if (itr->first % 3 == 0)
+    {
+      itr = map.erase(itr);
+    }
+    else
+    {
+      ++itr;
+    }
+  }
+
+  ASSERT_EQ(66, map.size());
+
+  size_t count = 0;
+  for (const auto& pair : map)
+  {
+    ASSERT_NE(0, pair.first % 3);
+    ++count;
+  }
+
+  ASSERT_EQ(66, count);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(FlatHashMapUnitTest, TestRepeatedInsertAndEraseDoesNotGrow)
+{
+  map_type map;
+
+  map[0] = 0;
+
+  const size_t capacity = map.capacity();
+
+  // Slots freed by erasing are reused, or reclaimed by rehashing in place.
+  for (uint64_t i = 1; i < 100000; ++i)
+  {
+    map[i] = i;
+    map.erase(i - 1);
+  }
+
+  ASSERT_EQ(1, map.size());
+  ASSERT_EQ(capacity, map.capacity());
+  ASSERT_EQ(99999, map.find(99999)->second);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(FlatHashMapUnitTest, TestCollidingKeys)
+{
+  corevm::types::flat_hash_map<uint64_t, uint64_t, ConstantHash> map;
+
+  for (uint64_t i = 0; i < 100; ++i)
+  {
+    map[i] = i;
+  }
+
+  // Probes past erased slots of the full groups.
+  for (uint64_t i = 0; i < 50; ++i)
+  {
+    map.erase(i);
+  }
+
+  for (uint64_t i = 0; i < 100; ++i)
+  {
+    ASSERT_EQ(i < 50 ? 0 : 1, map.count(i));
+  }
+
+  for (uint64_t i = 0; i < 50; ++i)
+  {
+    map[i] = i;
+  }
+
+  ASSERT_EQ(100, map.size());
+
+  for (uint64_t i = 0; i < 100; ++i)
+  {
+    ASSERT_EQ(i, map.find(i)->second);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(FlatHashMapUnitTest, TestCopyMoveAndEquality)
+{
+  map_type map1 { { 1, 11 }, { 2, 22 }, { 3, 33 } };
+
+  map_type map2(map1);
+
+  ASSERT_TRUE(map1 == map2);
+
+  map2[3] = 34;
+
+  ASSERT_TRUE(map1 != map2);
+  ASSERT_EQ(33, map1[3]);
+
+  map_type map3(std::move(map2));
+
+  ASSERT_TRUE(map2.empty());
+  ASSERT_EQ(3, map3.size());
+  ASSERT_EQ(34, map3[3]);
+
+  map2 = map1;
+
+  ASSERT_TRUE(map1 == map2);
+
+  map2.swap(map3);
+
+  ASSERT_EQ(34, map2[3]);
+  ASSERT_EQ(33, map3[3]);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(FlatHashMapUnitTest, TestClearAndReserve)
+{
+  map_type map;
+
+  map.reserve(1000);
+
+  const size_t capacity = map.capacity();
+
+  ASSERT_GE(capacity, 1000);
+
+  for (uint64_t i = 0; i < 1000; ++i)
+  {
+    map[i] = i;
+  }
+
+  ASSERT_EQ(capacity, map.capacity());
+
+  map.clear();
+
+  ASSERT_TRUE(map.empty());
+  ASSERT_TRUE(map.begin() == map.end());
+  ASSERT_EQ(capacity, map.capacity());
+  ASSERT_EQ(0, map.count(1));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(FlatHashMapUnitTest, TestMatchesStdUnorderedMap)
+{
+  map_type map;
+  std::unordered_map<uint64_t, uint64_t> expected;
+
+  uint64_t key = 1;
+
+  for (uint64_t i = 0; i < 50000; ++i)
+  {
+    key = key * 6364136223846793005ULL + 1442695040888963407ULL;
+    const uint64_t k = (key >> 40) % 4096;
+
+    if (i % 3 == 0)
+    {
+      ASSERT_EQ(expected.erase(k), map.erase(k));
+    }
+    else
+    {
+      map[k] = i;
+      expected[k] = i;
+    }
+  }
+
+  ASSERT_EQ(expected.size(), map.size());
+
+  size_t count = 0;
+  for (const auto& pair : map)
+  {
+    ASSERT_EQ(expected.at(pair.first), pair.second);
+    ++count;
+  }
+
+  ASSERT_EQ(expected.size(), count);
+}
+
+// -----------------------------------------------------------------------------
@@ -0,0 +1,305 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2016 Yanzheng Li
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#include "types/native_array_kernels.h"
+
+#include "simd_kernels_test_base.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+
+// -----------------------------------------------------------------------------
+
+class NativeArrayKernelsUnitTest : public SimdKernelsTestBase
+{
+protected:
+  typedef corevm::types::native_array_element_type element_type;
+
+  virtual void SetUp()
+  {
+    std::mt19937_64 engine(42);
+
+    // Elements with their highest bits set too, which are compared as
+    // unsigned integers.
+    m_elements.resize(MAX_SIZE + MAX_OFFSET);
+    for (auto& element : m_elements)
+    {
+      element = engine();
+    }
+  }
+
+  const element_type* elements(size_t offset) const
+  {
+    return m_elements.data() + offset;
+  }
+
+  static std::vector<const corevm::types::ArrayKernels*> all_kernels()
+  {
+    return supported_kernels(corevm::types::array_kernel_tables());
+  }
+
+  std::vector<element_type> m_elements;
+};
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeArrayKernelsUnitTest, TestSum)
+{
+  for (const auto kernels : all_kernels())
+  {
+    SCOPED_TRACE(kernels->isa);
+
+    for (size_t offset = 0; offset < MAX_OFFSET; ++offset)
+    {
+      for (size_t n = 0; n <= MAX_SIZE; ++n)
+      {
+        const element_type* p = elements(offset);
+
+        ASSERT_EQ(std::accumulate(p, p + n, element_type(0)),
+          kernels->sum(p, n));
+      }
+    }
+  }
+
+  const element_type* p = elements(0);
+  ASSERT_EQ(std::accumulate(p, p + MAX_SIZE, element_type(0)),
+    corevm::types::array_sum(p, MAX_SIZE));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeArrayKernelsUnitTest, TestMinAndMax)
+{
+  for (const auto kernels : all_kernels())
+  {
+    SCOPED_TRACE(kernels->isa);
+
+    for (size_t offset = 0; offset < MAX_OFFSET; ++offset)
+    {
+      for (size_t n = 1; n <= MAX_SIZE; ++n)
+      {
+        const element_type* p = elements(offset);
+
+        ASSERT_EQ(*std::min_element(p, p + n), kernels->min(p, n));
+        ASSERT_EQ(*std::max_element(p, p + n), kernels->max(p, n));
+      }
+    }
+  }
+
+  const element_type* p = elements(0);
+  ASSERT_EQ(*std::min_element(p, p + MAX_SIZE),
+    corevm::types::array_min(p, MAX_SIZE));
+  ASSERT_EQ(*std::max_element(p, p + MAX_SIZE),
+    corevm::types::array_max(p, MAX_SIZE));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeArrayKernelsUnitTest, TestMinAndMaxWithEqualHalves)
+{
+  // Elements that only differ in either of their 32 bit halves.
+  const std::vector<element_type> elements {
+    0x100000002ULL, 0x100000001ULL, 0x200000000ULL, 0x1FFFFFFFFULL,
+    0x100000003ULL, 0x000000004ULL, 0x100000000ULL, 0x1FFFFFFFEULL,
+    0x200000001ULL
+  };
+
+  for (const auto kernels : all_kernels())
+  {
+    SCOPED_TRACE(kernels->isa);
+
+    ASSERT_EQ(0x000000004ULL, kernels->min(elements.data(), elements.size()));
+    ASSERT_EQ(0x200000001ULL, kernels->max(elements.data(), elements.size()));
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeArrayKernelsUnitTest, TestFind)
+{
+  for (const auto kernels : all_kernels())
+  {
+    SCOPED_TRACE(kernels->isa);
+
+    for (size_t offset = 0; offset < MAX_OFFSET; ++offset)
+    {
+      for (size_t n = 0; n <= MAX_SIZE; ++n)
+      {
+        const element_type* p = elements(offset);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+          ASSERT_EQ(static_cast<size_t>(std::find(p, p + n, p[i]) - p),
+            kernels->find(p, n, p[i]));
+        }
+
+        ASSERT_EQ(n, kernels->find(p, n, p[n]));
+      }
+    }
+  }
+
+  const element_type* p = elements(0);
+  ASSERT_EQ(size_t(7), corevm::types::array_find(p, MAX_SIZE, p[7]));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeArrayKernelsUnitTest, TestFindFirstOfEqualElements)
+{
+  const std::vector<element_type> elements(20, 7);
+
+  for (const auto kernels : all_kernels())
+  {
+    SCOPED_TRACE(kernels->isa);
+
+    ASSERT_EQ(size_t(0), kernels->find(elements.data(), elements.size(), 7));
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeArrayKernelsUnitTest, TestFindWithEqualHalves)
+{
+  // Elements that match either half of the value, but not both.
+  const std::vector<element_type> elements {
+    0x100000002ULL, 0x200000001ULL, 0x300000001ULL, 0x100000003ULL,
+    0x100000001ULL
+  };
+
+  for (const auto kernels : all_kernels())
+  {
+    SCOPED_TRACE(kernels->isa);
+
+    ASSERT_EQ(size_t(4),
+      kernels->find(elements.data(), elements.size(), 0x100000001ULL));
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeArrayKernelsUnitTest, TestReverseCopy)
+{
+  for (const auto kernels : all_kernels())
+  {
+    SCOPED_TRACE(kernels->isa);
+
+    for (size_t offset = 0; offset < MAX_OFFSET; ++offset)
+    {
+      for (size_t n = 0; n <= MAX_SIZE; ++n)
+      {
+        const element_type* p = elements(offset);
+
+        std::vector<element_type> expected(n);
+        std::reverse_copy(p, p + n, expected.begin());
+
+        std::vector<element_type> actual(n);
+        kernels->reverse_copy(p, n, actual.data());
+
+        ASSERT_EQ(expected, actual);
+      }
+    }
+  }
+
+  const element_type* p = elements(0);
+
+  std::vector<element_type> expected(MAX_SIZE);
+  std::reverse_copy(p, p + MAX_SIZE, expected.begin());
+
+  std::vector<element_type> actual(MAX_SIZE);
+  corevm::types::array_reverse_copy(p, MAX_SIZE, actual.data());
+
+  ASSERT_EQ(expected, actual);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeArrayKernelsUnitTest, TestHash)
+{
+  // Past several blocks of stripes, whose accumulators are scrambled.
+  const size_t LONG_SIZE = 1000;
+
+  std::vector<element_type> long_elements(LONG_SIZE);
+  std::iota(long_elements.begin(), long_elements.end(), element_type(1));
+
+  const auto& scalar = *corevm::types::array_kernel_tables().scalar;
+
+  for (const auto kernels : all_kernels())
+  {
+    SCOPED_TRACE(kernels->isa);
+
+    for (size_t offset = 0; offset < MAX_OFFSET; ++offset)
+    {
+      for (size_t n = 0; n <= MAX_SIZE; ++n)
+      {
+        const element_type* p = elements(offset);
+
+        ASSERT_EQ(scalar.hash(p, n), kernels->hash(p, n));
+      }
+    }
+
+    const element_type* p = long_elements.data();
+    ASSERT_EQ(scalar.hash(p, LONG_SIZE), kernels->hash(p, LONG_SIZE));
+  }
+
+  const uint64_t hash =
+    corevm::types::array_hash(long_elements.data(), LONG_SIZE);
+
+  std::reverse(long_elements.begin(), long_elements.end());
+  ASSERT_NE(hash, corevm::types::array_hash(long_elements.data(), LONG_SIZE));
+
+  std::reverse(long_elements.begin(), long_elements.end());
+  std::swap(long_elements[100], long_elements[900]);
+  ASSERT_NE(hash, corevm::types::array_hash(long_elements.data(), LONG_SIZE));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeArrayKernelsUnitTest, TestStrideCopy)
+{
+  for (size_t stride = 1; stride <= 5; ++stride)
+  {
+    for (size_t n = 0; n <= MAX_SIZE; ++n)
+    {
+      const element_type* p = elements(0);
+
+      std::vector<element_type> expected;
+      for (size_t i = 0; i < n; i += stride)
+      {
+        expected.push_back(p[i]);
+      }
+
+      std::vector<element_type> actual((n + stride - 1) / stride);
+      corevm::types::array_stride_copy(p, n, stride, actual.data());
+
+      ASSERT_EQ(expected, actual);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
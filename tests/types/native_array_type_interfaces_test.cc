@@ -22,6 +22,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 *******************************************************************************/
 #include "native_type_interfaces_test_base.h"
 
+#include <limits>
 #include <string>
 
 
@@ -192,7 +193,7 @@ TEST_F(NativeArrayTypeInterfacesTest, TestPop)
 
   corevm::types::native_array expected_result {1, 2};
 
-  apply_interface_on_single_operand_and_assert_result<corevm::types::native_array>(
+  apply_interface_on_single_operand_in_place_and_assert_result<corevm::types::native_array>(
     operand,
     corevm::types::interface_array_pop,
     expected_result
@@ -235,3 +236,110 @@ TEST_F(NativeArrayTypeInterfacesTest, TestClear)
 }
 
 // -----------------------------------------------------------------------------
+
+TEST_F(NativeArrayTypeInterfacesTest, TestSum)
+{
+  corevm::types::native_array array {1, 2, 3};
+  corevm::types::NativeTypeValue operand = array;
+
+  corevm::types::uint64 expected_result = 6;
+
+  apply_interface_on_single_operand_and_assert_result<corevm::types::uint64>(
+    operand,
+    corevm::types::interface_array_sum,
+    expected_result
+  );
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeArrayTypeInterfacesTest, TestMin)
+{
+  corevm::types::native_array array {3, 1, 2};
+  corevm::types::NativeTypeValue operand = array;
+
+  corevm::types::uint64 expected_result = 1;
+
+  apply_interface_on_single_operand_and_assert_result<corevm::types::uint64>(
+    operand,
+    corevm::types::interface_array_min,
+    expected_result
+  );
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeArrayTypeInterfacesTest, TestMax)
+{
+  corevm::types::native_array array {3, 1, 2};
+  corevm::types::NativeTypeValue operand = array;
+
+  corevm::types::uint64 expected_result = 3;
+
+  apply_interface_on_single_operand_and_assert_result<corevm::types::uint64>(
+    operand,
+    corevm::types::interface_array_max,
+    expected_result
+  );
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeArrayTypeInterfacesTest, TestMinAndMaxOnEmptyArray)
+{
+  corevm::types::native_array array;
+  corevm::types::NativeTypeValue operand = array;
+
+  ASSERT_THROW(
+    {
+      corevm::types::interface_array_min(operand);
+    },
+    corevm::types::OutOfRangeError
+  );
+
+  ASSERT_THROW(
+    {
+      corevm::types::interface_array_max(operand);
+    },
+    corevm::types::OutOfRangeError
+  );
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeArrayTypeInterfacesTest, TestFind)
+{
+  corevm::types::native_array array {1, 2, 3, 2};
+  corevm::types::NativeTypeValue operand = array;
+  corevm::types::NativeTypeValue value = corevm::types::uint64(2);
+
+  corevm::types::uint64 expected_result = 1;
+
+  apply_interface_on_two_operands_and_assert_result<corevm::types::uint64>(
+    operand,
+    value,
+    corevm::types::interface_array_find,
+    expected_result
+  );
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeArrayTypeInterfacesTest, TestFindWithoutMatch)
+{
+  corevm::types::native_array array {1, 2, 3};
+  corevm::types::NativeTypeValue operand = array;
+  corevm::types::NativeTypeValue value = corevm::types::uint64(4);
+
+  corevm::types::uint64 expected_result =
+    std::numeric_limits<corevm::types::uint64>::max();
+
+  apply_interface_on_two_operands_and_assert_result<corevm::types::uint64>(
+    operand,
+    value,
+    corevm::types::interface_array_find,
+    expected_result
+  );
+}
+
+// -----------------------------------------------------------------------------
@@ -254,6 +254,231 @@ TEST_F(NativeArrayFunctionalityUnitTest, TestEraseFailure)
 
 // -----------------------------------------------------------------------------
 
+TEST_F(NativeArrayFunctionalityUnitTest, TestHash)
+{
+  corevm::types::native_array array {1, 2, 3, 4, 5, 6, 7};
+  const corevm::types::native_array same_array {1, 2, 3, 4, 5, 6, 7};
+  const corevm::types::native_array reversed_array {7, 6, 5, 4, 3, 2, 1};
+
+  const size_t hash = array.hash();
+
+  ASSERT_EQ(hash, array.hash());
+  ASSERT_EQ(hash, same_array.hash());
+  ASSERT_NE(hash, reversed_array.hash());
+  ASSERT_NE(corevm::types::native_array().hash(),
+    corevm::types::native_array {0}.hash());
+
+  // Copies carry the hash.
+  corevm::types::native_array copy(array);
+  ASSERT_EQ(hash, copy.hash());
+
+  // Mutations drop the hash.
+  array.push_back(8);
+  ASSERT_NE(hash, array.hash());
+  array.pop_back();
+  ASSERT_EQ(hash, array.hash());
+
+  array[0] = 0;
+  ASSERT_NE(hash, array.hash());
+  array.at(0) = 1;
+  ASSERT_EQ(hash, array.hash());
+
+  array.insert(array.begin(), 0);
+  ASSERT_NE(hash, array.hash());
+  array.erase(0);
+  ASSERT_EQ(hash, array.hash());
+
+  array.resize(3);
+  ASSERT_NE(hash, array.hash());
+
+  array.swap(copy);
+  ASSERT_EQ(hash, array.hash());
+  ASSERT_EQ(corevm::types::native_array({1, 2, 3}).hash(), copy.hash());
+
+  array.clear();
+  ASSERT_EQ(corevm::types::native_array().hash(), array.hash());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeArrayFunctionalityUnitTest, TestSlice)
+{
+  const corevm::types::native_array array {1, 2, 3, 4, 5};
+
+  // Short slices are copies.
+  const corevm::types::native_array slice = array.slice(1, 3);
+
+  ASSERT_TRUE(array.flat());
+  ASSERT_TRUE(slice.flat());
+  ASSERT_EQ(corevm::types::native_array({2, 3, 4}), slice);
+
+  ASSERT_EQ(corevm::types::native_array({4, 5}), array.slice(3, 10));
+  ASSERT_TRUE(array.slice(5, 1).empty());
+  ASSERT_TRUE(array.slice(10, 1).empty());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeArrayFunctionalityUnitTest, TestSliceOfLargeArray)
+{
+  const size_t size = corevm::types::native_array::VIEW_MIN_SIZE * 4;
+
+  corevm::types::native_array array;
+  for (size_t i = 0; i < size; ++i)
+  {
+    array.push_back(i);
+  }
+
+  const corevm::types::native_array expected_array(array);
+  const corevm::types::native_array expected_slice(
+    expected_array.begin() + 10, expected_array.begin() + size - 10);
+
+  // Large slices share a copy of the elements of the array, which is left
+  // as is.
+  corevm::types::native_array slice = array.slice(10, size - 20);
+  corevm::types::native_array slice2 = slice.slice(10, size - 30);
+
+  ASSERT_TRUE(array.flat());
+  ASSERT_FALSE(slice.flat());
+  ASSERT_FALSE(slice2.flat());
+
+  ASSERT_EQ(size, array.size());
+  ASSERT_EQ(size - 20, slice.size());
+  ASSERT_EQ(size - 30, slice2.size());
+
+  const corevm::types::native_array& const_slice = slice;
+
+  ASSERT_EQ(10, const_slice[0]);
+  ASSERT_EQ(20, const_slice.at(10));
+  ASSERT_EQ(20, slice2.at(0));
+  ASSERT_FALSE(slice.flat());
+
+  ASSERT_THROW(
+    {
+      const_slice.at(size - 20);
+    },
+    corevm::types::OutOfRangeError
+  );
+
+  // Copies of views are views.
+  corevm::types::native_array copy(slice);
+  ASSERT_FALSE(copy.flat());
+
+  ASSERT_EQ(expected_slice.hash(), slice.hash());
+  ASSERT_EQ(expected_slice, copy);
+  ASSERT_FALSE(slice.flat());
+
+  // Views are copied as they get mutated, apart from one another.
+  slice[0] = 0;
+  slice2.push_back(0);
+  array.pop_back();
+
+  ASSERT_TRUE(slice.flat());
+  ASSERT_TRUE(slice2.flat());
+  ASSERT_TRUE(array.flat());
+
+  ASSERT_EQ(0, slice[0]);
+  ASSERT_EQ(size - 29, slice2.size());
+  ASSERT_EQ(size - 1, array.size());
+
+  ASSERT_EQ(expected_slice, copy);
+  ASSERT_EQ(corevm::types::native_array(
+    expected_array.begin(), expected_array.end() - 1), array);
+  ASSERT_NE(expected_slice.hash(), slice.hash());
+
+  // The last view of the elements moves them back instead.
+  corevm::types::native_array last_view(std::move(copy));
+  last_view.flatten();
+
+  ASSERT_TRUE(last_view.flat());
+  ASSERT_EQ(expected_slice, last_view);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeArrayFunctionalityUnitTest, TestIterateOverSlicedArray)
+{
+  const size_t size = corevm::types::native_array::VIEW_MIN_SIZE * 4;
+
+  corevm::types::native_array array;
+  for (size_t i = 0; i < size; ++i)
+  {
+    array.push_back(i);
+  }
+
+  const corevm::types::native_array& src = array;
+  const corevm::types::native_array slice = src.slice(1, size - 2);
+
+  ASSERT_FALSE(slice.flat());
+
+  // Both the array and its slice read and iterate over all of their
+  // elements.
+  corevm::types::native_array_base dst;
+  dst.insert(dst.end(), src.begin(), src.end());
+
+  ASSERT_EQ(size, dst.size());
+  ASSERT_EQ(0, dst.front());
+  ASSERT_EQ(size - 1, dst.back());
+  ASSERT_EQ(0, src.front());
+  ASSERT_EQ(size - 1, src.back());
+  ASSERT_EQ(size - 1, src.data()[size - 1]);
+
+  ASSERT_EQ(1, slice.front());
+  ASSERT_EQ(size - 2, slice.back());
+  ASSERT_EQ(size - 2, slice.data()[size - 3]);
+  ASSERT_FALSE(slice.flat());
+
+  dst.assign(slice.rbegin(), slice.rend());
+
+  ASSERT_TRUE(slice.flat());
+  ASSERT_EQ(size - 2, dst.size());
+  ASSERT_EQ(size - 2, dst.front());
+  ASSERT_EQ(1, dst.back());
+
+  // Copies of the array view its shared copy of its elements, which the
+  // array drops as it gets mutated.
+  corevm::types::native_array copy(array);
+  ASSERT_FALSE(copy.flat());
+
+  array.push_back(size);
+
+  ASSERT_EQ(size + 1, array.size());
+  ASSERT_EQ(size, copy.size());
+  ASSERT_EQ(size - 1, copy.back());
+  ASSERT_EQ(size - 2, array.slice(1, size - 2).back());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeArrayFunctionalityUnitTest, TestSmallSliceOfLargeArray)
+{
+  const size_t size = corevm::types::native_array::VIEW_MIN_SIZE * 4;
+
+  corevm::types::native_array array;
+  for (size_t i = 0; i < size; ++i)
+  {
+    array.push_back(i);
+  }
+
+  // Slices of less than half of the array are copied, unless the array has
+  // a copy of its elements shared with its views already.
+  const corevm::types::native_array slice =
+    array.slice(10, corevm::types::native_array::VIEW_MIN_SIZE);
+
+  ASSERT_TRUE(slice.flat());
+  ASSERT_EQ(10, slice.front());
+
+  const corevm::types::native_array large_slice = array.slice(0, size);
+  const corevm::types::native_array slice2 =
+    array.slice(10, corevm::types::native_array::VIEW_MIN_SIZE);
+
+  ASSERT_FALSE(large_slice.flat());
+  ASSERT_FALSE(slice2.flat());
+  ASSERT_EQ(slice, slice2);
+}
+
+// -----------------------------------------------------------------------------
+
 class NativeArrayOperatorUnitTest : public NativeArrayUnitTest {};
 
 // -----------------------------------------------------------------------------
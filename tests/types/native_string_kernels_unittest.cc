@@ -0,0 +1,222 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2016 Yanzheng Li
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#include "types/native_string_kernels.h"
+
+#include "simd_kernels_test_base.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <random>
+#include <string>
+#include <vector>
+
+
+// -----------------------------------------------------------------------------
+
+class NativeStringKernelsUnitTest : public SimdKernelsTestBase
+{
+protected:
+  typedef corevm::types::StringKernels StringKernels;
+
+  /**
+   * Text over a small alphabet, so that first and last characters of
+   * needles often match at positions where the needles do not.
+   */
+  static std::string random_text(std::mt19937& engine, size_t n)
+  {
+    std::uniform_int_distribution<int> dist('a', 'c');
+
+    std::string text(n, ' ');
+    for (auto& c : text)
+    {
+      c = static_cast<char>(dist(engine));
+    }
+
+    return text;
+  }
+
+  static std::vector<const StringKernels*> all_kernels()
+  {
+    return supported_kernels(corevm::types::string_kernel_tables());
+  }
+
+  static size_t find(const StringKernels& kernels, const std::string& s,
+    const std::string& needle, size_t pos)
+  {
+    return corevm::types::string_find(kernels, s.data(), s.size(),
+      needle.data(), needle.size(), pos);
+  }
+
+  static size_t rfind(const StringKernels& kernels, const std::string& s,
+    const std::string& needle, size_t pos)
+  {
+    return corevm::types::string_rfind(kernels, s.data(), s.size(),
+      needle.data(), needle.size(), pos);
+  }
+};
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeStringKernelsUnitTest, TestFindAndRFind)
+{
+  for (const auto kernels : all_kernels())
+  {
+    SCOPED_TRACE(kernels->isa);
+
+    std::mt19937 engine(42);
+
+    for (size_t n = 0; n <= 100; n += 7)
+    {
+      const std::string s = random_text(engine, n);
+
+      for (size_t m = 1; m <= 6; ++m)
+      {
+        for (size_t k = 0; k < 4; ++k)
+        {
+          const std::string needle = random_text(engine, m);
+
+          for (size_t pos = 0; pos <= n + 1; ++pos)
+          {
+            ASSERT_EQ(s.find(needle, pos), find(*kernels, s, needle, pos));
+            ASSERT_EQ(s.rfind(needle, pos), rfind(*kernels, s, needle, pos));
+          }
+
+          ASSERT_EQ(s.rfind(needle),
+            rfind(*kernels, s, needle, std::string::npos));
+        }
+      }
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeStringKernelsUnitTest, TestFindAndRFindWithLongNeedles)
+{
+  for (const auto kernels : all_kernels())
+  {
+    SCOPED_TRACE(kernels->isa);
+
+    std::mt19937 engine(7);
+
+    const std::string s = random_text(engine, 300);
+
+    for (size_t begin = 0; begin < s.size(); begin += 13)
+    {
+      for (size_t m = 20; m <= 80 && begin + m <= s.size(); m += 30)
+      {
+        const std::string needle = s.substr(begin, m);
+
+        for (size_t pos = 0; pos <= s.size(); pos += 11)
+        {
+          ASSERT_EQ(s.find(needle, pos), find(*kernels, s, needle, pos));
+          ASSERT_EQ(s.rfind(needle, pos), rfind(*kernels, s, needle, pos));
+        }
+      }
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeStringKernelsUnitTest, TestFindAndRFindWithEmptyNeedle)
+{
+  for (const auto kernels : all_kernels())
+  {
+    SCOPED_TRACE(kernels->isa);
+
+    const std::string s = "Hello world";
+    const std::string needle;
+
+    ASSERT_EQ(s.find(needle, 0), find(*kernels, s, needle, 0));
+    ASSERT_EQ(s.find(needle, 5), find(*kernels, s, needle, 5));
+    ASSERT_EQ(s.find(needle, 11), find(*kernels, s, needle, 11));
+    ASSERT_EQ(s.find(needle, 12), find(*kernels, s, needle, 12));
+
+    ASSERT_EQ(s.rfind(needle, 0), rfind(*kernels, s, needle, 0));
+    ASSERT_EQ(s.rfind(needle, 5), rfind(*kernels, s, needle, 5));
+    ASSERT_EQ(s.rfind(needle, 12), rfind(*kernels, s, needle, 12));
+    ASSERT_EQ(s.rfind(needle), rfind(*kernels, s, needle, std::string::npos));
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeStringKernelsUnitTest, TestFindAndRFindInLongText)
+{
+  for (const auto kernels : all_kernels())
+  {
+    SCOPED_TRACE(kernels->isa);
+
+    std::string s(5000, 'a');
+    s.replace(1234, 3, "abc");
+    s.replace(4321, 3, "abc");
+
+    ASSERT_EQ(1234u, find(*kernels, s, "abc", 0));
+    ASSERT_EQ(4321u, find(*kernels, s, "abc", 1235));
+    ASSERT_EQ(std::string::npos, find(*kernels, s, "abc", 4322));
+
+    ASSERT_EQ(4321u, rfind(*kernels, s, "abc", std::string::npos));
+    ASSERT_EQ(1234u, rfind(*kernels, s, "abc", 4320));
+    ASSERT_EQ(std::string::npos, rfind(*kernels, s, "abc", 1233));
+  }
+
+  const std::string s = std::string(100, 'a') + "abc";
+
+  ASSERT_EQ(100u, corevm::types::string_find(s.data(), s.size(), "abc", 3, 0));
+  ASSERT_EQ(100u, corevm::types::string_rfind(s.data(), s.size(), "abc", 3,
+    std::string::npos));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeStringKernelsUnitTest, TestFindAndRFindWithSparseEndChars)
+{
+  // The first and last characters of the needle occur far apart, mostly
+  // without the rest of it.
+  std::string s(2000, 'a');
+  for (size_t i = 17; i + 5 < s.size(); i += 45)
+  {
+    s.replace(i, 5, i % 7 ? "wordd" : "world");
+  }
+
+  for (const auto kernels : all_kernels())
+  {
+    SCOPED_TRACE(kernels->isa);
+
+    for (const std::string needle : { "world", "w", "d", "wd", "x" })
+    {
+      for (size_t pos = 0; pos <= s.size(); pos += 97)
+      {
+        ASSERT_EQ(s.find(needle, pos), find(*kernels, s, needle, pos));
+        ASSERT_EQ(s.rfind(needle, pos), rfind(*kernels, s, needle, pos));
+      }
+
+      ASSERT_EQ(s.rfind(needle),
+        rfind(*kernels, s, needle, std::string::npos));
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
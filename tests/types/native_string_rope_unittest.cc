@@ -0,0 +1,312 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2016 Yanzheng Li
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#include "types/native_string_rope.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+
+// -----------------------------------------------------------------------------
+
+class NativeStringRopeUnitTest : public ::testing::Test
+{
+protected:
+  static std::string flatten(corevm::types::native_string_rope rope)
+  {
+    std::string str;
+    rope.flatten(&str);
+    return str;
+  }
+};
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeStringRopeUnitTest, TestEmpty)
+{
+  corevm::types::native_string_rope rope;
+
+  ASSERT_TRUE(rope.empty());
+  ASSERT_EQ(0, rope.size());
+  ASSERT_EQ("", flatten(rope));
+
+  corevm::types::native_string_rope rope2((std::string()));
+
+  ASSERT_TRUE(rope2.empty());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeStringRopeUnitTest, TestAppend)
+{
+  corevm::types::native_string_rope rope(std::string("Hello"));
+  std::string expected_result("Hello");
+
+  for (size_t i = 0; i < 10000; ++i)
+  {
+    const std::string piece = std::to_string(i);
+    rope.append(piece.data(), piece.size());
+    expected_result.append(piece);
+  }
+
+  ASSERT_EQ(expected_result.size(), rope.size());
+  ASSERT_EQ(expected_result, flatten(rope));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeStringRopeUnitTest, TestAppendToCopies)
+{
+  corevm::types::native_string_rope rope(std::string(2048, 'a'));
+  std::string expected_result(2048, 'a');
+
+  std::vector<corevm::types::native_string_rope> copies;
+  std::vector<std::string> expected_copies;
+
+  for (size_t i = 0; i < 1000; ++i)
+  {
+    copies.push_back(rope);
+    expected_copies.push_back(expected_result);
+
+    const std::string piece = std::to_string(i);
+    rope.append(piece.data(), piece.size());
+    expected_result.append(piece);
+  }
+
+  ASSERT_EQ(expected_result, flatten(rope));
+
+  // Copies are not affected by changes to the rope they were copied from.
+  for (size_t i = 0; i < copies.size(); ++i)
+  {
+    ASSERT_EQ(expected_copies[i], flatten(copies[i]));
+  }
+
+  // Nor by the rope being flattened.
+  std::string str;
+  rope.flatten(&str);
+
+  ASSERT_EQ(expected_result, str);
+  ASSERT_TRUE(rope.empty());
+  ASSERT_EQ(expected_copies.back(), flatten(copies.back()));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeStringRopeUnitTest, TestInsertAtFront)
+{
+  corevm::types::native_string_rope rope;
+  std::string expected_result;
+
+  for (size_t i = 0; i < 20000; ++i)
+  {
+    const std::string piece = std::to_string(i);
+    rope.insert(0, piece.data(), piece.size());
+    expected_result.insert(0, piece);
+  }
+
+  ASSERT_EQ(expected_result, flatten(rope));
+
+  // The tree is kept from degenerating into a list.
+  ASSERT_GT(32, rope.depth());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeStringRopeUnitTest, TestInsertAtRandomPositions)
+{
+  srand(42);
+
+  corevm::types::native_string_rope rope(std::string(4096, '-'));
+  std::string expected_result(4096, '-');
+
+  for (size_t i = 0; i < 5000; ++i)
+  {
+    const size_t pos = static_cast<size_t>(rand()) % (expected_result.size() + 1);
+    const std::string piece(static_cast<size_t>(rand()) % 40 + 1,
+      static_cast<char>('a' + i % 26));
+
+    corevm::types::native_string_rope copy(rope);
+
+    rope.insert(pos, piece.data(), piece.size());
+    expected_result.insert(pos, piece);
+
+    if (i % 500 == 0)
+    {
+      ASSERT_EQ(expected_result.size() - piece.size(), copy.size());
+    }
+  }
+
+  ASSERT_EQ(expected_result.size(), rope.size());
+  ASSERT_EQ(expected_result, flatten(rope));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeStringRopeUnitTest, TestCopyAndMove)
+{
+  corevm::types::native_string_rope rope(std::string("Hello"));
+  rope.append(" world", 6);
+
+  corevm::types::native_string_rope rope2(rope);
+  corevm::types::native_string_rope rope3(std::move(rope2));
+
+  ASSERT_TRUE(rope2.empty());
+  ASSERT_EQ("Hello world", flatten(rope3));
+
+  corevm::types::native_string_rope rope4;
+  rope4 = rope3;
+  rope4.append("!", 1);
+
+  ASSERT_EQ("Hello world", flatten(rope3));
+  ASSERT_EQ("Hello world!", flatten(rope4));
+
+  rope4.swap(rope3);
+
+  ASSERT_EQ("Hello world!", flatten(rope3));
+  ASSERT_EQ("Hello world", flatten(rope4));
+
+  rope4.clear();
+
+  ASSERT_TRUE(rope4.empty());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeStringRopeUnitTest, TestAt)
+{
+  corevm::types::native_string_rope rope;
+  std::string expected_result;
+
+  for (size_t i = 0; i < 2000; ++i)
+  {
+    const std::string piece = std::to_string(i);
+    rope.insert(i % 2 ? rope.size() / 2 : 0, piece.data(), piece.size());
+    expected_result.insert(i % 2 ? expected_result.size() / 2 : 0, piece);
+  }
+
+  for (size_t i = 0; i < expected_result.size(); ++i)
+  {
+    ASSERT_EQ(expected_result[i], rope.at(i));
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeStringRopeUnitTest, TestSubstr)
+{
+  srand(42);
+
+  corevm::types::native_string_rope rope;
+  std::string expected_result;
+
+  for (size_t i = 0; i < 2000; ++i)
+  {
+    const size_t pos = static_cast<size_t>(rand()) % (expected_result.size() + 1);
+    const std::string piece = std::to_string(i);
+
+    rope.insert(pos, piece.data(), piece.size());
+    expected_result.insert(pos, piece);
+  }
+
+  for (size_t i = 0; i < 500; ++i)
+  {
+    const size_t pos = static_cast<size_t>(rand()) % (expected_result.size() + 1);
+    const size_t n = static_cast<size_t>(rand()) % (expected_result.size() - pos + 1);
+
+    const corevm::types::native_string_rope substr = rope.substr(pos, n);
+
+    ASSERT_EQ(n, substr.size());
+    ASSERT_LE(substr.depth(), rope.depth());
+    ASSERT_EQ(expected_result.substr(pos, n), flatten(substr));
+  }
+
+  ASSERT_EQ(expected_result, flatten(rope));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeStringRopeUnitTest, TestSubstrOfSubstr)
+{
+  const std::string str(
+    "The quick brown fox jumps over the lazy dog, again and again.");
+
+  corevm::types::native_string_rope rope((std::string(str)));
+
+  corevm::types::native_string_rope substr = rope.substr(4, 40);
+  corevm::types::native_string_rope substr2 = substr.substr(6, 20);
+
+  ASSERT_EQ(0, substr2.depth());
+  ASSERT_EQ(str.substr(10, 20), flatten(substr2));
+  ASSERT_EQ(str[10], substr2.at(0));
+
+  ASSERT_TRUE(rope.substr(3, 0).empty());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeStringRopeUnitTest, TestChangingSubstrs)
+{
+  const std::string str(600, 'x');
+
+  corevm::types::native_string_rope rope((std::string(str)));
+
+  corevm::types::native_string_rope substr = rope.substr(100, 400);
+  substr.append("abc", 3);
+  substr.insert(10, "def", 3);
+  substr.insert(390, std::string(800, 'y').data(), 800);
+
+  std::string expected_result = str.substr(100, 400);
+  expected_result.append("abc");
+  expected_result.insert(10, "def");
+  expected_result.insert(390, std::string(800, 'y'));
+
+  ASSERT_EQ(expected_result, flatten(substr));
+
+  rope.append("!", 1);
+
+  ASSERT_EQ(str + "!", flatten(rope));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeStringRopeUnitTest, TestFlattenOutlivesSubstr)
+{
+  corevm::types::native_string_rope substr;
+  std::string str;
+
+  {
+    corevm::types::native_string_rope rope(std::string(1000, 'a'));
+    rope.append(std::string(1000, 'b').data(), 1000);
+
+    substr = rope.substr(900, 200);
+
+    rope.flatten(&str);
+  }
+
+  ASSERT_EQ(std::string(2000, 'a').replace(1000, 1000, 1000, 'b'), str);
+  ASSERT_EQ(std::string(100, 'a') + std::string(100, 'b'), flatten(substr));
+}
+
+// -----------------------------------------------------------------------------
@@ -130,6 +130,44 @@ TEST_F(NativeStringTypeInterfacesTest, TestAppend)
 
 // -----------------------------------------------------------------------------
 
+TEST_F(NativeStringTypeInterfacesTest, TestAppendRepeatedlyToCopies)
+{
+  corevm::types::NativeTypeValue operand = corevm::types::string();
+  corevm::types::NativeTypeValue str = corevm::types::string("abc");
+  corevm::types::NativeTypeValue c = corevm::types::int8('!');
+
+  std::string expected_result;
+
+  for (size_t i = 0; i < 2000; ++i)
+  {
+    // Appending to a copy leaves the original value untouched.
+    corevm::types::NativeTypeValue copy(operand);
+
+    corevm::types::interface_string_append(copy, str);
+    corevm::types::interface_string_pushback(copy, c);
+
+    ASSERT_EQ(expected_result.size(),
+      corevm::types::get_value_cref_from_type_value<
+        corevm::types::native_string>(operand).size());
+
+    operand = copy;
+    expected_result.append("abc!");
+  }
+
+  corevm::types::NativeTypeValue pos = corevm::types::uint32(0);
+  corevm::types::interface_string_insert_str(operand, pos, str);
+  expected_result.insert(0, "abc");
+
+  const auto& actual_result =
+    corevm::types::get_value_cref_from_type_value<corevm::types::native_string>(
+      operand);
+
+  ASSERT_TRUE(actual_result.flat());
+  ASSERT_EQ(expected_result, static_cast<const std::string&>(actual_result));
+}
+
+// -----------------------------------------------------------------------------
+
 TEST_F(NativeStringTypeInterfacesTest, TestPushBack)
 {
   corevm::types::NativeTypeValue operand = corevm::types::string("Hello world");
@@ -366,3 +404,153 @@ TEST_F(NativeStringTypeInterfacesTest, TestRFind2)
 }
 
 // -----------------------------------------------------------------------------
+
+TEST_F(NativeStringTypeInterfacesTest, TestReplaceAll)
+{
+  corevm::types::NativeTypeValue operand =
+    corevm::types::string("a-b--c-");
+  corevm::types::NativeTypeValue old_str = corevm::types::string("-");
+  corevm::types::NativeTypeValue new_str = corevm::types::string("+=");
+
+  corevm::types::native_string expected_result = "a+=b+=+=c+=";
+
+  apply_interface_on_three_operands_in_place_and_assert_result<corevm::types::native_string>(
+    operand,
+    old_str,
+    new_str,
+    corevm::types::interface_string_replace_all,
+    expected_result
+  );
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeStringTypeInterfacesTest, TestReplaceAllWithoutMatches)
+{
+  corevm::types::NativeTypeValue operand =
+    corevm::types::string("Hello world");
+  corevm::types::NativeTypeValue old_str = corevm::types::string("xyz");
+  corevm::types::NativeTypeValue empty_str = corevm::types::string("");
+  corevm::types::NativeTypeValue new_str = corevm::types::string("!");
+
+  corevm::types::native_string expected_result = "Hello world";
+
+  apply_interface_on_three_operands_in_place_and_assert_result<corevm::types::native_string>(
+    operand,
+    old_str,
+    new_str,
+    corevm::types::interface_string_replace_all,
+    expected_result
+  );
+
+  apply_interface_on_three_operands_in_place_and_assert_result<corevm::types::native_string>(
+    operand,
+    empty_str,
+    new_str,
+    corevm::types::interface_string_replace_all,
+    expected_result
+  );
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeStringTypeInterfacesTest, TestSplit)
+{
+  corevm::types::NativeTypeValue operand =
+    corevm::types::string("GET /index.html  200");
+  corevm::types::NativeTypeValue sep = corevm::types::string(" ");
+
+  corevm::types::native_array expected_result {
+    0, 3, 4, 15, 16, 16, 17, 20 };
+
+  apply_interface_on_two_operands_and_assert_result<corevm::types::native_array>(
+    operand,
+    sep,
+    corevm::types::interface_string_split,
+    expected_result
+  );
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeStringTypeInterfacesTest, TestSplitWithoutMatches)
+{
+  corevm::types::NativeTypeValue operand = corevm::types::string("abc");
+  corevm::types::NativeTypeValue sep = corevm::types::string(",");
+  corevm::types::NativeTypeValue empty_sep = corevm::types::string("");
+
+  corevm::types::native_array expected_result { 0, 3 };
+
+  apply_interface_on_two_operands_and_assert_result<corevm::types::native_array>(
+    operand,
+    sep,
+    corevm::types::interface_string_split,
+    expected_result
+  );
+
+  apply_interface_on_two_operands_and_assert_result<corevm::types::native_array>(
+    operand,
+    empty_sep,
+    corevm::types::interface_string_split,
+    expected_result
+  );
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeStringTypeInterfacesTest, TestJoin)
+{
+  corevm::types::NativeTypeValue operand =
+    corevm::types::string("GET /index.html  200");
+  corevm::types::NativeTypeValue offsets =
+    corevm::types::native_array { 0, 3, 4, 15, 16, 16, 17, 20 };
+  corevm::types::NativeTypeValue sep = corevm::types::string(", ");
+
+  corevm::types::native_string expected_result = "GET, /index.html, , 200";
+
+  apply_interface_on_three_operands_and_assert_result<corevm::types::native_string>(
+    operand,
+    offsets,
+    sep,
+    corevm::types::interface_string_join,
+    expected_result
+  );
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeStringTypeInterfacesTest, TestJoinWithInvalidOffsets)
+{
+  corevm::types::NativeTypeValue operand = corevm::types::string("abc");
+  corevm::types::NativeTypeValue sep = corevm::types::string(",");
+
+  corevm::types::NativeTypeValue odd_offsets =
+    corevm::types::native_array { 0, 1, 2 };
+  corevm::types::NativeTypeValue reversed_offsets =
+    corevm::types::native_array { 2, 1 };
+  corevm::types::NativeTypeValue past_end_offsets =
+    corevm::types::native_array { 1, 4 };
+
+  ASSERT_THROW(
+    {
+      corevm::types::interface_string_join(operand, odd_offsets, sep);
+    },
+    corevm::types::OutOfRangeError
+  );
+
+  ASSERT_THROW(
+    {
+      corevm::types::interface_string_join(operand, reversed_offsets, sep);
+    },
+    corevm::types::OutOfRangeError
+  );
+
+  ASSERT_THROW(
+    {
+      corevm::types::interface_string_join(operand, past_end_offsets, sep);
+    },
+    corevm::types::OutOfRangeError
+  );
+}
+
+// -----------------------------------------------------------------------------
@@ -656,3 +656,327 @@ TEST_F(NativeStringFunctionalityUnitTest, TestReplaceFailure)
 }
 
 // -----------------------------------------------------------------------------
+
+TEST_F(NativeStringFunctionalityUnitTest, TestFindAndRFind)
+{
+  const corevm::types::native_string str("abcabc");
+  const corevm::types::native_string needle("bc");
+
+  ASSERT_EQ(1u, str.find(needle));
+  ASSERT_EQ(4u, str.find(needle, 2));
+  ASSERT_EQ(corevm::types::native_string::npos, str.find(needle, 5));
+  ASSERT_EQ(4u, str.rfind(needle));
+  ASSERT_EQ(1u, str.rfind(needle, 3));
+  ASSERT_EQ(corevm::types::native_string::npos, str.rfind(needle, 0));
+
+  // Overloads of the base class remain available.
+  ASSERT_EQ(2u, str.find('c'));
+  ASSERT_EQ(3u, str.rfind("ab"));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeStringFunctionalityUnitTest, TestFindInBuilderMode)
+{
+  corevm::types::native_string str(
+    corevm::types::native_string::BUILDER_MODE_MIN_SIZE, 'a');
+  str.lazy_insert(0, corevm::types::native_string("needle"));
+
+  ASSERT_FALSE(str.flat());
+
+  const corevm::types::native_string needle("needle");
+
+  ASSERT_EQ(0u, str.find(needle));
+  ASSERT_EQ(0u, str.rfind(needle));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeStringFunctionalityUnitTest, TestHash)
+{
+  corevm::types::native_string str("Hello world");
+
+  ASSERT_EQ(std::hash<std::string>()("Hello world"), str.hash());
+
+  // Cached hashes are dropped as the string is mutated.
+  str.append("!");
+  ASSERT_EQ(std::hash<std::string>()("Hello world!"), str.hash());
+
+  str[0] = 'J';
+  ASSERT_EQ(std::hash<std::string>()("Jello world!"), str.hash());
+
+  str.erase(5);
+  ASSERT_EQ(std::hash<std::string>()("Jello"), str.hash());
+
+  str.clear();
+  ASSERT_EQ(std::hash<std::string>()(""), str.hash());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeStringFunctionalityUnitTest, TestIntern)
+{
+  const corevm::types::native_string str1 =
+    corevm::types::native_string::intern("Hello world");
+  const corevm::types::native_string str2 =
+    corevm::types::native_string::intern(std::string("Hello world"));
+  const corevm::types::native_string str3 =
+    corevm::types::native_string::intern("Hello world!");
+  const corevm::types::native_string str4("Hello world");
+
+  ASSERT_TRUE(str1.interned());
+  ASSERT_TRUE(str2.interned());
+  ASSERT_TRUE(str3.interned());
+  ASSERT_FALSE(str4.interned());
+
+  ASSERT_EQ(str1, str2);
+  ASSERT_NE(str1, str3);
+  ASSERT_EQ(str1, str4);
+  ASSERT_EQ(str4.hash(), str1.hash());
+
+  // Copies carry the atom along, while mutated copies drop it.
+  corevm::types::native_string str5 = str1;
+  ASSERT_TRUE(str5.interned());
+
+  str5.push_back('!');
+  ASSERT_FALSE(str5.interned());
+  ASSERT_EQ(str3, str5);
+  ASSERT_NE(str1, str5);
+
+  corevm::types::native_string str6 = str1;
+  corevm::types::native_string str7 = std::move(str6);
+  ASSERT_TRUE(str7.interned());
+  ASSERT_FALSE(str6.interned());
+  ASSERT_EQ(str1, str7);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeStringFunctionalityUnitTest, TestLazyAppend)
+{
+  corevm::types::native_string str("Hello");
+  std::string expected_result("Hello");
+
+  for (size_t i = 0; i < 1000; ++i)
+  {
+    const corevm::types::native_string piece(std::to_string(i));
+    str.lazy_append(piece);
+    expected_result.append(piece);
+  }
+
+  str.lazy_push_back('!');
+  expected_result.push_back('!');
+
+  // Appending alone does not need the rope.
+  ASSERT_TRUE(str.flat());
+  ASSERT_EQ(expected_result.size(), str.size());
+
+  // Large strings switch into builder mode as they get copied, and share
+  // their contents with the copies.
+  corevm::types::native_string copy(str);
+
+  ASSERT_FALSE(str.flat());
+  ASSERT_FALSE(copy.flat());
+
+  copy.lazy_append(copy);
+
+  ASSERT_FALSE(copy.flat());
+  ASSERT_EQ(expected_result.size() * 2, copy.size());
+
+  str.flatten();
+
+  ASSERT_TRUE(str.flat());
+  ASSERT_EQ(expected_result, static_cast<const std::string&>(str));
+  ASSERT_STREQ((expected_result + expected_result).c_str(), copy.c_str());
+  ASSERT_TRUE(copy.flat());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeStringFunctionalityUnitTest, TestAppendAndAssignStringInBuilderMode)
+{
+  const std::string contents(2000, 'a');
+
+  corevm::types::native_string str(contents);
+  corevm::types::native_string copy(str);
+
+  // Both strings are in builder mode, with their contents in a rope.
+  ASSERT_FALSE(str.flat());
+  ASSERT_FALSE(copy.flat());
+
+  corevm::types::native_string appended("xyz");
+  appended.append(copy);
+
+  ASSERT_EQ(2003, appended.size());
+  ASSERT_EQ(corevm::types::native_string("xyz" + contents), appended);
+
+  corevm::types::native_string appended_range("xyz");
+  appended_range.append(copy, 1000, 10);
+
+  ASSERT_EQ(corevm::types::native_string("xyz" + contents.substr(0, 10)),
+    appended_range);
+
+  corevm::types::native_string assigned("xyz");
+  assigned.assign(copy);
+
+  ASSERT_EQ(2000, assigned.size());
+  ASSERT_EQ(corevm::types::native_string(contents), assigned);
+
+  corevm::types::native_string added("xyz");
+  added += copy;
+
+  ASSERT_EQ(2003, added.size());
+  ASSERT_EQ(corevm::types::native_string("xyz" + contents), added);
+
+  ASSERT_EQ(corevm::types::native_string(contents), copy);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeStringFunctionalityUnitTest, TestLazyInsert)
+{
+  corevm::types::native_string str;
+  std::string expected_result;
+
+  for (size_t i = 0; i < 1000; ++i)
+  {
+    const corevm::types::native_string piece(std::to_string(i));
+    str.lazy_insert(0, piece);
+    str.lazy_insert(str.size() / 2, 2, '-');
+    expected_result.insert(0, piece);
+    expected_result.insert(expected_result.size() / 2, 2, '-');
+  }
+
+  ASSERT_FALSE(str.flat());
+  ASSERT_EQ(expected_result.size(), str.size());
+
+  ASSERT_THROW(
+    {
+      str.lazy_insert(str.size() + 1, corevm::types::native_string("!"));
+    },
+    corevm::types::OutOfRangeError
+  );
+
+  // Members that read the contents flatten the string first.
+  ASSERT_EQ(expected_result[10], str.at(10));
+  ASSERT_TRUE(str.flat());
+  ASSERT_EQ(corevm::types::native_string(expected_result), str);
+  ASSERT_EQ(std::hash<std::string>()(expected_result), str.hash());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeStringFunctionalityUnitTest, TestSubstr)
+{
+  const corevm::types::native_string str("Hello world");
+
+  const corevm::types::native_string substr = str.substr(6);
+
+  ASSERT_TRUE(substr.flat());
+  ASSERT_EQ(corevm::types::native_string("world"), substr);
+  ASSERT_EQ(corevm::types::native_string("lo w"), str.substr(3, 4));
+  ASSERT_EQ(corevm::types::native_string(""), str.substr(11));
+
+  ASSERT_THROW(
+    {
+      str.substr(12);
+    },
+    corevm::types::OutOfRangeError
+  );
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeStringFunctionalityUnitTest, TestSubstrOfLargeString)
+{
+  std::string expected_result;
+  for (size_t i = 0; expected_result.size() < 4096; ++i)
+  {
+    expected_result.append(std::to_string(i));
+  }
+
+  // Large strings switch into builder mode as they get copied.
+  const corevm::types::native_string copied(expected_result);
+  const corevm::types::native_string str(copied);
+
+  // Large substrings of strings in builder mode share their characters.
+  corevm::types::native_string substr = str.substr(100, 1000);
+  corevm::types::native_string substr2 = substr.substr(500);
+
+  ASSERT_FALSE(str.flat());
+  ASSERT_FALSE(substr.flat());
+  ASSERT_FALSE(substr2.flat());
+
+  ASSERT_EQ(1000, substr.size());
+  ASSERT_EQ(500, substr2.size());
+
+  const corevm::types::native_string& const_substr = substr;
+
+  ASSERT_EQ(expected_result[100], const_substr.at(0));
+  ASSERT_EQ(expected_result[1099], const_substr.at(999));
+  ASSERT_FALSE(substr.flat());
+
+  ASSERT_THROW(
+    {
+      const_substr.at(1000);
+    },
+    corevm::types::OutOfRangeError
+  );
+
+  // Short substrings are copies.
+  ASSERT_TRUE(substr.substr(10, 20).flat());
+
+  // Substrings are copied as they get mutated, apart from the string.
+  substr.lazy_append(corevm::types::native_string("!"));
+  substr2[0] = '-';
+
+  ASSERT_EQ(corevm::types::native_string(expected_result.substr(100, 1000) + "!"),
+    substr);
+  ASSERT_EQ(corevm::types::native_string("-" + expected_result.substr(601, 499)),
+    substr2);
+  ASSERT_EQ(corevm::types::native_string(expected_result), str);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeStringFunctionalityUnitTest, TestIterateOverSubstrOfLargeString)
+{
+  std::string expected_result;
+  for (size_t i = 0; expected_result.size() < 4096; ++i)
+  {
+    expected_result.append(std::to_string(i));
+  }
+
+  // Substrings of flat strings are copies, and leave the strings as is.
+  const corevm::types::native_string flat_str(expected_result);
+  const corevm::types::native_string flat_substr = flat_str.substr(100, 1000);
+
+  ASSERT_TRUE(flat_str.flat());
+  ASSERT_TRUE(flat_substr.flat());
+  ASSERT_EQ(expected_result,
+    std::string(flat_str.begin(), flat_str.end()));
+
+  // Strings in builder mode and their substrings iterate over all of their
+  // characters.
+  const corevm::types::native_string copied(expected_result);
+  const corevm::types::native_string str(copied);
+  const corevm::types::native_string substr = str.substr(100, 1000);
+
+  ASSERT_FALSE(str.flat());
+  ASSERT_FALSE(substr.flat());
+
+  ASSERT_EQ(expected_result.substr(100, 1000),
+    std::string(substr.begin(), substr.end()));
+  ASSERT_TRUE(substr.flat());
+
+  ASSERT_EQ(expected_result.front(), str.front());
+  ASSERT_EQ(expected_result.back(), str.back());
+
+  std::string dst;
+  dst.insert(dst.end(), str.rbegin(), str.rend());
+
+  ASSERT_EQ(std::string(expected_result.rbegin(), expected_result.rend()), dst);
+  ASSERT_EQ(expected_result, std::string(copied.cbegin(), copied.cend()));
+}
+
+// -----------------------------------------------------------------------------
@@ -21,11 +21,14 @@ IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
 CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 *******************************************************************************/
 #include "types/native_type_value.h"
+#include "types/interfaces.h"
+#include "corevm/macros.h"
 
 #include <gtest/gtest.h>
 
 #include <cmath>
 #include <cstdint>
+#include <utility>
 
 
 class NativeTypeValueUnitTest : public ::testing::Test
@@ -149,6 +152,134 @@ TEST_F(NativeTypeValueUnitTest, TestGetIntrinsicValueFromTypeValueWithCompatible
 
 // -----------------------------------------------------------------------------
 
+#if COREVM_USE_COMPACT_NATIVE_TYPE_VALUE
+
+TEST_F(NativeTypeValueUnitTest, TestCompactRepresentation)
+{
+  ASSERT_EQ(16, sizeof(corevm::types::NativeTypeValue));
+}
+
+#endif
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeTypeValueUnitTest, TestCopyOfStringArrayAndMapValues)
+{
+  corevm::types::NativeTypeValue str = corevm::types::string("Hello world");
+  corevm::types::NativeTypeValue ary = corevm::types::array { 1, 2, 3 };
+  corevm::types::NativeTypeValue map = corevm::types::map { { 1, 2 } };
+
+  corevm::types::NativeTypeValue str_copy(str);
+  corevm::types::NativeTypeValue ary_copy(ary);
+  corevm::types::NativeTypeValue map_copy(map);
+
+  str.get<corevm::types::string>().append("!");
+  ary.get<corevm::types::array>().push_back(4);
+  map.get<corevm::types::map>()[3] = 4;
+
+  ASSERT_EQ(corevm::types::string("Hello world"),
+    str_copy.get<corevm::types::string>());
+  ASSERT_EQ(corevm::types::array({ 1, 2, 3 }),
+    ary_copy.get<corevm::types::array>());
+  ASSERT_EQ(corevm::types::map({ { 1, 2 } }),
+    map_copy.get<corevm::types::map>());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeTypeValueUnitTest, TestMoveOfStringArrayAndMapValues)
+{
+  corevm::types::NativeTypeValue str = corevm::types::string("Hello world");
+  corevm::types::NativeTypeValue ary = corevm::types::array { 1, 2, 3 };
+  corevm::types::NativeTypeValue map = corevm::types::map { { 1, 2 } };
+
+  const corevm::types::string* str_ptr = &str.get<corevm::types::string>();
+
+  corevm::types::NativeTypeValue str_moved(std::move(str));
+  corevm::types::NativeTypeValue ary_moved(std::move(ary));
+  corevm::types::NativeTypeValue map_moved(std::move(map));
+
+  ASSERT_FALSE(str.valid());
+  ASSERT_FALSE(ary.valid());
+  ASSERT_FALSE(map.valid());
+
+  ASSERT_EQ(corevm::types::string("Hello world"),
+    str_moved.get<corevm::types::string>());
+  ASSERT_EQ(corevm::types::array({ 1, 2, 3 }),
+    ary_moved.get<corevm::types::array>());
+  ASSERT_EQ(corevm::types::map({ { 1, 2 } }),
+    map_moved.get<corevm::types::map>());
+
+#if COREVM_USE_COMPACT_NATIVE_TYPE_VALUE
+  ASSERT_EQ(str_ptr, &str_moved.get<corevm::types::string>());
+#else
+  (void)str_ptr;
+#endif
+}
+
+// -----------------------------------------------------------------------------
+
+#if COREVM_USE_COMPACT_NATIVE_TYPE_VALUE
+
+TEST_F(NativeTypeValueUnitTest, TestCopiesShareStringValues)
+{
+  corevm::types::NativeTypeValue str = corevm::types::string("Hello world");
+  corevm::types::NativeTypeValue str_copy(str);
+
+  const corevm::types::NativeTypeValue& const_str = str;
+  const corevm::types::NativeTypeValue& const_str_copy = str_copy;
+
+  ASSERT_EQ(&const_str.get<corevm::types::string>(),
+    &const_str_copy.get<corevm::types::string>());
+
+  // Writes through either copy stop the sharing.
+  str_copy.get<corevm::types::string>().append("!");
+
+  ASSERT_NE(&const_str.get<corevm::types::string>(),
+    &const_str_copy.get<corevm::types::string>());
+
+  ASSERT_EQ(corevm::types::string("Hello world"),
+    const_str.get<corevm::types::string>());
+  ASSERT_EQ(corevm::types::string("Hello world!"),
+    const_str_copy.get<corevm::types::string>());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeTypeValueUnitTest, TestReadOnlyOperatorsKeepValuesShared)
+{
+  corevm::types::NativeTypeValue str = corevm::types::string("Hello world");
+  corevm::types::NativeTypeValue str_copy(str);
+
+  corevm::types::NativeTypeValue ary = corevm::types::array { 1, 2, 3 };
+  corevm::types::NativeTypeValue ary_copy(ary);
+
+  corevm::types::interface_apply_eq_operator(str, str_copy);
+  corevm::types::interface_apply_neq_operator(str, str_copy);
+  corevm::types::interface_apply_lt_operator(str, str_copy);
+  corevm::types::interface_apply_gte_operator(str, str_copy);
+  corevm::types::interface_compute_hash_value(str);
+
+  corevm::types::interface_apply_eq_operator(ary, ary_copy);
+  corevm::types::interface_apply_gt_operator(ary, ary_copy);
+  corevm::types::interface_apply_lte_operator(ary, ary_copy);
+  corevm::types::interface_compute_hash_value(ary);
+
+  const corevm::types::NativeTypeValue& const_str = str;
+  const corevm::types::NativeTypeValue& const_str_copy = str_copy;
+  const corevm::types::NativeTypeValue& const_ary = ary;
+  const corevm::types::NativeTypeValue& const_ary_copy = ary_copy;
+
+  ASSERT_EQ(&const_str.get<corevm::types::string>(),
+    &const_str_copy.get<corevm::types::string>());
+  ASSERT_EQ(&const_ary.get<corevm::types::array>(),
+    &const_ary_copy.get<corevm::types::array>());
+}
+
+#endif
+
+// -----------------------------------------------------------------------------
+
 class NativeTypeValueUnaryOperatorUnitTest : public NativeTypeValueUnitTest {};
 
 // -----------------------------------------------------------------------------
@@ -0,0 +1,330 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2016 Yanzheng Li
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#include "types/native_vector_kernels.h"
+
+#include "simd_kernels_test_base.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstring>
+#include <random>
+#include <vector>
+
+
+// -----------------------------------------------------------------------------
+
+class NativeVectorKernelsUnitTest : public SimdKernelsTestBase
+{
+protected:
+  typedef corevm::types::native_vector_element_type element_type;
+
+  virtual void SetUp()
+  {
+    std::mt19937_64 engine(42);
+    std::uniform_real_distribution<element_type> dist(-100.0, 100.0);
+
+    m_lhs.resize(MAX_SIZE + MAX_OFFSET);
+    m_rhs.resize(MAX_SIZE + MAX_OFFSET);
+
+    for (size_t i = 0; i < m_lhs.size(); ++i)
+    {
+      m_lhs[i] = dist(engine);
+      m_rhs[i] = dist(engine);
+    }
+  }
+
+  const element_type* lhs(size_t offset) const
+  {
+    return m_lhs.data() + offset;
+  }
+
+  const element_type* rhs(size_t offset) const
+  {
+    return m_rhs.data() + offset;
+  }
+
+  static std::vector<const corevm::types::VectorKernels*> all_kernels()
+  {
+    return supported_kernels(corevm::types::vector_kernel_tables());
+  }
+
+  static bool bit_identical(element_type a, element_type b)
+  {
+    return std::memcmp(&a, &b, sizeof(element_type)) == 0;
+  }
+
+  /**
+   * Sums the terms in the order documented in `native_vector_kernels.h`.
+   */
+  static element_type sum_in_lanes(const std::vector<element_type>& terms)
+  {
+    element_type lanes[8] = { 0 };
+
+    size_t i = 0;
+    for (; i + 8 <= terms.size(); i += 8)
+    {
+      for (size_t j = 0; j < 8; ++j)
+      {
+        lanes[j] += terms[i + j];
+      }
+    }
+
+    element_type res = ((lanes[0] + lanes[4]) + (lanes[2] + lanes[6])) +
+      ((lanes[1] + lanes[5]) + (lanes[3] + lanes[7]));
+
+    for (; i < terms.size(); ++i)
+    {
+      res += terms[i];
+    }
+
+    return res;
+  }
+
+  std::vector<element_type> m_lhs;
+  std::vector<element_type> m_rhs;
+};
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeVectorKernelsUnitTest, TestElementwiseOperations)
+{
+  for (const auto kernels : all_kernels())
+  {
+    SCOPED_TRACE(kernels->isa);
+
+    for (size_t offset = 0; offset < MAX_OFFSET; ++offset)
+    {
+      for (size_t n = 0; n <= MAX_SIZE; ++n)
+      {
+        const element_type* a = lhs(offset);
+        const element_type* b = rhs(offset);
+
+        std::vector<element_type> sums(n);
+        std::vector<element_type> differences(n);
+        std::vector<element_type> products(n);
+        std::vector<element_type> quotients(n);
+
+        kernels->add(a, b, n, sums.data());
+        kernels->sub(a, b, n, differences.data());
+        kernels->mul(a, b, n, products.data());
+        kernels->div(a, b, n, quotients.data());
+
+        for (size_t i = 0; i < n; ++i)
+        {
+          ASSERT_EQ(a[i] + b[i], sums[i]);
+          ASSERT_EQ(a[i] - b[i], differences[i]);
+          ASSERT_EQ(a[i] * b[i], products[i]);
+          ASSERT_EQ(a[i] / b[i], quotients[i]);
+        }
+      }
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeVectorKernelsUnitTest, TestElementwiseOperationsInPlace)
+{
+  for (const auto kernels : all_kernels())
+  {
+    SCOPED_TRACE(kernels->isa);
+
+    std::vector<element_type> elements(m_lhs);
+
+    kernels->add(elements.data(), m_rhs.data(), elements.size(),
+      elements.data());
+
+    for (size_t i = 0; i < elements.size(); ++i)
+    {
+      ASSERT_EQ(m_lhs[i] + m_rhs[i], elements[i]);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeVectorKernelsUnitTest, TestScale)
+{
+  for (const auto kernels : all_kernels())
+  {
+    SCOPED_TRACE(kernels->isa);
+
+    for (size_t offset = 0; offset < MAX_OFFSET; ++offset)
+    {
+      for (size_t n = 0; n <= MAX_SIZE; ++n)
+      {
+        const element_type* a = lhs(offset);
+
+        std::vector<element_type> actual(n);
+        kernels->scale(a, n, -2.5, actual.data());
+
+        for (size_t i = 0; i < n; ++i)
+        {
+          ASSERT_EQ(a[i] * -2.5, actual[i]);
+        }
+      }
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeVectorKernelsUnitTest, TestSum)
+{
+  for (const auto kernels : all_kernels())
+  {
+    SCOPED_TRACE(kernels->isa);
+
+    for (size_t offset = 0; offset < MAX_OFFSET; ++offset)
+    {
+      for (size_t n = 0; n <= MAX_SIZE; ++n)
+      {
+        const element_type* a = lhs(offset);
+
+        const std::vector<element_type> terms(a, a + n);
+
+        ASSERT_EQ(sum_in_lanes(terms), kernels->sum(a, n));
+      }
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeVectorKernelsUnitTest, TestDot)
+{
+  for (const auto kernels : all_kernels())
+  {
+    SCOPED_TRACE(kernels->isa);
+
+    for (size_t offset = 0; offset < MAX_OFFSET; ++offset)
+    {
+      for (size_t n = 0; n <= MAX_SIZE; ++n)
+      {
+        const element_type* a = lhs(offset);
+        const element_type* b = rhs(offset);
+
+        std::vector<element_type> terms(n);
+        for (size_t i = 0; i < n; ++i)
+        {
+          terms[i] = a[i] * b[i];
+        }
+
+        ASSERT_EQ(sum_in_lanes(terms), kernels->dot(a, b, n));
+      }
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeVectorKernelsUnitTest, TestSumOfIntegers)
+{
+  for (const auto kernels : all_kernels())
+  {
+    SCOPED_TRACE(kernels->isa);
+
+    const std::vector<element_type> elements {
+      1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11
+    };
+
+    ASSERT_EQ(66.0, kernels->sum(elements.data(), elements.size()));
+    ASSERT_EQ(506.0,
+      kernels->dot(elements.data(), elements.data(), elements.size()));
+  }
+
+  const std::vector<element_type> elements { 1, 2, 3 };
+
+  ASSERT_EQ(6.0, corevm::types::vector_sum(elements.data(), elements.size()));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeVectorKernelsUnitTest, TestResultsBitIdenticalAcrossForms)
+{
+  // Magnitudes far apart, so that sums depend on their order, and signed
+  // zeros, which compare equal but differ in their bits.
+  std::mt19937_64 engine(7);
+  std::uniform_real_distribution<element_type> dist(-1.0, 1.0);
+
+  std::vector<element_type> a(MAX_SIZE + MAX_OFFSET);
+  std::vector<element_type> b(MAX_SIZE + MAX_OFFSET);
+
+  for (size_t i = 0; i < a.size(); ++i)
+  {
+    a[i] = dist(engine) * (i % 3 == 0 ? 1e16 : 1.0);
+    b[i] = i % 5 == 0 ? -0.0 : dist(engine);
+  }
+
+  const corevm::types::VectorKernels& scalar =
+    *corevm::types::vector_kernel_tables().scalar;
+
+  for (const auto kernels : all_kernels())
+  {
+    SCOPED_TRACE(kernels->isa);
+
+    for (size_t offset = 0; offset < MAX_OFFSET; ++offset)
+    {
+      for (size_t n = 0; n <= MAX_SIZE; ++n)
+      {
+        const element_type* x = a.data() + offset;
+        const element_type* y = b.data() + offset;
+
+        ASSERT_TRUE(bit_identical(scalar.sum(x, n), kernels->sum(x, n)));
+        ASSERT_TRUE(bit_identical(scalar.sum(y, n), kernels->sum(y, n)));
+        ASSERT_TRUE(
+          bit_identical(scalar.dot(x, y, n), kernels->dot(x, y, n)));
+
+        std::vector<element_type> expected(n);
+        std::vector<element_type> actual(n);
+
+        scalar.sub(y, y, n, expected.data());
+        kernels->sub(y, y, n, actual.data());
+
+        for (size_t i = 0; i < n; ++i)
+        {
+          ASSERT_TRUE(bit_identical(expected[i], actual[i]));
+        }
+
+        scalar.mul(x, y, n, expected.data());
+        kernels->mul(x, y, n, actual.data());
+
+        for (size_t i = 0; i < n; ++i)
+        {
+          ASSERT_TRUE(bit_identical(expected[i], actual[i]));
+        }
+
+        scalar.scale(y, n, -1.0, expected.data());
+        kernels->scale(y, n, -1.0, actual.data());
+
+        for (size_t i = 0; i < n; ++i)
+        {
+          ASSERT_TRUE(bit_identical(expected[i], actual[i]));
+        }
+      }
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
@@ -0,0 +1,200 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2016 Yanzheng Li
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#include "native_type_interfaces_test_base.h"
+#include "types/errors.h"
+
+
+class NativeVectorTypeInterfacesTest : public NativeTypeInterfacesTestBase {};
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeVectorTypeInterfacesTest, TestSize)
+{
+  corevm::types::native_vector vector { 1.0, 2.0, 3.0 };
+
+  corevm::types::NativeTypeValue operand = vector;
+
+  corevm::types::uint64 expected_result = 3;
+
+  apply_interface_on_single_operand_and_assert_result<corevm::types::uint64>(
+    operand,
+    corevm::types::interface_vector_size,
+    expected_result
+  );
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeVectorTypeInterfacesTest, TestAt)
+{
+  corevm::types::native_vector vector { 1.5, 2.5, 3.5 };
+
+  corevm::types::NativeTypeValue operand = vector;
+  corevm::types::NativeTypeValue index = corevm::types::uint64(1);
+
+  corevm::types::decimal2 expected_result = 2.5;
+
+  apply_interface_on_two_operands_and_assert_result<corevm::types::decimal2>(
+    operand,
+    index,
+    corevm::types::interface_vector_at,
+    expected_result
+  );
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeVectorTypeInterfacesTest, TestAtWithInvalidIndex)
+{
+  corevm::types::native_vector vector { 1.5, 2.5, 3.5 };
+
+  corevm::types::NativeTypeValue operand = vector;
+  corevm::types::NativeTypeValue index = corevm::types::uint64(3);
+
+  ASSERT_THROW(
+    {
+      corevm::types::interface_vector_at(operand, index);
+    },
+    corevm::types::OutOfRangeError
+  );
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeVectorTypeInterfacesTest, TestPut)
+{
+  corevm::types::native_vector vector { 1.0, 2.0, 3.0 };
+
+  corevm::types::NativeTypeValue operand = vector;
+  corevm::types::NativeTypeValue index = corevm::types::uint64(2);
+  corevm::types::NativeTypeValue value = corevm::types::decimal2(-4.5);
+
+  corevm::types::native_vector expected_result { 1.0, 2.0, -4.5 };
+
+  apply_interface_on_three_operands_in_place_and_assert_result<corevm::types::native_vector>(
+    operand,
+    index,
+    value,
+    corevm::types::interface_vector_put,
+    expected_result
+  );
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeVectorTypeInterfacesTest, TestAppend)
+{
+  corevm::types::native_vector vector { 1.0, 2.0 };
+
+  corevm::types::NativeTypeValue operand = vector;
+  corevm::types::NativeTypeValue data = corevm::types::uint32(3);
+
+  corevm::types::native_vector expected_result { 1.0, 2.0, 3.0 };
+
+  apply_interface_on_two_operands_in_place_and_assert_result<corevm::types::native_vector>(
+    operand,
+    data,
+    corevm::types::interface_vector_append,
+    expected_result
+  );
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeVectorTypeInterfacesTest, TestSum)
+{
+  corevm::types::native_vector vector;
+  for (int i = 1; i <= 100; ++i)
+  {
+    vector.push_back(i);
+  }
+
+  corevm::types::NativeTypeValue operand = vector;
+
+  corevm::types::decimal2 expected_result = 5050.0;
+
+  apply_interface_on_single_operand_and_assert_result<corevm::types::decimal2>(
+    operand,
+    corevm::types::interface_vector_sum,
+    expected_result
+  );
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeVectorTypeInterfacesTest, TestDot)
+{
+  corevm::types::native_vector vector { 1.0, 2.0, 3.0 };
+  corevm::types::native_vector other_vector { 4.0, -5.0, 6.0 };
+
+  corevm::types::NativeTypeValue operand = vector;
+  corevm::types::NativeTypeValue other_operand = other_vector;
+
+  corevm::types::decimal2 expected_result = 12.0;
+
+  apply_interface_on_two_operands_and_assert_result<corevm::types::decimal2>(
+    operand,
+    other_operand,
+    corevm::types::interface_vector_dot,
+    expected_result
+  );
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeVectorTypeInterfacesTest, TestDotWithMismatchingSizes)
+{
+  corevm::types::native_vector vector { 1.0, 2.0, 3.0 };
+  corevm::types::native_vector other_vector { 4.0, 5.0 };
+
+  corevm::types::NativeTypeValue operand = vector;
+  corevm::types::NativeTypeValue other_operand = other_vector;
+
+  ASSERT_THROW(
+    {
+      corevm::types::interface_vector_dot(operand, other_operand);
+    },
+    corevm::types::OutOfRangeError
+  );
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeVectorTypeInterfacesTest, TestScale)
+{
+  corevm::types::native_vector vector { 1.0, -2.0, 3.0 };
+
+  corevm::types::NativeTypeValue operand = vector;
+  corevm::types::NativeTypeValue factor = corevm::types::decimal2(0.5);
+
+  corevm::types::native_vector expected_result { 0.5, -1.0, 1.5 };
+
+  apply_interface_on_two_operands_and_assert_result<corevm::types::native_vector>(
+    operand,
+    factor,
+    corevm::types::interface_vector_scale,
+    expected_result
+  );
+}
+
+// -----------------------------------------------------------------------------
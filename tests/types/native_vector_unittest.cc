@@ -0,0 +1,223 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2016 Yanzheng Li
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#include "types/errors.h"
+#include "types/native_vector.h"
+#include "types/types.h"
+
+#include <gtest/gtest.h>
+
+
+class NativeVectorUnitTest : public ::testing::Test
+{
+protected:
+  /**
+   * Long enough for the element-wise operators to go through the unrolled
+   * loops of the kernels as well as their remainders.
+   */
+  static const size_t FIXTURE_SIZE = 37;
+
+  static corevm::types::native_vector make_vector(double first, double step)
+  {
+    corevm::types::native_vector vector;
+
+    for (size_t i = 0; i < FIXTURE_SIZE; ++i)
+    {
+      vector.push_back(first + step * static_cast<double>(i));
+    }
+
+    return vector;
+  }
+};
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeVectorUnitTest, TestEmptyInitialization)
+{
+  const corevm::types::native_vector vector;
+
+  ASSERT_EQ(true, vector.empty());
+  ASSERT_EQ(0, vector.size());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeVectorUnitTest, TestInitializationWithElements)
+{
+  const corevm::types::native_vector vector { 1.5, 2.5, 3.5 };
+
+  ASSERT_EQ(3, vector.size());
+  ASSERT_EQ(1.5, vector[0]);
+  ASSERT_EQ(2.5, vector[1]);
+  ASSERT_EQ(3.5, vector[2]);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeVectorUnitTest, TestCopyConstructorOnIntegerType)
+{
+  ASSERT_THROW(
+    {
+      const corevm::types::native_vector vector = 123;
+    },
+    corevm::types::ConversionError
+  );
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeVectorUnitTest, TestConvertingToIntegerType)
+{
+  ASSERT_THROW(
+    {
+      int i = corevm::types::native_vector();
+      i++;
+    },
+    corevm::types::ConversionError
+  );
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeVectorUnitTest, TestAtSuccessful)
+{
+  corevm::types::native_vector vector { 1.5, 2.5 };
+
+  ASSERT_EQ(2.5, vector.at(1));
+
+  vector.at(1) = 4.0;
+
+  ASSERT_EQ(4.0, vector[1]);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeVectorUnitTest, TestAtFailure)
+{
+  const corevm::types::native_vector vector { 1.5, 2.5 };
+
+  ASSERT_THROW(
+    {
+      vector.at(2);
+    },
+    corevm::types::OutOfRangeError
+  );
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeVectorUnitTest, TestHash)
+{
+  const corevm::types::native_vector vector1 { 1.0, 2.0, 3.0 };
+  const corevm::types::native_vector vector2 { 1.0, 2.0, 3.0 };
+  const corevm::types::native_vector vector3 { 3.0, 2.0, 1.0 };
+
+  ASSERT_EQ(vector1.hash(), vector2.hash());
+  ASSERT_NE(vector1.hash(), vector3.hash());
+}
+
+// -----------------------------------------------------------------------------
+
+class NativeVectorOperatorUnitTest : public NativeVectorUnitTest {};
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeVectorOperatorUnitTest, TestUnaryOperators)
+{
+  const corevm::types::native_vector vector { 1.0 };
+
+  ASSERT_THROW(+vector, corevm::types::InvalidOperatorError);
+  ASSERT_THROW(-vector, corevm::types::InvalidOperatorError);
+  ASSERT_THROW(++vector, corevm::types::InvalidOperatorError);
+  ASSERT_THROW(--vector, corevm::types::InvalidOperatorError);
+  ASSERT_THROW(!vector, corevm::types::InvalidOperatorError);
+  ASSERT_THROW(~vector, corevm::types::InvalidOperatorError);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeVectorOperatorUnitTest, TestElementwiseOperators)
+{
+  const corevm::types::native_vector lhs = make_vector(1.0, 1.5);
+  const corevm::types::native_vector rhs = make_vector(-3.0, 0.25);
+
+  const corevm::types::native_vector sums = lhs + rhs;
+  const corevm::types::native_vector differences = lhs - rhs;
+  const corevm::types::native_vector products = lhs * rhs;
+  const corevm::types::native_vector quotients = lhs / rhs;
+
+  ASSERT_EQ(lhs.size(), sums.size());
+  ASSERT_EQ(lhs.size(), differences.size());
+  ASSERT_EQ(lhs.size(), products.size());
+  ASSERT_EQ(lhs.size(), quotients.size());
+
+  for (size_t i = 0; i < FIXTURE_SIZE; ++i)
+  {
+    ASSERT_EQ(lhs[i] + rhs[i], sums[i]);
+    ASSERT_EQ(lhs[i] - rhs[i], differences[i]);
+    ASSERT_EQ(lhs[i] * rhs[i], products[i]);
+    ASSERT_EQ(lhs[i] / rhs[i], quotients[i]);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeVectorOperatorUnitTest, TestElementwiseOperatorsOnEmptyVectors)
+{
+  const corevm::types::native_vector lhs;
+  const corevm::types::native_vector rhs;
+
+  ASSERT_EQ(true, (lhs + rhs).empty());
+  ASSERT_EQ(true, (lhs * rhs).empty());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeVectorOperatorUnitTest, TestElementwiseOperatorsWithMismatchingSizes)
+{
+  const corevm::types::native_vector lhs { 1.0, 2.0, 3.0 };
+  const corevm::types::native_vector rhs { 1.0, 2.0 };
+
+  ASSERT_THROW(lhs + rhs, corevm::types::OutOfRangeError);
+  ASSERT_THROW(lhs - rhs, corevm::types::OutOfRangeError);
+  ASSERT_THROW(lhs * rhs, corevm::types::OutOfRangeError);
+  ASSERT_THROW(lhs / rhs, corevm::types::OutOfRangeError);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NativeVectorOperatorUnitTest, TestUnsupportedBinaryOperators)
+{
+  const corevm::types::native_vector lhs { 1.0 };
+  const corevm::types::native_vector rhs { 1.0 };
+
+  ASSERT_THROW(lhs % rhs, corevm::types::InvalidOperatorError);
+  ASSERT_THROW(lhs && rhs, corevm::types::InvalidOperatorError);
+  ASSERT_THROW(lhs || rhs, corevm::types::InvalidOperatorError);
+  ASSERT_THROW(lhs & rhs, corevm::types::InvalidOperatorError);
+  ASSERT_THROW(lhs | rhs, corevm::types::InvalidOperatorError);
+  ASSERT_THROW(lhs ^ rhs, corevm::types::InvalidOperatorError);
+  ASSERT_THROW(lhs << rhs, corevm::types::InvalidOperatorError);
+  ASSERT_THROW(lhs >> rhs, corevm::types::InvalidOperatorError);
+}
+
+// -----------------------------------------------------------------------------
@@ -0,0 +1,141 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2016 Yanzheng Li
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#include "types/number_format.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <string>
+
+
+// -----------------------------------------------------------------------------
+
+class NumberFormatUnitTest : public ::testing::Test
+{
+protected:
+  template<typename T>
+  static std::string format(T value)
+  {
+    char buf[corevm::types::NUMBER_REPR_MAX_SIZE];
+    const char* end = corevm::types::format_number(buf, value);
+    return std::string(static_cast<const char*>(buf), end);
+  }
+};
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NumberFormatUnitTest, TestFormatIntegers)
+{
+  ASSERT_EQ("0", format(int64_t(0)));
+  ASSERT_EQ("7", format(int64_t(7)));
+  ASSERT_EQ("-7", format(int64_t(-7)));
+  ASSERT_EQ("10", format(int32_t(10)));
+  ASSERT_EQ("123456789", format(int64_t(123456789)));
+  ASSERT_EQ("-65", format(int8_t(-65)));
+  ASSERT_EQ("255", format(uint8_t(255)));
+  ASSERT_EQ("1", format(true));
+  ASSERT_EQ("0", format(false));
+
+  ASSERT_EQ("-9223372036854775808",
+    format(std::numeric_limits<int64_t>::min()));
+  ASSERT_EQ("9223372036854775807",
+    format(std::numeric_limits<int64_t>::max()));
+  ASSERT_EQ("18446744073709551615",
+    format(std::numeric_limits<uint64_t>::max()));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NumberFormatUnitTest, TestFormatDecimals)
+{
+  ASSERT_EQ("0.0", format(0.0));
+  ASSERT_EQ("-0.0", format(-0.0));
+  ASSERT_EQ("1.0", format(1.0));
+  ASSERT_EQ("-2.5", format(-2.5));
+  ASSERT_EQ("0.1", format(0.1));
+  ASSERT_EQ("0.3333333333333333", format(1.0 / 3));
+  ASSERT_EQ("1234.5678", format(1234.5678));
+  ASSERT_EQ("0.0001", format(0.0001));
+  ASSERT_EQ("1e-05", format(0.00001));
+  ASSERT_EQ("1000000000000000.0", format(1e15));
+  ASSERT_EQ("1e+16", format(1e16));
+  ASSERT_EQ("1.5e+20", format(1.5e20));
+  ASSERT_EQ("5e-324", format(std::numeric_limits<double>::denorm_min()));
+  ASSERT_EQ("1.7976931348623157e+308",
+    format(std::numeric_limits<double>::max()));
+  ASSERT_EQ("inf", format(std::numeric_limits<double>::infinity()));
+  ASSERT_EQ("-inf", format(-std::numeric_limits<double>::infinity()));
+  ASSERT_EQ("nan", format(std::numeric_limits<double>::quiet_NaN()));
+
+  // Single precision numbers only take the digits needed in single precision.
+  ASSERT_EQ("0.1", format(0.1f));
+  ASSERT_EQ("3.141593", format(3.141593f));
+  ASSERT_EQ("16777216.0", format(16777216.0f));
+  ASSERT_EQ("3.4028235e+38", format(std::numeric_limits<float>::max()));
+  ASSERT_EQ("1e-45", format(std::numeric_limits<float>::denorm_min()));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(NumberFormatUnitTest, TestFormatDecimalsRoundTrip)
+{
+  std::mt19937_64 engine(42);
+
+  for (size_t i = 0; i < 100000; ++i)
+  {
+    const uint64_t bits = engine();
+
+    double value = 0;
+    std::memcpy(&value, &bits, sizeof(value));
+
+    if (value != value || value - value != 0)
+    {
+      continue;
+    }
+
+    const std::string str = format(value);
+    const double parsed_value = std::strtod(str.c_str(), nullptr);
+
+    ASSERT_EQ(0, std::memcmp(&value, &parsed_value, sizeof(value))) << str;
+
+    float value2 = 0;
+    const uint32_t bits2 = static_cast<uint32_t>(bits);
+    std::memcpy(&value2, &bits2, sizeof(value2));
+
+    if (value2 != value2 || value2 - value2 != 0)
+    {
+      continue;
+    }
+
+    const std::string str2 = format(value2);
+    const float parsed_value2 = std::strtof(str2.c_str(), nullptr);
+
+    ASSERT_EQ(0, std::memcmp(&value2, &parsed_value2, sizeof(value2))) << str2;
+  }
+}
+
+// -----------------------------------------------------------------------------
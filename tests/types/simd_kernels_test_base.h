@@ -0,0 +1,65 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2016 Yanzheng Li
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#include "types/simd_support.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <vector>
+
+
+/**
+ * Base of the tests of kernels with SIMD implementations, which run every
+ * implementation that the CPU supports, starting with the scalar one.
+ */
+class SimdKernelsTestBase : public ::testing::Test
+{
+protected:
+  /**
+   * Sizes cover inputs shorter than a vector, as well as ones with and
+   * without remainders past the unrolled loops of the kernels.
+   */
+  static const size_t MAX_SIZE = 80;
+
+  /** Offsets of the first element, to cover unaligned elements. */
+  static const size_t MAX_OFFSET = 4;
+
+  template <typename Kernels>
+  static std::vector<const Kernels*> supported_kernels(
+    const corevm::types::SimdKernelTables<Kernels>& tables)
+  {
+    std::vector<const Kernels*> res { tables.scalar };
+
+    if (tables.sse2)
+    {
+      res.push_back(tables.sse2);
+    }
+
+    if (tables.avx2 && corevm::types::cpu_supports_avx2())
+    {
+      res.push_back(tables.avx2);
+    }
+
+    return res;
+  }
+};
@@ -0,0 +1,68 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2016 Yanzheng Li
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#include "types/simd_support.h"
+
+#include "corevm/macros.h"
+#include "types/native_array_kernels.h"
+#include "types/native_string_kernels.h"
+#include "types/native_vector_kernels.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+
+// -----------------------------------------------------------------------------
+
+class SimdSupportUnitTest : public ::testing::Test {};
+
+// -----------------------------------------------------------------------------
+
+TEST_F(SimdSupportUnitTest, TestKernelsSelectedByCpuSupport)
+{
+  const bool avx2 = corevm::types::cpu_supports_avx2();
+
+  ASSERT_EQ(avx2, corevm::types::cpu_supports_avx2());
+
+  if (!avx2)
+  {
+    ASSERT_NE(std::string("avx2"), corevm::types::array_kernels_isa());
+    ASSERT_NE(std::string("avx2"), corevm::types::string_kernels_isa());
+    ASSERT_NE(std::string("avx2"), corevm::types::vector_kernels_isa());
+    return;
+  }
+
+#if COREVM_USE_SIMD_ARRAY_KERNELS
+  ASSERT_EQ(std::string("avx2"), corevm::types::array_kernels_isa());
+#endif
+
+#if COREVM_USE_SIMD_STRING_KERNELS
+  ASSERT_EQ(std::string("avx2"), corevm::types::string_kernels_isa());
+#endif
+
+#if COREVM_USE_SIMD_VECTOR_KERNELS
+  ASSERT_EQ(std::string("avx2"), corevm::types::vector_kernels_isa());
+#endif
+}
+
+// -----------------------------------------------------------------------------
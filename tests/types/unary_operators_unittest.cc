@@ -302,6 +302,18 @@ TEST_F(ReprOperatorUnitTest, TestWithFloatingPointOperand)
 
 // -----------------------------------------------------------------------------
 
+TEST_F(ReprOperatorUnitTest, TestWithDoublePrecisionFloatingPointOperand)
+{
+  corevm::types::decimal2 oprd = 0.1 + 0.2;
+
+  corevm::types::string expected_result("0.30000000000000004");
+
+  call_typed_unary_op_and_assert_result<corevm::types::repr>(
+    oprd, expected_result);
+}
+
+// -----------------------------------------------------------------------------
+
 class LogicalNotOperatorUnitTest : public UnaryOperatorsUnitTestBase {};
 
 // -----------------------------------------------------------------------------
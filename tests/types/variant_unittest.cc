@@ -28,6 +28,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include <cstdio>
 #include <sstream>
 #include <string>
+#include <utility>
 #include <vector>
 
 
@@ -373,6 +374,20 @@ TEST_F(VariantUnaryVisitationUnitTest, TestVisitation)
 
 // -----------------------------------------------------------------------------
 
+TEST_F(VariantUnaryVisitationUnitTest, TestVisitationOnInvalidVariant)
+{
+  VariantType v;
+
+  ASSERT_THROW(
+    {
+      corevm::types::variant::apply_visitor(tostring_visitor(), v);
+    },
+    std::runtime_error
+  );
+}
+
+// -----------------------------------------------------------------------------
+
 class VariantBinaryVisitationUnitTest : public VariantUnitTest
 {
 protected:
@@ -390,6 +405,21 @@ protected:
       return false;
     }
   };
+
+  struct which_visitor :
+    public corevm::types::variant::static_visitor<std::pair<int, int>>
+  {
+    template <typename T, typename T2>
+    std::pair<int, int> operator() (const T& lhs, const T2& rhs) const
+    {
+      return std::make_pair(which(lhs), which(rhs));
+    }
+
+    static int which(const int&) { return 0; }
+    static int which(const double&) { return 1; }
+    static int which(const std::string&) { return 2; }
+    static int which(const std::vector<int>&) { return 3; }
+  };
 };
 
 // -----------------------------------------------------------------------------
@@ -426,3 +456,49 @@ TEST_F(VariantBinaryVisitationUnitTest, TestVisitation)
 }
 
 // -----------------------------------------------------------------------------
+
+TEST_F(VariantBinaryVisitationUnitTest, TestVisitationOnAllPairsOfTypes)
+{
+  const std::vector<VariantType> values {
+    VariantType((int)1),
+    VariantType((double)3.14),
+    VariantType(std::string(HELLO_WORLD)),
+    VariantType(std::vector<int> {1, 2, 3}),
+  };
+
+  for (const auto& lhs : values)
+  {
+    for (const auto& rhs : values)
+    {
+      const std::pair<int, int> res =
+        corevm::types::variant::apply_visitor(which_visitor(), lhs, rhs);
+
+      ASSERT_EQ(lhs.which(), res.first);
+      ASSERT_EQ(rhs.which(), res.second);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(VariantBinaryVisitationUnitTest, TestVisitationOnInvalidVariant)
+{
+  VariantType v1;
+  VariantType v2 = (int)1;
+
+  ASSERT_THROW(
+    {
+      corevm::types::variant::apply_visitor(equality_visitor(), v1, v2);
+    },
+    std::runtime_error
+  );
+
+  ASSERT_THROW(
+    {
+      corevm::types::variant::apply_visitor(equality_visitor(), v2, v1);
+    },
+    std::runtime_error
+  );
+}
+
+// -----------------------------------------------------------------------------